@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2008-2013 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NavMapManager.h"
+#include "NavTile.h"
+
+#include <ace/Guard_T.h>
+#include <cstdio>
+
+namespace NAV
+{
+    NavMapManager::NavMapManager() { }
+
+    NavMapManager::~NavMapManager()
+    {
+        for (TileMap::iterator itr = _tiles.begin(); itr != _tiles.end(); ++itr)
+            delete itr->second;
+    }
+
+    NavTile const* NavMapManager::GetTile(uint32 mapId, uint32 tileX, uint32 tileY)
+    {
+        if (tileX >= NAV_TILES_PER_MAP || tileY >= NAV_TILES_PER_MAP)
+            return NULL;
+
+        uint32 key = GetTileKey(mapId, tileX, tileY);
+        {
+            ACE_Read_Guard<ACE_RW_Thread_Mutex> guard(_lock);
+            TileMap::const_iterator itr = _tiles.find(key);
+            if (itr != _tiles.end())
+                return itr->second;
+        }
+
+        // load without holding the lock, queries on tiles that are already loaded must not wait for the disk
+        char fileName[32];
+        snprintf(fileName, sizeof(fileName), "%03u%02u%02u.nav", mapId, tileX, tileY);
+
+        NavTile* tile = new NavTile();
+        if (!tile->Load(_basePath + fileName, mapId, tileX, tileY))
+        {
+            delete tile;
+            tile = NULL;
+        }
+
+        ACE_Write_Guard<ACE_RW_Thread_Mutex> guard(_lock);
+
+        // another thread may have loaded it meanwhile, keep the published tile
+        std::pair<TileMap::iterator, bool> inserted = _tiles.insert(TileMap::value_type(key, tile));
+        if (!inserted.second)
+            delete tile;
+
+        return inserted.first->second;
+    }
+
+    uint32 NavMapManager::GetLoadedTileCount() const
+    {
+        ACE_Read_Guard<ACE_RW_Thread_Mutex> guard(_lock);
+
+        uint32 count = 0;
+        for (TileMap::const_iterator itr = _tiles.begin(); itr != _tiles.end(); ++itr)
+            if (itr->second)
+                ++count;
+
+        return count;
+    }
+
+    size_t NavMapManager::GetLoadedSize() const
+    {
+        ACE_Read_Guard<ACE_RW_Thread_Mutex> guard(_lock);
+
+        size_t size = 0;
+        for (TileMap::const_iterator itr = _tiles.begin(); itr != _tiles.end(); ++itr)
+            if (itr->second)
+                size += itr->second->GetSize();
+
+        return size;
+    }
+
+    NavMapManager* gNavMapManager = NULL;
+
+    NavMapManager* NavMapFactory::createOrGetNavMapManager()
+    {
+        if (gNavMapManager == NULL)
+            gNavMapManager = new NavMapManager();
+        return gNavMapManager;
+    }
+
+    void NavMapFactory::clear()
+    {
+        delete gNavMapManager;
+        gNavMapManager = NULL;
+    }
+}
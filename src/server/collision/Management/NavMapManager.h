@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2008-2013 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _NAVMAPMANAGER_H
+#define _NAVMAPMANAGER_H
+
+#include "Define.h"
+#include "Dynamic/UnorderedMap.h"
+#include <ace/RW_Thread_Mutex.h>
+
+#include <string>
+
+namespace NAV
+{
+    class NavTile;
+
+    /**
+    Per process cache of the navigation tiles. Tiles are loaded the first time a path
+    query touches them and stay mapped until the manager is destroyed; all instances
+    of a map share the same tiles. Missing tiles are remembered, so maps without
+    navigation data cost a single lookup per query.
+    */
+    class NavMapManager
+    {
+        public:
+            NavMapManager();
+            ~NavMapManager();
+
+            void Initialize(std::string const& basePath) { _basePath = basePath; }
+
+            // returns NULL if there is no navigation data for the tile, safe to call from any map thread
+            NavTile const* GetTile(uint32 mapId, uint32 tileX, uint32 tileY);
+
+            uint32 GetLoadedTileCount() const;
+            size_t GetLoadedSize() const;
+
+        private:
+            typedef UNORDERED_MAP<uint32, NavTile*> TileMap;
+
+            static uint32 GetTileKey(uint32 mapId, uint32 tileX, uint32 tileY) { return (mapId << 16) | (tileX << 8) | tileY; }
+
+            TileMap _tiles;
+            mutable ACE_RW_Thread_Mutex _lock;
+            std::string _basePath;
+    };
+
+    class NavMapFactory
+    {
+        public:
+            static NavMapManager* createOrGetNavMapManager();
+            static void clear();
+    };
+}
+
+#endif
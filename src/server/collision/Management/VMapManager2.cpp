@@ -27,10 +27,15 @@
 #include <G3D/Vector3.h>
 #include <ace/Null_Mutex.h>
 #include <ace/Singleton.h>
+#include "VMapDefinitions.h"
+
+#ifndef NO_CORE_FUNCS
 #include "DisableMgr.h"
 #include "DBCStores.h"
-#include "Log.h"
-#include "VMapDefinitions.h"
+#define IS_VMAP_DISABLED_FOR(MAPID, FLAGS) DisableMgr::IsDisabledFor(DISABLE_TYPE_VMAP, MAPID, NULL, FLAGS)
+#else
+#define IS_VMAP_DISABLED_FOR(MAPID, FLAGS) false
+#endif
 
 using G3D::Vector3;
 
@@ -136,7 +141,7 @@ namespace VMAP
 
     bool VMapManager2::isInLineOfSight(unsigned int mapId, float x1, float y1, float z1, float x2, float y2, float z2)
     {
-        if (!isLineOfSightCalcEnabled() || DisableMgr::IsDisabledFor(DISABLE_TYPE_VMAP, mapId, NULL, VMAP_DISABLE_LOS))
+        if (!isLineOfSightCalcEnabled() || IS_VMAP_DISABLED_FOR(mapId, VMAP_DISABLE_LOS))
             return true;
 
         // Don't calculate hit position, if wrong src/dest points provided!
@@ -167,7 +172,7 @@ namespace VMAP
         rx=x2;
         ry=y2;
         rz=z2;
-        if (isLineOfSightCalcEnabled() && !DisableMgr::IsDisabledFor(DISABLE_TYPE_VMAP, mapId, NULL, VMAP_DISABLE_LOS))
+        if (isLineOfSightCalcEnabled() && !IS_VMAP_DISABLED_FOR(mapId, VMAP_DISABLE_LOS))
         {
             InstanceTreeMap::iterator instanceTree = iInstanceMapTrees.find(mapId);
             if (instanceTree != iInstanceMapTrees.end())
@@ -201,7 +206,7 @@ namespace VMAP
 
     float VMapManager2::getHeight(unsigned int mapId, float x, float y, float z, float maxSearchDist)
     {
-        if (isHeightCalcEnabled() && !DisableMgr::IsDisabledFor(DISABLE_TYPE_VMAP, mapId, NULL, VMAP_DISABLE_HEIGHT))
+        if (isHeightCalcEnabled() && !IS_VMAP_DISABLED_FOR(mapId, VMAP_DISABLE_HEIGHT))
         {
             InstanceTreeMap::iterator instanceTree = iInstanceMapTrees.find(mapId);
             if (instanceTree != iInstanceMapTrees.end())
@@ -220,7 +225,7 @@ namespace VMAP
 
     bool VMapManager2::getAreaInfo(unsigned int mapId, float x, float y, float& z, uint32& flags, int32& adtId, int32& rootId, int32& groupId) const
     {
-        if (!DisableMgr::IsDisabledFor(DISABLE_TYPE_VMAP, mapId, NULL, VMAP_DISABLE_AREAFLAG))
+        if (!IS_VMAP_DISABLED_FOR(mapId, VMAP_DISABLE_AREAFLAG))
         {
             InstanceTreeMap::const_iterator instanceTree = iInstanceMapTrees.find(mapId);
             if (instanceTree != iInstanceMapTrees.end())
@@ -238,7 +243,7 @@ namespace VMAP
 
     bool VMapManager2::GetLiquidLevel(uint32 mapId, float x, float y, float z, uint8 reqLiquidType, float& level, float& floor, uint32& type) const
     {
-        if (!DisableMgr::IsDisabledFor(DISABLE_TYPE_VMAP, mapId, NULL, VMAP_DISABLE_LIQUIDSTATUS))
+        if (!IS_VMAP_DISABLED_FOR(mapId, VMAP_DISABLE_LIQUIDSTATUS))
         {
             InstanceTreeMap::const_iterator instanceTree = iInstanceMapTrees.find(mapId);
             if (instanceTree != iInstanceMapTrees.end())
@@ -248,10 +253,12 @@ namespace VMAP
                 if (instanceTree->second->GetLocationInfo(pos, info))
                 {
                     floor = info.ground_Z;
-                    ASSERT(floor < std::numeric_limits<float>::max());
+                    VMAP_ASSERT(floor < std::numeric_limits<float>::max());
                     type = info.hitModel->GetLiquidType();  // entry from LiquidType.dbc
+#ifndef NO_CORE_FUNCS
                     if (reqLiquidType && !(GetLiquidFlags(type) & reqLiquidType))
                         return false;
+#endif
                     if (info.hitInstance->GetLiquidLevel(pos, info, level))
                         return true;
                 }
@@ -264,7 +271,7 @@ namespace VMAP
     WorldModel* VMapManager2::acquireModelInstance(const std::string& basepath, const std::string& filename)
     {
         //! Critical section, thread safe access to iLoadedModelFiles
-        TRINITY_GUARD(ACE_Thread_Mutex, LoadedModelFilesLock);
+        ACE_Guard<ACE_Thread_Mutex> guard(LoadedModelFilesLock);
 
         ModelFileMap::iterator model = iLoadedModelFiles.find(filename);
         if (model == iLoadedModelFiles.end())
@@ -272,11 +279,11 @@ namespace VMAP
             WorldModel* worldmodel = new WorldModel();
             if (!worldmodel->readFile(basepath + filename + ".vmo"))
             {
-                sLog->outDebug(LOG_FILTER_MAPS, "VMapManager2: could not load '%s%s.vmo'", basepath.c_str(), filename.c_str());
+                VMAP_DEBUG_LOG(LOG_FILTER_MAPS, "VMapManager2: could not load '%s%s.vmo'", basepath.c_str(), filename.c_str());
                 delete worldmodel;
                 return NULL;
             }
-            sLog->outDebug(LOG_FILTER_MAPS, "VMapManager2: loading file '%s%s'", basepath.c_str(), filename.c_str());
+            VMAP_DEBUG_LOG(LOG_FILTER_MAPS, "VMapManager2: loading file '%s%s'", basepath.c_str(), filename.c_str());
             model = iLoadedModelFiles.insert(std::pair<std::string, ManagedModel>(filename, ManagedModel())).first;
             model->second.setModel(worldmodel);
         }
@@ -287,17 +294,17 @@ namespace VMAP
     void VMapManager2::releaseModelInstance(const std::string &filename)
     {
         //! Critical section, thread safe access to iLoadedModelFiles
-        TRINITY_GUARD(ACE_Thread_Mutex, LoadedModelFilesLock);
+        ACE_Guard<ACE_Thread_Mutex> guard(LoadedModelFilesLock);
 
         ModelFileMap::iterator model = iLoadedModelFiles.find(filename);
         if (model == iLoadedModelFiles.end())
         {
-            sLog->outDebug(LOG_FILTER_MAPS, "VMapManager2: trying to unload non-loaded file '%s'", filename.c_str());
+            VMAP_DEBUG_LOG(LOG_FILTER_MAPS, "VMapManager2: trying to unload non-loaded file '%s'", filename.c_str());
             return;
         }
         if (model->second.decRefCount() == 0)
         {
-            sLog->outDebug(LOG_FILTER_MAPS, "VMapManager2: unloading file '%s'", filename.c_str());
+            VMAP_DEBUG_LOG(LOG_FILTER_MAPS, "VMapManager2: unloading file '%s'", filename.c_str());
             delete model->second.getModel();
             iLoadedModelFiles.erase(model);
         }
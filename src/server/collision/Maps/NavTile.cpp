@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2008-2013 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NavTile.h"
+
+#include <ace/Mem_Map.h>
+#include <ace/OS_NS_unistd.h>
+#include <cstdio>
+
+namespace NAV
+{
+    NavTile::NavTile() : _mapping(NULL), _cellIndex(NULL), _layers(NULL) { }
+
+    NavTile::~NavTile()
+    {
+        Unload();
+    }
+
+    bool NavTile::Load(std::string const& fileName, uint32 mapId, uint32 tileX, uint32 tileY)
+    {
+        Unload();
+
+        if (ACE_OS::access(fileName.c_str(), R_OK) == -1)
+            return false;
+
+        _mapping = new ACE_Mem_Map();
+        if (_mapping->map(fileName.c_str(), static_cast<size_t>(-1), O_RDONLY, ACE_DEFAULT_FILE_PERMS, PROT_READ, ACE_MAP_SHARED) == -1)
+        {
+            delete _mapping;
+            _mapping = NULL;
+            return false;
+        }
+
+        // the mapping stays valid without the descriptor, tiles are kept for the whole process
+        _mapping->close_handle();
+
+        uint8 const* data = static_cast<uint8 const*>(_mapping->addr());
+        size_t size = _mapping->size();
+        size_t const cells = NAV_TILE_CELLS * NAV_TILE_CELLS;
+
+        if (size < sizeof(NavTileHeader))
+        {
+            Unload();
+            return false;
+        }
+
+        NavTileHeader const* header = reinterpret_cast<NavTileHeader const*>(data);
+        if (header->magic != NAV_TILE_MAGIC || header->version != NAV_TILE_VERSION || header->mapId != mapId ||
+            header->tileX != tileX || header->tileY != tileY || header->cellsPerSide != NAV_TILE_CELLS ||
+            size != sizeof(NavTileHeader) + (cells + 1) * sizeof(uint32) + header->layerCount * sizeof(NavLayer))
+        {
+            Unload();
+            return false;
+        }
+
+        _cellIndex = reinterpret_cast<uint32 const*>(data + sizeof(NavTileHeader));
+        _layers = reinterpret_cast<NavLayer const*>(data + sizeof(NavTileHeader) + (cells + 1) * sizeof(uint32));
+
+        // only the bounds are checked here, checking every cell would page in the whole index
+        if (_cellIndex[0] != 0 || _cellIndex[cells] != header->layerCount)
+        {
+            Unload();
+            return false;
+        }
+
+        return true;
+    }
+
+    void NavTile::Unload()
+    {
+        if (_mapping)
+        {
+            _mapping->close();
+            delete _mapping;
+            _mapping = NULL;
+        }
+
+        _cellIndex = NULL;
+        _layers = NULL;
+    }
+
+    size_t NavTile::GetSize() const
+    {
+        return _mapping ? _mapping->size() : 0;
+    }
+
+    bool WriteNavTile(std::string const& fileName, NavTileHeader const& header, std::vector<uint32> const& cellIndex, std::vector<NavLayer> const& layers)
+    {
+        if (cellIndex.size() != NAV_TILE_CELLS * NAV_TILE_CELLS + 1 || layers.size() != header.layerCount)
+            return false;
+
+        FILE* file = fopen(fileName.c_str(), "wb");
+        if (!file)
+            return false;
+
+        bool result = fwrite(&header, sizeof(header), 1, file) == 1 &&
+            fwrite(&cellIndex[0], sizeof(uint32), cellIndex.size(), file) == cellIndex.size() &&
+            (layers.empty() || fwrite(&layers[0], sizeof(NavLayer), layers.size(), file) == layers.size());
+
+        fclose(file);
+        return result;
+    }
+}
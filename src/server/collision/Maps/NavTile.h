@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2008-2013 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _NAVTILE_H
+#define _NAVTILE_H
+
+#include "Define.h"
+
+#include <string>
+#include <vector>
+
+class ACE_Mem_Map;
+
+/**
+Navigation data of one map tile, written by the navgenerator tool.
+
+Every tile is split into NAV_TILE_CELLS x NAV_TILE_CELLS cells. A cell holds up to
+NAV_MAX_LAYERS walkable surfaces (terrain, floors and bridges of world models) and
+every surface stores to which surface of each of its 8 neighbour cells a unit can
+walk. Cells are numbered along the same axes as the .map and .vmtile tiles, so the
+global cell of a position is NAV_TILE_CELLS * (32 - pos / NAV_TILE_SIZE).
+*/
+
+namespace NAV
+{
+    const uint32 NAV_TILE_MAGIC     = 0x5456414E;           // "NAVT"
+    const uint32 NAV_TILE_VERSION   = 1;
+
+    // same tiling as the .map and .vmtile files, the navgenerator does not include the grid headers
+    const uint32 NAV_TILES_PER_MAP  = 64;                   // MAX_NUMBER_OF_GRIDS
+    const float  NAV_TILE_SIZE      = 533.33333f;           // SIZE_OF_GRIDS
+
+    const uint32 NAV_TILE_CELLS     = 256;
+    const uint32 NAV_MAP_CELLS      = NAV_TILE_CELLS * NAV_TILES_PER_MAP;
+    const uint32 NAV_MAX_LAYERS     = 7;                    // a link stores the neighbour layer + 1 in 3 bits
+    const float  NAV_CELL_SIZE      = NAV_TILE_SIZE / NAV_TILE_CELLS;
+
+    // neighbour directions, a link for direction d leads to cell (x + NAV_DIR_X[d], y + NAV_DIR_Y[d])
+    const int32 NAV_DIR_X[8] = { 1, 1, 0, -1, -1, -1,  0,  1 };
+    const int32 NAV_DIR_Y[8] = { 0, 1, 1,  1,  0, -1, -1, -1 };
+
+    inline float WorldToCell(float pos) { return NAV_TILE_CELLS * (NAV_TILES_PER_MAP / 2 - pos / NAV_TILE_SIZE); }
+    inline float CellToWorld(int32 cell) { return (NAV_TILES_PER_MAP / 2 - (cell + 0.5f) / NAV_TILE_CELLS) * NAV_TILE_SIZE; }
+
+    struct NavTileHeader
+    {
+        uint32 magic;
+        uint32 version;
+        uint32 mapId;
+        uint32 tileX;
+        uint32 tileY;
+        uint32 cellsPerSide;
+        uint32 layerCount;
+    };
+
+    struct NavLayer
+    {
+        float z;
+        uint32 links;                                       // 8 directions x 3 bits, 0 = blocked, n = layer n - 1 of the neighbour
+
+        int32 GetLink(uint32 dir) const { return int32((links >> (dir * 3)) & 7) - 1; }
+        void SetLink(uint32 dir, uint32 layer) { links |= (layer + 1) << (dir * 3); }
+    };
+
+    // The tile file is mapped read only, it is paged in on first access and shared
+    // between all maps and all processes using it
+    class NavTile
+    {
+        public:
+            NavTile();
+            ~NavTile();
+
+            bool Load(std::string const& fileName, uint32 mapId, uint32 tileX, uint32 tileY);
+            void Unload();
+
+            // cellX and cellY are the cell inside of this tile
+            uint32 GetLayerCount(uint32 cellX, uint32 cellY) const
+            {
+                uint32 cell = cellX * NAV_TILE_CELLS + cellY;
+                return _cellIndex[cell + 1] - _cellIndex[cell];
+            }
+
+            NavLayer const* GetLayers(uint32 cellX, uint32 cellY) const { return _layers + _cellIndex[cellX * NAV_TILE_CELLS + cellY]; }
+
+            size_t GetSize() const;
+
+        private:
+            ACE_Mem_Map* _mapping;
+            uint32 const* _cellIndex;                       // NAV_TILE_CELLS^2 + 1 entries, first layer of every cell
+            NavLayer const* _layers;
+    };
+
+    bool WriteNavTile(std::string const& fileName, NavTileHeader const& header, std::vector<uint32> const& cellIndex, std::vector<NavLayer> const& layers);
+}
+
+#endif
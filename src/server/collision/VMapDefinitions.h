@@ -41,15 +41,20 @@ namespace VMAP
     };
 }
 
-// Set of helper macros for extractors (VMAP and MMAP)
+// Set of helper macros for extractors (VMAP and NAV), the tools build the collision code without the core logger
 #ifndef NO_CORE_FUNCS
-#define VMAP_ERROR_LOG(FILTER, ...) TC_LOG_ERROR(FILTER, __VA_ARGS__)
+#include "Errors.h"
+#include "Log.h"
+#define VMAP_ERROR_LOG(FILTER, ...) sLog->outError(FILTER, __VA_ARGS__)
 #define VMAP_DEBUG_LOG(FILTER, ...) TC_LOG_DEBUG(FILTER, __VA_ARGS__)
-#define VMAP_INFO_LOG(FILTER, ...) TC_LOG_INFO(FILTER, __VA_ARGS__)
+#define VMAP_INFO_LOG(FILTER, ...) sLog->outInfo(FILTER, __VA_ARGS__)
+#define VMAP_ASSERT(assertion) ASSERT(assertion)
 #else
-#define VMAP_ERROR_LOG(FILTER, ...) (void)sizeof(FILTER)
-#define VMAP_DEBUG_LOG(FILTER, ...) (void)sizeof(FILTER)
-#define VMAP_INFO_LOG(FILTER, ...)  (void)sizeof(FILTER)
+#include <cassert>
+#define VMAP_ERROR_LOG(FILTER, ...) ((void)0)
+#define VMAP_DEBUG_LOG(FILTER, ...) ((void)0)
+#define VMAP_INFO_LOG(FILTER, ...)  ((void)0)
+#define VMAP_ASSERT(assertion) assert(assertion)
 #endif
 
 #endif
@@ -29,6 +29,8 @@
 #include "SmartScriptMgr.h"
 //#include "SmartAI.h"
 
+#define SMART_TARGET_LIST_POOL_SIZE 8                       // free target lists kept per script, actions nest only a few levels deep
+
 class SmartScript
 {
     public:
@@ -48,9 +50,15 @@ class SmartScript
         void ProcessAction(SmartScriptHolder& e, Unit* unit = NULL, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, const SpellInfo* spell = NULL, GameObject* gob = NULL);
         ObjectList* GetTargets(SmartScriptHolder const& e, Unit* invoker = NULL);
         ObjectList* GetWorldObjectsInDist(float dist);
+
+        // Target lists returned by GetTargets come from a small per-script pool, hand them back
+        // with ReleaseTargetList once the action is done unless they were stored
+        ObjectList* AcquireTargetList();
+        void ReleaseTargetList(ObjectList* targets);
         void InstallTemplate(SmartScriptHolder const& e);
         SmartScriptHolder CreateEvent(SMART_EVENT e, uint32 event_flags, uint32 event_param1, uint32 event_param2, uint32 event_param3, uint32 event_param4, SMART_ACTION action, uint32 action_param1, uint32 action_param2, uint32 action_param3, uint32 action_param4, uint32 action_param5, uint32 action_param6, SMARTAI_TARGETS t, uint32 target_param1, uint32 target_param2, uint32 target_param3, uint32 phaseMask = 0);
         void AddEvent(SMART_EVENT e, uint32 event_flags, uint32 event_param1, uint32 event_param2, uint32 event_param3, uint32 event_param4, SMART_ACTION action, uint32 action_param1, uint32 action_param2, uint32 action_param3, uint32 action_param4, uint32 action_param5, uint32 action_param6, SMARTAI_TARGETS t, uint32 target_param1, uint32 target_param2, uint32 target_param3, uint32 phaseMask = 0);
+        uint32 GetEventCount() const { return uint32(mEvents.size()); }
         void SetPathId(uint32 id) { mPathId = id; }
         uint32 GetPathId() const { return mPathId; }
         WorldObject* GetBaseObject()
@@ -101,7 +109,7 @@ class SmartScript
                 if ((*mTargetStorage)[id] == targets)
                     return;
 
-                delete (*mTargetStorage)[id];
+                ReleaseTargetList((*mTargetStorage)[id]);
             }
 
             (*mTargetStorage)[id] = targets;
@@ -219,6 +227,9 @@ class SmartScript
         void SetPhase(uint32 p = 0) { mEventPhase = p; }
 
         SmartAIEventList mEvents;
+        std::vector<uint32> mEventsByType;                  // positions in mEvents grouped by event type, rebuilt by IndexEvents
+        uint32 mEventTypeOffsets[SMART_EVENT_END + 1];      // first mEventsByType slot of every event type
+        std::vector<ObjectList*> mTargetListPool;
         SmartAIEventList mInstallEvents;
         SmartAIEventList mTimedActionList;
         Creature* me;
@@ -242,6 +253,7 @@ class SmartScript
 
         SMARTAI_TEMPLATE mTemplate;
         void InstallEvents();
+        void IndexEvents();
 
         void RemoveStoredEvent (uint32 id)
         {
@@ -1279,7 +1279,8 @@ struct SmartScriptHolder
 
 typedef UNORDERED_MAP<uint32, WayPoint*> WPPath;
 
-typedef std::list<WorldObject*> ObjectList;
+// vector so lists taken from the SmartScript target list pool keep their storage between actions
+typedef std::vector<WorldObject*> ObjectList;
 typedef UNORDERED_MAP<uint32, ObjectList*> ObjectListMap;
 
 class SmartWaypointMgr
@@ -1325,7 +1326,7 @@ class SmartAIMgr
             else
             {
                 if (entry > 0)//first search is for guid (negative), do not drop error if not found
-                    sLog->outDebug(LOG_FILTER_DATABASE_AI, "SmartAIMgr::GetScript: Could not load Script for Entry %d ScriptType %u.", entry, uint32(type));
+                    TC_LOG_DEBUG(LOG_FILTER_DATABASE_AI, "SmartAIMgr::GetScript: Could not load Script for Entry %d ScriptType %u.", entry, uint32(type));
                 return temp;
             }
         }
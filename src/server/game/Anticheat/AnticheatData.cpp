@@ -12,6 +12,7 @@ AnticheatData::AnticheatData()
     }
     average = 0;
     creationTime = 0;
+    pendingSince = 0;
     hasDailyReport = false;
 }
 
@@ -19,6 +20,24 @@ AnticheatData::~AnticheatData()
 {
 }
 
+bool AnticheatData::AddSample(AnticheatSample const& sample, uint32 now)
+{
+    if (pendingSamples.empty())
+    {
+        pendingSamples.reserve(ANTICHEAT_BATCH_SIZE);
+        pendingSince = now;
+    }
+
+    pendingSamples.push_back(sample);
+    return pendingSamples.size() >= ANTICHEAT_BATCH_SIZE || getMSTimeDiff(pendingSince, now) >= ANTICHEAT_BATCH_DELAY;
+}
+
+void AnticheatData::TakeSamples(std::vector<AnticheatSample>& samples)
+{
+    samples.swap(pendingSamples);
+    pendingSamples.clear();
+}
+
 void AnticheatData::SetDailyReportState(bool b)
 {
     hasDailyReport = b;
@@ -52,7 +71,7 @@ const MovementInfo& AnticheatData::GetLastMovementInfo() const
     return lastMovementInfo;
 }
 
-void AnticheatData::SetLastMovementInfo(MovementInfo& moveInfo)
+void AnticheatData::SetLastMovementInfo(MovementInfo const& moveInfo)
 {
     lastMovementInfo = moveInfo;
 }
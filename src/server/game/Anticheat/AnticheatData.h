@@ -1,21 +1,61 @@
 #ifndef SC_ACDATA_H
 #define SC_ACDATA_H
 
-#include "AnticheatMgr.h"
+#include "Common.h"
+#include "ObjectMovement.h"
+#include "Timer.h"
+
+#include <ace/Thread_Mutex.h>
+#include <memory>
+#include <vector>
 
 #define MAX_REPORT_TYPES 6
 
+// a player's samples are handed to the analysis thread in batches of this size, or after this many ms
+#define ANTICHEAT_BATCH_SIZE 16
+#define ANTICHEAT_BATCH_DELAY 1000
+
+enum AnticheatSampleFlags
+{
+    ANTICHEAT_SAMPLE_SKIP_CHECKS        = 0x01,             // in flight, on a transport or in a vehicle, only remembered
+    ANTICHEAT_SAMPLE_CAN_FLY            = 0x02,
+    ANTICHEAT_SAMPLE_CAN_WALK_ON_WATER  = 0x04,
+    ANTICHEAT_SAMPLE_CLIMB_EXEMPT       = 0x08,             // in water, flying or falling
+    ANTICHEAT_SAMPLE_GROUND_Z           = 0x10              // groundZ was looked up, the sample is at z 0 and not falling
+};
+
+// One movement packet as the analysis thread needs it, everything the checks read from the Player is copied in
+struct AnticheatSample
+{
+    MovementInfo movementInfo;
+    uint32 opcode;
+    uint32 mapId;
+    Position playerPos;                                     // position before this movement
+    float allowedSpeed;                                     // speed of the current move type in yards per second
+    float groundZ;
+    uint8 flags;                                            // AnticheatSampleFlags
+};
+
 class AnticheatData
 {
 public:
+    typedef ACE_Thread_Mutex LockType;
+
     AnticheatData();
     ~AnticheatData();
 
+    // the analysis thread holds it for a whole batch, everyone else reading or resetting reports takes it too
+    LockType& GetLock() { return lock; }
+
+    // only called by the thread handling the player's movement, true once the samples should be handed over
+    bool AddSample(AnticheatSample const& sample, uint32 now);
+    void TakeSamples(std::vector<AnticheatSample>& samples);
+
     void SetLastOpcode(uint32 opcode);
     uint32 GetLastOpcode() const;
 
     const MovementInfo& GetLastMovementInfo() const;
-    void SetLastMovementInfo(MovementInfo& moveInfo);
+    void SetLastMovementInfo(MovementInfo const& moveInfo);
 
     void SetPosition(float x, float y, float z, float o);
 
@@ -58,6 +98,12 @@ private:
     uint32 tempReports[MAX_REPORT_TYPES];
     uint32 tempReportsTimer[MAX_REPORT_TYPES];
     bool hasDailyReport;
+
+    LockType lock;
+    std::vector<AnticheatSample> pendingSamples;
+    uint32 pendingSince;
 };
 
+typedef std::shared_ptr<AnticheatData> AnticheatDataPtr;
+
 #endif
\ No newline at end of file
@@ -4,101 +4,137 @@
 
 #define CLIMB_ANGLE 1.9f
 
+AnticheatAnalyzer::AnticheatAnalyzer() : m_analyzedSamples(0), m_analysisTime(0), m_pendingSamples(0)
+{
+    ACE_Task_Base::activate(THR_NEW_LWP | THR_JOINABLE | THR_INHERIT_SCHED, 1);
+}
+
+AnticheatAnalyzer::~AnticheatAnalyzer()
+{
+    m_queue.deactivate();
+    wait();
+
+    AnticheatBatch* batch;
+    ACE_Time_Value noWait = ACE_Time_Value::zero;
+    while (m_queue.dequeue_head(batch, &noWait) != -1)
+        delete batch;
+}
+
+void AnticheatAnalyzer::Enqueue(AnticheatBatch* batch)
+{
+    m_pendingSamples.fetch_add(uint32(batch->samples.size()), std::memory_order_relaxed);
+    if (m_queue.enqueue_tail(batch) == -1)
+    {
+        m_pendingSamples.fetch_sub(uint32(batch->samples.size()), std::memory_order_relaxed);
+        delete batch;
+    }
+}
+
+int AnticheatAnalyzer::svc()
+{
+    AnticheatBatch* batch;
+    while (m_queue.dequeue_head(batch) != -1)
+    {
+        ACE_Time_Value start = ACE_OS::gettimeofday();
+
+        {
+            ACE_GUARD_RETURN(AnticheatData::LockType, guard, batch->data->GetLock(), -1);
+            for (std::vector<AnticheatSample>::const_iterator itr = batch->samples.begin(); itr != batch->samples.end(); ++itr)
+                sAnticheatMgr->AnalyzeSample(*batch->data, *itr);
+        }
+
+        ACE_UINT64 analysisTime;
+        (ACE_OS::gettimeofday() - start).to_usec(analysisTime);
+
+        m_analysisTime.fetch_add(analysisTime, std::memory_order_relaxed);
+        m_analyzedSamples.fetch_add(batch->samples.size(), std::memory_order_relaxed);
+        m_pendingSamples.fetch_sub(uint32(batch->samples.size()), std::memory_order_relaxed);
+        delete batch;
+    }
+
+    return 0;
+}
+
 AnticheatMgr::AnticheatMgr()
 {
+    m_analyzer = new AnticheatAnalyzer();
 }
 
 AnticheatMgr::~AnticheatMgr()
 {
-    m_Players.clear();
+    delete m_analyzer;
 }
 
-void AnticheatMgr::JumpHackDetection(Player* player, MovementInfo movementInfo,uint32 opcode)
+void AnticheatMgr::JumpHackDetection(AnticheatData& data, AnticheatSample const& sample)
 {
     if ((sWorld->getIntConfig(CONFIG_ANTICHEAT_DETECTIONS_ENABLED) & JUMP_HACK_DETECTION) == 0)
         return;
 
-    uint32 key = player->GetGUIDLow();
-
-    if (m_Players[key].GetLastOpcode() == CMSG_MOVE_JUMP && opcode == CMSG_MOVE_JUMP)
+    if (data.GetLastOpcode() == CMSG_MOVE_JUMP && sample.opcode == CMSG_MOVE_JUMP)
     {
-        BuildReport(player,JUMP_HACK_REPORT);
+        BuildReport(data, JUMP_HACK_REPORT);
         //sLog->outError("AnticheatMgr:: Jump-Hack detected player GUID (low) %u",player->GetGUIDLow());
     }
 }
 
-void AnticheatMgr::WalkOnWaterHackDetection(Player* player, MovementInfo movementInfo)
+void AnticheatMgr::WalkOnWaterHackDetection(AnticheatData& data, AnticheatSample const& sample)
 {
     if ((sWorld->getIntConfig(CONFIG_ANTICHEAT_DETECTIONS_ENABLED) & WALK_WATER_HACK_DETECTION) == 0)
         return;
 
-    uint32 key = player->GetGUIDLow();
-    if (!m_Players[key].GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_WATERWALKING))
-        return;
-
-    // if we are a ghost we can walk on water
-    if (!player->IsAlive())
+    if (!data.GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_WATERWALKING))
         return;
 
-    if (player->HasAuraType(SPELL_AURA_FEATHER_FALL) ||
-        player->HasAuraType(SPELL_AURA_SAFE_FALL) ||
-        player->HasAuraType(SPELL_AURA_WATER_WALK))
+    // ghosts and players with feather fall, safe fall or water walk auras can walk on water
+    if (sample.flags & ANTICHEAT_SAMPLE_CAN_WALK_ON_WATER)
         return;
 
     //sLog->outError("AnticheatMgr:: Walk on Water - Hack detected player GUID (low) %u",player->GetGUIDLow());
-    BuildReport(player,WALK_WATER_HACK_REPORT);
-
+    BuildReport(data, WALK_WATER_HACK_REPORT);
 }
 
-void AnticheatMgr::FlyHackDetection(Player* player, MovementInfo movementInfo)
+void AnticheatMgr::FlyHackDetection(AnticheatData& data, AnticheatSample const& sample)
 {
     if ((sWorld->getIntConfig(CONFIG_ANTICHEAT_DETECTIONS_ENABLED) & FLY_HACK_DETECTION) == 0)
         return;
 
-    uint32 key = player->GetGUIDLow();
-    if (!m_Players[key].GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_FLYING))
+    if (!data.GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_FLYING))
         return;
 
-    if (player->HasAuraType(SPELL_AURA_FLY) ||
-        player->HasAuraType(SPELL_AURA_MOD_INCREASE_MOUNTED_FLIGHT_SPEED) ||
-        player->HasAuraType(SPELL_AURA_MOD_INCREASE_FLIGHT_SPEED))
+    if (sample.flags & ANTICHEAT_SAMPLE_CAN_FLY)
         return;
 
     //sLog->outError("AnticheatMgr:: Fly-Hack detected player GUID (low) %u",player->GetGUIDLow());
-    BuildReport(player,FLY_HACK_REPORT);
+    BuildReport(data, FLY_HACK_REPORT);
 }
 
-void AnticheatMgr::TeleportPlaneHackDetection(Player* player, MovementInfo movementInfo)
+void AnticheatMgr::TeleportPlaneHackDetection(AnticheatData& data, AnticheatSample const& sample)
 {
     if ((sWorld->getIntConfig(CONFIG_ANTICHEAT_DETECTIONS_ENABLED) & TELEPORT_PLANE_HACK_DETECTION) == 0)
         return;
 
-    uint32 key = player->GetGUIDLow();
-
-    if (m_Players[key].GetLastMovementInfo().pos.GetPositionZ() != 0 ||
-        movementInfo.pos.GetPositionZ() != 0)
+    if (data.GetLastMovementInfo().pos.GetPositionZ() != 0 ||
+        sample.movementInfo.pos.GetPositionZ() != 0)
         return;
 
-    if (movementInfo.HasMovementFlag(MOVEMENTFLAG_FALLING))
+    // the ground height is only looked up for samples at z 0 that are not falling
+    if (!(sample.flags & ANTICHEAT_SAMPLE_GROUND_Z))
         return;
 
     //DEAD_FALLING was deprecated
     //if (player->getDeathState() == DEAD_FALLING)
     //    return;
-    float x, y, z;
-    player->GetPosition(x, y, z);
-    float ground_Z = player->GetMap()->GetHeight(x, y, z);
-    float z_diff = fabs(ground_Z - z);
+    float z_diff = fabs(sample.groundZ - sample.playerPos.GetPositionZ());
 
     // we are not really walking there
     if (z_diff > 1.0f)
     {
         //sLog->outError("AnticheatMgr:: Teleport To Plane - Hack detected player GUID (low) %u",player->GetGUIDLow());
-        BuildReport(player,TELEPORT_PLANE_HACK_REPORT);
+        BuildReport(data, TELEPORT_PLANE_HACK_REPORT);
     }
 }
 
-void AnticheatMgr::StartHackDetection(Player* player, MovementInfo movementInfo, uint32 opcode)
+void AnticheatMgr::StartHackDetection(Player* player, MovementInfo const& movementInfo, uint32 opcode)
 {
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_ENABLE))
         return;
@@ -106,91 +142,139 @@ void AnticheatMgr::StartHackDetection(Player* player, MovementInfo movementInfo,
     if (player->isGameMaster())
         return;
 
-    uint32 key = player->GetGUIDLow();
+    AnticheatDataPtr data = player->GetSession()->GetAnticheatData();
+    if (!data)
+        return;
+
+    AnticheatSample sample;
+    sample.movementInfo = movementInfo;
+    sample.opcode = opcode;
+    sample.mapId = player->GetMapId();
+    sample.allowedSpeed = 0.0f;
+    sample.groundZ = 0.0f;
+    sample.flags = 0;
+    player->GetPosition(&sample.playerPos);
 
     if (player->isInFlight() || player->GetTransport() || player->GetVehicle())
+        sample.flags |= ANTICHEAT_SAMPLE_SKIP_CHECKS;
+    else
     {
-        m_Players[key].SetLastMovementInfo(movementInfo);
-        m_Players[key].SetLastOpcode(opcode);
-        return;
+        // we need to know HOW is the player moving
+        // TO-DO: Should we check the incoming movement flags?
+        UnitMoveType moveType;
+        if (player->HasUnitMovementFlag(MOVEMENTFLAG_SWIMMING))
+            moveType = MOVE_SWIM;
+        else if (player->IsFlying())
+            moveType = MOVE_FLIGHT;
+        else if (player->HasUnitMovementFlag(MOVEMENTFLAG_WALKING))
+            moveType = MOVE_WALK;
+        else
+            moveType = MOVE_RUN;
+
+        sample.allowedSpeed = player->GetSpeed(moveType);
+
+        if (player->HasAuraType(SPELL_AURA_FLY) ||
+            player->HasAuraType(SPELL_AURA_MOD_INCREASE_MOUNTED_FLIGHT_SPEED) ||
+            player->HasAuraType(SPELL_AURA_MOD_INCREASE_FLIGHT_SPEED))
+            sample.flags |= ANTICHEAT_SAMPLE_CAN_FLY;
+
+        // if we are a ghost we can walk on water
+        if (!player->IsAlive() ||
+            player->HasAuraType(SPELL_AURA_FEATHER_FALL) ||
+            player->HasAuraType(SPELL_AURA_SAFE_FALL) ||
+            player->HasAuraType(SPELL_AURA_WATER_WALK))
+            sample.flags |= ANTICHEAT_SAMPLE_CAN_WALK_ON_WATER;
+
+        // in this case we don't care if they are "legal" flags, they are handled in another parts of the Anticheat Manager.
+        if (player->IsInWater() ||
+            player->IsFlying() ||
+            player->IsFalling())
+            sample.flags |= ANTICHEAT_SAMPLE_CLIMB_EXEMPT;
+
+        // the terrain belongs to the map, look the height up here, but only in the rare case the check needs it
+        if (movementInfo.pos.GetPositionZ() == 0 && !movementInfo.HasMovementFlag(MOVEMENTFLAG_FALLING))
+        {
+            sample.groundZ = player->GetMap()->GetHeight(sample.playerPos.GetPositionX(), sample.playerPos.GetPositionY(), sample.playerPos.GetPositionZ());
+            sample.flags |= ANTICHEAT_SAMPLE_GROUND_Z;
+        }
     }
 
-    SpeedHackDetection(player,movementInfo);
-    FlyHackDetection(player,movementInfo);
-    WalkOnWaterHackDetection(player,movementInfo);
-    JumpHackDetection(player,movementInfo,opcode);
-    TeleportPlaneHackDetection(player, movementInfo);
-    ClimbHackDetection(player,movementInfo,opcode);
+    if (data->AddSample(sample, getMSTime()))
+        SubmitSamples(data);
+}
+
+void AnticheatMgr::SubmitSamples(AnticheatDataPtr const& data)
+{
+    AnticheatBatch* batch = new AnticheatBatch();
+    batch->data = data;
+    data->TakeSamples(batch->samples);
 
-    m_Players[key].SetLastMovementInfo(movementInfo);
-    m_Players[key].SetLastOpcode(opcode);
+    if (batch->samples.empty())
+        delete batch;
+    else
+        m_analyzer->Enqueue(batch);
+}
+
+void AnticheatMgr::AnalyzeSample(AnticheatData& data, AnticheatSample const& sample)
+{
+    if (!(sample.flags & ANTICHEAT_SAMPLE_SKIP_CHECKS))
+    {
+        SpeedHackDetection(data, sample);
+        FlyHackDetection(data, sample);
+        WalkOnWaterHackDetection(data, sample);
+        JumpHackDetection(data, sample);
+        TeleportPlaneHackDetection(data, sample);
+        ClimbHackDetection(data, sample);
+    }
+
+    data.SetLastMovementInfo(sample.movementInfo);
+    data.SetLastOpcode(sample.opcode);
 }
 
 // basic detection
-void AnticheatMgr::ClimbHackDetection(Player *player, MovementInfo movementInfo, uint32 opcode)
+void AnticheatMgr::ClimbHackDetection(AnticheatData& data, AnticheatSample const& sample)
 {
     if ((sWorld->getIntConfig(CONFIG_ANTICHEAT_DETECTIONS_ENABLED) & CLIMB_HACK_DETECTION) == 0)
         return;
 
-    uint32 key = player->GetGUIDLow();
-
-    if (opcode != CMSG_MOVE_HEARTBEAT ||
-        m_Players[key].GetLastOpcode() != CMSG_MOVE_HEARTBEAT)
+    if (sample.opcode != CMSG_MOVE_HEARTBEAT ||
+        data.GetLastOpcode() != CMSG_MOVE_HEARTBEAT)
         return;
 
-    // in this case we don't care if they are "legal" flags, they are handled in another parts of the Anticheat Manager.
-    if (player->IsInWater() ||
-        player->IsFlying() ||
-        player->IsFalling())
+    if (sample.flags & ANTICHEAT_SAMPLE_CLIMB_EXEMPT)
         return;
 
-    Position playerPos;
-    player->GetPosition(&playerPos);
-
-    float deltaZ = fabs(playerPos.GetPositionZ() - movementInfo.pos.GetPositionZ());
-    float deltaXY = movementInfo.pos.GetExactDist2d(&playerPos);
+    float deltaZ = fabs(sample.playerPos.GetPositionZ() - sample.movementInfo.pos.GetPositionZ());
+    float deltaXY = sample.movementInfo.pos.GetExactDist2d(&sample.playerPos);
 
-    float angle = player->NormalizeOrientation(tan(deltaZ/deltaXY));
+    float angle = Position::NormalizeOrientation(tan(deltaZ/deltaXY));
 
     if (angle > CLIMB_ANGLE)
     {
         //sLog->outError("AnticheatMgr:: Climb-Hack detected player GUID (low) %u", player->GetGUIDLow());
-        BuildReport(player,CLIMB_HACK_REPORT);
+        BuildReport(data, CLIMB_HACK_REPORT);
     }
 }
 
-void AnticheatMgr::SpeedHackDetection(Player* player,MovementInfo movementInfo)
+void AnticheatMgr::SpeedHackDetection(AnticheatData& data, AnticheatSample const& sample)
 {
     if ((sWorld->getIntConfig(CONFIG_ANTICHEAT_DETECTIONS_ENABLED) & SPEED_HACK_DETECTION) == 0)
         return;
 
-    uint32 key = player->GetGUIDLow();
-
     // We also must check the map because the movementFlag can be modified by the client.
     // If we just check the flag, they could always add that flag and always skip the speed hacking detection.
     // 369 == DEEPRUN TRAM
-    if (player->GetMapId() == 369)
+    if (sample.mapId == 369)
         return;
 
-    uint32 distance2D = (uint32)movementInfo.pos.GetExactDist2d(&m_Players[key].GetLastMovementInfo().pos);
-    uint8 moveType = 0;
-
-    // we need to know HOW is the player moving
-    // TO-DO: Should we check the incoming movement flags?
-    if (player->HasUnitMovementFlag(MOVEMENTFLAG_SWIMMING))
-        moveType = MOVE_SWIM;
-    else if (player->IsFlying())
-        moveType = MOVE_FLIGHT;
-    else if (player->HasUnitMovementFlag(MOVEMENTFLAG_WALKING))
-        moveType = MOVE_WALK;
-    else
-        moveType = MOVE_RUN;
+    MovementInfo const& movementInfo = sample.movementInfo;
+    uint32 distance2D = (uint32)movementInfo.pos.GetExactDist2d(&data.GetLastMovementInfo().pos);
 
     // how many yards the player can do in one sec.
-    uint32 speedRate = (uint32)(player->GetSpeed(UnitMoveType(moveType)) + movementInfo.j_xyspeed);
+    uint32 speedRate = (uint32)(sample.allowedSpeed + movementInfo.j_xyspeed);
 
     // how long the player took to move to here.
-    uint32 timeDiff = getMSTimeDiff(m_Players[key].GetLastMovementInfo().time,movementInfo.time);
+    uint32 timeDiff = getMSTimeDiff(data.GetLastMovementInfo().time, movementInfo.time);
 
     if (!timeDiff)
         timeDiff = 1;
@@ -201,7 +285,7 @@ void AnticheatMgr::SpeedHackDetection(Player* player,MovementInfo movementInfo)
     // we did the (uint32) cast to accept a margin of tolerance
     if (clientSpeedRate > speedRate)
     {
-        BuildReport(player,SPEED_HACK_REPORT);
+        BuildReport(data, SPEED_HACK_REPORT);
         //sLog->outError("AnticheatMgr:: Speed-Hack detected player GUID (low) %u",player->GetGUIDLow());
     }
 }
@@ -216,12 +300,16 @@ void AnticheatMgr::HandlePlayerLogin(Player* player)
     /*
     // we must delete this to prevent errors in case of crash
     CharacterDatabase.PExecute("DELETE FROM players_reports_status WHERE guid=%u",player->GetGUIDLow());
-    // we initialize the pos of lastMovementPosition var.
-    m_Players[player->GetGUIDLow()].SetPosition(player->GetPositionX(),player->GetPositionY(),player->GetPositionZ(),player->GetOrientation());
     QueryResult resultDB = CharacterDatabase.PQuery("SELECT * FROM daily_players_reports WHERE guid=%u;",player->GetGUIDLow());
 
     if (resultDB)
-        m_Players[player->GetGUIDLow()].SetDailyReportState(true);*/
+        data->SetDailyReportState(true);*/
+
+    // a fresh state per character, batches of a previous character of the session still point to the old one
+    AnticheatDataPtr data(new AnticheatData());
+    // we initialize the pos of lastMovementPosition var.
+    data->SetPosition(player->GetPositionX(), player->GetPositionY(), player->GetPositionZ(), player->GetOrientation());
+    player->GetSession()->SetAnticheatData(data);
 }
 
 void AnticheatMgr::HandlePlayerLogout(Player* player)
@@ -230,8 +318,10 @@ void AnticheatMgr::HandlePlayerLogout(Player* player)
 
     // We must also delete it at logout to prevent have data of offline players in the db when we query the database (IE: The GM Command)
     //CharacterDatabase.PExecute("DELETE FROM players_reports_status WHERE guid=%u",player->GetGUIDLow());
-    // Delete not needed data from the memory.
-    m_Players.erase(player->GetGUIDLow());
+    // Delete not needed data from the memory, the analysis thread frees it after the last batch.
+    if (AnticheatDataPtr data = player->GetSession()->GetAnticheatData())
+        SubmitSamples(data);
+    player->GetSession()->SetAnticheatData(AnticheatDataPtr());
 }
 
 void AnticheatMgr::SavePlayerData(Player* player)
@@ -239,19 +329,42 @@ void AnticheatMgr::SavePlayerData(Player* player)
     //CharacterDatabase.PExecute("REPLACE INTO players_reports_status (guid,average,total_reports,speed_reports,fly_reports,jump_reports,waterwalk_reports,teleportplane_reports,climb_reports,creation_time) VALUES (%u,%f,%u,%u,%u,%u,%u,%u,%u,%u);",player->GetGUIDLow(),m_Players[player->GetGUIDLow()].GetAverage(),m_Players[player->GetGUIDLow()].GetTotalReports(), m_Players[player->GetGUIDLow()].GetTypeReports(SPEED_HACK_REPORT),m_Players[player->GetGUIDLow()].GetTypeReports(FLY_HACK_REPORT),m_Players[player->GetGUIDLow()].GetTypeReports(JUMP_HACK_REPORT),m_Players[player->GetGUIDLow()].GetTypeReports(WALK_WATER_HACK_REPORT),m_Players[player->GetGUIDLow()].GetTypeReports(TELEPORT_PLANE_HACK_REPORT),m_Players[player->GetGUIDLow()].GetTypeReports(CLIMB_HACK_REPORT),m_Players[player->GetGUIDLow()].GetCreationTime());
 }
 
+AnticheatDataPtr AnticheatMgr::GetPlayerData(uint32 lowGUID) const
+{
+    if (Player* player = ObjectAccessor::FindPlayer(MAKE_NEW_GUID(lowGUID, 0, HIGHGUID_PLAYER)))
+        return player->GetSession()->GetAnticheatData();
+
+    return AnticheatDataPtr();
+}
+
 uint32 AnticheatMgr::GetTotalReports(uint32 lowGUID)
 {
-    return m_Players[lowGUID].GetTotalReports();
+    AnticheatDataPtr data = GetPlayerData(lowGUID);
+    if (!data)
+        return 0;
+
+    ACE_GUARD_RETURN(AnticheatData::LockType, guard, data->GetLock(), 0);
+    return data->GetTotalReports();
 }
 
 float AnticheatMgr::GetAverage(uint32 lowGUID)
 {
-    return m_Players[lowGUID].GetAverage();
+    AnticheatDataPtr data = GetPlayerData(lowGUID);
+    if (!data)
+        return 0.0f;
+
+    ACE_GUARD_RETURN(AnticheatData::LockType, guard, data->GetLock(), 0.0f);
+    return data->GetAverage();
 }
 
 uint32 AnticheatMgr::GetTypeReports(uint32 lowGUID, uint8 type)
 {
-    return m_Players[lowGUID].GetTypeReports(type);
+    AnticheatDataPtr data = GetPlayerData(lowGUID);
+    if (!data)
+        return 0;
+
+    ACE_GUARD_RETURN(AnticheatData::LockType, guard, data->GetLock(), 0);
+    return data->GetTypeReports(type);
 }
 
 bool AnticheatMgr::MustCheckTempReports(uint8 type)
@@ -262,75 +375,69 @@ bool AnticheatMgr::MustCheckTempReports(uint8 type)
     return true;
 }
 
-void AnticheatMgr::BuildReport(Player* player,uint8 reportType)
+// called by the analysis thread with the lock of data held
+void AnticheatMgr::BuildReport(AnticheatData& data, uint8 reportType)
 {
-    uint32 key = player->GetGUIDLow();
-
     if (MustCheckTempReports(reportType))
     {
         uint32 actualTime = getMSTime();
 
-        if (!m_Players[key].GetTempReportsTimer(reportType))
-            m_Players[key].SetTempReportsTimer(actualTime,reportType);
+        if (!data.GetTempReportsTimer(reportType))
+            data.SetTempReportsTimer(actualTime, reportType);
 
-        if (getMSTimeDiff(m_Players[key].GetTempReportsTimer(reportType),actualTime) < 3000)
+        if (getMSTimeDiff(data.GetTempReportsTimer(reportType), actualTime) < 3000)
         {
-            m_Players[key].SetTempReports(m_Players[key].GetTempReports(reportType)+1,reportType);
+            data.SetTempReports(data.GetTempReports(reportType) + 1, reportType);
 
-            if (m_Players[key].GetTempReports(reportType) < 3)
+            if (data.GetTempReports(reportType) < 3)
                 return;
         }
         else
         {
-            m_Players[key].SetTempReportsTimer(actualTime,reportType);
-            m_Players[key].SetTempReports(1,reportType);
+            data.SetTempReportsTimer(actualTime, reportType);
+            data.SetTempReports(1, reportType);
             return;
         }
     }
 
     // generating creationTime for average calculation
-    if (!m_Players[key].GetTotalReports())
-        m_Players[key].SetCreationTime(getMSTime());
+    if (!data.GetTotalReports())
+        data.SetCreationTime(getMSTime());
 
     // increasing total_reports
-    m_Players[key].SetTotalReports(m_Players[key].GetTotalReports()+1);
+    data.SetTotalReports(data.GetTotalReports() + 1);
     // increasing specific cheat report
-    m_Players[key].SetTypeReports(reportType,m_Players[key].GetTypeReports(reportType)+1);
+    data.SetTypeReports(reportType, data.GetTypeReports(reportType) + 1);
 
     // diff time for average calculation
-    uint32 diffTime = getMSTimeDiff(m_Players[key].GetCreationTime(),getMSTime()) / IN_MILLISECONDS;
+    uint32 diffTime = getMSTimeDiff(data.GetCreationTime(), getMSTime()) / IN_MILLISECONDS;
 
     if (diffTime > 0)
     {
         // Average == Reports per second
-        float average = float(m_Players[key].GetTotalReports()) / float(diffTime);
-        m_Players[key].SetAverage(average);
+        float average = float(data.GetTotalReports()) / float(diffTime);
+        data.SetAverage(average);
     }
 
-    if (sWorld->getIntConfig(CONFIG_ANTICHEAT_MAX_REPORTS_FOR_DAILY_REPORT) < m_Players[key].GetTotalReports())
+    if (sWorld->getIntConfig(CONFIG_ANTICHEAT_MAX_REPORTS_FOR_DAILY_REPORT) < data.GetTotalReports())
     {
-        if (!m_Players[key].GetDailyReportState())
+        if (!data.GetDailyReportState())
         {
-            //CharacterDatabase.PExecute("REPLACE INTO daily_players_reports (guid,average,total_reports,speed_reports,fly_reports,jump_reports,waterwalk_reports,teleportplane_reports,climb_reports,creation_time) VALUES (%u,%f,%u,%u,%u,%u,%u,%u,%u,%u);",player->GetGUIDLow(),m_Players[player->GetGUIDLow()].GetAverage(),m_Players[player->GetGUIDLow()].GetTotalReports(), m_Players[player->GetGUIDLow()].GetTypeReports(SPEED_HACK_REPORT),m_Players[player->GetGUIDLow()].GetTypeReports(FLY_HACK_REPORT),m_Players[player->GetGUIDLow()].GetTypeReports(JUMP_HACK_REPORT),m_Players[player->GetGUIDLow()].GetTypeReports(WALK_WATER_HACK_REPORT),m_Players[player->GetGUIDLow()].GetTypeReports(TELEPORT_PLANE_HACK_REPORT),m_Players[player->GetGUIDLow()].GetTypeReports(CLIMB_HACK_REPORT),m_Players[player->GetGUIDLow()].GetCreationTime());
-            m_Players[key].SetDailyReportState(true);
+            //CharacterDatabase.PExecute("REPLACE INTO daily_players_reports ...");
+            data.SetDailyReportState(true);
         }
     }
 
-    if (m_Players[key].GetTotalReports() > sWorld->getIntConfig(CONFIG_ANTICHEAT_REPORTS_INGAME_NOTIFICATION))
-    {
-        // display warning at the center of the screen, hacky way?
-        std::string str = "";
-        str = "|cFFFFFC00[Anticheat]|cFF00FFFF[|cFF60FF00" + std::string(player->GetName()) + "|cFF00FFFF] Cheat detected!";
-        WorldPacket data(SMSG_NOTIFICATION, 2 + str.length());
-        data.WriteBits(str.length(), 12);
-        data.FlushBits();
-        data.WriteString(str);
-        //sWorld->SendGlobalGMMessage(&data); NO MORE OF THIS PLEASE THIS IS FLOODING MY SCREEN FOR NOTHIN'
-    }
+    // the in game warning for CONFIG_ANTICHEAT_REPORTS_INGAME_NOTIFICATION is disabled, it flooded the GMs
 }
 
 void AnticheatMgr::AnticheatGlobalCommand(ChatHandler* handler)
 {
+    uint64 analyzedSamples = m_analyzer->GetAnalyzedSamples();
+    uint64 analysisTime = m_analyzer->GetAnalysisTime();
+    handler->PSendSysMessage("Movement samples analyzed: " UI64FMTD " (" UI64FMTD " per second of analysis), %u waiting",
+        analyzedSamples, analysisTime ? analyzedSamples * 1000000 / analysisTime : analyzedSamples, m_analyzer->GetPendingSamples());
+
     // MySQL will sort all for us, anyway this is not the best way we must only save the anticheat data not whole player's data!.
     sObjectAccessor->SaveAllPlayers();
 
@@ -387,41 +494,51 @@ void AnticheatMgr::AnticheatGlobalCommand(ChatHandler* handler)
     }
 }
 
+void AnticheatMgr::ResetReports(AnticheatData& data)
+{
+    ACE_GUARD(AnticheatData::LockType, guard, data.GetLock());
+    data.SetTotalReports(0);
+    data.SetAverage(0);
+    data.SetCreationTime(0);
+    for (uint8 i = 0; i < MAX_REPORT_TYPES; i++)
+    {
+        data.SetTempReports(0, i);
+        data.SetTempReportsTimer(0, i);
+        data.SetTypeReports(i, 0);
+    }
+}
+
 void AnticheatMgr::AnticheatDeleteCommand(uint32 guid)
 {
     if (!guid)
     {
-        for (AnticheatPlayersDataMap::iterator it = m_Players.begin(); it != m_Players.end(); ++it)
-        {
-            (*it).second.SetTotalReports(0);
-            (*it).second.SetAverage(0);
-            (*it).second.SetCreationTime(0);
-            for (uint8 i = 0; i < MAX_REPORT_TYPES; i++)
-            {
-                (*it).second.SetTempReports(0,i);
-                (*it).second.SetTempReportsTimer(0,i);
-                (*it).second.SetTypeReports(i,0);
-            }
-        }
+        TRINITY_READ_GUARD(HashMapHolder<Player>::LockType, *HashMapHolder<Player>::GetLock());
+        HashMapHolder<Player>::MapType const& players = sObjectAccessor->GetPlayers();
+        for (HashMapHolder<Player>::MapType::const_iterator it = players.begin(); it != players.end(); ++it)
+            if (AnticheatDataPtr data = it->second->GetSession()->GetAnticheatData())
+                ResetReports(*data);
+
         CharacterDatabase.PExecute("DELETE FROM players_reports_status;");
     }
     else
     {
-        m_Players[guid].SetTotalReports(0);
-        m_Players[guid].SetAverage(0);
-        m_Players[guid].SetCreationTime(0);
-        for (uint8 i = 0; i < MAX_REPORT_TYPES; i++)
-        {
-            m_Players[guid].SetTempReports(0,i);
-            m_Players[guid].SetTempReportsTimer(0,i);
-            m_Players[guid].SetTypeReports(i,0);
-        }
+        if (AnticheatDataPtr data = GetPlayerData(guid))
+            ResetReports(*data);
+
         CharacterDatabase.PExecute("DELETE FROM players_reports_status WHERE guid=%u;",guid);
     }
 }
 
 void AnticheatMgr::ResetDailyReportStates()
 {
-    for (AnticheatPlayersDataMap::iterator it = m_Players.begin(); it != m_Players.end(); ++it)
-        m_Players[(*it).first].SetDailyReportState(false);
-}
\ No newline at end of file
+    TRINITY_READ_GUARD(HashMapHolder<Player>::LockType, *HashMapHolder<Player>::GetLock());
+    HashMapHolder<Player>::MapType const& players = sObjectAccessor->GetPlayers();
+    for (HashMapHolder<Player>::MapType::const_iterator it = players.begin(); it != players.end(); ++it)
+    {
+        if (AnticheatDataPtr data = it->second->GetSession()->GetAnticheatData())
+        {
+            ACE_GUARD(AnticheatData::LockType, guard, data->GetLock());
+            data->SetDailyReportState(false);
+        }
+    }
+}
@@ -2,12 +2,16 @@
 #define SC_ACMGR_H
 
 #include <ace/Singleton.h>
+#include <ace/Task.h>
+#include <ace/Message_Queue_T.h>
 #include "Common.h"
 #include "SharedDefines.h"
 #include "ScriptPCH.h"
 #include "AnticheatData.h"
 #include "Chat.h"
 
+#include <atomic>
+
 class Player;
 class AnticheatData;
 
@@ -33,21 +37,46 @@ enum DetectionTypes
     CLIMB_HACK_DETECTION            = 32
 };
 
-// GUIDLow is the key.
-typedef std::map<uint32, AnticheatData> AnticheatPlayersDataMap;
+// Samples of one player, handed from the thread that recorded them to the analysis thread
+struct AnticheatBatch
+{
+    AnticheatDataPtr data;
+    std::vector<AnticheatSample> samples;
+};
+
+// Runs the movement checks of the queued batches on its own thread
+class AnticheatAnalyzer : protected ACE_Task_Base
+{
+    public:
+        AnticheatAnalyzer();
+        ~AnticheatAnalyzer();
+
+        void Enqueue(AnticheatBatch* batch);
+
+        uint64 GetAnalyzedSamples() const { return m_analyzedSamples.load(std::memory_order_relaxed); }
+        uint64 GetAnalysisTime() const { return m_analysisTime.load(std::memory_order_relaxed); }      // microseconds
+        uint32 GetPendingSamples() const { return m_pendingSamples.load(std::memory_order_relaxed); }
+
+    private:
+        virtual int svc();
+
+        ACE_Message_Queue_Ex<AnticheatBatch, ACE_MT_SYNCH> m_queue;
+        std::atomic<uint64> m_analyzedSamples;
+        std::atomic<uint64> m_analysisTime;
+        std::atomic<uint32> m_pendingSamples;
+};
 
 class AnticheatMgr
 {
-    friend class ACE_Singleton<AnticheatMgr, ACE_Null_Mutex>;
+    friend class ACE_Singleton<AnticheatMgr, ACE_Thread_Mutex>;
+    friend class AnticheatAnalyzer;
     AnticheatMgr();
     ~AnticheatMgr();
 
 public:
 
-    void StartHackDetection(Player* player, MovementInfo movementInfo, uint32 opcode);
-    void DeletePlayerReport(Player* player, bool login);
-    void DeletePlayerData(Player* player);
-    void CreatePlayerData(Player* player);
+    // only records the sample, the checks run later on the analysis thread
+    void StartHackDetection(Player* player, MovementInfo const& movementInfo, uint32 opcode);
     void SavePlayerData(Player* player);
 
     void StartScripts();
@@ -64,20 +93,26 @@ public:
 
     void ResetDailyReportStates();
 private:
-    void SpeedHackDetection(Player* player, MovementInfo movementInfo);
-    void FlyHackDetection(Player* player, MovementInfo movementInfo);
-    void WalkOnWaterHackDetection(Player* player, MovementInfo movementInfo);
-    void JumpHackDetection(Player* player, MovementInfo movementInfo,uint32 opcode);
-    void TeleportPlaneHackDetection(Player* player, MovementInfo);
-    void ClimbHackDetection(Player* player,MovementInfo movementInfo,uint32 opcode);
+    void AnalyzeSample(AnticheatData& data, AnticheatSample const& sample);
+
+    void SpeedHackDetection(AnticheatData& data, AnticheatSample const& sample);
+    void FlyHackDetection(AnticheatData& data, AnticheatSample const& sample);
+    void WalkOnWaterHackDetection(AnticheatData& data, AnticheatSample const& sample);
+    void JumpHackDetection(AnticheatData& data, AnticheatSample const& sample);
+    void TeleportPlaneHackDetection(AnticheatData& data, AnticheatSample const& sample);
+    void ClimbHackDetection(AnticheatData& data, AnticheatSample const& sample);
 
-    void BuildReport(Player* player,uint8 reportType);
+    void BuildReport(AnticheatData& data, uint8 reportType);
 
     bool MustCheckTempReports(uint8 type);
 
-    AnticheatPlayersDataMap m_Players;                        ///< Player data
+    void SubmitSamples(AnticheatDataPtr const& data);
+    AnticheatDataPtr GetPlayerData(uint32 lowGUID) const;
+    void ResetReports(AnticheatData& data);
+
+    AnticheatAnalyzer* m_analyzer;
 };
 
-#define sAnticheatMgr ACE_Singleton<AnticheatMgr, ACE_Null_Mutex>::instance()
+#define sAnticheatMgr ACE_Singleton<AnticheatMgr, ACE_Thread_Mutex>::instance()
 
-#endif
\ No newline at end of file
+#endif
@@ -24,6 +24,7 @@
 #include "Common.h"
 #include "DatabaseEnv.h"
 #include "DBCStructure.h"
+#include "AuctionSearchIndex.h"
 
 class Item;
 class Player;
@@ -135,6 +136,7 @@ class AuctionHouseObject
 
   private:
     AuctionEntryMap AuctionsMap;
+    AuctionSearchIndex SearchIndex;
 
     // storage for "next" auction item for next Update()
     AuctionEntryMap::const_iterator next;
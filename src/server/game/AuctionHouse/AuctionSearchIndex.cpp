@@ -0,0 +1,329 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuctionSearchIndex.h"
+#include "AuctionHouseMgr.h"
+#include "DBCStores.h"
+#include "ObjectMgr.h"
+#include "Util.h"
+
+#include <algorithm>
+
+AuctionSearchIndex::AuctionSearchIndex()
+{
+    for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
+        m_localeBuilt[i] = false;
+}
+
+void AuctionSearchIndex::BuildSearchName(ItemTemplate const* proto, int32 randomPropertyId, LocaleConstant locale, std::wstring& name)
+{
+    name.clear();
+
+    std::string utf8 = proto->Name1;
+    if (utf8.empty())
+        return;
+
+    if (ItemLocale const* il = sObjectMgr->GetItemLocale(proto->ItemId))
+        ObjectMgr::GetLocaleString(il->Name, locale, utf8);
+
+    // The suffix (ie: of the Monkey) comes from ItemRandomProperties.dbc, not ItemRandomSuffix.dbc, and has
+    // to use the property id of the item itself so that the name matches what BuildAuctionInfo sends
+    if (randomPropertyId)
+    {
+        ItemRandomPropertiesEntry const* itemRandProp = sItemRandomPropertiesStore.LookupEntry(uint32(randomPropertyId));
+        if (itemRandProp && itemRandProp->nameSuffix && *itemRandProp->nameSuffix)
+        {
+            utf8 += ' ';
+            utf8 += itemRandProp->nameSuffix;
+        }
+    }
+
+    if (!Utf8toWStr(utf8, name))
+    {
+        name.clear();
+        return;
+    }
+
+    wstrToLower(name);
+}
+
+void AuctionSearchIndex::AddPosting(PostingList& list, uint32 id)
+{
+    // auction ids are generated in ascending order, so this is nearly always an append
+    if (list.empty() || list.back() < id)
+        list.push_back(id);
+    else
+        list.insert(std::lower_bound(list.begin(), list.end(), id), id);
+}
+
+void AuctionSearchIndex::RemovePosting(PostingMap& map, uint32 key, uint32 id)
+{
+    PostingMap::iterator itr = map.find(key);
+    if (itr == map.end())
+        return;
+
+    PostingList& list = itr->second;
+    PostingList::iterator pos = std::lower_bound(list.begin(), list.end(), id);
+    if (pos != list.end() && *pos == id)
+        list.erase(pos);
+
+    if (list.empty())
+        map.erase(itr);
+}
+
+void AuctionSearchIndex::Insert(AuctionEntry* auction, ItemTemplate const* proto, int32 randomPropertyId)
+{
+    uint32 id = auction->Id;
+    if (m_records.find(id) != m_records.end())
+        Remove(id);
+
+    std::pair<uint32, int32> nameKey(proto->ItemId, randomPropertyId);
+    std::map<std::pair<uint32, int32>, uint32>::const_iterator nameItr = m_nameIds.find(nameKey);
+
+    uint32 nameId;
+    if (nameItr != m_nameIds.end())
+        nameId = nameItr->second;
+    else
+    {
+        if (!m_freeNames.empty())
+        {
+            nameId = m_freeNames.back();
+            m_freeNames.pop_back();
+        }
+        else
+        {
+            nameId = uint32(m_names.size());
+            m_names.push_back(Name());
+            for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
+                if (m_localeBuilt[i])
+                    m_localeNames[i].resize(m_names.size());
+        }
+
+        Name& name = m_names[nameId];
+        name.itemEntry = proto->ItemId;
+        name.randomPropertyId = randomPropertyId;
+        name.auctions = 0;
+        m_nameIds[nameKey] = nameId;
+
+        for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
+            if (m_localeBuilt[i])
+                BuildSearchName(proto, randomPropertyId, LocaleConstant(i), m_localeNames[i][nameId]);
+    }
+
+    Name& name = m_names[nameId];
+    ++name.auctions;
+    AddPosting(name.ids, id);
+
+    Record& record = m_records[id];
+    record.auction = auction;
+    record.nameId = nameId;
+    record.requiredLevel = proto->RequiredLevel;
+    record.inventoryType = proto->InventoryType;
+    record.itemClass = proto->Class;
+    record.itemSubClass = proto->SubClass;
+    record.quality = proto->Quality;
+
+    AddPosting(m_all, id);
+    AddPosting(m_byClass[record.itemClass], id);
+    AddPosting(m_bySubClass[GetSubClassKey(record.itemClass, record.itemSubClass)], id);
+    AddPosting(m_byInventoryType[record.inventoryType], id);
+    AddPosting(m_byQuality[record.quality], id);
+    AddPosting(m_byLevel[record.requiredLevel], id);
+}
+
+void AuctionSearchIndex::Remove(uint32 auctionId)
+{
+    UNORDERED_MAP<uint32, Record>::iterator itr = m_records.find(auctionId);
+    if (itr == m_records.end())
+        return;
+
+    Record const& record = itr->second;
+
+    PostingList::iterator pos = std::lower_bound(m_all.begin(), m_all.end(), auctionId);
+    if (pos != m_all.end() && *pos == auctionId)
+        m_all.erase(pos);
+
+    RemovePosting(m_byClass, record.itemClass, auctionId);
+    RemovePosting(m_bySubClass, GetSubClassKey(record.itemClass, record.itemSubClass), auctionId);
+    RemovePosting(m_byInventoryType, record.inventoryType, auctionId);
+    RemovePosting(m_byQuality, record.quality, auctionId);
+    RemovePosting(m_byLevel, record.requiredLevel, auctionId);
+
+    Name& name = m_names[record.nameId];
+    pos = std::lower_bound(name.ids.begin(), name.ids.end(), auctionId);
+    if (pos != name.ids.end() && *pos == auctionId)
+        name.ids.erase(pos);
+
+    if (--name.auctions == 0)
+    {
+        m_nameIds.erase(std::make_pair(name.itemEntry, name.randomPropertyId));
+        PostingList().swap(name.ids);
+        for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
+            if (m_localeBuilt[i])
+                std::wstring().swap(m_localeNames[i][record.nameId]);
+
+        m_freeNames.push_back(record.nameId);
+    }
+
+    m_records.erase(itr);
+}
+
+void AuctionSearchIndex::MatchNames(AuctionSearchQuery const& query)
+{
+    uint8 locale = query.locale < TOTAL_LOCALES ? uint8(query.locale) : uint8(LOCALE_enUS);
+    std::vector<std::wstring>& names = m_localeNames[locale];
+
+    if (!m_localeBuilt[locale])
+    {
+        names.resize(m_names.size());
+        for (uint32 i = 0; i < m_names.size(); ++i)
+            if (m_names[i].auctions)
+                if (ItemTemplate const* proto = sObjectMgr->GetItemTemplate(m_names[i].itemEntry))
+                    BuildSearchName(proto, m_names[i].randomPropertyId, LocaleConstant(locale), names[i]);
+
+        m_localeBuilt[locale] = true;
+    }
+
+    // one substring test per distinct name instead of one per auction
+    m_nameMatches.assign(m_names.size(), false);
+    for (uint32 i = 0; i < m_names.size(); ++i)
+        if (m_names[i].auctions && names[i].find(query.name) != std::wstring::npos)
+            m_nameMatches[i] = true;
+}
+
+bool AuctionSearchIndex::Matches(Record const& record, AuctionSearchQuery const& query) const
+{
+    if (query.itemClass != AUCTION_SEARCH_ANY && record.itemClass != query.itemClass)
+        return false;
+
+    if (query.itemSubClass != AUCTION_SEARCH_ANY && record.itemSubClass != query.itemSubClass)
+        return false;
+
+    if (query.inventoryType != AUCTION_SEARCH_ANY && record.inventoryType != query.inventoryType)
+        return false;
+
+    if (query.quality != AUCTION_SEARCH_ANY && record.quality != query.quality)
+        return false;
+
+    if (query.levelMin != 0x00 && (record.requiredLevel < query.levelMin || (query.levelMax != 0x00 && record.requiredLevel > query.levelMax)))
+        return false;
+
+    if (!query.name.empty() && !m_nameMatches[record.nameId])
+        return false;
+
+    return true;
+}
+
+void AuctionSearchIndex::Search(AuctionSearchQuery const& query, std::vector<AuctionEntry*>& result)
+{
+    if (!query.name.empty())
+        MatchNames(query);
+
+    // walk the smallest posting list among the requested filters
+    PostingList const* list = &m_all;
+
+    if (query.itemClass != AUCTION_SEARCH_ANY)
+    {
+        PostingMap::const_iterator itr;
+        if (query.itemSubClass != AUCTION_SEARCH_ANY)
+        {
+            itr = m_bySubClass.find(GetSubClassKey(query.itemClass, query.itemSubClass));
+            if (itr == m_bySubClass.end())
+                return;
+        }
+        else
+        {
+            itr = m_byClass.find(query.itemClass);
+            if (itr == m_byClass.end())
+                return;
+        }
+
+        if (itr->second.size() < list->size())
+            list = &itr->second;
+    }
+
+    if (query.inventoryType != AUCTION_SEARCH_ANY)
+    {
+        PostingMap::const_iterator itr = m_byInventoryType.find(query.inventoryType);
+        if (itr == m_byInventoryType.end())
+            return;
+
+        if (itr->second.size() < list->size())
+            list = &itr->second;
+    }
+
+    if (query.quality != AUCTION_SEARCH_ANY)
+    {
+        PostingMap::const_iterator itr = m_byQuality.find(query.quality);
+        if (itr == m_byQuality.end())
+            return;
+
+        if (itr->second.size() < list->size())
+            list = &itr->second;
+    }
+
+    // the level range and the name match cover several lists each, walk their union when it is smaller
+    size_t levelSize = m_all.size();
+    PostingMap::const_iterator levelBegin = m_byLevel.end();
+    PostingMap::const_iterator levelEnd = m_byLevel.end();
+    if (query.levelMin != 0x00)
+    {
+        levelBegin = m_byLevel.lower_bound(query.levelMin);
+        if (query.levelMax != 0x00)
+            levelEnd = m_byLevel.upper_bound(query.levelMax);
+
+        levelSize = 0;
+        for (PostingMap::const_iterator itr = levelBegin; itr != levelEnd; ++itr)
+            levelSize += itr->second.size();
+    }
+
+    size_t nameSize = m_all.size();
+    if (!query.name.empty())
+    {
+        nameSize = 0;
+        for (uint32 i = 0; i < m_names.size(); ++i)
+            if (m_nameMatches[i])
+                nameSize += m_names[i].ids.size();
+    }
+
+    if (levelSize < list->size() || nameSize < list->size())
+    {
+        // both unions are disjoint, every auction has a single level and a single name
+        m_candidates.clear();
+        if (levelSize <= nameSize)
+        {
+            for (PostingMap::const_iterator itr = levelBegin; itr != levelEnd; ++itr)
+                m_candidates.insert(m_candidates.end(), itr->second.begin(), itr->second.end());
+        }
+        else
+        {
+            for (uint32 i = 0; i < m_names.size(); ++i)
+                if (m_nameMatches[i])
+                    m_candidates.insert(m_candidates.end(), m_names[i].ids.begin(), m_names[i].ids.end());
+        }
+
+        std::sort(m_candidates.begin(), m_candidates.end());
+        list = &m_candidates;
+    }
+
+    for (PostingList::const_iterator itr = list->begin(); itr != list->end(); ++itr)
+    {
+        UNORDERED_MAP<uint32, Record>::const_iterator record = m_records.find(*itr);
+        if (record != m_records.end() && Matches(record->second, query))
+            result.push_back(record->second.auction);
+    }
+}
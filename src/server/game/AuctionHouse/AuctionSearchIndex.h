@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_AUCTIONSEARCHINDEX_H
+#define TRINITY_AUCTIONSEARCHINDEX_H
+
+#include "Common.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+struct AuctionEntry;
+struct ItemTemplate;
+
+#define AUCTION_SEARCH_ANY  0xFFFFFFFF
+
+struct AuctionSearchQuery
+{
+    AuctionSearchQuery() : locale(LOCALE_enUS), levelMin(0), levelMax(0), inventoryType(AUCTION_SEARCH_ANY),
+        itemClass(AUCTION_SEARCH_ANY), itemSubClass(AUCTION_SEARCH_ANY), quality(AUCTION_SEARCH_ANY) { }
+
+    std::wstring name;                                      // lower case, empty matches every name
+    LocaleConstant locale;                                  // db locale of the item names
+    uint8 levelMin;                                         // 0 disables the level range
+    uint8 levelMax;                                         // 0 for no upper bound
+    uint32 inventoryType;
+    uint32 itemClass;
+    uint32 itemSubClass;
+    uint32 quality;
+};
+
+// Search index of the auctions of one auction house. Every auction is added to sorted posting
+// lists by item class, subclass, inventory type, quality, required level and name, a query walks
+// the smallest set of lists that covers it and checks the other filters on the values cached at
+// insert time. Names are shared by all auctions of the same item and random property, and are
+// built lower cased per locale the first time that locale is searched.
+// Only used from the world thread, like the auction maps themselves.
+class AuctionSearchIndex
+{
+    public:
+
+        AuctionSearchIndex();
+
+        void Insert(AuctionEntry* auction, ItemTemplate const* proto, int32 randomPropertyId);
+        void Remove(uint32 auctionId);
+
+        // Appends the matching auctions ordered by auction id
+        void Search(AuctionSearchQuery const& query, std::vector<AuctionEntry*>& result);
+
+        uint32 GetSize() const { return uint32(m_all.size()); }
+        uint32 GetNameCount() const { return uint32(m_nameIds.size()); }
+
+        // Localized item name with the random property suffix, lower cased, empty if it can't be matched
+        static void BuildSearchName(ItemTemplate const* proto, int32 randomPropertyId, LocaleConstant locale, std::wstring& name);
+
+    private:
+
+        typedef std::vector<uint32> PostingList;            // auction ids, ascending
+        typedef std::map<uint32, PostingList> PostingMap;
+
+        struct Record
+        {
+            AuctionEntry* auction;
+            uint32 nameId;
+            uint32 requiredLevel;
+            uint32 inventoryType;
+            uint32 itemClass;
+            uint32 itemSubClass;
+            uint32 quality;
+        };
+
+        struct Name
+        {
+            uint32 itemEntry;
+            int32 randomPropertyId;
+            uint32 auctions;                                // 0 for free slots
+            PostingList ids;
+        };
+
+        static void AddPosting(PostingList& list, uint32 id);
+        static void RemovePosting(PostingMap& map, uint32 key, uint32 id);
+        static uint32 GetSubClassKey(uint32 itemClass, uint32 itemSubClass) { return (itemClass << 16) | (itemSubClass & 0xFFFF); }
+
+        bool Matches(Record const& record, AuctionSearchQuery const& query) const;
+        void MatchNames(AuctionSearchQuery const& query);
+
+        UNORDERED_MAP<uint32, Record> m_records;
+        PostingList m_all;
+        PostingMap m_byClass;
+        PostingMap m_bySubClass;
+        PostingMap m_byInventoryType;
+        PostingMap m_byQuality;
+        PostingMap m_byLevel;
+
+        std::vector<Name> m_names;
+        std::vector<uint32> m_freeNames;
+        std::map<std::pair<uint32, int32>, uint32> m_nameIds;
+        std::vector<std::wstring> m_localeNames[TOTAL_LOCALES]; // by name id, filled once the locale was searched
+        bool m_localeBuilt[TOTAL_LOCALES];
+
+        // scratch space of Search
+        std::vector<bool> m_nameMatches;
+        PostingList m_candidates;
+};
+
+#endif
@@ -247,12 +247,12 @@ void BattlegroundTP::RespawnFlag(uint32 Team, bool captured)
 {
     if (Team == ALLIANCE)
     {
-        sLog->outDebug(LOG_FILTER_BATTLEGROUND, "Respawning Alliance flag");
+        TC_LOG_DEBUG(LOG_FILTER_BATTLEGROUND, "Respawning Alliance flag");
         m_FlagState[TEAM_ALLIANCE] = BG_TP_FLAG_STATE_ON_BASE;
     }
     else
     {
-        sLog->outDebug(LOG_FILTER_BATTLEGROUND, "Respawning Horde flag");
+        TC_LOG_DEBUG(LOG_FILTER_BATTLEGROUND, "Respawning Horde flag");
         m_FlagState[TEAM_HORDE] = BG_TP_FLAG_STATE_ON_BASE;
     }
 
@@ -771,7 +771,7 @@ bool BattlegroundTP::SetupBattleground()
         return false;
     }
 
-    sLog->outDebug(LOG_FILTER_BATTLEGROUND, "BatteGroundTP: BG objects and spirit guides spawned");
+    TC_LOG_DEBUG(LOG_FILTER_BATTLEGROUND, "BatteGroundTP: BG objects and spirit guides spawned");
 
     return true;
 }
@@ -22,36 +22,81 @@
 #include "SpellMgr.h"
 #include "VMapManager2.h"
 
+#include <atomic>
+
 namespace DisableMgr
 {
 
 namespace
 {
+    uint8 const MAX_DISABLE_TYPES = 7;
+
     struct DisableData
     {
+        uint32 entry;
         uint8 flags;
-        std::set<uint32> params[2];                             // params0, params1
+        std::vector<uint32> params[2];                          // params0, params1, sorted
+
+        bool operator<(DisableData const& right) const { return entry < right.entry; }
+        bool operator==(DisableData const& right) const { return entry == right.entry; }
     };
 
-    // single disables here with optional data
-    typedef std::map<uint32, DisableData> DisableTypeMap;
-    // global disable map by source
-    typedef std::map<DisableType, DisableTypeMap> DisableMap;
+    // Disables of one type sorted by entry, with one bit per entry so the common
+    // case of an entry that is not disabled is answered without a search
+    struct DisableTypeTable
+    {
+        std::vector<uint64> mask;
+        std::vector<DisableData> entries;
+
+        void Build()
+        {
+            // the first row of an entry wins
+            std::stable_sort(entries.begin(), entries.end());
+            entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+
+            mask.clear();
+            if (!entries.empty())
+                mask.resize(entries.back().entry / 64 + 1, 0);
 
-    DisableMap m_DisableMap;
+            for (std::vector<DisableData>::const_iterator itr = entries.begin(); itr != entries.end(); ++itr)
+                mask[itr->entry / 64] |= UI64LIT(1) << (itr->entry % 64);
+        }
+
+        DisableData const* Find(uint32 entry) const
+        {
+            if (entry / 64 >= mask.size() || !(mask[entry / 64] & (UI64LIT(1) << (entry % 64))))
+                return NULL;
 
-    uint8 MAX_DISABLE_TYPES = 7;
+            DisableData key;
+            key.entry = entry;
+            return &*std::lower_bound(entries.begin(), entries.end(), key);
+        }
+    };
+
+    // Never changed once published, a reload publishes a new copy
+    struct DisableTables
+    {
+        DisableTypeTable types[MAX_DISABLE_TYPES];
+    };
+
+    std::atomic<DisableTables const*> m_disables(NULL);
+    std::vector<DisableTables const*> m_retiredDisables;    // replaced tables, map threads may still read them
+    ACE_Thread_Mutex m_disablesLock;                        // serializes reloads
+
+    void PublishDisables(DisableTables const* tables)
+    {
+        if (DisableTables const* old = m_disables.exchange(tables, std::memory_order_acq_rel))
+            m_retiredDisables.push_back(old);
+    }
 }
 
 void LoadDisables()
 {
     uint32 oldMSTime = getMSTime();
 
-    // reload case
-    for (DisableMap::iterator itr = m_DisableMap.begin(); itr != m_DisableMap.end(); ++itr)
-        itr->second.clear();
+    TRINITY_GUARD(ACE_Thread_Mutex, m_disablesLock);
 
-    m_DisableMap.clear();
+    DisableTables* tables = new DisableTables();
 
     QueryResult result = WorldDatabase.Query("SELECT sourceType, entry, flags, params_0, params_1 FROM disables");
 
@@ -59,6 +104,7 @@ void LoadDisables()
 
     if (!result)
     {
+        PublishDisables(tables);
         sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded 0 disables. DB table `disables` is empty!");
 
         return;
@@ -81,6 +127,7 @@ void LoadDisables()
         std::string params_1 = fields[4].GetString();
 
         DisableData data;
+        data.entry = entry;
         data.flags = flags;
 
         switch (type)
@@ -102,14 +149,16 @@ void LoadDisables()
                 {
                     Tokenizer tokens(params_0, ',');
                     for (uint8 i = 0; i < tokens.size(); )
-                        data.params[0].insert(atoi(tokens[i++]));
+                        data.params[0].push_back(atoi(tokens[i++]));
+                    std::sort(data.params[0].begin(), data.params[0].end());
                 }
 
                 if (flags & SPELL_DISABLE_AREA)
                 {
                     Tokenizer tokens(params_1, ',');
                     for (uint8 i = 0; i < tokens.size(); )
-                        data.params[1].insert(atoi(tokens[i++]));
+                        data.params[1].push_back(atoi(tokens[i++]));
+                    std::sort(data.params[1].begin(), data.params[1].end());
                 }
 
                 break;
@@ -241,11 +290,16 @@ void LoadDisables()
                 break;
         }
 
-        m_DisableMap[type].insert(DisableTypeMap::value_type(entry, data));
+        tables->types[type].entries.push_back(data);
         ++total_count;
     }
     while (result->NextRow());
 
+    for (uint8 i = 0; i < MAX_DISABLE_TYPES; ++i)
+        tables->types[i].Build();
+
+    PublishDisables(tables);
+
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded %u disables in %u ms", total_count, GetMSTimeDiffToNow(oldMSTime));
 
 }
@@ -254,7 +308,10 @@ void CheckQuestDisables()
 {
     uint32 oldMSTime = getMSTime();
 
-    uint32 count = m_DisableMap[DISABLE_TYPE_QUEST].size();
+    TRINITY_GUARD(ACE_Thread_Mutex, m_disablesLock);
+
+    DisableTables const* current = m_disables.load(std::memory_order_acquire);
+    uint32 count = current ? uint32(current->types[DISABLE_TYPE_QUEST].entries.size()) : 0;
     if (!count)
     {
         sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Checked 0 quest disables.");
@@ -263,39 +320,54 @@ void CheckQuestDisables()
     }
 
     // check only quests, rest already done at startup
-    for (DisableTypeMap::iterator itr = m_DisableMap[DISABLE_TYPE_QUEST].begin(); itr != m_DisableMap[DISABLE_TYPE_QUEST].end();)
+    DisableTables* tables = new DisableTables(*current);
+    std::vector<DisableData>& quests = tables->types[DISABLE_TYPE_QUEST].entries;
+    for (std::vector<DisableData>::iterator itr = quests.begin(); itr != quests.end();)
     {
-        const uint32 entry = itr->first;
+        const uint32 entry = itr->entry;
         if (!sObjectMgr->GetQuestTemplate(entry))
         {
             sLog->outError(LOG_FILTER_SQL, "Quest entry %u from `disables` doesn't exist, skipped.", entry);
-            m_DisableMap[DISABLE_TYPE_QUEST].erase(itr++);
+            itr = quests.erase(itr);
             continue;
         }
-        if (itr->second.flags)
+        if (itr->flags)
             sLog->outError(LOG_FILTER_SQL, "Disable flags specified for quest %u, useless data.", entry);
         ++itr;
     }
 
+    tables->types[DISABLE_TYPE_QUEST].Build();
+    PublishDisables(tables);
+
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Checked %u quest disables in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
 
 }
 
+void ReclaimDisables()
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_disablesLock);
+
+    for (std::vector<DisableTables const*>::const_iterator itr = m_retiredDisables.begin(); itr != m_retiredDisables.end(); ++itr)
+        delete *itr;
+    m_retiredDisables.clear();
+}
+
 bool IsDisabledFor(DisableType type, uint32 entry, Unit const* unit, uint8 flags)
 {
     ASSERT(type < MAX_DISABLE_TYPES);
-    if (m_DisableMap[type].empty())
+    DisableTables const* tables = m_disables.load(std::memory_order_acquire);
+    if (!tables)
         return false;
 
-    DisableTypeMap::iterator itr = m_DisableMap[type].find(entry);
-    if (itr == m_DisableMap[type].end())    // not disabled
+    DisableData const* data = tables->types[type].Find(entry);
+    if (!data)                              // not disabled
         return false;
 
     switch (type)
     {
         case DISABLE_TYPE_SPELL:
         {
-            uint8 spellFlags = itr->second.flags;
+            uint8 spellFlags = data->flags;
             if (unit)
             {
                 if ((spellFlags & SPELL_DISABLE_PLAYER && unit->GetTypeId() == TYPEID_PLAYER) ||
@@ -303,8 +375,8 @@ bool IsDisabledFor(DisableType type, uint32 entry, Unit const* unit, uint8 flags
                 {
                     if (spellFlags & SPELL_DISABLE_MAP)
                     {
-                        std::set<uint32> const& mapIds = itr->second.params[0];
-                        if (mapIds.find(unit->GetMapId()) != mapIds.end())
+                        std::vector<uint32> const& mapIds = data->params[0];
+                        if (std::binary_search(mapIds.begin(), mapIds.end(), unit->GetMapId()))
                             return true;                                        // Spell is disabled on current map
 
                         if (!(spellFlags & SPELL_DISABLE_AREA))
@@ -315,8 +387,8 @@ bool IsDisabledFor(DisableType type, uint32 entry, Unit const* unit, uint8 flags
 
                     if (spellFlags & SPELL_DISABLE_AREA)
                     {
-                        std::set<uint32> const& areaIds = itr->second.params[1];
-                        if (areaIds.find(unit->GetAreaId()) != areaIds.end())
+                        std::vector<uint32> const& areaIds = data->params[1];
+                        if (std::binary_search(areaIds.begin(), areaIds.end(), unit->GetAreaId()))
                             return true;                                        // Spell is disabled in this area
                         return false;                                           // Spell is disabled in another area, but not this one, return false
                     }
@@ -337,7 +409,7 @@ bool IsDisabledFor(DisableType type, uint32 entry, Unit const* unit, uint8 flags
                 MapEntry const* mapEntry = sMapStore.LookupEntry(entry);
                 if (mapEntry->IsDungeon())
                 {
-                    uint8 disabledModes = itr->second.flags;
+                    uint8 disabledModes = data->flags;
                     Difficulty targetDifficulty = player->GetDifficulty(mapEntry->IsRaid());
                     GetDownscaledMapDifficultyData(entry, targetDifficulty);
                     switch (targetDifficulty)
@@ -383,7 +455,7 @@ bool IsDisabledFor(DisableType type, uint32 entry, Unit const* unit, uint8 flags
         case DISABLE_TYPE_ACHIEVEMENT_CRITERIA:
             return true;
         case DISABLE_TYPE_VMAP:
-           return flags & itr->second.flags;
+           return flags & data->flags;
     }
 
     return false;
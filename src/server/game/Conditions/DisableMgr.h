@@ -59,6 +59,8 @@ namespace DisableMgr
     void LoadDisables();
     bool IsDisabledFor(DisableType type, uint32 entry, Unit const* unit, uint8 flags = 0);
     void CheckQuestDisables();
+    // Frees the tables replaced by a reload, only call while no map is updating
+    void ReclaimDisables();
 }
 
 #endif //TRINITY_DISABLEMGR_H
@@ -36,6 +36,7 @@ DB2Storage <QuestPackageItemEntry> sQuestPackageItemStore(QuestPackageItemEntryf
 typedef std::list<std::string> StoreProblemList1;
 
 uint32 DB2FilesCount = 0;
+uint32 DB2InPlaceCount = 0;
 
 static bool LoadDB2_assert_print(uint32 fsize,uint32 rsize, const std::string& filename)
 {
@@ -64,7 +65,12 @@ inline void LoadDB2(StoreProblemList1& errlist, DB2Storage<T>& storage, const st
     ++DB2FilesCount;
 
     std::string db2_filename = db2_path + filename;
-    if (!storage.Load(db2_filename.c_str()))
+    if (storage.Load(db2_filename.c_str()))
+    {
+        if (storage.IsDataInPlace())
+            ++DB2InPlaceCount;
+    }
+    else
     {
         // sort problematic db2 to (1) non compatible and (2) nonexistent
         if (FILE * f = fopen(db2_filename.c_str(), "rb"))
@@ -81,6 +87,8 @@ inline void LoadDB2(StoreProblemList1& errlist, DB2Storage<T>& storage, const st
 
 void LoadDB2Stores(const std::string& dataPath)
 {
+    uint32 oldMSTime = getMSTime();
+
     std::string db2Path = dataPath + "dbc/";
 
     StoreProblemList1 bad_db2_files;
@@ -119,5 +127,5 @@ void LoadDB2Stores(const std::string& dataPath)
         exit(1);
     }
 
-    sLog->outInfo(LOG_FILTER_GENERAL, ">> Initialized %d DB2 data stores.", DB2FilesCount);
+    sLog->outInfo(LOG_FILTER_GENERAL, ">> Initialized %d DB2 data stores (%u used in place) in %u ms", DB2FilesCount, DB2InPlaceCount, GetMSTimeDiffToNow(oldMSTime));
 }
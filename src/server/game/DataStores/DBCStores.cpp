@@ -265,6 +265,7 @@ DBCStorage <PhaseEntry> sPhaseStores(PhaseEntryfmt);
 typedef std::list<std::string> StoreProblemList;
 
 uint32 DBCFileCount = 0;
+uint32 DBCInPlaceCount = 0;
 
 static bool LoadDBC_assert_print(uint32 fsize, uint32 rsize, const std::string& filename)
 {
@@ -288,6 +289,9 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
 
     if (storage.Load(dbcFilename.c_str(), sql))
     {
+        if (storage.IsDataInPlace())
+            ++DBCInPlaceCount;
+
         for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
         {
             if (!(availableDbcLocales & (1 << i)))
@@ -785,7 +789,7 @@ void LoadDBCStores(const std::string& dataPath)
         exit(1);
     }
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Initialized %d DBC data stores in %u ms", DBCFileCount, GetMSTimeDiffToNow(oldMSTime));
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Initialized %d DBC data stores (%u used in place) in %u ms", DBCFileCount, DBCInPlaceCount, GetMSTimeDiffToNow(oldMSTime));
 }
 
 const std::string* GetRandomCharacterName(uint8 race, uint8 gender)
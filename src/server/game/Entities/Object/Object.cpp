@@ -87,12 +87,16 @@ Object::Object() : m_PackGUID(sizeof(uint64)+1)
 
     m_inWorld           = false;
     m_objectUpdated     = false;
+    m_objectUpdateMap   = NULL;
 
     m_PackGUID.appendPackGUID(0);
 }
 
 WorldObject::~WorldObject()
 {
+    // objects deleted by a grid unload are still linked into their cell
+    RemoveFromSpatialIndex();
+
     // this may happen because there are many !create/delete
     if (IsWorldObject() && m_currMap)
     {
@@ -120,7 +124,7 @@ Object::~Object()
     {
         sLog->outFatal(LOG_FILTER_GENERAL, "Object::~Object - guid=" UI64FMTD ", typeid=%d, entry=%u deleted but still in update list!!", GetGUID(), GetTypeId(), GetEntry());
         //ASSERT(false);
-        sObjectAccessor->RemoveUpdateObject(this);
+        RemoveFromObjectUpdate();
     }
 
     delete [] m_uint32Values;
@@ -185,6 +189,25 @@ void Object::RemoveFromWorld()
     ClearUpdateMask(true);
 }
 
+void Object::AddToObjectUpdate()
+{
+    m_objectUpdateMap = GetObjectUpdateMap();
+    if (m_objectUpdateMap)
+        m_objectUpdateMap->AddUpdateObject(this);
+    else
+        sObjectAccessor->AddUpdateObject(this);
+}
+
+void Object::RemoveFromObjectUpdate()
+{
+    if (m_objectUpdateMap)
+        m_objectUpdateMap->RemoveUpdateObject(this);
+    else
+        sObjectAccessor->RemoveUpdateObject(this);
+
+    m_objectUpdateMap = NULL;
+}
+
 void Object::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target) const
 {
     if (!target)
@@ -431,9 +454,11 @@ void Object::ClearUpdateMask(bool remove)
                 _dynamicFields[i].ClearMask();
 
         if (remove)
-            sObjectAccessor->RemoveUpdateObject(this);
+            RemoveFromObjectUpdate();
 
+        // the update lists drop the object before building it, it is registered nowhere now
         m_objectUpdated = false;
+        m_objectUpdateMap = NULL;
     }
 }
 
@@ -536,7 +561,7 @@ void Object::SetInt32Value(uint16 index, int32 value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
+            AddToObjectUpdate();
             m_objectUpdated = true;
         }
     }
@@ -553,7 +578,7 @@ void Object::SetUInt32Value(uint16 index, uint32 value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
+            AddToObjectUpdate();
             m_objectUpdated = true;
         }
     }
@@ -587,7 +612,7 @@ void Object::SetUInt64Value(uint16 index, uint64 value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
+            AddToObjectUpdate();
             m_objectUpdated = true;
         }
     }
@@ -605,7 +630,7 @@ bool Object::AddUInt64Value(uint16 index, uint64 value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
+            AddToObjectUpdate();
             m_objectUpdated = true;
         }
 
@@ -627,7 +652,7 @@ bool Object::RemoveUInt64Value(uint16 index, uint64 value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
+            AddToObjectUpdate();
             m_objectUpdated = true;
         }
 
@@ -648,7 +673,7 @@ void Object::SetFloatValue(uint16 index, float value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
+            AddToObjectUpdate();
             m_objectUpdated = true;
         }
     }
@@ -672,7 +697,7 @@ void Object::SetByteValue(uint16 index, uint8 offset, uint8 value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
+            AddToObjectUpdate();
             m_objectUpdated = true;
         }
     }
@@ -696,7 +721,7 @@ void Object::SetUInt16Value(uint16 index, uint8 offset, uint16 value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
+            AddToObjectUpdate();
             m_objectUpdated = true;
         }
     }
@@ -763,7 +788,7 @@ void Object::SetFlag(uint16 index, uint32 newFlag)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
+            AddToObjectUpdate();
             m_objectUpdated = true;
         }
     }
@@ -778,7 +803,7 @@ void Object::SetFixedFlag(uint16 index, uint32 newFlag)
 
     if (m_inWorld && !m_objectUpdated)
     {
-        sObjectAccessor->AddUpdateObject(this);
+        AddToObjectUpdate();
         m_objectUpdated = true;
     }
 }
@@ -798,7 +823,7 @@ void Object::RemoveFlag(uint16 index, uint32 oldFlag)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
+            AddToObjectUpdate();
             m_objectUpdated = true;
         }
     }
@@ -821,7 +846,7 @@ void Object::SetByteFlag(uint16 index, uint8 offset, uint8 newFlag)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
+            AddToObjectUpdate();
             m_objectUpdated = true;
         }
     }
@@ -844,7 +869,7 @@ void Object::RemoveByteFlag(uint16 index, uint8 offset, uint8 oldFlag)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
+            AddToObjectUpdate();
             m_objectUpdated = true;
         }
     }
@@ -863,7 +888,7 @@ void Object::SetDynamicUInt32Value(uint32 tab, uint16 index, uint32 value)
 
         if (m_inWorld && !m_objectUpdated)
         {
-            sObjectAccessor->AddUpdateObject(this);
+            AddToObjectUpdate();
             m_objectUpdated = true;
         }
     }
@@ -880,7 +905,7 @@ bool Object::PrintIndexError(uint32 index, bool set) const
 WorldObject::WorldObject(bool isWorldObject): WorldLocation(),
 m_name(""), m_isActive(false), m_isWorldObject(isWorldObject), m_zoneScript(NULL),
 m_transport(NULL), m_currMap(NULL), m_InstanceId(0),
-m_phaseMask(PHASEMASK_NORMAL)
+m_phaseMask(PHASEMASK_NORMAL), m_spatialIndex(NULL), m_spatialSlot(0)
 , m_explicitSeerGuid()
 {
     m_serverSideVisibility.SetValue(SERVERSIDE_VISIBILITY_GHOST, GHOST_VISIBILITY_ALIVE | GHOST_VISIBILITY_GHOST);
@@ -1300,7 +1325,7 @@ void Object::ForceValuesUpdateAtIndex(uint32 i)
     _changedFields[i] = true;
     if (m_inWorld && !m_objectUpdated)
     {
-        sObjectAccessor->AddUpdateObject(this);
+        AddToObjectUpdate();
         m_objectUpdated = true;
     }
 }
@@ -1550,6 +1575,11 @@ void WorldObject::ResetMap()
     ASSERT(!IsInWorld());
     if (IsWorldObject())
         m_currMap->RemoveWorldObject(this);
+
+    // never leave the object in the update list of a map it left, the map may be unloaded before the next update
+    if (m_objectUpdated)
+        RemoveFromObjectUpdate();
+
     m_currMap = NULL;
     //maybe not for corpse
     //m_mapId = 0;
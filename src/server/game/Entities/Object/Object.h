@@ -26,6 +26,7 @@
 #include "ObjectDefines.h"
 #include "ObjectMovement.h"
 #include "GridDefines.h"
+#include "CellSpatialIndex.h"
 #include "Map.h"
 #include <set>
 #include <string>
@@ -382,6 +383,11 @@ class Object
         virtual void BuildUpdate(UpdateDataMapType&) {}
         void BuildFieldsUpdate(Player*, UpdateDataMapType &) const;
 
+        // map whose update list sends the changes of this object, NULL for the global list of ObjectAccessor
+        virtual Map* GetObjectUpdateMap() const { return NULL; }
+        void AddToObjectUpdate();
+        void RemoveFromObjectUpdate();
+
         void SetFieldNotifyFlag(uint16 flag) { _fieldNotifyFlags |= flag; }
         void RemoveFieldNotifyFlag(uint16 flag) { _fieldNotifyFlags &= ~flag; }
 
@@ -444,6 +450,7 @@ class Object
         uint16 _fieldNotifyFlags;
 
         bool m_objectUpdated;
+        Map* m_objectUpdateMap;                             // update list the object is registered in
 
         DynamicFields* _dynamicFields;
         uint32 _dynamicTabCount;
@@ -481,7 +488,7 @@ class GridObject
     public:
         bool IsInGrid() const { return _gridRef.isValid(); }
         void AddToGrid(GridRefManager<T>& m) { ASSERT(!IsInGrid()); _gridRef.link(&m, (T*)this); }
-        void RemoveFromGrid() { ASSERT(IsInGrid()); _gridRef.unlink(); }
+        void RemoveFromGrid() { ASSERT(IsInGrid()); _gridRef.unlink(); ((T*)this)->RemoveFromSpatialIndex(); }
     private:
         GridReference<T> _gridRef;
 };
@@ -669,6 +676,7 @@ class WorldObject : public Object, public WorldLocation
         virtual void ResetMap();
         Map* GetMap() const  { return m_currMap; }
         Map* FindMap() const { return m_currMap; }
+        Map* GetObjectUpdateMap() const { return m_currMap; }
         //used to check all object's GetMap() calls when object is not in world!
 
         //this function should be removed in nearest time...
@@ -723,6 +731,10 @@ class WorldObject : public Object, public WorldLocation
         bool IsPermanentWorldObject() const { return m_isWorldObject; }
         bool IsWorldObject() const;
 
+        // Position stored in the spatial index of the grid cell, refreshed whenever the map moves the object
+        void UpdateSpatialIndex() { if (m_spatialIndex) m_spatialIndex->Update(this); }
+        void RemoveFromSpatialIndex() { if (m_spatialIndex) m_spatialIndex->Remove(this); }
+
         template<class NOTIFIER> void VisitNearbyObject(const float &radius, NOTIFIER &notifier, bool loadGrids = false) const { if (IsInWorld()) GetMap()->VisitAll(GetPositionX(), GetPositionY(), radius, notifier, loadGrids); }
         template<class NOTIFIER> void VisitNearbyGridObject(const float &radius, NOTIFIER &notifier, bool loadGrids = false) const { if (IsInWorld()) GetMap()->VisitGrid(GetPositionX(), GetPositionY(), radius, notifier, loadGrids); }
         template<class NOTIFIER> void VisitNearbyWorldObject(const float &radius, NOTIFIER &notifier, bool loadGrids = false) const { if (IsInWorld()) GetMap()->VisitWorld(GetPositionX(), GetPositionY(), radius, notifier, loadGrids); }
@@ -791,6 +803,10 @@ class WorldObject : public Object, public WorldLocation
         uint32 m_InstanceId;                                // in map copy with instance id
         uint32 m_phaseMask;                                 // in area phase state
 
+        friend class CellSpatialIndex;
+        CellSpatialIndex* m_spatialIndex;                   // index of the grid cell the object is linked into
+        uint32 m_spatialSlot;
+
         std::list<uint64/* guid*/> _visibilityPlayerList;
 
         bool CanNeverSee(WorldObject const* obj) const { return GetMap() != obj->GetMap() || !InSamePhase(obj); }
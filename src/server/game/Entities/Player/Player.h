@@ -43,6 +43,7 @@
 #include "PhaseMgr.h"
 #include "CUFProfiles.h"
 #include "SpellChargesTracker.h"
+#include "SavedRowCache.h"
 
 // for template
 #include "SpellMgr.h"
@@ -211,6 +212,49 @@ struct SpellCooldown
 typedef std::map<uint32, SpellCooldown> SpellCooldowns;
 typedef ACE_Based::LockedMap<uint32 /*instanceId*/, time_t/*releaseTime*/> InstanceTimeMap;
 
+// primary key of a character_aura row
+struct SavedAuraKey
+{
+    uint64 casterGuid;
+    uint64 itemGuid;
+    uint32 spellId;
+    uint8 effectMask;
+
+    bool operator<(SavedAuraKey const& right) const
+    {
+        if (casterGuid != right.casterGuid)
+            return casterGuid < right.casterGuid;
+        if (itemGuid != right.itemGuid)
+            return itemGuid < right.itemGuid;
+        if (spellId != right.spellId)
+            return spellId < right.spellId;
+        return effectMask < right.effectMask;
+    }
+};
+
+struct SavedAura
+{
+    uint8 slot;
+    uint8 recalculateMask;
+    uint8 stackAmount;
+    int32 maxDuration;
+    int32 duration;
+    uint8 charges;
+
+    bool operator==(SavedAura const& right) const
+    {
+        return slot == right.slot && recalculateMask == right.recalculateMask && stackAmount == right.stackAmount &&
+            maxDuration == right.maxDuration && duration == right.duration && charges == right.charges;
+    }
+};
+
+typedef MoPCore::SavedRowCache<SavedAuraKey, SavedAura> SavedAuraCache;
+typedef MoPCore::SavedRowCache<std::pair<uint8 /*slot*/, uint8 /*effect*/>, std::pair<int32 /*baseamount*/, int32 /*amount*/> > SavedAuraEffectCache;
+typedef MoPCore::SavedRowCache<uint32 /*spell*/, std::pair<uint16 /*item*/, uint64 /*time*/> > SavedSpellCooldownCache;
+typedef MoPCore::SavedRowCache<uint8 /*spec*/, std::vector<uint16> /*glyphs*/> SavedGlyphCache;
+typedef MoPCore::SavedRowCache<std::string /*name*/, std::string /*data*/> SavedCUFProfileCache;
+typedef MoPCore::SavedRowCache<uint8 /*always 0*/, std::vector<uint32> /*raw column values*/> SavedStatsCache;
+
 enum TrainerSpellState
 {
     TRAINER_SPELL_GRAY           = 0,
@@ -915,6 +959,8 @@ enum PlayerLoginQueryIndex
     PLAYER_LOGIN_QUERY_LOADCURRENCY                 = 39,
     PLAYER_LOGIN_QUERY_LOAD_CUF_PROFILES            = 40,
     PLAYER_LOGIN_QUERY_LOAD_ARCHAEOLOGY             = 41,
+    PLAYER_LOGIN_QUERY_LOAD_WEEKLY_BOSS_KILLS       = 42,
+    PLAYER_LOGIN_QUERY_LOAD_DYNAMIC_DIFFICULTY_MAPS = 43,
 
     MAX_PLAYER_LOGIN_QUERY
 };
@@ -1810,6 +1856,7 @@ class Player : public Unit, public GridObject<Player>
 
         bool m_mailsLoaded;
         bool m_mailsUpdated;
+        std::list<std::function<void()> > m_mailLoadWaiters;  // called once the mails are loaded, not empty while they load
 
         void SetBindPoint(uint64 guid);
         void SendTalentWipeConfirm(uint64 guid, bool specializaion);
@@ -1864,6 +1911,8 @@ class Player : public Unit, public GridObject<Player>
         void UpdateNextMailTimeAndUnreads();
         void AddNewMailDeliverTime(time_t deliver_time);
         bool IsMailsLoaded() const { return m_mailsLoaded; }
+        // Loads the mails and their items without blocking the map thread, then calls next; right away if they are loaded already
+        void LoadMail(std::function<void()> next);
 
         void RemoveMail(uint32 id);
 
@@ -3150,8 +3199,8 @@ class Player : public Unit, public GridObject<Player>
         void _LoadInventory(PreparedQueryResult result, uint32 timeDiff);
         void _LoadVoidStorage(PreparedQueryResult result);
         void _LoadMailInit(PreparedQueryResult resultUnread, PreparedQueryResult resultDelivery);
-        void _LoadMail();
-        void _LoadMailedItems(Mail* mail);
+        void _LoadMail(PreparedQueryResult mailResult, PreparedQueryResult itemResult);
+        void _LoadMailedItem(Mail* mail, Field* fields);
         void _LoadQuestStatus(PreparedQueryResult result);
         void _LoadQuestStatusRewarded(PreparedQueryResult result);
         void _LoadDailyQuestStatus(PreparedQueryResult result);
@@ -3159,6 +3208,8 @@ class Player : public Unit, public GridObject<Player>
         void _LoadMonthlyQuestStatus(PreparedQueryResult result);
         void _LoadSeasonalQuestStatus(PreparedQueryResult result);
         void _LoadRandomBGStatus(PreparedQueryResult result);
+        void _LoadWeeklyBossKills(PreparedQueryResult result);
+        void _LoadDynamicDifficultyMaps(PreparedQueryResult result);
         void _LoadWeekendBGStatus(PreparedQueryResult result);
         void _LoadGroup(PreparedQueryResult result);
         void _LoadSkills(PreparedQueryResult result);
@@ -3231,6 +3282,18 @@ class Player : public Unit, public GridObject<Player>
 
         bool isOnDynamicDifficultyMap;
 
+        // character_weekly_boss_kills and character_dynamic_difficulty_maps, kept here so looting and map entry do not query them
+        struct WeeklyBossKill
+        {
+            uint32 entry;
+            uint32 mapId;
+            uint32 difficulty;
+            bool looted;
+        };
+        typedef std::vector<WeeklyBossKill> WeeklyBossKillList;
+        WeeklyBossKillList m_weeklyBossKills;
+        std::set<uint32> m_dynamicDifficultyMaps;
+
         uint32 m_atLoginFlags;
 
         Item* m_items[PLAYER_SLOTS_COUNT];
@@ -3498,6 +3561,14 @@ class Player : public Unit, public GridObject<Player>
         uint32 m_SeasonGames[MAX_PVP_SLOT];
         
         CUFProfiles m_cufProfiles;
+
+        // last saved content of the tables that have no per row update state, see SavedRowCache
+        SavedAuraCache m_savedAuras;
+        SavedAuraEffectCache m_savedAuraEffects;
+        SavedSpellCooldownCache m_savedSpellCooldowns;
+        SavedGlyphCache m_savedGlyphs;
+        SavedCUFProfileCache m_savedCUFProfiles;
+        SavedStatsCache m_savedStats;
 };
 
 void AddItemsSetItem(Player*player, Item* item);
@@ -87,228 +87,20 @@
 
 void Player::ReadMovementInfo(WorldPacket& data, MovementInfo* mi, ExtraMovementStatusElement* extras)
 {
-    bool hasTransportData = false;
-    bool hasSpline = false;
-
-    uint32 bitcounterLoop = 0;
-
-    MovementStatusElements const* sequence = GetMovementStatusElementsSequence(data.GetOpcode());
-    if (sequence == NULL)
+    MovementCodec const* codec = GetMovementCodec(data.GetOpcode());
+    if (codec == NULL)
     {
         sLog->outError(LOG_FILTER_NETWORKIO, "WorldSession::ReadMovementInfo: No movement sequence found for opcode 0x%04X", uint32(data.GetOpcode()));
         return;
     }
 
-    ObjectGuid guid;
-    ObjectGuid tguid;
-
-    for (; *sequence != MSEEnd; ++sequence)
-    {
-        MovementStatusElements const& element = *sequence;
-        if (element == MSEEnd)
-            break;
-
-        if (element >= MSEHasGuidByte0 && element <= MSEHasGuidByte7)
-        {
-            guid[element - MSEHasGuidByte0] = data.ReadBit();
-            continue;
-        }
-
-        if (element >= MSEHasTransportGuidByte0 &&
-            element <= MSEHasTransportGuidByte7)
-        {
-            if (hasTransportData)
-                tguid[element - MSEHasTransportGuidByte0] = data.ReadBit();
-            continue;
-        }
-
-        if (element >= MSEGuidByte0 && element <= MSEGuidByte7)
-        {
-            data.ReadByteSeq(guid[element - MSEGuidByte0]);
-            continue;
-        }
-
-        if (element >= MSETransportGuidByte0 &&
-            element <= MSETransportGuidByte7)
-        {
-            if (hasTransportData)
-                data.ReadByteSeq(tguid[element - MSETransportGuidByte0]);
-            continue;
-        }
-
-        if (element >= MSEGenericDword0 &&
-            element <= MSEGenericDword7)
-        {
-            data.read_skip<uint32>();
-            continue;
-        }
-
-        switch (element)
-        {
-            case MSEExtraElement:
-                extras->ReadNextElement(data);
-                break;
-            case MSEGeneric2bits0:
-                data.ReadBits(2);
-                break;
-            case MSEUnkUIntCount:
-                bitcounterLoop = data.ReadBits(22);
-                break;
-            case MSEUnkUIntLoop:
-				for (int i = 0; i != bitcounterLoop; i++)
-					data.read_skip<uint32>();
-                break;
-            case MSEFlushBits:
-                data.FlushBits();
-                break;
-            case MSEHasMovementFlags:
-                mi->flags = !data.ReadBit();
-                break;
-            case MSEHasMovementFlags2:
-                mi->flags2 = !data.ReadBit();
-                break;
-            case MSEHasTimestamp:
-                mi->time = !data.ReadBit();
-                break;
-            case MSEHasOrientation:
-                mi->pos.m_orientation = !data.ReadBit() ? 1.0f : 0.0f;
-                break;
-            case MSEHasTransportData:
-                hasTransportData = data.ReadBit();
-                break;
-            case MSEHasTransportTime2:
-                if (hasTransportData)
-                    mi->has_t_time2 = data.ReadBit();
-                break;
-            case MSEHasTransportTime3:
-                if (hasTransportData)
-                    mi->has_t_time3 = data.ReadBit();
-                break;
-            case MSEHasPitch:
-                mi->HavePitch = !data.ReadBit();
-                break;
-            case MSEHasFallData:
-                mi->hasFallData = data.ReadBit();
-                break;
-            case MSEHasFallDirection:
-                if (mi->hasFallData)
-                    mi->hasFallDirection = data.ReadBit();
-                break;
-            case MSEHasSplineElevation:
-                mi->HaveSplineElevation = !data.ReadBit();
-                break;
-            case MSEHasSpline:
-                hasSpline = data.ReadBit();
-                break;
-            case MSEMovementFlags:
-                if (mi->flags)
-                    mi->flags = data.ReadBits(30);
-                break;
-            case MSEMovementFlags2:
-                if (mi->flags2)
-                    mi->flags2 = data.ReadBits(13);
-                break;
-            case MSETimestamp:
-                if (mi->time)
-                    data >> mi->time;
-                break;
-            case MSEPositionX:
-                data >> mi->pos.m_positionX;
-                break;
-            case MSEPositionY:
-                data >> mi->pos.m_positionY;
-                break;
-            case MSEPositionZ:
-                data >> mi->pos.m_positionZ;
-                break;
-            case MSEOrientation:
-                if (mi->pos.m_orientation != 0.0f)
-                    mi->pos.SetOrientation(data.read<float>());
-                break;
-            case MSETransportPositionX:
-                if (hasTransportData)
-                    data >> mi->t_pos.m_positionX;
-                break;
-            case MSETransportPositionY:
-                if (hasTransportData)
-                    data >> mi->t_pos.m_positionY;
-                break;
-            case MSETransportPositionZ:
-                if (hasTransportData)
-                    data >> mi->t_pos.m_positionZ;
-                break;
-            case MSETransportOrientation:
-                if (hasTransportData)
-                    mi->t_pos.SetOrientation(data.read<float>());
-                break;
-            case MSETransportSeat:
-                if (hasTransportData)
-                    data >> mi->t_seat;
-                break;
-            case MSETransportTime:
-                if (hasTransportData)
-                    data >> mi->t_time;
-                break;
-            case MSETransportTime2:
-                if (hasTransportData && mi->has_t_time2)
-                    data >> mi->t_time2;
-                break;
-            case MSETransportTime3:
-                if (hasTransportData && mi->has_t_time3)
-                    data >> mi->t_time3;
-                break;
-            case MSEPitch:
-                if (mi->HavePitch)
-                    data >> mi->pitch;
-                break;
-            case MSEFallTime:
-                if (mi->hasFallData)
-                    data >> mi->fallTime;
-                break;
-            case MSEFallVerticalSpeed:
-                if (mi->hasFallData)
-                    data >> mi->j_zspeed;
-                break;
-            case MSEFallCosAngle:
-                if (mi->hasFallData && mi->hasFallDirection)
-                    data >> mi->j_cosAngle;
-                break;
-            case MSEFallSinAngle:
-                if (mi->hasFallData && mi->hasFallDirection)
-                    data >> mi->j_sinAngle;
-                break;
-            case MSEFallHorizontalSpeed:
-                if (mi->hasFallData && mi->hasFallDirection)
-                    data >> mi->j_xyspeed;
-                break;
-            case MSESplineElevation:
-                if (mi->HaveSplineElevation)
-                    data >> mi->splineElevation;
-                break;
-            case MSEZeroBit:
-            case MSEOneBit:
-                data.ReadBit();
-                break;
-            case MSEHasUnkTime:
-                mi->Alive32 = !data.ReadBit();
-                break;
-            case MSEUnkTime:
-                if (mi->Alive32)
-                    data >> mi->Alive32;
-                break;
-            case MSECounter:
-                data.read_skip<uint32>();
-                break;
-            default:
-                ASSERT(false && "Incorrect sequence element detected at ReadMovementInfo");
-                break;
-        }
-    }
+    MovementReadState state(mi, extras);
+    codec->Read(data, state);
 
-    mi->guid = guid;
-    mi->t_guid = tguid;
+    mi->guid = state.guid;
+    mi->t_guid = state.tguid;
 
-    if (hasTransportData && mi->pos.m_positionX != mi->t_pos.m_positionX)
+    if (state.hasTransportData && mi->pos.m_positionX != mi->t_pos.m_positionX)
        if (GetTransport())
            GetTransport()->UpdatePosition(mi);
 }
@@ -365,7 +157,7 @@ void Player::HandleFall(MovementInfo const& movementInfo)
             }
 
             // Z given by moveinfo, LastZ, FallTime, WaterZ, MapZ, Damage, Safefall reduction.
-            sLog->outDebug(LOG_FILTER_PLAYER, "FALLDAMAGE z = %f sz = %f pZ = %f FallTime = %d mZ = %f damage = %d SF = %d", movementInfo.pos.GetPositionZ(), height, GetPositionZ(), movementInfo.fallTime, height, damage, safe_fall);
+            TC_LOG_DEBUG(LOG_FILTER_PLAYER, "FALLDAMAGE z = %f sz = %f pZ = %f FallTime = %d mZ = %f damage = %d SF = %d", movementInfo.pos.GetPositionZ(), height, GetPositionZ(), movementInfo.fallTime, height, damage, safe_fall);
         }
     }
 
@@ -496,7 +288,7 @@ bool Player::TeleportTo(uint32 mapid, float x, float y, float z, float orientati
     // client without expansion support
     if (GetSession()->Expansion() < mEntry->Expansion())
     {
-        sLog->outDebug(LOG_FILTER_MAPS, "Player %s using client without required expansion tried teleport to non accessible map %u", GetName(), mapid);
+        TC_LOG_DEBUG(LOG_FILTER_MAPS, "Player %s using client without required expansion tried teleport to non accessible map %u", GetName(), mapid);
 
         if (GetTransport())
         {
@@ -513,7 +305,7 @@ bool Player::TeleportTo(uint32 mapid, float x, float y, float z, float orientati
         return false;                                       // normal client can't teleport to this map...
     }
     else
-        sLog->outDebug(LOG_FILTER_MAPS, "Player %s is being teleported to map %u", GetName(), mapid);
+        TC_LOG_DEBUG(LOG_FILTER_MAPS, "Player %s is being teleported to map %u", GetName(), mapid);
 
     if (m_vehicle)
         ExitVehicle();
@@ -0,0 +1,101 @@
+#ifndef MoPCore_GAME_SAVED_ROW_CACHE_H
+#define MoPCore_GAME_SAVED_ROW_CACHE_H
+
+#include "DatabaseEnv.h"
+
+#include <deque>
+#include <map>
+#include <vector>
+
+namespace MoPCore
+{
+    // Remembers the rows last committed to one character table, keyed like the table's primary key,
+    // so a save only has to touch the rows that were added, changed or removed since then.
+    // The rows of a save only become the saved state once its transaction committed: a save built
+    // meanwhile diffs against the older state and writes a superset, a failed commit is forgotten.
+    template <typename Key, typename Row>
+    class SavedRowCache final
+    {
+        public:
+            typedef std::map<Key, Row> RowMap;
+
+            SavedRowCache() : synced_(false) { }
+
+            // false until a complete rewrite of the table was committed, until then its content is unknown
+            bool synced()
+            {
+                settle();
+                return synced_;
+            }
+
+            // makes the next save rewrite the whole table again
+            void reset()
+            {
+                rows_.clear();
+                pending_.clear();
+                synced_ = false;
+            }
+
+            // collects the keys that have to be deleted and the keys that have to be written to reach `current`
+            void diff(RowMap const& current, std::vector<Key>& removed, std::vector<Key>& changed);
+
+            // takes `current` over as the rows written by `trans`, they become the saved state when it commits;
+            // leaves `current` with unspecified content
+            void store(RowMap& current, SQLTransaction& trans)
+            {
+                pending_.push_back(PendingRows(trans->GetResult()));
+                pending_.back().rows.swap(current);
+            }
+
+        private:
+            struct PendingRows
+            {
+                explicit PendingRows(SQLTransactionResult const& commitResult) : result(commitResult) { }
+
+                SQLTransactionResult result;
+                RowMap rows;
+            };
+
+            // moves the rows of the finished transactions over, they finish in the order they were committed
+            void settle()
+            {
+                while (!pending_.empty())
+                {
+                    TransactionResult::State state = pending_.front().result->GetState();
+                    if (state == TransactionResult::TRANSACTION_PENDING)
+                        break;
+
+                    if (state == TransactionResult::TRANSACTION_COMMITTED)
+                    {
+                        rows_.swap(pending_.front().rows);
+                        synced_ = true;
+                    }
+
+                    pending_.pop_front();
+                }
+            }
+
+            RowMap rows_;
+            std::deque<PendingRows> pending_;
+            bool synced_;
+    };
+
+    template <typename Key, typename Row>
+    void SavedRowCache<Key, Row>::diff(RowMap const& current, std::vector<Key>& removed, std::vector<Key>& changed)
+    {
+        settle();
+
+        for (auto const& row : rows_)
+            if (current.find(row.first) == current.end())
+                removed.push_back(row.first);
+
+        for (auto const& row : current)
+        {
+            auto const saved = rows_.find(row.first);
+            if (saved == rows_.end() || !(saved->second == row.second))
+                changed.push_back(row.first);
+        }
+    }
+} // namespace MoPCore
+
+#endif // MoPCore_GAME_SAVED_ROW_CACHE_H
@@ -207,6 +207,8 @@ Unit::Unit(bool isWorldObject): WorldObject(isWorldObject)
         m_currentSpells[i] = NULL;
 
     m_addDmgOnce = 0;
+    m_procAuraFlags = 0;
+    m_healDamage = NULL;
 
     for (uint8 i = 0; i < MAX_SUMMON_SLOT; ++i)
         m_SummonSlot[i] = 0;
@@ -337,7 +339,7 @@ Unit::~Unit()
 
     _DeleteRemovedAuras();
 
-    m_healDamage.clear();
+    delete m_healDamage;
 
     delete i_motionMaster;
     delete m_charmInfo;
@@ -368,16 +370,10 @@ void Unit::Update(uint32 p_time)
 
     _UpdateSpells(p_time);
 
-    for (HealDamageLogList::iterator itr = m_healDamage.begin(); itr != m_healDamage.end();)
+    if (m_healDamage && m_healDamage->IsExpired(getMSTime()))
     {
-        auto ptr = *itr;
-
-        if ((getMSTime() - ptr.m_time) > 60 * IN_MILLISECONDS)
-        {
-            itr = m_healDamage.erase(itr);
-        }
-        else
-            ++itr;
+        delete m_healDamage;
+        m_healDamage = NULL;
     }
 
     // If this is set during update SetCantProc(false) call is missing somewhere in the code
@@ -537,11 +533,9 @@ void Unit::DealDamageMods(Unit* victim, uint32 &damage, uint32* absorb)
 
 uint32 Unit::DealDamage(Unit* victim, uint32 damage, CleanDamage const* cleanDamage, DamageEffectType damagetype, SpellSchoolMask damageSchoolMask, SpellInfo const* spellProto, bool durabilityLoss)
 {
-    HealDamageLog dmgTaken(damage, getMSTime(), DAMAGE_TAKE_LOG);
-    victim->AddHealDamageLog(dmgTaken);
-
-    HealDamageLog dmgDone(damage, getMSTime(), DAMAGE_DONE_LOG);
-    AddHealDamageLog(dmgDone);
+    ASSERT(Map::IsRegionLocal(victim));
+    victim->AddHealDamageLog(DAMAGE_TAKE_LOG, damage);
+    AddHealDamageLog(DAMAGE_DONE_LOG, damage);
 
     // Log damage > 1 000 000 on worldboss
     if (damage > 1000000 && GetTypeId() == TYPEID_PLAYER && victim->GetTypeId() == TYPEID_UNIT && victim->ToCreature()->GetCreatureTemplate()->rank)
@@ -2447,7 +2441,7 @@ MeleeHitOutcome Unit::RollMeleeOutcomeAgainst(const Unit* victim, WeaponAttackTy
     // only players can't dodge if attacker is behind
     if (victim->GetTypeId() == TYPEID_PLAYER && !victim->HasInArc(M_PI, this) && !victim->HasAuraType(SPELL_AURA_IGNORE_HIT_DIRECTION))
     {
-        //sLog->outDebug(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: attack came from behind and victim was a player.");
+        //TC_LOG_DEBUG(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: attack came from behind and victim was a player.");
     }
     else
     {
@@ -2472,7 +2466,7 @@ MeleeHitOutcome Unit::RollMeleeOutcomeAgainst(const Unit* victim, WeaponAttackTy
             && ((tmp -= skillBonus) > 0)
             && roll < (sum += tmp))
         {
-            //sLog->outDebug(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: DODGE <%d, %d)", sum-tmp, sum);
+            //TC_LOG_DEBUG(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: DODGE <%d, %d)", sum-tmp, sum);
             return MELEE_HIT_DODGE;
         }
     }
@@ -2481,7 +2475,7 @@ MeleeHitOutcome Unit::RollMeleeOutcomeAgainst(const Unit* victim, WeaponAttackTy
     // check if attack comes from behind, nobody can parry or block if attacker is behind
     if (!victim->HasInArc(M_PI, this) && !victim->HasAuraType(SPELL_AURA_IGNORE_HIT_DIRECTION))
     {
-        //sLog->outDebug(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: attack came from behind.");
+        //TC_LOG_DEBUG(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: attack came from behind.");
     }
     else
     {
@@ -2504,7 +2498,7 @@ MeleeHitOutcome Unit::RollMeleeOutcomeAgainst(const Unit* victim, WeaponAttackTy
                 int32 tmp2 = int32(parry_chance);
                 if (tmp2 > 0 && (tmp2 -= skillBonus) > 0 && roll < (sum += tmp2)) // check if unit _can_ parry
                 {
-                    //sLog->outDebug(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: PARRY <%d, %d)", sum - tmp2, sum);
+                    //TC_LOG_DEBUG(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: PARRY <%d, %d)", sum - tmp2, sum);
                     return MELEE_HIT_PARRY;
                 }
             }
@@ -2517,7 +2511,7 @@ MeleeHitOutcome Unit::RollMeleeOutcomeAgainst(const Unit* victim, WeaponAttackTy
                 && (tmp -= skillBonus) > 0
                 && roll < (sum += tmp))
             {
-                //sLog->outDebug(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: BLOCK <%d, %d)", sum-tmp, sum);
+                //TC_LOG_DEBUG(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: BLOCK <%d, %d)", sum-tmp, sum);
                 return MELEE_HIT_BLOCK;
             }
         }
@@ -2528,10 +2522,10 @@ MeleeHitOutcome Unit::RollMeleeOutcomeAgainst(const Unit* victim, WeaponAttackTy
 
     if (tmp > 0 && roll < (sum += tmp))
     {
-        //sLog->outDebug(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: CRIT <%d, %d)", sum - tmp, sum);
+        //TC_LOG_DEBUG(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: CRIT <%d, %d)", sum - tmp, sum);
         if (GetTypeId() == TYPEID_UNIT && (ToCreature()->GetCreatureTemplate()->flags_extra & CREATURE_FLAG_EXTRA_NO_CRIT))
 		{
-            //sLog->outDebug(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: CRIT DISABLED)");
+            //TC_LOG_DEBUG(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: CRIT DISABLED)");
 		}
         else return MELEE_HIT_CRIT;
     }
@@ -2549,7 +2543,7 @@ MeleeHitOutcome Unit::RollMeleeOutcomeAgainst(const Unit* victim, WeaponAttackTy
 
         tmp = victimMaxSkillValueForLevel;
         {
-            //sLog->outDebug(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: GLANCING <%d, %d)", sum-4000, sum);
+            //TC_LOG_DEBUG(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: GLANCING <%d, %d)", sum-4000, sum);
             return MELEE_HIT_GLANCING;
         }
     }
@@ -2570,13 +2564,13 @@ MeleeHitOutcome Unit::RollMeleeOutcomeAgainst(const Unit* victim, WeaponAttackTy
             tmp = tmp * 200 - 1500;
             if (roll < (sum += tmp))
             {
-                //sLog->outDebug(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: CRUSHING <%d, %d)", sum-tmp, sum);
+                //TC_LOG_DEBUG(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: CRUSHING <%d, %d)", sum-tmp, sum);
                 return MELEE_HIT_CRUSHING;
             }
         }
     }
 
-    //sLog->outDebug(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: NORMAL");
+    //TC_LOG_DEBUG(LOG_FILTER_UNITS, "RollMeleeOutcomeAgainst: NORMAL");
     return MELEE_HIT_NORMAL;
 }
 
@@ -3455,7 +3449,7 @@ void Unit::InterruptSpell(CurrentSpellTypes spellType, bool withDelayed, bool wi
 {
     ASSERT(spellType < CURRENT_MAX_SPELL);
 
-    //sLog->outDebug(LOG_FILTER_UNITS, "Interrupt spell for unit %u.", GetEntry());
+    //TC_LOG_DEBUG(LOG_FILTER_UNITS, "Interrupt spell for unit %u.", GetEntry());
     Spell* spell = m_currentSpells[spellType];
     if (spell
         && (withDelayed || spell->getState() != SPELL_STATE_DELAYED)
@@ -3717,6 +3711,7 @@ AuraPtr Unit::_TryStackingOrRefreshingExistingAura(SpellInfo const* newAura, uin
 void Unit::_AddAura(UnitAuraPtr aura, Unit* caster)
 {
     ASSERT(!m_cleanupDone);
+    ASSERT(Map::IsRegionLocal(this));
     m_ownedAuras.insert(AuraMap::value_type(aura->GetId(), aura));
 
     _RemoveNoStackAurasDueToAura(aura);
@@ -3771,6 +3766,21 @@ AuraApplication * Unit::_CreateAuraApplication(AuraPtr aura, uint32 effMask)
     AuraApplication * aurApp = new AuraApplication(this, caster, AuraPtr(aura), effMask);
     m_appliedAuras.insert(AuraApplicationMap::value_type(aurId, aurApp));
 
+    if (uint32 procFlags = GetAuraProcFlags(aurSpellInfo))
+    {
+        // after the applications of the same spell, like the multimap insert
+        ProcAuraIndex::iterator itr = m_procAuras.begin();
+        while (itr != m_procAuras.end() && itr->spellId <= aurId)
+            ++itr;
+
+        ProcAuraEntry entry;
+        entry.spellId = aurId;
+        entry.procFlags = procFlags;
+        entry.aurApp = aurApp;
+        m_procAuras.insert(itr, entry);
+        m_procAuraFlags |= procFlags;
+    }
+
     if (aurSpellInfo->AuraInterruptFlags)
     {
         m_interruptableAuras.push_back(aurApp);
@@ -3868,6 +3878,19 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator &i, AuraRemoveMode removeMo
     // Remove all pointers from lists here to prevent possible pointer invalidation on spellcast/auraapply/auraremove
     m_appliedAuras.erase(i);
 
+    for (ProcAuraIndex::iterator itr = m_procAuras.begin(); itr != m_procAuras.end(); ++itr)
+    {
+        if (itr->aurApp == aurApp)
+        {
+            m_procAuras.erase(itr);
+
+            m_procAuraFlags = 0;
+            for (ProcAuraIndex::const_iterator itr2 = m_procAuras.begin(); itr2 != m_procAuras.end(); ++itr2)
+                m_procAuraFlags |= itr2->procFlags;
+            break;
+        }
+    }
+
     if (aura->GetSpellInfo()->AuraInterruptFlags)
     {
         m_interruptableAuras.remove(aurApp);
@@ -12280,13 +12303,11 @@ void Unit::SetCharm(Unit* charm, bool apply)
 
 int32 Unit::DealHeal(Unit* victim, uint32 addhealth, SpellInfo const* spellProto)
 {
+    ASSERT(Map::IsRegionLocal(victim));
     int32 gain = 0;
 
-    HealDamageLog healTaken(addhealth, getMSTime(), HEAL_TAKE_LOG);
-    AddHealDamageLog(healTaken);
-
-    HealDamageLog healDone (addhealth, getMSTime(), HEAL_DONE_LOG);
-    AddHealDamageLog(healDone);
+    AddHealDamageLog(HEAL_TAKE_LOG, addhealth);
+    AddHealDamageLog(HEAL_DONE_LOG, addhealth);
 
     if (victim->IsAIEnabled)
         victim->GetAI()->HealReceived(this, addhealth);
@@ -15663,7 +15684,10 @@ void Unit::setDeathState(DeathState s)
 
         // players in instance don't have ZoneScript, but they have InstanceScript
         if (ZoneScript* zoneScript = GetZoneScript() ? GetZoneScript() : (ZoneScript*)GetInstanceScript())
+        {
+            MapRegionSerialGuard guard(FindMap());
             zoneScript->OnUnitDeath(this);
+        }
 
         if (isPet())
         {
@@ -17291,6 +17315,42 @@ bool Unit::isFrozen() const
     return HasAuraState(AURA_STATE_FROZEN);
 }
 
+uint32 Unit::GetAuraProcFlags(SpellInfo const* spellInfo)
+{
+    // handled by the new proc system, see IsTriggeredAtSpellProcEvent
+    if (sSpellMgr->GetSpellProcEntry(spellInfo->Id))
+        return 0;
+
+    uint32 procFlags = spellInfo->ProcFlags;
+    if (SpellProcEventEntry const* spellProcEvent = sSpellMgr->GetSpellProcEvent(spellInfo->Id))
+        if (spellProcEvent->procFlags)
+            procFlags = spellProcEvent->procFlags;
+
+    if (!procFlags)
+        return 0;
+
+    switch (spellInfo->Id)
+    {
+        // triggered by specific spells whatever the event flags, see IsTriggeredAtSpellProcEvent
+        case 117896:                                        // Backdraft
+        case 44448:                                         // Pyroblast!
+        case 121152:                                        // Blindside
+            return 0xFFFFFFFF;
+        default:
+            return procFlags;
+    }
+}
+
+void Unit::GetProcAuraCandidates(uint32 procFlag, ProcAuraCandidates& candidates) const
+{
+    if (!(m_procAuraFlags & procFlag))
+        return;
+
+    for (ProcAuraIndex::const_iterator itr = m_procAuras.begin(); itr != m_procAuras.end(); ++itr)
+        if (itr->procFlags & procFlag)
+            candidates.push_back(itr->aurApp);
+}
+
 struct ProcTriggeredData
 {
     ProcTriggeredData(AuraPtr _aura)
@@ -17612,21 +17672,40 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
     HealInfo healInfo = HealInfo(actor, actionTarget, damage, procSpell, procSpell ? SpellSchoolMask(procSpell->SchoolMask) : SPELL_SCHOOL_MASK_NORMAL);
     ProcEventInfo eventInfo = ProcEventInfo(actor, actionTarget, target, procFlag, 0, 0, procExtra, NULL, &damageInfo, &healInfo);
 
+    // Only visit the auras indexed for a flag of this event, copied as the checks below may apply or remove auras
+    ProcAuraCandidates candidates;
+    GetProcAuraCandidates(procFlag, candidates);
+    uint32 removedAuras = m_removedAurasCount;
+
     ProcTriggeredList procTriggered;
     // Fill procTriggered list
-    for (AuraApplicationMap::const_iterator itr = GetAppliedAuras().begin(); itr!= GetAppliedAuras().end(); ++itr)
+    for (ProcAuraCandidates::const_iterator itr = candidates.begin(); itr != candidates.end(); ++itr)
     {
+        AuraApplication* aurApp = *itr;
+
+        // a check of an earlier candidate removed auras, skip the candidates that are gone
+        if (removedAuras != m_removedAurasCount)
+        {
+            bool applied = false;
+            for (ProcAuraIndex::const_iterator entry = m_procAuras.begin(); entry != m_procAuras.end() && !applied; ++entry)
+                applied = entry->aurApp == aurApp;
+            if (!applied)
+                continue;
+        }
+
+        uint32 spellId = aurApp->GetBase()->GetId();
+
         // Do not allow auras to proc from effect triggered by itself
-        if (procAura && procAura->Id == itr->first)
+        if (procAura && procAura->Id == spellId)
             continue;
-        ProcTriggeredData triggerData(itr->second->GetBase());
+        ProcTriggeredData triggerData(aurApp->GetBase());
         // Defensive procs are active on absorbs (so absorption effects are not a hindrance)
         bool active = damage || (procExtra & PROC_EX_BLOCK && isVictim);
         if (isVictim)
             procExtra &= ~PROC_EX_INTERNAL_REQ_FAMILY;
 
         // only auras that has triggered spell should proc from fully absorbed damage
-        SpellInfo const* spellProto = itr->second->GetBase()->GetSpellInfo();
+        SpellInfo const* spellProto = aurApp->GetBase()->GetSpellInfo();
         if (!spellProto)
             continue;
 
@@ -17644,7 +17723,7 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         // Custom MoP Script
         if (procExtra & PROC_EX_NORMAL_HIT)
         {
-            if (itr->first == 77606)
+            if (spellId == 77606)
             {
                 if (procSpell && procSpell->IsCanBeStolen())
                     active = true;
@@ -17652,7 +17731,7 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         }
 
         // Breath of Fire DoT shoudn't remove Breath of Fire disorientation - Hack Fix
-        if (procSpell && procSpell->Id == 123725 && itr->first == 123393)
+        if (procSpell && procSpell->Id == 123725 && spellId == 123393)
             continue;
 
         // Some spells can proc on absorb
@@ -17679,7 +17758,7 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
             continue;
 
         // AuraScript Hook
-        if (!triggerData.aura->CallScriptCheckProcHandlers(itr->second, eventInfo))
+        if (!triggerData.aura->CallScriptCheckProcHandlers(aurApp, eventInfo))
             continue;
 
         // Triggered spells not triggering additional spells
@@ -17688,9 +17767,9 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
 
         for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
         {
-            if (itr->second->HasEffect(i))
+            if (aurApp->HasEffect(i))
             {
-                AuraEffectPtr aurEff = itr->second->GetBase()->GetEffect(i);
+                AuraEffectPtr aurEff = aurApp->GetBase()->GetEffect(i);
                 // Skip this auras
                 if (isNonTriggerAura[aurEff->GetAuraType()])
                     continue;
@@ -19290,6 +19369,7 @@ void Unit::Kill(Unit* victim, bool durabilityLoss, SpellInfo const* spellProto)
     // handle player kill only if not suicide (spirit of redemption for example)
     if (player && this != victim)
     {
+        MapRegionSerialGuard guard(FindMap());
         if (OutdoorPvP* pvp = player->GetOutdoorPvP())
             pvp->HandleKill(player, victim);
 
@@ -22060,69 +22140,95 @@ void Unit::SetEclipsePower(int32 power, bool send)
 	}
 }
 
-/* In the next functions, we keep 1 minute of last damage */
-uint32 Unit::GetHealingDoneInPastSecs(uint32 secs)
+HealDamageLog::HealDamageLog() : _lastSecond(0)
 {
-    uint32 heal = 0;
+    memset(_buckets, 0, sizeof(_buckets));
+    memset(_totals, 0, sizeof(_totals));
+}
 
-    for (auto itr : m_healDamage)
-    {
-        if (itr.m_type != HEAL_DONE_LOG)
-            continue;
+void HealDamageLog::Advance(uint32 second)
+{
+    if (second == _lastSecond)
+        return;
 
-        if ((getMSTime() - itr.m_time) <= (secs * IN_MILLISECONDS))
-            heal += itr.m_value;
+    // more than a full ring passed, or getMSTime() wrapped around
+    if (second < _lastSecond || second - _lastSecond >= BucketCount)
+    {
+        memset(_buckets, 0, sizeof(_buckets));
+        memset(_totals, 0, sizeof(_totals));
+    }
+    else
+    {
+        for (uint32 s = _lastSecond + 1; s <= second; ++s)
+        {
+            uint32* bucket = _buckets[s % BucketCount];
+            for (uint8 i = 0; i < MAX_HEAL_DAMAGE_LOG_TYPES; ++i)
+            {
+                _totals[i] -= bucket[i];
+                bucket[i] = 0;
+            }
+        }
     }
 
-    return heal;
-};
+    _lastSecond = second;
+}
 
-uint32 Unit::GetHealingTakenInPastSecs(uint32 secs)
+void HealDamageLog::Add(HealDamageLogType type, uint32 value, uint32 now)
 {
-    uint32 heal = 0;
-
-    for (auto itr : m_healDamage)
-    {
-        if (itr.m_type != HEAL_TAKE_LOG)
-            continue;
+    Advance(now / IN_MILLISECONDS);
+    _buckets[_lastSecond % BucketCount][type] += value;
+    _totals[type] += value;
+}
 
-        if ((getMSTime() - itr.m_time) <= (secs * IN_MILLISECONDS))
-            heal += itr.m_value;
-    }
+uint32 HealDamageLog::GetSum(HealDamageLogType type, uint32 secs, uint32 now) const
+{
+    uint32 second = now / IN_MILLISECONDS;
+    if (second < _lastSecond || second - _lastSecond >= BucketCount)
+        return 0;
 
-    return heal;
-};
+    // seconds second - secs .. second, of which only the ones up to _lastSecond hold values
+    uint32 count = std::min<uint32>(secs + 1, BucketCount);
+    uint32 skipped = second - _lastSecond;
+    if (skipped >= count)
+        return 0;
+    count -= skipped;
 
-uint32 Unit::GetDamageDoneInPastSecs(uint32 secs)
-{
-    uint32 damage = 0;
+    if (count == BucketCount)
+        return _totals[type];
 
-    for (auto itr : m_healDamage)
-    {
-        if (itr.m_type != DAMAGE_DONE_LOG)
-            continue;
+    uint32 sum = 0;
+    for (uint32 i = 0; i < count; ++i)
+        sum += _buckets[(_lastSecond - i) % BucketCount][type];
+    return sum;
+}
 
-        if ((getMSTime() - itr.m_time) <= (secs * IN_MILLISECONDS))
-            damage += itr.m_value;
-    }
+void Unit::AddHealDamageLog(HealDamageLogType type, uint32 value)
+{
+    if (!m_healDamage)
+        m_healDamage = new HealDamageLog();
 
-    return damage;
-};
+    m_healDamage->Add(type, value, getMSTime());
+}
 
-uint32 Unit::GetDamageTakenInPastSecs(uint32 secs)
+/* In the next functions, we keep 1 minute of last damage */
+uint32 Unit::GetHealingDoneInPastSecs(uint32 secs)
 {
-    uint32 damage = 0;
+    return m_healDamage ? m_healDamage->GetSum(HEAL_DONE_LOG, secs, getMSTime()) : 0;
+}
 
-    for (auto itr : m_healDamage)
-    {
-        if (itr.m_type != DAMAGE_TAKE_LOG)
-            continue;
+uint32 Unit::GetHealingTakenInPastSecs(uint32 secs)
+{
+    return m_healDamage ? m_healDamage->GetSum(HEAL_TAKE_LOG, secs, getMSTime()) : 0;
+}
 
-        if ((getMSTime() - itr.m_time) <= (secs * IN_MILLISECONDS))
-            damage += itr.m_value;
-    }
+uint32 Unit::GetDamageDoneInPastSecs(uint32 secs)
+{
+    return m_healDamage ? m_healDamage->GetSum(DAMAGE_DONE_LOG, secs, getMSTime()) : 0;
+}
 
-    return damage;
+uint32 Unit::GetDamageTakenInPastSecs(uint32 secs)
+{
+    return m_healDamage ? m_healDamage->GetSum(DAMAGE_TAKE_LOG, secs, getMSTime()) : 0;
 }
 
 void Unit::RemoveSoulSwapDOT(Unit* target)
@@ -755,23 +755,31 @@ enum HealDamageLogType
     DAMAGE_TAKE_LOG,
     HEAL_DONE_LOG,
     HEAL_TAKE_LOG,
+    MAX_HEAL_DAMAGE_LOG_TYPES
 };
 
-struct HealDamageLog
+#define HEAL_DAMAGE_LOG_SECONDS 60
+
+// Heal and damage of the last HEAL_DAMAGE_LOG_SECONDS, summed per second in a ring of buckets
+// so adding a value and dropping expired seconds never allocates or scans
+class HealDamageLog
 {
-    HealDamageLog()
-        : m_value(0), m_time(0), m_type(DAMAGE_DONE_LOG)
-    {
-    }
+    public:
+        HealDamageLog();
 
-    HealDamageLog(uint32 value, uint32 time, HealDamageLogType type)
-        : m_value(value), m_time(time), m_type(type)
-    {
-    }
+        void Add(HealDamageLogType type, uint32 value, uint32 now);
+        // Sum of the values of the seconds overlapping the last secs seconds
+        uint32 GetSum(HealDamageLogType type, uint32 secs, uint32 now) const;
+        bool IsExpired(uint32 now) const { return now / IN_MILLISECONDS - _lastSecond > HEAL_DAMAGE_LOG_SECONDS; }
 
-    uint32 m_value;
-    uint32 m_time;
-    HealDamageLogType m_type;
+    private:
+        static uint32 const BucketCount = HEAL_DAMAGE_LOG_SECONDS + 1;   // + the current second
+
+        void Advance(uint32 second);
+
+        uint32 _buckets[BucketCount][MAX_HEAL_DAMAGE_LOG_TYPES];
+        uint32 _totals[MAX_HEAL_DAMAGE_LOG_TYPES];         // sum of all buckets
+        uint32 _lastSecond;                                 // second of the newest bucket
 };
 
 class DispelInfo
@@ -1220,6 +1228,7 @@ class Unit : public WorldObject
         typedef std::list<AuraEffectPtr> AuraEffectList;
         typedef std::list<AuraPtr> AuraList;
         typedef std::list<AuraApplication *> AuraApplicationList;
+        typedef std::vector<AuraApplication*> ProcAuraCandidates;
         typedef std::list<DiminishingReturn> Diminishing;
         typedef std::set<uint32> ComboPointHolderSet;
         typedef std::vector<uint32> AuraIdList;
@@ -1471,6 +1480,10 @@ class Unit : public WorldObject
 
         void ProcDamageAndSpell(Unit* victim, uint32 procAttacker, uint32 procVictim, uint32 procEx, uint32 amount, uint32 absorb = 0, WeaponAttackType attType = BASE_ATTACK, SpellInfo const* procSpell = NULL, SpellInfo const* procAura = NULL);
         void ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, uint32 procExtra, WeaponAttackType attType, SpellInfo const* procSpell, uint32 damage, uint32 absorb = 0, SpellInfo const* procAura = NULL);
+        // Applied auras that ProcDamageAndSpellFor can trigger for an event with procFlag, in GetAppliedAuras() order
+        void GetProcAuraCandidates(uint32 procFlag, ProcAuraCandidates& candidates) const;
+        // Proc flags an aura of the spell triggers on in ProcDamageAndSpellFor, 0 if it never does
+        static uint32 GetAuraProcFlags(SpellInfo const* spellInfo);
 
         bool IsNoBreakingCC(bool isVictim, Unit* target, uint32 procFlag, uint32 procExtra, WeaponAttackType attType, SpellInfo const* procSpell, uint32 damage, uint32 absorb, SpellInfo const* procAura, SpellInfo const* spellProto) const;
 
@@ -2308,7 +2321,7 @@ class Unit : public WorldObject
         uint32 GetHealingTakenInPastSecs(uint32 secs);
         uint32 GetDamageDoneInPastSecs(uint32 secs);
         uint32 GetDamageTakenInPastSecs(uint32 secs);
-        void AddHealDamageLog(HealDamageLog const& log) { m_healDamage.push_back(log); }
+        void AddHealDamageLog(HealDamageLogType type, uint32 value);
 
         // Movement info
         Movement::MoveSpline * movespline;
@@ -2384,12 +2397,21 @@ class Unit : public WorldObject
         AuraEffectList m_modAuras[TOTAL_AURAS];
         AuraList m_scAuras;                        // casted singlecast auras
         AuraApplicationList m_interruptableAuras;             // auras which have interrupt mask applied on unit
+
+        struct ProcAuraEntry
+        {
+            uint32 spellId;
+            uint32 procFlags;                                 // GetAuraProcFlags() at apply time
+            AuraApplication* aurApp;
+        };
+        typedef std::vector<ProcAuraEntry> ProcAuraIndex;
+        ProcAuraIndex m_procAuras;                            // applied auras with proc flags, sorted like m_appliedAuras
+        uint32 m_procAuraFlags;                               // union of the proc flags of m_procAuras
         AuraStateAurasMap m_auraStateAuras;        // Used for improve performance of aura state checks on aura apply/remove
         uint32 m_interruptMask;
         AuraList _SoulSwapDOTList;
 
-        typedef std::list<HealDamageLog> HealDamageLogList;
-        HealDamageLogList m_healDamage;
+        HealDamageLog* m_healDamage;                          // only allocated while the unit deals or takes heal or damage
 
         float m_auraModifiersGroup[UNIT_MOD_END][MODIFIER_TYPE_END];
         float m_weaponDamage[MAX_ATTACK][2];
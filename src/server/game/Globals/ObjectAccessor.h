@@ -231,6 +231,7 @@ class ObjectAccessor
         static void SaveAllPlayers();
 
         //non-static functions
+        // objects whose changes can not be sent by a map (see Object::GetObjectUpdateMap)
         void AddUpdateObject(Object* obj)
         {
             TRINITY_GUARD(ACE_Thread_Mutex, i_objectLock);
@@ -1549,7 +1549,7 @@ void ObjectMgr::LoadCreatures()
             continue;
         }
 
-        CreatureData& data = _creatureDataStore[guid];
+        CreatureData& data = _creatureDataStore.Insert(guid);
         data.id             = entry;
         data.mapid          = fields[index++].GetUInt16();
         data.zoneId         = fields[index++].GetUInt16();
@@ -1671,8 +1671,12 @@ void ObjectMgr::AddCreatureToGrid(uint32 guid, CreatureData const* data)
         if (mask & 1)
         {
             CellCoord cellCoord = MoPCore::ComputeCellCoord(data->posX, data->posY);
-            CellObjectGuids& cell_guids = _mapObjectGuidsStore[MAKE_PAIR32(data->mapid, i)][cellCoord.GetId()];
-            cell_guids.creatures.insert(guid);
+            _mapObjectGuidsStore.Modify(MakeCellKey(data->mapid, i, cellCoord.GetId()), [guid](CellObjectGuids& cell_guids)
+            {
+                CellGuidSet::iterator itr = std::lower_bound(cell_guids.creatures.begin(), cell_guids.creatures.end(), guid);
+                if (itr == cell_guids.creatures.end() || *itr != guid)
+                    cell_guids.creatures.insert(itr, guid);
+            });
         }
     }
 }
@@ -1685,8 +1689,12 @@ void ObjectMgr::RemoveCreatureFromGrid(uint32 guid, CreatureData const* data)
         if (mask & 1)
         {
             CellCoord cellCoord = MoPCore::ComputeCellCoord(data->posX, data->posY);
-            CellObjectGuids& cell_guids = _mapObjectGuidsStore[MAKE_PAIR32(data->mapid, i)][cellCoord.GetId()];
-            cell_guids.creatures.erase(guid);
+            _mapObjectGuidsStore.Modify(MakeCellKey(data->mapid, i, cellCoord.GetId()), [guid](CellObjectGuids& cell_guids)
+            {
+                CellGuidSet::iterator itr = std::lower_bound(cell_guids.creatures.begin(), cell_guids.creatures.end(), guid);
+                if (itr != cell_guids.creatures.end() && *itr == guid)
+                    cell_guids.creatures.erase(itr);
+            });
         }
     }
 }
@@ -1736,7 +1744,7 @@ uint32 ObjectMgr::AddGOData(uint32 entry, uint32 mapId, float x, float y, float
         }
     }
 
-    sLog->outDebug(LOG_FILTER_MAPS, "AddGOData: dbguid %u entry %u map %u x %f y %f z %f o %f", guid, entry, mapId, x, y, z, o);
+    TC_LOG_DEBUG(LOG_FILTER_MAPS, "AddGOData: dbguid %u entry %u map %u x %f y %f z %f o %f", guid, entry, mapId, x, y, z, o);
 
     return guid;
 }
@@ -1889,7 +1897,7 @@ void ObjectMgr::LoadGameobjects()
             continue;
         }
 
-        GameObjectData& data = _gameObjectDataStore[guid];
+        GameObjectData& data = _gameObjectDataStore.Insert(guid);
 
         data.id             = entry;
         data.mapid          = fields[2].GetUInt16();
@@ -1989,8 +1997,12 @@ void ObjectMgr::AddGameobjectToGrid(uint32 guid, GameObjectData const* data)
         if (mask & 1)
         {
             CellCoord cellCoord = MoPCore::ComputeCellCoord(data->posX, data->posY);
-            CellObjectGuids& cell_guids = _mapObjectGuidsStore[MAKE_PAIR32(data->mapid, i)][cellCoord.GetId()];
-            cell_guids.gameobjects.insert(guid);
+            _mapObjectGuidsStore.Modify(MakeCellKey(data->mapid, i, cellCoord.GetId()), [guid](CellObjectGuids& cell_guids)
+            {
+                CellGuidSet::iterator itr = std::lower_bound(cell_guids.gameobjects.begin(), cell_guids.gameobjects.end(), guid);
+                if (itr == cell_guids.gameobjects.end() || *itr != guid)
+                    cell_guids.gameobjects.insert(itr, guid);
+            });
         }
     }
 }
@@ -2003,8 +2015,12 @@ void ObjectMgr::RemoveGameobjectFromGrid(uint32 guid, GameObjectData const* data
         if (mask & 1)
         {
             CellCoord cellCoord = MoPCore::ComputeCellCoord(data->posX, data->posY);
-            CellObjectGuids& cell_guids = _mapObjectGuidsStore[MAKE_PAIR32(data->mapid, i)][cellCoord.GetId()];
-            cell_guids.gameobjects.erase(guid);
+            _mapObjectGuidsStore.Modify(MakeCellKey(data->mapid, i, cellCoord.GetId()), [guid](CellObjectGuids& cell_guids)
+            {
+                CellGuidSet::iterator itr = std::lower_bound(cell_guids.gameobjects.begin(), cell_guids.gameobjects.end(), guid);
+                if (itr != cell_guids.gameobjects.end() && *itr == guid)
+                    cell_guids.gameobjects.erase(itr);
+            });
         }
     }
 }
@@ -7369,7 +7385,7 @@ void ObjectMgr::DeleteCreatureData(uint32 guid)
     if (data)
         RemoveCreatureFromGrid(guid, data);
 
-    _creatureDataStore.erase(guid);
+    _creatureDataStore.Erase(guid);
 }
 
 void ObjectMgr::DeleteGOData(uint32 guid)
@@ -7379,21 +7395,45 @@ void ObjectMgr::DeleteGOData(uint32 guid)
     if (data)
         RemoveGameobjectFromGrid(guid, data);
 
-    _gameObjectDataStore.erase(guid);
+    _gameObjectDataStore.Erase(guid);
 }
 
 void ObjectMgr::AddCorpseCellData(uint32 mapid, uint32 cellid, uint32 player_guid, uint32 instance)
 {
     // corpses are always added to spawn mode 0 and they are spawned by their instance id
-    CellObjectGuids& cell_guids = _mapObjectGuidsStore[MAKE_PAIR32(mapid, 0)][cellid];
-    cell_guids.corpses[player_guid] = instance;
+    _mapObjectGuidsStore.Modify(MakeCellKey(mapid, 0, cellid), [player_guid, instance](CellObjectGuids& cell_guids)
+    {
+        CellCorpseSet::iterator itr = std::lower_bound(cell_guids.corpses.begin(), cell_guids.corpses.end(), std::make_pair(player_guid, uint32(0)));
+        if (itr != cell_guids.corpses.end() && itr->first == player_guid)
+            itr->second = instance;
+        else
+            cell_guids.corpses.insert(itr, std::make_pair(player_guid, instance));
+    });
 }
 
 void ObjectMgr::DeleteCorpseCellData(uint32 mapid, uint32 cellid, uint32 player_guid)
 {
     // corpses are always added to spawn mode 0 and they are spawned by their instance id
-    CellObjectGuids& cell_guids = _mapObjectGuidsStore[MAKE_PAIR32(mapid, 0)][cellid];
-    cell_guids.corpses.erase(player_guid);
+    _mapObjectGuidsStore.Modify(MakeCellKey(mapid, 0, cellid), [player_guid](CellObjectGuids& cell_guids)
+    {
+        CellCorpseSet::iterator itr = std::lower_bound(cell_guids.corpses.begin(), cell_guids.corpses.end(), std::make_pair(player_guid, uint32(0)));
+        if (itr != cell_guids.corpses.end() && itr->first == player_guid)
+            cell_guids.corpses.erase(itr);
+    });
+}
+
+void ObjectMgr::FreezeSpawnStores()
+{
+    _creatureDataStore.Freeze();
+    _gameObjectDataStore.Freeze();
+    _mapObjectGuidsStore.Freeze();
+}
+
+void ObjectMgr::ReclaimSpawnStores()
+{
+    _creatureDataStore.Reclaim();
+    _gameObjectDataStore.Reclaim();
+    _mapObjectGuidsStore.Reclaim();
 }
 
 void ObjectMgr::LoadQuestRelationsHelper(QuestRelations& map, std::string table, bool starter, bool go)
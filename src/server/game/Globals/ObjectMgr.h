@@ -45,6 +45,7 @@
 #include <functional>
 #include "PhaseMgr.h"
 #include <LockedMap.h>
+#include <SnapshotMap.h>
 
 class Item;
 class PhaseMgr;
@@ -362,16 +363,16 @@ struct AreaTriggerStruct
     float  target_Orientation;
 };
 
-typedef std::set<uint32> CellGuidSet;
-typedef std::map<uint32/*player guid*/, uint32/*instance*/> CellCorpseSet;
+typedef std::vector<uint32> CellGuidSet;                                            // sorted
+typedef std::vector<std::pair<uint32/*player guid*/, uint32/*instance*/> > CellCorpseSet; // sorted by player guid
 struct CellObjectGuids
 {
     CellGuidSet creatures;
     CellGuidSet gameobjects;
     CellCorpseSet corpses;
 };
-typedef ACE_Based::LockedMap<uint32/*cell_id*/, CellObjectGuids> CellObjectGuidsMap;
-typedef ACE_Based::LockedMap<uint32/*(mapid, spawnMode) pair*/, CellObjectGuidsMap> MapObjectGuids;
+// published cells are never changed, writers replace the whole cell
+typedef ACE_Based::SnapshotMap<uint64/*(mapid, spawnMode) pair << 32 | cell_id*/, CellObjectGuids> MapObjectGuids;
 
 // Trinity string ranges
 #define MIN_TRINITY_STRING_ID           1                    // 'trinity_string'
@@ -409,8 +410,8 @@ private:
 };
 
 typedef std::map<uint64, uint64> LinkedRespawnContainer;
-typedef ACE_Based::LockedMap<uint32, CreatureData> CreatureDataContainer;
-typedef ACE_Based::LockedMap<uint32, GameObjectData> GameObjectDataContainer;
+typedef ACE_Based::SnapshotMap<uint32, CreatureData> CreatureDataContainer;
+typedef ACE_Based::SnapshotMap<uint32, GameObjectData> GameObjectDataContainer;
 typedef ACE_Based::LockedMap<TempSummonGroupKey, std::vector<TempSummonData>> TempSummonDataContainer;
 typedef ACE_Based::LockedMap<uint32, CreatureLocale> CreatureLocaleContainer;
 typedef ACE_Based::LockedMap<uint32, GameObjectLocale> GameObjectLocaleContainer;
@@ -1054,9 +1055,11 @@ class ObjectMgr
             return NULL;
         }
 
-        CellObjectGuids const& GetCellObjectGuids(uint16 mapid, uint8 spawnMode, uint32 cell_id)
+        CellObjectGuids const& GetCellObjectGuids(uint16 mapid, uint8 spawnMode, uint32 cell_id) const
         {
-            return _mapObjectGuidsStore[MAKE_PAIR32(mapid, spawnMode)][cell_id];
+            static CellObjectGuids const emptyCell;
+            CellObjectGuids const* cell_guids = _mapObjectGuidsStore.Find(MakeCellKey(mapid, spawnMode, cell_id));
+            return cell_guids ? *cell_guids : emptyCell;
         }
 
        /**
@@ -1077,13 +1080,8 @@ class ObjectMgr
             return NULL;
         }
 
-        CreatureData const* GetCreatureData(uint32 guid) const
-        {
-            CreatureDataContainer::const_iterator itr = _creatureDataStore.find(guid);
-            if (itr == _creatureDataStore.end()) return NULL;
-            return &itr->second;
-        }
-        CreatureData& NewOrExistCreatureData(uint32 guid) { return _creatureDataStore[guid]; }
+        CreatureData const* GetCreatureData(uint32 guid) const { return _creatureDataStore.Find(guid); }
+        CreatureData& NewOrExistCreatureData(uint32 guid) { return _creatureDataStore.Insert(guid); }
         void DeleteCreatureData(uint32 guid);
         uint64 GetLinkedRespawnGuid(uint64 guid) const
         {
@@ -1140,13 +1138,8 @@ class ObjectMgr
             return &itr->second;
         }
 
-        GameObjectData const* GetGOData(uint32 guid) const
-        {
-            GameObjectDataContainer::const_iterator itr = _gameObjectDataStore.find(guid);
-            if (itr == _gameObjectDataStore.end()) return NULL;
-            return &itr->second;
-        }
-        GameObjectData& NewGOData(uint32 guid) { return _gameObjectDataStore[guid]; }
+        GameObjectData const* GetGOData(uint32 guid) const { return _gameObjectDataStore.Find(guid); }
+        GameObjectData& NewGOData(uint32 guid) { return _gameObjectDataStore.Insert(guid); }
         void DeleteGOData(uint32 guid);
 
         TrinityStringLocale const* GetTrinityStringLocale(int32 entry) const
@@ -1168,6 +1161,9 @@ class ObjectMgr
         void RemoveCreatureFromGrid(uint32 guid, CreatureData const* data);
         void AddGameobjectToGrid(uint32 guid, GameObjectData const* data);
         void RemoveGameobjectFromGrid(uint32 guid, GameObjectData const* data);
+        // spawn data and cells are read without locks once frozen, see ACE_Based::SnapshotMap
+        void FreezeSpawnStores();
+        void ReclaimSpawnStores();
         uint32 AddGOData(uint32 entry, uint32 map, float x, float y, float z, float o, uint32 spawntimedelay = 0, float rotation0 = 0, float rotation1 = 0, float rotation2 = 0, float rotation3 = 0);
         uint32 AddCreData(uint32 entry, uint32 team, uint32 map, float x, float y, float z, float o, uint32 spawntimedelay = 0);
         bool MoveCreData(uint32 guid, uint32 map, Position pos);
@@ -1400,6 +1396,8 @@ class ObjectMgr
         ResearchLootVector _researchLoot;
 
     private:
+        static uint64 MakeCellKey(uint16 mapid, uint8 spawnMode, uint32 cell_id) { return (uint64(MAKE_PAIR32(mapid, spawnMode)) << 32) | cell_id; }
+
         void LoadScripts(ScriptsType type);
         void CheckScripts(ScriptsType type, std::set<int32>& ids);
         void LoadQuestRelationsHelper(QuestRelations& map, std::string table, bool starter, bool go);
@@ -113,7 +113,8 @@ struct Cell
     static CellArea CalculateCellArea(float x, float y, float radius);
 
 private:
-    template<class T, class CONTAINER> void VisitCircle(TypeContainerVisitor<T, CONTAINER> &, Map &, CellCoord const&, CellCoord const&) const;
+    template<class T, class CONTAINER> void VisitCircle(TypeContainerVisitor<T, CONTAINER> &, Map &, CellCoord const&, CellCoord const&, float, float, float) const;
+    template<class T, class CONTAINER> void VisitCell(Cell const&, TypeContainerVisitor<T, CONTAINER> &, Map &, float, float, float) const;
 };
 
 #endif
@@ -20,11 +20,40 @@
 #define TRINITY_CELLIMPL_H
 
 #include <cmath>
+#include <type_traits>
+#include <utility>
 
 #include "Cell.h"
 #include "Map.h"
 #include "Object.h"
 
+namespace MoPCore
+{
+    // Notifiers that implement VisitObject(WorldObject*, uint32 typeMask) are served from the
+    // spatial index of every cell instead of walking the object lists of the cell
+    template<class NOTIFIER>
+    class UsesSpatialIndex
+    {
+        template<class U> static char Test(decltype(std::declval<U&>().VisitObject(static_cast<WorldObject*>(NULL), 0u))*);
+        template<class U> static long Test(...);
+
+        public:
+            static bool const value = sizeof(Test<NOTIFIER>(NULL)) == sizeof(char);
+    };
+
+    template<class T, class CONTAINER>
+    inline void VisitCell(Cell const& cell, TypeContainerVisitor<T, CONTAINER>& visitor, Map& map, float /*x*/, float /*y*/, float /*radius*/, std::false_type)
+    {
+        map.Visit(cell, visitor);
+    }
+
+    template<class T, class CONTAINER>
+    inline void VisitCell(Cell const& cell, TypeContainerVisitor<T, CONTAINER>& visitor, Map& map, float x, float y, float radius, std::true_type)
+    {
+        map.VisitSpatialIndex(cell, visitor.GetVisitor(), std::is_same<CONTAINER, WorldTypeMapContainer>::value, x, y, radius);
+    }
+}
+
 inline Cell::Cell(CellCoord const& p)
 {
     data.Part.grid_x = p.x_coord / MAX_NUMBER_OF_CELLS;
@@ -71,9 +100,13 @@ inline void Cell::Visit(CellCoord const& standing_cell, TypeContainerVisitor<T,
     //maybe it is better to just return when radius <= 0.0f?
     if (radius <= 0.0f)
     {
-        map.Visit(*this, visitor);
+        VisitCell(*this, visitor, map, x_off, y_off, -1.0f);
         return;
     }
+
+    //the spatial index filters by the real radius, only the visited cell area is limited
+    float const searchRadius = radius;
+
     //lets limit the upper value for search radius
     if (radius > SIZE_OF_GRIDS)
         radius = SIZE_OF_GRIDS;
@@ -83,7 +116,7 @@ inline void Cell::Visit(CellCoord const& standing_cell, TypeContainerVisitor<T,
     //if radius fits inside standing cell
     if (!area)
     {
-        map.Visit(*this, visitor);
+        VisitCell(*this, visitor, map, x_off, y_off, searchRadius);
         return;
     }
 
@@ -93,13 +126,13 @@ inline void Cell::Visit(CellCoord const& standing_cell, TypeContainerVisitor<T,
     //there are nothing to optimize because SIZE_OF_GRID_CELL is too big...
     if ((area.high_bound.x_coord > (area.low_bound.x_coord + 4)) && (area.high_bound.y_coord > (area.low_bound.y_coord + 4)))
     {
-        VisitCircle(visitor, map, area.low_bound, area.high_bound);
+        VisitCircle(visitor, map, area.low_bound, area.high_bound, x_off, y_off, searchRadius);
         return;
     }
 
     //ALWAYS visit standing cell first!!! Since we deal with small radiuses
     //it is very essential to call visitor for standing cell firstly...
-    map.Visit(*this, visitor);
+    VisitCell(*this, visitor, map, x_off, y_off, searchRadius);
 
     // loop the cell range
     for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
@@ -112,7 +145,7 @@ inline void Cell::Visit(CellCoord const& standing_cell, TypeContainerVisitor<T,
             {
                 Cell r_zone(cellCoord);
                 r_zone.data.Part.nocreate = this->data.Part.nocreate;
-                map.Visit(r_zone, visitor);
+                VisitCell(r_zone, visitor, map, x_off, y_off, searchRadius);
             }
         }
     }
@@ -127,7 +160,13 @@ inline void Cell::Visit(CellCoord const& standing_cell, TypeContainerVisitor<T,
 }
 
 template<class T, class CONTAINER>
-inline void Cell::VisitCircle(TypeContainerVisitor<T, CONTAINER>& visitor, Map& map, CellCoord const& begin_cell, CellCoord const& end_cell) const
+inline void Cell::VisitCell(Cell const& cell, TypeContainerVisitor<T, CONTAINER>& visitor, Map& map, float x, float y, float radius) const
+{
+    MoPCore::VisitCell(cell, visitor, map, x, y, radius, std::integral_constant<bool, MoPCore::UsesSpatialIndex<T>::value>());
+}
+
+template<class T, class CONTAINER>
+inline void Cell::VisitCircle(TypeContainerVisitor<T, CONTAINER>& visitor, Map& map, CellCoord const& begin_cell, CellCoord const& end_cell, float x, float y, float radius) const
 {
     //here is an algorithm for 'filling' circum-squared octagon
     uint32 x_shift = (uint32)ceilf((end_cell.x_coord - begin_cell.x_coord) * 0.3f - 0.5f);
@@ -136,14 +175,14 @@ inline void Cell::VisitCircle(TypeContainerVisitor<T, CONTAINER>& visitor, Map&
     const uint32 x_end = end_cell.x_coord - x_shift;
 
     //visit central strip with constant width...
-    for (uint32 x = x_start; x <= x_end; ++x)
+    for (uint32 cell_x = x_start; cell_x <= x_end; ++cell_x)
     {
-        for (uint32 y = begin_cell.y_coord; y <= end_cell.y_coord; ++y)
+        for (uint32 cell_y = begin_cell.y_coord; cell_y <= end_cell.y_coord; ++cell_y)
         {
-            CellCoord cellCoord(x, y);
+            CellCoord cellCoord(cell_x, cell_y);
             Cell r_zone(cellCoord);
             r_zone.data.Part.nocreate = this->data.Part.nocreate;
-            map.Visit(r_zone, visitor);
+            VisitCell(r_zone, visitor, map, x, y, radius);
         }
     }
 
@@ -160,20 +199,20 @@ inline void Cell::VisitCircle(TypeContainerVisitor<T, CONTAINER>& visitor, Map&
         //each step reduces strip height by 2 cells...
         y_end += 1;
         y_start -= 1;
-        for (uint32 y = y_start; y >= y_end; --y)
+        for (uint32 cell_y = y_start; cell_y >= y_end; --cell_y)
         {
             //we visit cells symmetrically from both sides, heading from center to sides and from up to bottom
             //e.g. filling 2 trapezoids after filling central cell strip...
-            CellCoord cellCoord_left(x_start - step, y);
+            CellCoord cellCoord_left(x_start - step, cell_y);
             Cell r_zone_left(cellCoord_left);
             r_zone_left.data.Part.nocreate = this->data.Part.nocreate;
-            map.Visit(r_zone_left, visitor);
+            VisitCell(r_zone_left, visitor, map, x, y, radius);
 
             //right trapezoid cell visit
-            CellCoord cellCoord_right(x_end + step, y);
+            CellCoord cellCoord_right(x_end + step, cell_y);
             Cell r_zone_right(cellCoord_right);
             r_zone_right.data.Part.nocreate = this->data.Part.nocreate;
-            map.Visit(r_zone_right, visitor);
+            VisitCell(r_zone_right, visitor, map, x, y, radius);
         }
     }
 }
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CellSpatialIndex.h"
+#include "GridDefines.h"
+#include "Object.h"
+#include "Errors.h"
+
+static uint8 GetGridMapTypeMask(WorldObject const* obj)
+{
+    switch (obj->GetTypeId())
+    {
+        case TYPEID_UNIT:           return GRID_MAP_TYPE_MASK_CREATURE;
+        case TYPEID_PLAYER:         return GRID_MAP_TYPE_MASK_PLAYER;
+        case TYPEID_GAMEOBJECT:     return GRID_MAP_TYPE_MASK_GAMEOBJECT;
+        case TYPEID_DYNAMICOBJECT:  return GRID_MAP_TYPE_MASK_DYNAMICOBJECT;
+        case TYPEID_CORPSE:         return GRID_MAP_TYPE_MASK_CORPSE;
+        case TYPEID_AREATRIGGER:    return GRID_MAP_TYPE_MASK_AREATRIGGER;
+        default:                    return 0;
+    }
+}
+
+static float GetSpatialReach(WorldObject const* obj)
+{
+    // gameobject range checks may use the model bounds, which can reach far past the object size
+    if (obj->GetTypeId() == TYPEID_GAMEOBJECT)
+        return SIZE_OF_GRIDS;
+
+    return obj->GetObjectSize() + SPATIAL_INDEX_QUERY_MARGIN;
+}
+
+CellSpatialIndex::~CellSpatialIndex()
+{
+    for (std::vector<WorldObject*>::const_iterator itr = i_objects.begin(); itr != i_objects.end(); ++itr)
+        (*itr)->m_spatialIndex = NULL;
+}
+
+void CellSpatialIndex::Insert(WorldObject* obj, bool worldObject)
+{
+    ASSERT(!obj->m_spatialIndex);
+
+    obj->m_spatialIndex = this;
+    obj->m_spatialSlot = uint32(i_objects.size());
+
+    i_x.push_back(obj->GetPositionX());
+    i_y.push_back(obj->GetPositionY());
+    i_reach.push_back(GetSpatialReach(obj));
+    i_world.push_back(worldObject ? 1 : 0);
+    i_typeMask.push_back(GetGridMapTypeMask(obj));
+    i_objects.push_back(obj);
+}
+
+void CellSpatialIndex::Remove(WorldObject* obj)
+{
+    ASSERT(obj->m_spatialIndex == this);
+
+    // move the last entry into the freed slot
+    uint32 slot = obj->m_spatialSlot;
+    uint32 last = uint32(i_objects.size()) - 1;
+    if (slot != last)
+    {
+        i_x[slot] = i_x[last];
+        i_y[slot] = i_y[last];
+        i_reach[slot] = i_reach[last];
+        i_world[slot] = i_world[last];
+        i_typeMask[slot] = i_typeMask[last];
+        i_objects[slot] = i_objects[last];
+        i_objects[slot]->m_spatialSlot = slot;
+    }
+
+    i_x.pop_back();
+    i_y.pop_back();
+    i_reach.pop_back();
+    i_world.pop_back();
+    i_typeMask.pop_back();
+    i_objects.pop_back();
+
+    obj->m_spatialIndex = NULL;
+}
+
+void CellSpatialIndex::Update(WorldObject* obj)
+{
+    ASSERT(obj->m_spatialIndex == this);
+
+    uint32 slot = obj->m_spatialSlot;
+    i_x[slot] = obj->GetPositionX();
+    i_y[slot] = obj->GetPositionY();
+    i_reach[slot] = GetSpatialReach(obj);
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_CELLSPATIALINDEX_H
+#define TRINITY_CELLSPATIALINDEX_H
+
+#include "Define.h"
+
+#include <algorithm>
+#include <vector>
+
+class WorldObject;
+
+// Added to the object size of every entry, covers checks that allow some leeway around the
+// searched radius and objects moved since the map last refreshed their stored position
+#define SPATIAL_INDEX_QUERY_MARGIN  5.0f
+#define SPATIAL_INDEX_BATCH_SIZE    64
+
+// Positions of the objects linked into one grid cell, kept in contiguous arrays next to the
+// GridRefManager lists of the cell. Searchers run the distance test over these arrays and
+// only dereference the objects that pass it, instead of walking every object of the cell.
+// Entries are appended on insert and a removal moves the last entry into the freed slot, so the
+// visit order is not the order of the cell lists and changes as objects leave the cell. The
+// *Searcher and *LastSearcher notifiers keep the first or last object passing their check, so
+// with several candidates they can return a different one than the list walk did; the nearest
+// object checks shrink their range on every hit and only resolve ties between equally near
+// objects differently.
+class CellSpatialIndex
+{
+    public:
+
+        CellSpatialIndex() { }
+        ~CellSpatialIndex();
+
+        void Insert(WorldObject* obj, bool worldObject);
+        void Remove(WorldObject* obj);
+
+        // Refreshes the stored position and size after the object moved inside the cell
+        void Update(WorldObject* obj);
+
+        // Calls notifier.VisitObject(object, GRID_MAP_TYPE_MASK_*) for every object of the world or
+        // grid containers whose stored position is within radius of x, y, radius < 0 visits all of them
+        template<class NOTIFIER>
+        void Visit(NOTIFIER& notifier, bool worldObjects, float x, float y, float radius) const;
+
+        uint32 GetSize() const { return uint32(i_objects.size()); }
+
+    private:
+
+        std::vector<float> i_x;
+        std::vector<float> i_y;
+        std::vector<float> i_reach;                         // object size plus SPATIAL_INDEX_QUERY_MARGIN
+        std::vector<uint8> i_world;                         // 1 for objects stored in the world object containers
+        std::vector<uint8> i_typeMask;                      // GRID_MAP_TYPE_MASK_*
+        std::vector<WorldObject*> i_objects;
+};
+
+template<class NOTIFIER>
+inline void CellSpatialIndex::Visit(NOTIFIER& notifier, bool worldObjects, float x, float y, float radius) const
+{
+    uint32 const count = uint32(i_objects.size());
+    uint8 const world = worldObjects ? 1 : 0;
+
+    if (radius < 0.0f)
+    {
+        for (uint32 i = 0; i < count; ++i)
+            if (i_world[i] == world)
+                notifier.VisitObject(i_objects[i], i_typeMask[i]);
+        return;
+    }
+
+    uint8 hits[SPATIAL_INDEX_BATCH_SIZE];
+    for (uint32 begin = 0; begin < count; begin += SPATIAL_INDEX_BATCH_SIZE)
+    {
+        uint32 const end = std::min(count, begin + SPATIAL_INDEX_BATCH_SIZE);
+        float const* px = &i_x[begin];
+        float const* py = &i_y[begin];
+        float const* reach = &i_reach[begin];
+        uint8 const* pw = &i_world[begin];
+
+        // no branches in here so the compiler can vectorise the distance test
+        for (uint32 i = 0; i < end - begin; ++i)
+        {
+            float dx = px[i] - x;
+            float dy = py[i] - y;
+            float r = radius + reach[i];
+            hits[i] = uint8(dx * dx + dy * dy <= r * r) & uint8(pw[i] == world);
+        }
+
+        for (uint32 i = 0; i < end - begin; ++i)
+            if (hits[i])
+                notifier.VisitObject(i_objects[begin + i], i_typeMask[begin + i]);
+    }
+}
+
+#endif
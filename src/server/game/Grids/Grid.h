@@ -33,6 +33,7 @@
 #include "Define.h"
 #include "TypeContainer.h"
 #include "TypeContainerVisitor.h"
+#include "CellSpatialIndex.h"
 
 // forward declaration
 template<class A, class T, class O> class GridLoader;
@@ -60,6 +61,7 @@ class Grid
         {
             i_objects.template insert<SPECIFIC_OBJECT>(obj);
             ASSERT(obj->IsInGrid());
+            i_spatialIndex.Insert(obj, true);
         }
 
         /** an object of interested exits the grid
@@ -107,12 +109,18 @@ class Grid
             return i_objects.template Count<T>();
         }
 
+        /** Positions of all objects of the cell for radius searches, objects leave it when removed from the grid
+         */
+        CellSpatialIndex& GetSpatialIndex() { return i_spatialIndex; }
+        CellSpatialIndex const& GetSpatialIndex() const { return i_spatialIndex; }
+
         /** Inserts a container type object into the grid.
          */
         template<class SPECIFIC_OBJECT> void AddGridObject(SPECIFIC_OBJECT *obj)
         {
             i_container.template insert<SPECIFIC_OBJECT>(obj);
             ASSERT(obj->IsInGrid());
+            i_spatialIndex.Insert(obj, false);
         }
 
         /** Removes a containter type object from the grid
@@ -137,6 +145,7 @@ class Grid
 
         TypeMapContainer<GRID_OBJECT_TYPES> i_container;
         TypeMapContainer<WORLD_OBJECT_TYPES> i_objects;
+        CellSpatialIndex i_spatialIndex;
         //typedef std::set<void*> ActiveGridObjects;
         //ActiveGridObjects m_activeGridObjects;
 };
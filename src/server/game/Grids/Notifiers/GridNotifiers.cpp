@@ -241,7 +241,11 @@ void ObjectUpdater::Visit(GridRefManager<T> &m)
             continue;
 
         if (iter->getSource()->IsInWorld())
+        {
             iter->getSource()->Update(i_timeDiff);
+            // also catches objects moved by a direct Relocate, e.g. transport passengers
+            iter->getSource()->UpdateSpatialIndex();
+        }
     }
 }
 
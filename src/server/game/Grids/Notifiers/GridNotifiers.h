@@ -21,6 +21,7 @@
 
 #include "ObjectGridLoader.h"
 #include "UpdateData.h"
+#include "SharedWorldPacket.h"
 #include <iostream>
 
 #include "Corpse.h"
@@ -124,13 +125,13 @@ namespace MoPCore
     struct MessageDistDeliverer
     {
         WorldObject* i_source;
-        WorldPacket* i_message;
+        SharedWorldPacket i_message;                        // every receiver queues the same payload
         uint32 i_phaseMask;
         float i_distSq;
         uint32 team;
         Player const* skipped_receiver;
         MessageDistDeliverer(WorldObject* src, WorldPacket* msg, float dist, bool own_team_only = false, Player const* skipped = NULL)
-            : i_source(src), i_message(msg), i_phaseMask(src->GetPhaseMask()), i_distSq(dist * dist)
+            : i_source(src), i_message(*msg), i_phaseMask(src->GetPhaseMask()), i_distSq(dist * dist)
             , team((own_team_only && src->GetTypeId() == TYPEID_PLAYER) ? ((Player*)src)->GetTeam() : 0)
             , skipped_receiver(skipped)
         {
@@ -203,6 +204,12 @@ namespace MoPCore
 
     // SEARCHERS & LIST SEARCHERS & WORKERS
 
+    // Searchers also implement VisitObject, Cell::Visit then hands them the objects that pass the
+    // distance test of the cell spatial index instead of the object lists of every cell
+
+    template<class Check>
+    bool CheckGridObject(Check& check, WorldObject* obj, uint32 typeMask);
+
     // WorldObject searchers & workers
 
     template<class Check>
@@ -223,6 +230,7 @@ namespace MoPCore
         void Visit(DynamicObjectMapType &m);
         void Visit(AreaTriggerMapType &m);
 
+        void VisitObject(WorldObject* obj, uint32 typeMask);
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
     };
 
@@ -244,18 +252,19 @@ namespace MoPCore
         void Visit(DynamicObjectMapType &m);
         void Visit(AreaTriggerMapType &m);
 
+        void VisitObject(WorldObject* obj, uint32 typeMask);
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
     };
 
-    template<class Check>
+    template<class Check, class Container = std::list<WorldObject*> >
     struct WorldObjectListSearcher
     {
         uint32 i_mapTypeMask;
         uint32 i_phaseMask;
-        std::list<WorldObject*> &i_objects;
+        Container &i_objects;
         Check& i_check;
 
-        WorldObjectListSearcher(WorldObject const* searcher, std::list<WorldObject*> &objects, Check & check, uint32 mapTypeMask = GRID_MAP_TYPE_MASK_ALL)
+        WorldObjectListSearcher(WorldObject const* searcher, Container &objects, Check & check, uint32 mapTypeMask = GRID_MAP_TYPE_MASK_ALL)
             : i_mapTypeMask(mapTypeMask), i_phaseMask(searcher->GetPhaseMask()), i_objects(objects), i_check(check) {}
 
         void Visit(PlayerMapType &m);
@@ -265,6 +274,7 @@ namespace MoPCore
         void Visit(DynamicObjectMapType &m);
         void Visit(AreaTriggerMapType &m);
 
+        void VisitObject(WorldObject* obj, uint32 typeMask);
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
     };
 
@@ -348,6 +358,7 @@ namespace MoPCore
 
         void Visit(GameObjectMapType &m);
 
+        void VisitObject(WorldObject* obj, uint32 typeMask);
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
     };
 
@@ -364,6 +375,7 @@ namespace MoPCore
 
         void Visit(GameObjectMapType &m);
 
+        void VisitObject(WorldObject* obj, uint32 typeMask);
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
     };
 
@@ -379,6 +391,7 @@ namespace MoPCore
 
         void Visit(GameObjectMapType &m);
 
+        void VisitObject(WorldObject* obj, uint32 typeMask);
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
     };
 
@@ -418,6 +431,7 @@ namespace MoPCore
         void Visit(CreatureMapType &m);
         void Visit(PlayerMapType &m);
 
+        void VisitObject(WorldObject* obj, uint32 typeMask);
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
     };
 
@@ -435,6 +449,7 @@ namespace MoPCore
         void Visit(CreatureMapType &m);
         void Visit(PlayerMapType &m);
 
+        void VisitObject(WorldObject* obj, uint32 typeMask);
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
     };
 
@@ -452,6 +467,7 @@ namespace MoPCore
         void Visit(PlayerMapType &m);
         void Visit(CreatureMapType &m);
 
+        void VisitObject(WorldObject* obj, uint32 typeMask);
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
     };
 
@@ -469,6 +485,7 @@ namespace MoPCore
 
         void Visit(CreatureMapType &m);
 
+        void VisitObject(WorldObject* obj, uint32 typeMask);
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
     };
 
@@ -485,6 +502,7 @@ namespace MoPCore
 
         void Visit(CreatureMapType &m);
 
+        void VisitObject(WorldObject* obj, uint32 typeMask);
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
     };
 
@@ -500,6 +518,7 @@ namespace MoPCore
 
         void Visit(CreatureMapType &m);
 
+        void VisitObject(WorldObject* obj, uint32 typeMask);
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
     };
 
@@ -536,6 +555,7 @@ namespace MoPCore
 
         void Visit(PlayerMapType &m);
 
+        void VisitObject(WorldObject* obj, uint32 typeMask);
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
     };
 
@@ -551,6 +571,7 @@ namespace MoPCore
 
         void Visit(PlayerMapType &m);
 
+        void VisitObject(WorldObject* obj, uint32 typeMask);
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
     };
 
@@ -567,6 +588,7 @@ namespace MoPCore
 
         void Visit(PlayerMapType& m);
 
+        void VisitObject(WorldObject* obj, uint32 typeMask);
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
     };
 
@@ -41,7 +41,10 @@ inline void MoPCore::ObjectUpdater::Visit(CreatureMapType &m)
 {
     for (CreatureMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
         if (iter->getSource()->IsInWorld())
+        {
             iter->getSource()->Update(i_timeDiff);
+            iter->getSource()->UpdateSpatialIndex();
+        }
 }
 
 // SEARCHERS & LIST SEARCHERS & WORKERS
@@ -186,6 +189,33 @@ void MoPCore::WorldObjectSearcher<Check>::Visit(AreaTriggerMapType &m)
     }
 }
 
+// Calls the check with the concrete type of the object, like the Visit methods of the containers do
+template<class Check>
+inline bool MoPCore::CheckGridObject(Check& check, WorldObject* obj, uint32 typeMask)
+{
+    switch (typeMask)
+    {
+        case GRID_MAP_TYPE_MASK_PLAYER:         return check(static_cast<Player*>(obj));
+        case GRID_MAP_TYPE_MASK_CREATURE:       return check(static_cast<Creature*>(obj));
+        case GRID_MAP_TYPE_MASK_GAMEOBJECT:     return check(static_cast<GameObject*>(obj));
+        case GRID_MAP_TYPE_MASK_DYNAMICOBJECT:  return check(static_cast<DynamicObject*>(obj));
+        case GRID_MAP_TYPE_MASK_CORPSE:         return check(static_cast<Corpse*>(obj));
+        case GRID_MAP_TYPE_MASK_AREATRIGGER:    return check(static_cast<AreaTrigger*>(obj));
+        default:                                return false;
+    }
+}
+
+template<class Check>
+void MoPCore::WorldObjectSearcher<Check>::VisitObject(WorldObject* obj, uint32 typeMask)
+{
+    // already found
+    if (i_object || !(i_mapTypeMask & typeMask))
+        return;
+
+    if (obj->InSamePhase(i_phaseMask) && CheckGridObject(i_check, obj, typeMask))
+        i_object = obj;
+}
+
 template<class Check>
 void MoPCore::WorldObjectLastSearcher<Check>::Visit(GameObjectMapType &m)
 {
@@ -283,7 +313,17 @@ void MoPCore::WorldObjectLastSearcher<Check>::Visit(AreaTriggerMapType  &m)
 }
 
 template<class Check>
-void MoPCore::WorldObjectListSearcher<Check>::Visit(PlayerMapType &m)
+void MoPCore::WorldObjectLastSearcher<Check>::VisitObject(WorldObject* obj, uint32 typeMask)
+{
+    if (!(i_mapTypeMask & typeMask))
+        return;
+
+    if (obj->InSamePhase(i_phaseMask) && CheckGridObject(i_check, obj, typeMask))
+        i_object = obj;
+}
+
+template<class Check, class Container>
+void MoPCore::WorldObjectListSearcher<Check, Container>::Visit(PlayerMapType &m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_PLAYER))
         return;
@@ -293,8 +333,8 @@ void MoPCore::WorldObjectListSearcher<Check>::Visit(PlayerMapType &m)
             i_objects.push_back(itr->getSource());
 }
 
-template<class Check>
-void MoPCore::WorldObjectListSearcher<Check>::Visit(CreatureMapType &m)
+template<class Check, class Container>
+void MoPCore::WorldObjectListSearcher<Check, Container>::Visit(CreatureMapType &m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_CREATURE))
         return;
@@ -304,8 +344,8 @@ void MoPCore::WorldObjectListSearcher<Check>::Visit(CreatureMapType &m)
             i_objects.push_back(itr->getSource());
 }
 
-template<class Check>
-void MoPCore::WorldObjectListSearcher<Check>::Visit(CorpseMapType &m)
+template<class Check, class Container>
+void MoPCore::WorldObjectListSearcher<Check, Container>::Visit(CorpseMapType &m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_CORPSE))
         return;
@@ -315,8 +355,8 @@ void MoPCore::WorldObjectListSearcher<Check>::Visit(CorpseMapType &m)
             i_objects.push_back(itr->getSource());
 }
 
-template<class Check>
-void MoPCore::WorldObjectListSearcher<Check>::Visit(GameObjectMapType &m)
+template<class Check, class Container>
+void MoPCore::WorldObjectListSearcher<Check, Container>::Visit(GameObjectMapType &m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_GAMEOBJECT))
         return;
@@ -326,8 +366,8 @@ void MoPCore::WorldObjectListSearcher<Check>::Visit(GameObjectMapType &m)
             i_objects.push_back(itr->getSource());
 }
 
-template<class Check>
-void MoPCore::WorldObjectListSearcher<Check>::Visit(DynamicObjectMapType &m)
+template<class Check, class Container>
+void MoPCore::WorldObjectListSearcher<Check, Container>::Visit(DynamicObjectMapType &m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_DYNAMICOBJECT))
         return;
@@ -337,8 +377,8 @@ void MoPCore::WorldObjectListSearcher<Check>::Visit(DynamicObjectMapType &m)
             i_objects.push_back(itr->getSource());
 }
 
-template<class Check>
-void MoPCore::WorldObjectListSearcher<Check>::Visit(AreaTriggerMapType &m)
+template<class Check, class Container>
+void MoPCore::WorldObjectListSearcher<Check, Container>::Visit(AreaTriggerMapType &m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_AREATRIGGER))
         return;
@@ -348,6 +388,16 @@ void MoPCore::WorldObjectListSearcher<Check>::Visit(AreaTriggerMapType &m)
             i_objects.push_back(itr->getSource());
 }
 
+template<class Check, class Container>
+void MoPCore::WorldObjectListSearcher<Check, Container>::VisitObject(WorldObject* obj, uint32 typeMask)
+{
+    if (!(i_mapTypeMask & typeMask))
+        return;
+
+    if (CheckGridObject(i_check, obj, typeMask))
+        i_objects.push_back(obj);
+}
+
 // Gameobject searchers
 
 template<class Check>
@@ -370,6 +420,18 @@ void MoPCore::GameObjectSearcher<Check>::Visit(GameObjectMapType &m)
     }
 }
 
+template<class Check>
+void MoPCore::GameObjectSearcher<Check>::VisitObject(WorldObject* obj, uint32 typeMask)
+{
+    // already found
+    if (i_object || typeMask != GRID_MAP_TYPE_MASK_GAMEOBJECT)
+        return;
+
+    GameObject* go = static_cast<GameObject*>(obj);
+    if (go->InSamePhase(i_phaseMask) && i_check(go))
+        i_object = go;
+}
+
 template<class Check>
 void MoPCore::GameObjectLastSearcher<Check>::Visit(GameObjectMapType &m)
 {
@@ -383,6 +445,17 @@ void MoPCore::GameObjectLastSearcher<Check>::Visit(GameObjectMapType &m)
     }
 }
 
+template<class Check>
+void MoPCore::GameObjectLastSearcher<Check>::VisitObject(WorldObject* obj, uint32 typeMask)
+{
+    if (typeMask != GRID_MAP_TYPE_MASK_GAMEOBJECT)
+        return;
+
+    GameObject* go = static_cast<GameObject*>(obj);
+    if (go->InSamePhase(i_phaseMask) && i_check(go))
+        i_object = go;
+}
+
 template<class Check>
 void MoPCore::GameObjectListSearcher<Check>::Visit(GameObjectMapType &m)
 {
@@ -392,6 +465,17 @@ void MoPCore::GameObjectListSearcher<Check>::Visit(GameObjectMapType &m)
                 i_objects.push_back(itr->getSource());
 }
 
+template<class Check>
+void MoPCore::GameObjectListSearcher<Check>::VisitObject(WorldObject* obj, uint32 typeMask)
+{
+    if (typeMask != GRID_MAP_TYPE_MASK_GAMEOBJECT)
+        return;
+
+    GameObject* go = static_cast<GameObject*>(obj);
+    if (go->InSamePhase(i_phaseMask) && i_check(go))
+        i_objects.push_back(go);
+}
+
 // Unit searchers
 
 template<class Check>
@@ -434,6 +518,25 @@ void MoPCore::UnitSearcher<Check>::Visit(PlayerMapType &m)
     }
 }
 
+template<class Check>
+void MoPCore::UnitSearcher<Check>::VisitObject(WorldObject* obj, uint32 typeMask)
+{
+    // already found
+    if (i_object || !obj->InSamePhase(i_phaseMask))
+        return;
+
+    if (typeMask == GRID_MAP_TYPE_MASK_CREATURE)
+    {
+        if (i_check(static_cast<Creature*>(obj)))
+            i_object = static_cast<Creature*>(obj);
+    }
+    else if (typeMask == GRID_MAP_TYPE_MASK_PLAYER)
+    {
+        if (i_check(static_cast<Player*>(obj)))
+            i_object = static_cast<Player*>(obj);
+    }
+}
+
 template<class Check>
 void MoPCore::UnitLastSearcher<Check>::Visit(CreatureMapType &m)
 {
@@ -460,6 +563,24 @@ void MoPCore::UnitLastSearcher<Check>::Visit(PlayerMapType &m)
     }
 }
 
+template<class Check>
+void MoPCore::UnitLastSearcher<Check>::VisitObject(WorldObject* obj, uint32 typeMask)
+{
+    if (!obj->InSamePhase(i_phaseMask))
+        return;
+
+    if (typeMask == GRID_MAP_TYPE_MASK_CREATURE)
+    {
+        if (i_check(static_cast<Creature*>(obj)))
+            i_object = static_cast<Creature*>(obj);
+    }
+    else if (typeMask == GRID_MAP_TYPE_MASK_PLAYER)
+    {
+        if (i_check(static_cast<Player*>(obj)))
+            i_object = static_cast<Player*>(obj);
+    }
+}
+
 template<class Check>
 void MoPCore::UnitListSearcher<Check>::Visit(PlayerMapType &m)
 {
@@ -478,6 +599,24 @@ void MoPCore::UnitListSearcher<Check>::Visit(CreatureMapType &m)
                 i_objects.push_back(itr->getSource());
 }
 
+template<class Check>
+void MoPCore::UnitListSearcher<Check>::VisitObject(WorldObject* obj, uint32 typeMask)
+{
+    if (!obj->InSamePhase(i_phaseMask))
+        return;
+
+    if (typeMask == GRID_MAP_TYPE_MASK_CREATURE)
+    {
+        if (i_check(static_cast<Creature*>(obj)))
+            i_objects.push_back(static_cast<Creature*>(obj));
+    }
+    else if (typeMask == GRID_MAP_TYPE_MASK_PLAYER)
+    {
+        if (i_check(static_cast<Player*>(obj)))
+            i_objects.push_back(static_cast<Player*>(obj));
+    }
+}
+
 // Creature searchers
 
 template<class Check>
@@ -500,6 +639,18 @@ void MoPCore::CreatureSearcher<Check>::Visit(CreatureMapType &m)
     }
 }
 
+template<class Check>
+void MoPCore::CreatureSearcher<Check>::VisitObject(WorldObject* obj, uint32 typeMask)
+{
+    // already found
+    if (i_object || typeMask != GRID_MAP_TYPE_MASK_CREATURE)
+        return;
+
+    Creature* creature = static_cast<Creature*>(obj);
+    if (creature->InSamePhase(i_phaseMask) && i_check(creature))
+        i_object = creature;
+}
+
 template<class Check>
 void MoPCore::CreatureLastSearcher<Check>::Visit(CreatureMapType &m)
 {
@@ -513,6 +664,17 @@ void MoPCore::CreatureLastSearcher<Check>::Visit(CreatureMapType &m)
     }
 }
 
+template<class Check>
+void MoPCore::CreatureLastSearcher<Check>::VisitObject(WorldObject* obj, uint32 typeMask)
+{
+    if (typeMask != GRID_MAP_TYPE_MASK_CREATURE)
+        return;
+
+    Creature* creature = static_cast<Creature*>(obj);
+    if (creature->InSamePhase(i_phaseMask) && i_check(creature))
+        i_object = creature;
+}
+
 template<class Check>
 void MoPCore::CreatureListSearcher<Check>::Visit(CreatureMapType &m)
 {
@@ -522,6 +684,17 @@ void MoPCore::CreatureListSearcher<Check>::Visit(CreatureMapType &m)
                 i_objects.push_back(itr->getSource());
 }
 
+template<class Check>
+void MoPCore::CreatureListSearcher<Check>::VisitObject(WorldObject* obj, uint32 typeMask)
+{
+    if (typeMask != GRID_MAP_TYPE_MASK_CREATURE)
+        return;
+
+    Creature* creature = static_cast<Creature*>(obj);
+    if (creature->InSamePhase(i_phaseMask) && i_check(creature))
+        i_objects.push_back(creature);
+}
+
 template<class Check>
 void MoPCore::PlayerListSearcher<Check>::Visit(PlayerMapType &m)
 {
@@ -536,6 +709,17 @@ void MoPCore::PlayerListSearcher<Check>::Visit(PlayerMapType &m)
     }
 }
 
+template<class Check>
+void MoPCore::PlayerListSearcher<Check>::VisitObject(WorldObject* obj, uint32 typeMask)
+{
+    if (typeMask != GRID_MAP_TYPE_MASK_PLAYER)
+        return;
+
+    Player* player = static_cast<Player*>(obj);
+    if (player->InSamePhase(i_phaseMask) && i_check(player))
+        i_objects.push_back(player);
+}
+
 template<class Check>
 void MoPCore::PlayerSearcher<Check>::Visit(PlayerMapType &m)
 {
@@ -556,6 +740,18 @@ void MoPCore::PlayerSearcher<Check>::Visit(PlayerMapType &m)
     }
 }
 
+template<class Check>
+void MoPCore::PlayerSearcher<Check>::VisitObject(WorldObject* obj, uint32 typeMask)
+{
+    // already found
+    if (i_object || typeMask != GRID_MAP_TYPE_MASK_PLAYER)
+        return;
+
+    Player* player = static_cast<Player*>(obj);
+    if (player->InSamePhase(i_phaseMask) && i_check(player))
+        i_object = player;
+}
+
 template<class Check>
 void MoPCore::PlayerLastSearcher<Check>::Visit(PlayerMapType& m)
 {
@@ -569,6 +765,17 @@ void MoPCore::PlayerLastSearcher<Check>::Visit(PlayerMapType& m)
     }
 }
 
+template<class Check>
+void MoPCore::PlayerLastSearcher<Check>::VisitObject(WorldObject* obj, uint32 typeMask)
+{
+    if (typeMask != GRID_MAP_TYPE_MASK_PLAYER)
+        return;
+
+    Player* player = static_cast<Player*>(obj);
+    if (player->InSamePhase(i_phaseMask) && i_check(player))
+        i_object = player;
+}
+
 template<class Builder>
 void MoPCore::LocalizedPacketDo<Builder>::operator()(Player* p)
 {
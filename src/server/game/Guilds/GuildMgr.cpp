@@ -112,6 +112,16 @@ Guild* GuildMgr::GetGuildByLeader(uint64 guid) const
     return NULL;
 }
 
+// all guilds and their members are loaded, offline players included
+Guild* GuildMgr::GetGuildByMember(uint64 guid) const
+{
+    for (GuildContainer::const_iterator itr = GuildStore.begin(); itr != GuildStore.end(); ++itr)
+        if (itr->second->IsMember(guid))
+            return itr->second;
+
+    return NULL;
+}
+
 uint32 GuildMgr::GetXPForGuildLevel(uint8 level) const
 {
     if (level < GuildXPperLevel.size())
@@ -34,6 +34,7 @@ public:
     Guild* GetGuildById(uint32 guildId) const;
     Guild* GetGuildByGuid(uint64 guid) const;
     Guild* GetGuildByName(const std::string& guildName) const;
+    Guild* GetGuildByMember(uint64 guid) const;
     std::string GetGuildNameById(uint32 guildId) const;
 
     void LoadGuildXpForLevel();
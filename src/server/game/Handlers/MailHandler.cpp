@@ -328,13 +328,14 @@ void WorldSession::HandleSendMail(WorldPacket& recvData)
         .SendMailTo(trans, MailReceiver(receive, GUID_LOPART(rc)), MailSender(player), body.empty() ? MAIL_CHECK_MASK_COPIED : MAIL_CHECK_MASK_HAS_BODY, deliver_delay);
 
     player->SaveInventoryAndGoldToDB(trans);
-    CharacterDatabase.CommitTransaction(trans);
+    // keyed like the saves of the sender, whose items and money it writes
+    CharacterDatabase.CommitTransaction(trans, SQL_QUEUE_INTERACTIVE, player->GetGUIDLow());
 }
 
 // Called when mail is read
 void WorldSession::HandleMailMarkAsRead(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_MARK_AS_READ");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_MARK_AS_READ");
 
     ObjectGuid mailbox;
     uint32 mailId;
@@ -374,7 +375,7 @@ void WorldSession::HandleMailMarkAsRead(WorldPacket& recvData)
 // Called when client deletes mail
 void WorldSession::HandleMailDelete(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_DELETE");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_DELETE");
 
     uint32 mailId;
     recvData.read_skip<uint32>();
@@ -399,7 +400,7 @@ void WorldSession::HandleMailDelete(WorldPacket& recvData)
 
 void WorldSession::HandleMailReturnToSender(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_RETURN_TO_SENDER");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_RETURN_TO_SENDER");
 
     ObjectGuid owner;
     uint32 mailId;
@@ -462,7 +463,7 @@ void WorldSession::HandleMailReturnToSender(WorldPacket& recvData)
         draft.AddMoney(m->money).SendReturnToSender(GetAccountId(), m->receiver, m->sender, trans);
     }
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, SQL_QUEUE_INTERACTIVE, player->GetGUIDLow());
 
     delete m;                                               //we can deallocate old mail
     player->SendMailResult(mailId, MAIL_RETURNED_TO_SENDER, MAIL_OK);
@@ -471,7 +472,7 @@ void WorldSession::HandleMailReturnToSender(WorldPacket& recvData)
 // Called when player takes item attached in mail
 void WorldSession::HandleMailTakeItem(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_TAKE_ITEM");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_TAKE_ITEM");
 
     ObjectGuid mailbox;
     uint32 mailId;
@@ -570,7 +571,7 @@ void WorldSession::HandleMailTakeItem(WorldPacket& recvData)
 
         player->SaveInventoryAndGoldToDB(trans);
         player->_SaveMail(trans);
-        CharacterDatabase.CommitTransaction(trans);
+        CharacterDatabase.CommitTransaction(trans, SQL_QUEUE_INTERACTIVE, player->GetGUIDLow());
 
         player->SendMailResult(mailId, MAIL_ITEM_TAKEN, MAIL_OK, 0, itemId, count);
     }
@@ -580,7 +581,7 @@ void WorldSession::HandleMailTakeItem(WorldPacket& recvData)
 
 void WorldSession::HandleMailTakeMoney(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_TAKE_MONEY");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_TAKE_MONEY");
 
     ObjectGuid mailbox;
     uint64 money;
@@ -628,13 +629,13 @@ void WorldSession::HandleMailTakeMoney(WorldPacket& recvData)
     SQLTransaction trans = CharacterDatabase.BeginTransaction();
     player->SaveGoldToDB(trans);
     player->_SaveMail(trans);
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, SQL_QUEUE_INTERACTIVE, player->GetGUIDLow());
 }
 
 // Called when player lists his received mails
 void WorldSession::HandleGetMailList(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_GET_MAIL_LIST");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_GET_MAIL_LIST");
 
     ObjectGuid mailBoxGuid;
 
@@ -649,11 +650,13 @@ void WorldSession::HandleGetMailList(WorldPacket& recvData)
     if (!GetPlayer()->GetGameObjectIfCanInteractWith(mailBoxGuid, GAMEOBJECT_TYPE_MAILBOX))
         return;
 
-    Player* player = _player;
-
     //load players mails, and mailed items
-    if (!player->m_mailsLoaded)
-        player->_LoadMail();
+    _player->LoadMail([this]() { SendMailList(); });
+}
+
+void WorldSession::SendMailList()
+{
+    Player* player = _player;
 
     // client can't work with packets > max int16 value
     const uint32 maxPacketSize = 32767;
@@ -779,7 +782,7 @@ void WorldSession::HandleGetMailList(WorldPacket& recvData)
         {
             ObjectGuid senderGuid = (*itr)->sender;
             uint8 bytesOrder[8] = { 7, 0, 6, 5, 4, 2, 3, 1 };
-            dataBuffer.WriteBytesSeq(senderGuid, bitsOrder);
+            dataBuffer.WriteBytesSeq(senderGuid, bytesOrder);
         }
 
         dataBuffer << uint8((*itr)->messageType);                   // Message Type
@@ -824,7 +827,7 @@ void WorldSession::HandleGetMailList(WorldPacket& recvData)
 // Used when player copies mail body to his inventory
 void WorldSession::HandleMailCreateTextItem(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_CREATE_TEXT_ITEM");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_CREATE_TEXT_ITEM");
 
     ObjectGuid mailbox;
     uint32 mailId;
@@ -896,13 +899,15 @@ void WorldSession::HandleMailCreateTextItem(WorldPacket& recvData)
     }
 }
 
-// TODO Fix me! ... this void has probably bad condition, but good data are sent
 void WorldSession::HandleQueryNextMailTime(WorldPacket & /*recvData*/)
 {
-    WorldPacket data(SMSG_QUERY_NEXT_MAIL_TIME);
-    if (!_player->m_mailsLoaded)
-        _player->_LoadMail();
+    _player->LoadMail([this]() { SendQueryNextMailTime(); });
+}
 
+// TODO Fix me! ... this void has probably bad condition, but good data are sent
+void WorldSession::SendQueryNextMailTime()
+{
+    WorldPacket data(SMSG_QUERY_NEXT_MAIL_TIME);
     if (_player->unReadMails > 0)
     {
         int count = 0;
@@ -57,7 +57,7 @@ enum CharterCosts
 
 void WorldSession::HandlePetitionBuyOpcode(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Received opcode CMSG_PETITION_BUY");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Received opcode CMSG_PETITION_BUY");
     ObjectGuid npcGuid;
     uint32 nameLen = 0;
     std::string name;
@@ -85,13 +85,13 @@ void WorldSession::HandlePetitionBuyOpcode(WorldPacket& recvData)
     
     name = recvData.ReadString(nameLen);
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Petitioner with GUID %u tried sell petition: name %s", GUID_LOPART(npcGuid), name.c_str());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Petitioner with GUID %u tried sell petition: name %s", GUID_LOPART(npcGuid), name.c_str());
 
     // prevent cheating
     Creature* creature = GetPlayer()->GetNPCIfCanInteractWith(npcGuid, UNIT_NPC_FLAG_PETITIONER);
     if (!creature)
     {
-        sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: HandlePetitionBuyOpcode - Unit (GUID: %u) not found or you can't interact with him.", GUID_LOPART(npcGuid));
+        TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: HandlePetitionBuyOpcode - Unit (GUID: %u) not found or you can't interact with him.", GUID_LOPART(npcGuid));
         return;
     }
 
@@ -164,31 +164,27 @@ void WorldSession::HandlePetitionBuyOpcode(WorldPacket& recvData)
     // a petition is invalid, if both the owner and the type matches
     // we checked above, if this player is in an arenateam, so this must be
     // datacorruption
-    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_BY_OWNER);
-    stmt->setUInt32(0, _player->GetGUIDLow());
-    stmt->setUInt8(1, type);
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
+    // the invalid petitions are deleted by owner and type, so the map thread does not have to look them up first
+    SQLTransaction trans = CharacterDatabase.BeginTransaction();
 
-    std::ostringstream ssInvalidPetitionGUIDs;
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PETITION_BY_OWNER_AND_TYPE);
+    stmt->setUInt32(0, _player->GetGUIDLow());
+    stmt->setUInt8(1, uint8(type));
+    trans->Append(stmt);
 
-    if (result)
-    {
-        do
-        {
-            Field* fields = result->Fetch();
-            ssInvalidPetitionGUIDs << '\'' << fields[0].GetUInt32() << "', ";
-        }
-        while (result->NextRow());
-    }
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PETITION_SIGNATURE_BY_OWNER_AND_TYPE);
+    stmt->setUInt32(0, _player->GetGUIDLow());
+    stmt->setUInt8(1, uint8(type));
+    trans->Append(stmt);
 
     // delete petitions with the same guid as this one
-    ssInvalidPetitionGUIDs << '\'' << charter->GetGUIDLow() << '\'';
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PETITION_BY_GUID);
+    stmt->setUInt32(0, charter->GetGUIDLow());
+    trans->Append(stmt);
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Invalid petition GUIDs: %s", ssInvalidPetitionGUIDs.str().c_str());
-    CharacterDatabase.EscapeString(name);
-    SQLTransaction trans = CharacterDatabase.BeginTransaction();
-    trans->PAppend("DELETE FROM petition WHERE petitionguid IN (%s)",  ssInvalidPetitionGUIDs.str().c_str());
-    trans->PAppend("DELETE FROM petition_sign WHERE petitionguid IN (%s)", ssInvalidPetitionGUIDs.str().c_str());
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PETITION_SIGNATURE_BY_GUID);
+    stmt->setUInt32(0, charter->GetGUIDLow());
+    trans->Append(stmt);
 
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PETITION);
     stmt->setUInt32(0, _player->GetGUIDLow());
@@ -202,9 +198,8 @@ void WorldSession::HandlePetitionBuyOpcode(WorldPacket& recvData)
 
 void WorldSession::HandlePetitionShowSignOpcode(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Received opcode CMSG_PETITION_SHOW_SIGNATURES");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Received opcode CMSG_PETITION_SHOW_SIGNATURES");
 
-    uint8 signs = 0;
     ObjectGuid petitionguid;
 
     uint8 bitsOrder[8] = { 4, 3, 5, 6, 2, 1, 0, 7 };
@@ -222,11 +217,19 @@ void WorldSession::HandlePetitionShowSignOpcode(WorldPacket& recvData)
 
     stmt->setUInt32(0, petitionGuidLow);
 
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
+    AddQueryCallback(CharacterDatabase.AsyncQuery(stmt), [this, petitionguid](PreparedQueryResult result)
+    {
+        HandlePetitionShowSignCallback(result, petitionguid);
+    });
+}
+
+void WorldSession::HandlePetitionShowSignCallback(PreparedQueryResult result, ObjectGuid petitionguid)
+{
+    uint32 petitionGuidLow = GUID_LOPART(petitionguid);
 
     if (!result)
     {
-        sLog->outDebug(LOG_FILTER_PLAYER_ITEMS, "Petition %u is not found for player %u %s", GUID_LOPART(petitionguid), GetPlayer()->GetGUIDLow(), GetPlayer()->GetName());
+        TC_LOG_DEBUG(LOG_FILTER_PLAYER_ITEMS, "Petition %u is not found for player %u %s", GUID_LOPART(petitionguid), GetPlayer()->GetGUIDLow(), GetPlayer()->GetName());
         return;
     }
     Field* fields = result->Fetch();
@@ -236,17 +239,26 @@ void WorldSession::HandlePetitionShowSignOpcode(WorldPacket& recvData)
     if (type == GUILD_CHARTER_TYPE && _player->GetGuildId())
         return;
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_SIGNATURE);
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_SIGNATURE);
 
     stmt->setUInt32(0, petitionGuidLow);
 
-    result = CharacterDatabase.Query(stmt);
+    AddQueryCallback(CharacterDatabase.AsyncQuery(stmt), [this, petitionguid](PreparedQueryResult result)
+    {
+        SendPetitionSignatures(result, petitionguid);
+    });
+}
+
+void WorldSession::SendPetitionSignatures(PreparedQueryResult result, ObjectGuid petitionguid)
+{
+    uint8 signs = 0;
+    uint32 petitionGuidLow = GUID_LOPART(petitionguid);
 
     // result == NULL also correct in case no sign yet
     if (result)
         signs = uint8(result->GetRowCount());
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "CMSG_PETITION_SHOW_SIGNATURES petition entry: '%u'", petitionGuidLow);
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "CMSG_PETITION_SHOW_SIGNATURES petition entry: '%u'", petitionGuidLow);
 
     WorldPacket data(SMSG_PETITION_SHOW_SIGNATURES);
     ByteBuffer signsBuffer;
@@ -324,7 +336,7 @@ void WorldSession::HandlePetitionShowSignOpcode(WorldPacket& recvData)
 
 void WorldSession::HandlePetitionQueryOpcode(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Received opcode CMSG_PETITION_QUERY");   // ok
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Received opcode CMSG_PETITION_QUERY");   // ok
 
     uint32 guildId;
     ObjectGuid petitionGuid;
@@ -339,22 +351,28 @@ void WorldSession::HandlePetitionQueryOpcode(WorldPacket& recvData)
     uint8 bytesOrder[8] = { 6, 5, 1, 7, 4, 3, 2, 0 };
     recvData.ReadBytesSeq(petitionGuid, bytesOrder);
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "CMSG_PETITION_QUERY Petition GUID %u Guild GUID %u", GUID_LOPART(petitionGuid), guildId);
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "CMSG_PETITION_QUERY Petition GUID %u Guild GUID %u", GUID_LOPART(petitionGuid), guildId);
 
     SendPetitionQueryOpcode(uint64(guildId));
 }
 
 void WorldSession::SendPetitionQueryOpcode(uint64 petitionguid)
 {
-    uint64 ownerguid = 0;
-    uint32 type;
-    std::string name = "NO_NAME_FOR_GUID";
-
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION);
 
     stmt->setUInt32(0, GUID_LOPART(petitionguid));
 
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
+    AddQueryCallback(CharacterDatabase.AsyncQuery(stmt), [this, petitionguid](PreparedQueryResult result)
+    {
+        SendPetitionQueryCallback(result, petitionguid);
+    });
+}
+
+void WorldSession::SendPetitionQueryCallback(PreparedQueryResult result, uint64 petitionguid)
+{
+    uint64 ownerguid = 0;
+    uint32 type;
+    std::string name = "NO_NAME_FOR_GUID";
 
     if (result)
     {
@@ -365,7 +383,7 @@ void WorldSession::SendPetitionQueryOpcode(uint64 petitionguid)
     }
     else
     {
-        sLog->outDebug(LOG_FILTER_NETWORKIO, "CMSG_PETITION_QUERY failed for petition (GUID: %u)", GUID_LOPART(petitionguid));
+        TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "CMSG_PETITION_QUERY failed for petition (GUID: %u)", GUID_LOPART(petitionguid));
         return;
     }
 
@@ -428,7 +446,7 @@ void WorldSession::SendPetitionQueryOpcode(uint64 petitionguid)
 
 void WorldSession::HandlePetitionRenameOpcode(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Received opcode CMSG_PETITION_RENAME");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Received opcode CMSG_PETITION_RENAME");
 
     ObjectGuid petitionGuid;
     uint32 type = 0;
@@ -460,7 +478,7 @@ void WorldSession::HandlePetitionRenameOpcode(WorldPacket& recvData)
     Item* item = _player->GetItemByGuid(petitionGuid);
     if (!item)
     {
-        sLog->outDebug(LOG_FILTER_NETWORKIO, "CMSG_PETITION_QUERY failed for petition (GUID: %u)", GUID_LOPART(petitionGuid));
+        TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "CMSG_PETITION_QUERY failed for petition (GUID: %u)", GUID_LOPART(petitionGuid));
         return;
     }
 
@@ -480,7 +498,7 @@ void WorldSession::HandlePetitionRenameOpcode(WorldPacket& recvData)
     stmt->setUInt32(1, GUID_LOPART(petitionGuid));
     CharacterDatabase.Execute(stmt);
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Petition (GUID: %u) renamed to '%s'", GUID_LOPART(petitionGuid), newName.c_str());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Petition (GUID: %u) renamed to '%s'", GUID_LOPART(petitionGuid), newName.c_str());
 
     WorldPacket data(SMSG_PETITION_RENAME);
 
@@ -514,9 +532,8 @@ void WorldSession::HandlePetitionRenameOpcode(WorldPacket& recvData)
 
 void WorldSession::HandlePetitionSignOpcode(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Received opcode CMSG_PETITION_SIGN");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Received opcode CMSG_PETITION_SIGN");
 
-    Field* fields;
     ObjectGuid petitionGuid;
     uint8 unk;
 
@@ -530,28 +547,25 @@ void WorldSession::HandlePetitionSignOpcode(WorldPacket& recvData)
     uint8 bytesOrder[8] = { 5, 0, 6, 4, 2, 7, 1, 3 };
     recvData.ReadBytesSeq(petitionGuid, bytesOrder);
 
-    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION);
-    stmt->setUInt32(0, GUID_LOPART(petitionGuid));
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-    if (!result)
-        return;
-
-    fields = result->Fetch();
-    ObjectGuid ownerGuid = MAKE_NEW_GUID(fields[0].GetUInt32(), 0, HIGHGUID_PLAYER);
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_SIGNATURES);
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_SIGNATURES);
     stmt->setUInt32(0, GUID_LOPART(petitionGuid));
     stmt->setUInt32(1, GUID_LOPART(petitionGuid));
-    result = CharacterDatabase.Query(stmt);
+    AddQueryCallback(CharacterDatabase.AsyncQuery(stmt), [this, petitionGuid](PreparedQueryResult result)
+    {
+        HandlePetitionSignCallback(result, petitionGuid);
+    });
+}
 
+void WorldSession::HandlePetitionSignCallback(PreparedQueryResult result, ObjectGuid petitionGuid)
+{
     if (!result)
     {
         sLog->outError(LOG_FILTER_NETWORKIO, "Petition %u is not found for player %u %s", GUID_LOPART(petitionGuid), GetPlayer()->GetGUIDLow(), GetPlayer()->GetName());
         return;
     }
 
-    fields = result->Fetch();
+    Field* fields = result->Fetch();
+    ObjectGuid ownerGuid = MAKE_NEW_GUID(fields[0].GetUInt32(), 0, HIGHGUID_PLAYER);
     uint64 signs = fields[1].GetUInt64();
     uint8 type = fields[2].GetUInt8();
 
@@ -586,40 +600,43 @@ void WorldSession::HandlePetitionSignOpcode(WorldPacket& recvData)
 
     // Client doesn't allow to sign petition two times by one character, but not check sign by another character from same account
     // not allow sign another player from already sign player account
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_SIG_BY_ACCOUNT);
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_SIG_BY_ACCOUNT);
 
     stmt->setUInt32(0, GetAccountId());
     stmt->setUInt32(1, GUID_LOPART(petitionGuid));
 
-    result = CharacterDatabase.Query(stmt);
-
-    if (result)
+    uint64 petitionGuidRaw = petitionGuid;
+    uint64 ownerGuidRaw = ownerGuid;
+    AddQueryCallback(CharacterDatabase.AsyncQuery(stmt), [this, petitionGuidRaw, ownerGuidRaw, playerGuid](PreparedQueryResult result)
     {
-        SendPetitionSignResult(_player->GetGUID(), petitionGuid, PETITION_SIGN_ALREADY_SIGNED);
-        return;
-    }
+        if (result)
+        {
+            SendPetitionSignResult(_player->GetGUID(), petitionGuidRaw, PETITION_SIGN_ALREADY_SIGNED);
+            return;
+        }
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PETITION_SIGNATURE);
+        PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PETITION_SIGNATURE);
 
-    stmt->setUInt32(0, GUID_LOPART(ownerGuid));
-    stmt->setUInt32(1, GUID_LOPART(petitionGuid));
-    stmt->setUInt32(2, playerGuid);
-    stmt->setUInt32(3, GetAccountId());
+        stmt->setUInt32(0, GUID_LOPART(ownerGuidRaw));
+        stmt->setUInt32(1, GUID_LOPART(petitionGuidRaw));
+        stmt->setUInt32(2, playerGuid);
+        stmt->setUInt32(3, GetAccountId());
 
-    CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt);
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "PETITION SIGN: GUID %u by player: %s (GUID: %u Account: %u)", GUID_LOPART(petitionGuid), _player->GetName(), playerGuid, GetAccountId());
+        TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "PETITION SIGN: GUID %u by player: %s (GUID: %u Account: %u)", GUID_LOPART(petitionGuidRaw), _player->GetName(), playerGuid, GetAccountId());
 
-    SendPetitionSignResult(_player->GetGUID(), petitionGuid, PETITION_SIGN_OK);
+        SendPetitionSignResult(_player->GetGUID(), petitionGuidRaw, PETITION_SIGN_OK);
 
-    Player* owner = ObjectAccessor::FindPlayer(ownerGuid);
-    if (owner)
-        owner->GetSession()->SendPetitionSignResult(_player->GetGUID(), petitionGuid, PETITION_SIGN_OK);
+        Player* owner = ObjectAccessor::FindPlayer(ownerGuidRaw);
+        if (owner)
+            owner->GetSession()->SendPetitionSignResult(_player->GetGUID(), petitionGuidRaw, PETITION_SIGN_OK);
+    });
 }
 
 void WorldSession::HandlePetitionDeclineOpcode(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Received opcode CMSG_PETITION_DECLINE");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Received opcode CMSG_PETITION_DECLINE");
 
     ObjectGuid petitionGuid;
 
@@ -631,26 +648,27 @@ void WorldSession::HandlePetitionDeclineOpcode(WorldPacket& recvData)
     uint8 bytesOrder[8] = { 5, 3, 4, 6, 0, 7, 2, 1 };
     recvData.ReadBytesSeq(petitionGuid, bytesOrder);
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Petition %u declined by %u", GUID_LOPART(petitionGuid), _player->GetGUIDLow());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Petition %u declined by %u", GUID_LOPART(petitionGuid), _player->GetGUIDLow());
 
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION);
     stmt->setUInt32(0, GUID_LOPART(petitionGuid));
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-    if (!result)
-        return;
+    AddQueryCallback(CharacterDatabase.AsyncQuery(stmt), [petitionGuid](PreparedQueryResult result)
+    {
+        if (!result)
+            return;
 
-    Field* fields = result->Fetch();
-    ObjectGuid ownerGuid = MAKE_NEW_GUID(fields[0].GetUInt32(), 0, HIGHGUID_PLAYER);
+        Field* fields = result->Fetch();
+        ObjectGuid ownerGuid = MAKE_NEW_GUID(fields[0].GetUInt32(), 0, HIGHGUID_PLAYER);
 
-    Player* owner = ObjectAccessor::FindPlayer(ownerGuid);
-    if (owner)
-        owner->GetSession()->SendPetitionSignResult(ownerGuid, petitionGuid, PETITION_SIGN_DECLINED);
+        Player* owner = ObjectAccessor::FindPlayer(ownerGuid);
+        if (owner)
+            owner->GetSession()->SendPetitionSignResult(ownerGuid, petitionGuid, PETITION_SIGN_DECLINED);
+    });
 }
 
 void WorldSession::HandleOfferPetitionOpcode(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Received opcode CMSG_OFFER_PETITION");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Received opcode CMSG_OFFER_PETITION");
 
     ObjectGuid petitionGuid, playerGuid;
     uint32 type, junk;
@@ -707,7 +725,7 @@ void WorldSession::HandleOfferPetitionOpcode(WorldPacket& recvData)
 
     uint32 petitionGuidLow = GUID_LOPART(petitionGuid);
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "OFFER PETITION: type %u, GUID1 %u, to player id: %u", type, petitionGuidLow, GUID_LOPART(playerGuid));
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "OFFER PETITION: type %u, GUID1 %u, to player id: %u", type, petitionGuidLow, GUID_LOPART(playerGuid));
 
     if (!sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_INTERACTION_GUILD) && GetPlayer()->GetTeam() != player->GetTeam())
     {
@@ -733,7 +751,22 @@ void WorldSession::HandleOfferPetitionOpcode(WorldPacket& recvData)
 
     auto stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_SIGNATURE);
     stmt->setUInt32(0, petitionGuidLow);
-    auto result = CharacterDatabase.Query(stmt);
+    AddQueryCallback(CharacterDatabase.AsyncQuery(stmt), [this, petitionGuid, playerGuid](PreparedQueryResult result)
+    {
+        HandleOfferPetitionCallback(result, petitionGuid, playerGuid);
+    });
+}
+
+void WorldSession::HandleOfferPetitionCallback(PreparedQueryResult result, ObjectGuid petitionGuid, ObjectGuid playerGuid)
+{
+    // the player may have logged out while the signatures were loaded
+    Player* player = ObjectAccessor::FindPlayer(playerGuid);
+    if (!player)
+        return;
+
+    uint32 petitionGuidLow = GUID_LOPART(petitionGuid);
+    ObjectGuid guid1 = petitionGuid;
+    ObjectGuid guid2;
 
     typedef std::vector<uint32> storage;
     storage loParts;
@@ -833,10 +866,9 @@ void WorldSession::HandleOfferPetitionOpcode(WorldPacket& recvData)
 
 void WorldSession::HandleTurnInPetitionOpcode(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Received opcode CMSG_TURN_IN_PETITION");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Received opcode CMSG_TURN_IN_PETITION");
 
     // Get petition guid from packet
-    WorldPacket data;
     ObjectGuid petitionGuid;
 
     uint8 bitsOrder[8] = { 2, 3, 5, 0, 7, 1, 4, 6 };
@@ -852,17 +884,23 @@ void WorldSession::HandleTurnInPetitionOpcode(WorldPacket& recvData)
     if (!item)
         return;
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Petition %u turned in by %u", GUID_LOPART(petitionGuid), _player->GetGUIDLow());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Petition %u turned in by %u", GUID_LOPART(petitionGuid), _player->GetGUIDLow());
 
     // Get petition data from db
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION);
+    stmt->setUInt32(0, GUID_LOPART(petitionGuid));
+    AddQueryCallback(CharacterDatabase.AsyncQuery(stmt), [this, petitionGuid](PreparedQueryResult result)
+    {
+        HandleTurnInPetitionCallback(result, petitionGuid);
+    });
+}
+
+void WorldSession::HandleTurnInPetitionCallback(PreparedQueryResult result, ObjectGuid petitionGuid)
+{
     uint32 ownerguidlo;
     uint32 type;
     std::string name;
 
-    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION);
-    stmt->setUInt32(0, GUID_LOPART(petitionGuid));
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
     if (result)
     {
         Field* fields = result->Fetch();
@@ -880,6 +918,24 @@ void WorldSession::HandleTurnInPetitionOpcode(WorldPacket& recvData)
     if (_player->GetGUIDLow() != ownerguidlo)
         return;
 
+    // Get petition signatures from db
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_SIGNATURE);
+    stmt->setUInt32(0, GUID_LOPART(petitionGuid));
+    AddQueryCallback(CharacterDatabase.AsyncQuery(stmt), [this, petitionGuid, name](PreparedQueryResult result)
+    {
+        HandleTurnInPetitionSignaturesCallback(result, petitionGuid, name);
+    });
+}
+
+void WorldSession::HandleTurnInPetitionSignaturesCallback(PreparedQueryResult result, ObjectGuid petitionGuid, std::string const& name)
+{
+    WorldPacket data;
+
+    // the charter may have been traded or destroyed meanwhile, it is deleted below
+    Item* item = _player->GetItemByGuid(petitionGuid);
+    if (!item)
+        return;
+
     // Check if player is already in a guild
     if (_player->GetGuildId())
     {
@@ -897,13 +953,8 @@ void WorldSession::HandleTurnInPetitionOpcode(WorldPacket& recvData)
         return;
     }
 
-    // Get petition signatures from db
     uint8 signatures;
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_SIGNATURE);
-    stmt->setUInt32(0, GUID_LOPART(petitionGuid));
-    result = CharacterDatabase.Query(stmt);
-
     if (result)
         signatures = uint8(result->GetRowCount());
     else
@@ -949,7 +1000,7 @@ void WorldSession::HandleTurnInPetitionOpcode(WorldPacket& recvData)
 
     SQLTransaction trans = CharacterDatabase.BeginTransaction();
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PETITION_BY_GUID);
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PETITION_BY_GUID);
     stmt->setUInt32(0, GUID_LOPART(petitionGuid));
     trans->Append(stmt);
 
@@ -960,7 +1011,7 @@ void WorldSession::HandleTurnInPetitionOpcode(WorldPacket& recvData)
     CharacterDatabase.CommitTransaction(trans);
 
     // created
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "TURN IN PETITION GUID %u", GUID_LOPART(petitionGuid));
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "TURN IN PETITION GUID %u", GUID_LOPART(petitionGuid));
 
     data.Initialize(SMSG_TURN_IN_PETITION_RESULTS, 4);
     data.WriteBits(PETITION_TURN_OK, 4);
@@ -970,7 +1021,7 @@ void WorldSession::HandleTurnInPetitionOpcode(WorldPacket& recvData)
 
 void WorldSession::HandlePetitionShowListOpcode(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Received CMSG_PETITION_SHOWLIST");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Received CMSG_PETITION_SHOWLIST");
 
     ObjectGuid PetitionGuid;
     
@@ -1002,7 +1053,7 @@ void WorldSession::SendPetitionShowList(uint64 guid)
     Creature* creature = GetPlayer()->GetNPCIfCanInteractWith(guid, UNIT_NPC_FLAG_PETITIONER);
     if (!creature)
     {
-        sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: HandlePetitionShowListOpcode - Unit (GUID: %u) not found or you can't interact with him.", uint32(GUID_LOPART(guid)));
+        TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: HandlePetitionShowListOpcode - Unit (GUID: %u) not found or you can't interact with him.", uint32(GUID_LOPART(guid)));
         return;
     }
 
@@ -1028,7 +1079,7 @@ void WorldSession::SendPetitionShowList(uint64 guid)
 
     SendPacket(&data);
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Sent SMSG_PETITION_SHOW_LIST");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Sent SMSG_PETITION_SHOW_LIST");
 }
 
 void WorldSession::SendPetitionSignResult(ObjectGuid ownerGuid, ObjectGuid petitionGuid, uint8 result)
@@ -433,7 +433,7 @@ void WorldSession::HandleUseItemOpcode(WorldPacket& recvPacket)
         return;
     }
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_USE_ITEM packet, bagIndex: %u, slot: %u, castCount: %u, spellId: %u, Item: %u, glyphIndex: %u, data length = %i", bagIndex, slot, castCount, spellId, pItem->GetEntry(), glyphIndex, (uint32)recvPacket.size());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_USE_ITEM packet, bagIndex: %u, slot: %u, castCount: %u, spellId: %u, Item: %u, glyphIndex: %u, data length = %i", bagIndex, slot, castCount, spellId, pItem->GetEntry(), glyphIndex, (uint32)recvPacket.size());
 
     ItemTemplate const* proto = pItem->GetTemplate();
     if (!proto)
@@ -520,7 +520,7 @@ void WorldSession::HandleUseItemOpcode(WorldPacket& recvPacket)
 
 void WorldSession::HandleOpenItemOpcode(WorldPacket& recvPacket)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_OPEN_ITEM packet, data length = %i", (uint32)recvPacket.size());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_OPEN_ITEM packet, data length = %i", (uint32)recvPacket.size());
 
     Player* pUser = _player;
 
@@ -584,31 +584,38 @@ void WorldSession::HandleOpenItemOpcode(WorldPacket& recvPacket)
 
         stmt->setUInt32(0, item->GetGUIDLow());
 
-        PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-        if (result)
-        {
-            Field* fields = result->Fetch();
-            uint32 entry = fields[0].GetUInt32();
-            uint32 flags = fields[1].GetUInt32();
-
-            item->SetUInt64Value(ITEM_FIELD_GIFTCREATOR, 0);
-            item->SetEntry(entry);
-            item->SetUInt32Value(ITEM_FIELD_FLAGS, flags);
-            item->SetState(ITEM_CHANGED, pUser);
-        }
-        else
+        uint64 itemGuid = item->GetGUID();
+        AddQueryCallback(CharacterDatabase.AsyncQuery(stmt), [this, itemGuid](PreparedQueryResult result)
         {
-            sLog->outError(LOG_FILTER_NETWORKIO, "Wrapped item %u don't have record in character_gifts table and will deleted", item->GetGUIDLow());
-            pUser->DestroyItem(item->GetBagSlot(), item->GetSlot(), true);
-            return;
-        }
+            // the item may have been moved, traded or destroyed while the gift was looked up
+            Item* item = _player->GetItemByGuid(itemGuid);
+            if (!item || !item->HasFlag(ITEM_FIELD_FLAGS, ITEM_FLAG_WRAPPED))
+                return;
 
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GIFT);
+            if (result)
+            {
+                Field* fields = result->Fetch();
+                uint32 entry = fields[0].GetUInt32();
+                uint32 flags = fields[1].GetUInt32();
+
+                item->SetUInt64Value(ITEM_FIELD_GIFTCREATOR, 0);
+                item->SetEntry(entry);
+                item->SetUInt32Value(ITEM_FIELD_FLAGS, flags);
+                item->SetState(ITEM_CHANGED, _player);
+            }
+            else
+            {
+                sLog->outError(LOG_FILTER_NETWORKIO, "Wrapped item %u don't have record in character_gifts table and will deleted", item->GetGUIDLow());
+                _player->DestroyItem(item->GetBagSlot(), item->GetSlot(), true);
+                return;
+            }
 
-        stmt->setUInt32(0, item->GetGUIDLow());
+            PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GIFT);
+
+            stmt->setUInt32(0, item->GetGUIDLow());
 
-        CharacterDatabase.Execute(stmt);
+            CharacterDatabase.Execute(stmt);
+        });
     }
     else
         pUser->SendLoot(item->GetGUID(), LOOT_CORPSE);
@@ -626,7 +633,7 @@ void WorldSession::HandleGameObjectUseOpcode(WorldPacket& recvData)
     uint8 bytesOrder[8] = { 4, 3, 2, 0, 5, 6, 1, 7 };
     recvData.ReadBytesSeq(guid, bytesOrder);
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: Recvd CMSG_GAMEOBJECT_USE Message [guid=%u]", GUID_LOPART(guid));
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: Recvd CMSG_GAMEOBJECT_USE Message [guid=%u]", GUID_LOPART(guid));
 
     // ignore for remote control state
     if (_player->m_mover != _player)
@@ -648,7 +655,7 @@ void WorldSession::HandleGameobjectReportUse(WorldPacket& recvPacket)
     uint8 bytesOrder[8] = { 1, 3, 5, 4, 6, 7, 2, 0 };
     recvPacket.ReadBytesSeq(guid, bytesOrder);
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: Recvd CMSG_GAMEOBJECT_REPORT_USE Message [in game guid: %u]", GUID_LOPART(guid));
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: Recvd CMSG_GAMEOBJECT_REPORT_USE Message [in game guid: %u]", GUID_LOPART(guid));
 
     // ignore for remote control state
     if (_player->m_mover != _player)
@@ -1577,7 +1584,7 @@ void WorldSession::HandleTotemDestroyed(WorldPacket& recvPacket)
 
 void WorldSession::HandleSelfResOpcode(WorldPacket& /*recvData*/)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_SELF_RES");                  // empty opcode
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_SELF_RES");                  // empty opcode
 
     if (_player->HasAuraType(SPELL_AURA_PREVENT_RESURRECTION))
         return; // silent return, client should display error by itself and not send this opcode
@@ -1629,7 +1636,7 @@ void WorldSession::HandleSpellClick(WorldPacket& recvData)
 
 void WorldSession::HandleMirrorImageDataRequest(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_GET_MIRRORIMAGE_DATA");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_GET_MIRRORIMAGE_DATA");
     ObjectGuid guid;
     uint32 displayId = recvData.read<uint32>();
 
@@ -1811,7 +1818,7 @@ void WorldSession::HandleMirrorImageDataRequest(WorldPacket& recvData)
 
 void WorldSession::HandleUpdateProjectilePosition(WorldPacket& recvPacket)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_UPDATE_PROJECTILE_POSITION");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_UPDATE_PROJECTILE_POSITION");
 
     uint64 casterGuid;
     uint32 spellId;
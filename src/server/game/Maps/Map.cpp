@@ -34,6 +34,10 @@
 #include "DynamicTree.h"
 #include "Vehicle.h"
 
+#include <ace/Mem_Map.h>
+#include <ace/OS_NS_unistd.h>
+#include <ace/TSS_T.h>
+
 union u_map_magic
 {
     char asChar[4];
@@ -69,6 +73,20 @@ Map::~Map()
 
     if (!m_scriptSchedule.empty())
         sScriptMgr->DecreaseScheduledScriptCount(m_scriptSchedule.size());
+
+    for (std::vector<MarkedCells*>::const_iterator itr = _regionMarkedCells.begin(); itr != _regionMarkedCells.end(); ++itr)
+        delete *itr;
+
+    // items of players that left the map can still wait here, hand them to the map of their owner
+    while (!_updateObjects.empty())
+    {
+        Object* obj = *_updateObjects.begin();
+        _updateObjects.erase(_updateObjects.begin());
+        if (obj->GetObjectUpdateMap() != this)
+            obj->AddToObjectUpdate();
+        else
+            obj->ClearUpdateMask(false);
+    }
 }
 
 bool Map::ExistMap(uint32 mapid, int gx, int gy)
@@ -130,9 +148,11 @@ void Map::LoadVMap(int gx, int gy)
             sLog->outInfo(LOG_FILTER_MAPS, "Could not load VMAP name:%s, id:%d, x:%d, y:%d (vmap rep.: x:%d, y:%d)", GetMapName(), GetId(), gx, gy, gx, gy);
             break;
         case VMAP::VMAP_LOAD_RESULT_IGNORED:
-            sLog->outDebug(LOG_FILTER_MAPS, "Ignored VMAP name:%s, id:%d, x:%d, y:%d (vmap rep.: x:%d, y:%d)", GetMapName(), GetId(), gx, gy, gx, gy);
+            TC_LOG_DEBUG(LOG_FILTER_MAPS, "Ignored VMAP name:%s, id:%d, x:%d, y:%d (vmap rep.: x:%d, y:%d)", GetMapName(), GetId(), gx, gy, gx, gy);
             break;
     }
+
+    _queryCache.InvalidateTerrain();
 }
 
 void Map::LoadMap(int gx, int gy, bool reload)
@@ -148,6 +168,7 @@ void Map::LoadMap(int gx, int gy, bool reload)
 
         ((MapInstanced*)(m_parentMap))->AddGridMapReference(GridCoord(gx, gy));
         GridMaps[gx][gy] = m_parentMap->GridMaps[gx][gy];
+        _queryCache.InvalidateTerrain();
         return;
     }
 
@@ -176,6 +197,8 @@ void Map::LoadMap(int gx, int gy, bool reload)
         sLog->outError(LOG_FILTER_MAPS, "Error loading map file: \n %s\n", tmp);
     }
     delete [] tmp;
+
+    _queryCache.InvalidateTerrain();
 }
 
 void Map::LoadMapAndVMap(int gx, int gy)
@@ -202,11 +225,11 @@ void Map::DeleteStateMachine()
 }
 
 Map::Map(uint32 id, time_t expiry, uint32 InstanceId, uint8 SpawnMode, Map* _parent):
-_creatureToMoveLock(false), i_mapEntry (sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode), i_InstanceId(InstanceId),
+_creatureToMoveLock(false), _regionUpdate(false), i_mapEntry (sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode), i_InstanceId(InstanceId),
 m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
 m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD),
 m_activeNonPlayersIter(m_activeNonPlayers.end()), i_gridExpiry(expiry),
-i_scriptLock(false)
+i_scriptLock(false), _regionCondition(_regionLock), _nextRegion(0), _finishedRegions(0)
 {
     m_parentMap = (_parent ? _parent : this);
     for (unsigned int idx=0; idx < MAX_NUMBER_OF_GRIDS; ++idx)
@@ -269,7 +292,7 @@ void Map::SwitchGridContainers(Creature* obj, bool on)
     if (!IsGridLoaded(GridCoord(cell.data.Part.grid_x, cell.data.Part.grid_y)))
         return;
 
-    sLog->outDebug(LOG_FILTER_MAPS, "Switch object " UI64FMTD " from grid[%u, %u] %u", obj->GetGUID(), cell.data.Part.grid_x, cell.data.Part.grid_y, on);
+    TC_LOG_DEBUG(LOG_FILTER_MAPS, "Switch object " UI64FMTD " from grid[%u, %u] %u", obj->GetGUID(), cell.data.Part.grid_x, cell.data.Part.grid_y, on);
     NGridType *ngrid = getNGrid(cell.GridX(), cell.GridY());
     ASSERT(ngrid != NULL);
 
@@ -300,7 +323,7 @@ template<>
 void Map::DeleteFromWorld(Player* player)
 {
     sObjectAccessor->RemoveObject(player);
-    sObjectAccessor->RemoveUpdateObject(player); //TODO: I do not know why we need this, it should be removed in ~Object anyway
+    player->RemoveFromObjectUpdate();
     delete player;
 }
 
@@ -313,7 +336,7 @@ void Map::EnsureGridCreated(const GridCoord &p)
         TRINITY_GUARD(ACE_Thread_Mutex, Lock);
         if (!getNGrid(p.x_coord, p.y_coord))
         {
-            sLog->outDebug(LOG_FILTER_MAPS, "Creating grid[%u, %u] for map %u instance %u", p.x_coord, p.y_coord, GetId(), i_InstanceId);
+            TC_LOG_DEBUG(LOG_FILTER_MAPS, "Creating grid[%u, %u] for map %u instance %u", p.x_coord, p.y_coord, GetId(), i_InstanceId);
 
             setNGrid(new NGridType(p.x_coord*MAX_NUMBER_OF_GRIDS + p.y_coord, p.x_coord, p.y_coord, i_gridExpiry, sWorld->getBoolConfig(CONFIG_GRID_UNLOAD)),
                 p.x_coord, p.y_coord);
@@ -343,7 +366,7 @@ void Map::EnsureGridLoadedForActiveObject(const Cell &cell, WorldObject* object)
     // refresh grid state & timer
     if (grid->GetGridState() != GRID_STATE_ACTIVE)
     {
-        sLog->outDebug(LOG_FILTER_MAPS, "Active object " UI64FMTD " triggers loading of grid [%u, %u] on map %u", object->GetGUID(), cell.GridX(), cell.GridY(), GetId());
+        TC_LOG_DEBUG(LOG_FILTER_MAPS, "Active object " UI64FMTD " triggers loading of grid [%u, %u] on map %u", object->GetGUID(), cell.GridX(), cell.GridY(), GetId());
         ResetGridExpiry(*grid, 0.1f);
         grid->SetGridState(GRID_STATE_ACTIVE);
     }
@@ -358,7 +381,7 @@ bool Map::EnsureGridLoaded(const Cell &cell)
     ASSERT(grid != NULL);
     if (!isGridObjectDataLoaded(cell.GridX(), cell.GridY()))
     {
-        sLog->outDebug(LOG_FILTER_MAPS, "Loading grid[%u, %u] for map %u instance %u", cell.GridX(), cell.GridY(), GetId(), i_InstanceId);
+        TC_LOG_DEBUG(LOG_FILTER_MAPS, "Loading grid[%u, %u] for map %u instance %u", cell.GridX(), cell.GridY(), GetId(), i_InstanceId);
 
         setGridObjectDataLoaded(true, cell.GridX(), cell.GridY());
 
@@ -446,7 +469,7 @@ bool Map::AddToMap(T *obj)
     else
         EnsureGridCreated(GridCoord(cell.GridX(), cell.GridY()));
     AddToGrid(obj, cell);
-    sLog->outDebug(LOG_FILTER_MAPS, "Object %u enters grid[%u, %u]", GUID_LOPART(obj->GetGUID()), cell.GridX(), cell.GridY());
+    TC_LOG_DEBUG(LOG_FILTER_MAPS, "Object %u enters grid[%u, %u]", GUID_LOPART(obj->GetGUID()), cell.GridX(), cell.GridY());
 
     //Must already be set before AddToMap. Usually during obj->Create.
     //obj->SetMap(this);
@@ -469,6 +492,11 @@ bool Map::IsGridLoaded(const GridCoord &p) const
 }
 
 void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<MoPCore::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<MoPCore::ObjectUpdater, WorldTypeMapContainer> &worldVisitor)
+{
+    VisitNearbyCellsOf(obj, gridVisitor, worldVisitor, marked_cells);
+}
+
+void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<MoPCore::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<MoPCore::ObjectUpdater, WorldTypeMapContainer> &worldVisitor, MarkedCells& markedCells)
 {
     // Check for valid position
     if (!obj->IsPositionValid())
@@ -484,10 +512,10 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<MoPCore::Obj
             // marked cells are those that have been visited
             // don't visit the same cell twice
             uint32 cell_id = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
-            if (isCellMarked(cell_id))
+            if (markedCells.test(cell_id))
                 continue;
 
-            markCell(cell_id);
+            markedCells.set(cell_id);
             CellCoord pair(x, y);
             Cell cell(pair);
             cell.SetNoCreate();
@@ -500,6 +528,7 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<MoPCore::Obj
 void Map::Update(const uint32 t_diff)
 {
     _dynamicTree.update(t_diff);
+    _queryCache.NextTick();
     /// update worldsessions for existing players
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
@@ -513,39 +542,70 @@ void Map::Update(const uint32 t_diff)
         }
     }
     /// update active cells around players and active objects
-    resetMarkedCells();
+    bool split = false;
+    bool playersUpdated = CanUpdateRegions();
+    if (playersUpdated)
+    {
+        // players reach anything (groups, trades, duels, mail, other maps), they are never updated in parallel
+        for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
+        {
+            Player* player = m_mapRefIter->getSource();
+            if (!player || !player->IsInWorld())
+                continue;
 
-    MoPCore::ObjectUpdater updater(t_diff);
-    // for creature
-    TypeContainerVisitor<MoPCore::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
-    // for pets
-    TypeContainerVisitor<MoPCore::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
+            player->Update(t_diff);
+            player->UpdateSpatialIndex();
+        }
 
-    // the player iterator is stored in the map object
-    // to make sure calls to Map::Remove don't invalidate it
-    for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
+        split = BuildRegions(sWorld->getFloatConfig(CONFIG_MAPUPDATE_REGION_MARGIN));
+    }
+
+    if (split)
     {
-        Player* player = m_mapRefIter->getSource();
+        m_updateStats.regions = _regions.size();
+        UpdateRegions(t_diff);
+    }
+    else
+    {
+        m_updateStats.regions = 0;
+        resetMarkedCells();
 
-        if (!player || !player->IsInWorld())
-            continue;
+        MoPCore::ObjectUpdater updater(t_diff);
+        // for creature
+        TypeContainerVisitor<MoPCore::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
+        // for pets
+        TypeContainerVisitor<MoPCore::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
 
-        // update players at tick
-        player->Update(t_diff);
+        // the player iterator is stored in the map object
+        // to make sure calls to Map::Remove don't invalidate it
+        for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
+        {
+            Player* player = m_mapRefIter->getSource();
 
-        VisitNearbyCellsOf(player, grid_object_update, world_object_update);
-    }
+            if (!player || !player->IsInWorld())
+                continue;
 
-    // non-player active objects, increasing iterator in the loop in case of object removal
-    for (m_activeNonPlayersIter = m_activeNonPlayers.begin(); m_activeNonPlayersIter != m_activeNonPlayers.end();)
-    {
-        WorldObject* obj = *m_activeNonPlayersIter;
-        ++m_activeNonPlayersIter;
+            // update players at tick
+            if (!playersUpdated)
+            {
+                player->Update(t_diff);
+                player->UpdateSpatialIndex();
+            }
 
-        if (!obj || !obj->IsInWorld())
-            continue;
+            VisitNearbyCellsOf(player, grid_object_update, world_object_update);
+        }
+
+        // non-player active objects, increasing iterator in the loop in case of object removal
+        for (m_activeNonPlayersIter = m_activeNonPlayers.begin(); m_activeNonPlayersIter != m_activeNonPlayers.end();)
+        {
+            WorldObject* obj = *m_activeNonPlayersIter;
+            ++m_activeNonPlayersIter;
+
+            if (!obj || !obj->IsInWorld())
+                continue;
 
-        VisitNearbyCellsOf(obj, grid_object_update, world_object_update);
+            VisitNearbyCellsOf(obj, grid_object_update, world_object_update);
+        }
     }
 
     ///- Process necessary scripts
@@ -561,6 +621,297 @@ void Map::Update(const uint32 t_diff)
     sScriptMgr->OnMapUpdate(this, t_diff);
 }
 
+bool Map::CanUpdateRegions() const
+{
+    if (!sWorld->getBoolConfig(CONFIG_MAPUPDATE_REGION_SPLIT) || !i_mapEntry || !i_mapEntry->IsContinent())
+        return false;
+
+    MapUpdater* mapUpdater = sMapMgr->GetMapUpdater();
+    if (!mapUpdater->activated() || mapUpdater->worker_count() < 2)
+        return false;
+
+    return m_mapRefManager.getSize() >= sWorld->getIntConfig(CONFIG_MAPUPDATE_REGION_MIN_PLAYERS);
+}
+
+bool Map::BuildRegions(float margin)
+{
+    _regions.clear();
+
+    std::vector<WorldObject*> sources;
+    sources.reserve(m_mapRefManager.getSize() + m_activeNonPlayers.size());
+
+    for (MapRefManager::iterator itr = m_mapRefManager.begin(); itr != m_mapRefManager.end(); ++itr)
+        if (Player* player = itr->getSource())
+            if (player->IsInWorld() && player->IsPositionValid())
+                sources.push_back(player);
+
+    size_t playerCount = sources.size();
+
+    for (ActiveNonPlayers::const_iterator itr = m_activeNonPlayers.begin(); itr != m_activeNonPlayers.end(); ++itr)
+        if ((*itr)->IsInWorld() && (*itr)->IsPositionValid())
+            sources.push_back(*itr);
+
+    if (sources.size() < 2)
+        return false;
+
+    // union-find over the sources, two sources whose surroundings touch the same grid end in the same region
+    std::vector<uint32> parent(sources.size());
+    for (uint32 i = 0; i < parent.size(); ++i)
+        parent[i] = i;
+
+    std::vector<int32> gridOwner(MAX_NUMBER_OF_GRIDS * MAX_NUMBER_OF_GRIDS, -1);
+    for (uint32 i = 0; i < sources.size(); ++i)
+    {
+        WorldObject* obj = sources[i];
+        CellArea area = Cell::CalculateCellArea(obj->GetPositionX(), obj->GetPositionY(), obj->GetGridActivationRange() + margin);
+
+        for (uint32 x = area.low_bound.x_coord / MAX_NUMBER_OF_CELLS; x <= area.high_bound.x_coord / MAX_NUMBER_OF_CELLS; ++x)
+        {
+            for (uint32 y = area.low_bound.y_coord / MAX_NUMBER_OF_CELLS; y <= area.high_bound.y_coord / MAX_NUMBER_OF_CELLS; ++y)
+            {
+                int32& owner = gridOwner[x * MAX_NUMBER_OF_GRIDS + y];
+                if (owner < 0)
+                {
+                    owner = int32(i);
+                    continue;
+                }
+
+                uint32 left = i;
+                while (parent[left] != left)
+                    left = parent[left] = parent[parent[left]];
+
+                uint32 right = uint32(owner);
+                while (parent[right] != right)
+                    right = parent[right] = parent[parent[right]];
+
+                if (left != right)
+                    parent[std::max(left, right)] = std::min(left, right);
+            }
+        }
+    }
+
+    std::vector<int32> regionOf(sources.size(), -1);
+    std::vector<uint32> rootOf(sources.size());
+    for (uint32 i = 0; i < sources.size(); ++i)
+    {
+        uint32 root = i;
+        while (parent[root] != root)
+            root = parent[root];
+
+        rootOf[i] = root;
+
+        if (regionOf[root] < 0)
+        {
+            regionOf[root] = int32(_regions.size());
+            _regions.push_back(MapRegion());
+        }
+
+        MapRegion& region = _regions[regionOf[root]];
+        if (i < playerCount)
+            region.players.push_back(sources[i]->ToPlayer());
+        else
+            region.objects.push_back(sources[i]);
+    }
+
+    if (_regions.size() < 2)
+        return false;
+
+    _regionOfGrid.resize(gridOwner.size());
+    for (uint32 i = 0; i < gridOwner.size(); ++i)
+        _regionOfGrid[i] = gridOwner[i] < 0 ? -1 : regionOf[rootOf[gridOwner[i]]];
+
+    while (_regionMarkedCells.size() < _regions.size())
+        _regionMarkedCells.push_back(new MarkedCells());
+
+    for (uint32 i = 0; i < _regions.size(); ++i)
+        _regions[i].markedCells = _regionMarkedCells[i];
+
+    return true;
+}
+
+// region the calling thread updates, map is NULL outside of Map::UpdateRegion
+struct UpdatingMapRegion
+{
+    UpdatingMapRegion() : map(NULL), region(-1) { }
+
+    Map const* map;
+    int32 region;
+};
+
+typedef ACE_TSS<UpdatingMapRegion> UpdatingMapRegionTSS;
+static UpdatingMapRegionTSS updatingMapRegion;
+
+bool Map::IsRegionLocal(WorldObject const* obj)
+{
+    Map const* map = updatingMapRegion->map;
+    if (!map || !map->_regionUpdate || obj->FindMap() != map || !obj->IsPositionValid())
+        return true;
+
+    GridCoord grid = MoPCore::ComputeGridCoord(obj->GetPositionX(), obj->GetPositionY());
+    return map->_regionOfGrid[grid.x_coord * MAX_NUMBER_OF_GRIDS + grid.y_coord] == updatingMapRegion->region;
+}
+
+class MapRegionUpdateRequest : public ACE_Method_Request
+{
+    public:
+
+        MapRegionUpdateRequest(Map& m, uint32 d) : m_map(m), m_diff(d) { }
+
+        virtual int call()
+        {
+            m_map.UpdatePendingRegions(m_diff);
+            return 0;
+        }
+
+    private:
+
+        Map& m_map;
+        uint32 m_diff;
+};
+
+void Map::UpdateRegions(uint32 t_diff)
+{
+    MapUpdater* mapUpdater = sMapMgr->GetMapUpdater();
+
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, _regionLock);
+        _nextRegion = 0;
+        _finishedRegions = 0;
+    }
+
+    // scripts started by the regions are only scheduled, they run in the serial part of Map::Update
+    bool scriptLock = i_scriptLock;
+    i_scriptLock = true;
+    _regionUpdate = true;
+
+    // idle workers help with the regions, a helper that comes too late simply finds nothing left to do
+    size_t helpers = std::min(_regions.size(), mapUpdater->worker_count()) - 1;
+    for (size_t i = 0; i < helpers; ++i)
+        mapUpdater->schedule_task(new MapRegionUpdateRequest(*this, t_diff));
+
+    UpdatePendingRegions(t_diff);
+
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, _regionLock);
+        while (_finishedRegions < _regions.size())
+            _regionCondition.wait();
+    }
+
+    _regionUpdate = false;
+    i_scriptLock = scriptLock;
+}
+
+void Map::UpdatePendingRegions(uint32 t_diff)
+{
+    for (;;)
+    {
+        MapRegion* region;
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, _regionLock);
+            if (_nextRegion >= _regions.size())
+                return;
+
+            region = &_regions[_nextRegion++];
+        }
+
+        UpdateRegion(*region, t_diff);
+
+        TRINITY_GUARD(ACE_Thread_Mutex, _regionLock);
+        if (++_finishedRegions == _regions.size())
+            _regionCondition.broadcast();
+    }
+}
+
+void Map::UpdateRegion(MapRegion& region, uint32 t_diff)
+{
+    // regions never share a grid, but neighbouring grids may share words of marked_cells
+    MarkedCells& markedCells = *region.markedCells;
+    markedCells.reset();
+
+    updatingMapRegion->map = this;
+    updatingMapRegion->region = int32(&region - &_regions[0]);
+
+    MoPCore::ObjectUpdater updater(t_diff);
+    TypeContainerVisitor<MoPCore::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
+    TypeContainerVisitor<MoPCore::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
+
+    // the players themselves were updated in the serial part of Map::Update
+    for (std::vector<Player*>::const_iterator itr = region.players.begin(); itr != region.players.end(); ++itr)
+    {
+        Player* player = *itr;
+        if (!player->IsInWorld() || player->GetMap() != this)
+            continue;
+
+        VisitNearbyCellsOf(player, grid_object_update, world_object_update, markedCells);
+    }
+
+    for (std::vector<WorldObject*>::const_iterator itr = region.objects.begin(); itr != region.objects.end(); ++itr)
+    {
+        WorldObject* obj = *itr;
+        if (!obj->IsInWorld() || !obj->isActiveObject())
+            continue;
+
+        VisitNearbyCellsOf(obj, grid_object_update, world_object_update, markedCells);
+    }
+
+    updatingMapRegion->map = NULL;
+}
+
+bool Map::BenchmarkRegions(uint32 count, uint32& regions, uint32& serialTime, uint32& splitTime)
+{
+    MapUpdater* mapUpdater = sMapMgr->GetMapUpdater();
+    if (!mapUpdater->activated() || mapUpdater->worker_count() < 2)
+        return false;
+
+    if (!BuildRegions(sWorld->getFloatConfig(CONFIG_MAPUPDATE_REGION_MARGIN)))
+        return false;
+
+    regions = _regions.size();
+
+    // a zero diff runs the same visits and object updates without advancing any timer
+    uint32 startTime = getMSTime();
+    for (uint32 i = 0; i < count; ++i)
+        for (std::vector<MapRegion>::iterator itr = _regions.begin(); itr != _regions.end(); ++itr)
+            UpdateRegion(*itr, 0);
+    serialTime = GetMSTimeDiffToNow(startTime);
+
+    startTime = getMSTime();
+    for (uint32 i = 0; i < count; ++i)
+        UpdateRegions(0);
+    splitTime = GetMSTimeDiffToNow(startTime);
+
+    return true;
+}
+
+void Map::SendObjectUpdates()
+{
+    UpdateDataMapType update_players;
+
+    for (;;)
+    {
+        Object* obj;
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, _updateObjectsLock);
+            if (_updateObjects.empty())
+                break;
+
+            obj = *_updateObjects.begin();
+            _updateObjects.erase(_updateObjects.begin());
+        }
+
+        ASSERT(obj && obj->IsInWorld());
+        obj->BuildUpdate(update_players);
+    }
+
+    WorldPacket packet;                                     // here we allocate a std::vector with a size of 0x10000
+    for (UpdateDataMapType::iterator iter = update_players.begin(); iter != update_players.end(); ++iter)
+    {
+        if (iter->second.BuildPacket(&packet))
+            iter->first->GetSession()->SendPacket(&packet);
+        packet.clear();                                     // clean the string
+    }
+}
+
 void Map::RemovePlayerFromMap(Player* player, bool remove)
 {
     player->RemoveFromWorld();
@@ -614,12 +965,13 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
         z += player->GetFloatValue(UNIT_FIELD_HOVERHEIGHT);
 
     player->Relocate(x, y, z, orientation);
+    player->UpdateSpatialIndex();
     if (player->IsVehicle())
         player->GetVehicleKit()->RelocatePassengers();
 
     if (old_cell.DiffGrid(new_cell) || old_cell.DiffCell(new_cell))
     {
-        sLog->outDebug(LOG_FILTER_MAPS, "Player %s relocation grid[%u, %u]cell[%u, %u]->grid[%u, %u]cell[%u, %u]", player->GetName(), old_cell.GridX(), old_cell.GridY(), old_cell.CellX(), old_cell.CellY(), new_cell.GridX(), new_cell.GridY(), new_cell.CellX(), new_cell.CellY());
+        TC_LOG_DEBUG(LOG_FILTER_MAPS, "Player %s relocation grid[%u, %u]cell[%u, %u]->grid[%u, %u]cell[%u, %u]", player->GetName(), old_cell.GridX(), old_cell.GridY(), old_cell.CellX(), old_cell.CellY(), new_cell.GridX(), new_cell.GridY(), new_cell.CellX(), new_cell.CellY());
 
         player->RemoveFromGrid();
 
@@ -652,7 +1004,7 @@ void Map::CreatureRelocation(Creature* creature, float x, float y, float z, floa
     if (old_cell.DiffCell(new_cell) || old_cell.DiffGrid(new_cell))
     {
         #ifdef TRINITY_DEBUG
-            sLog->outDebug(LOG_FILTER_MAPS, "Creature (GUID: %u Entry: %u) added to moving list from grid[%u, %u]cell[%u, %u] to grid[%u, %u]cell[%u, %u].", creature->GetGUIDLow(), creature->GetEntry(), old_cell.GridX(), old_cell.GridY(), old_cell.CellX(), old_cell.CellY(), new_cell.GridX(), new_cell.GridY(), new_cell.CellX(), new_cell.CellY());
+            TC_LOG_DEBUG(LOG_FILTER_MAPS, "Creature (GUID: %u Entry: %u) added to moving list from grid[%u, %u]cell[%u, %u] to grid[%u, %u]cell[%u, %u].", creature->GetGUIDLow(), creature->GetEntry(), old_cell.GridX(), old_cell.GridY(), old_cell.CellX(), old_cell.CellY(), new_cell.GridX(), new_cell.GridY(), new_cell.CellX(), new_cell.CellY());
         #endif
         AddCreatureToMoveList(creature, x, y, z, ang);
         // in diffcell/diffgrid case notifiers called at finishing move creature in Map::MoveAllCreaturesInMoveList
@@ -660,6 +1012,7 @@ void Map::CreatureRelocation(Creature* creature, float x, float y, float z, floa
     else
     {
         creature->Relocate(x, y, z, ang);
+        creature->UpdateSpatialIndex();
         if (creature->IsVehicle())
             creature->GetVehicleKit()->RelocatePassengers();
         creature->OnRelocated();
@@ -686,6 +1039,7 @@ void Map::AddCreatureToMoveList(Creature* c, float x, float y, float z, float an
     if (_creatureToMoveLock) //can this happen?
         return;
 
+    MapRegionGuard<ACE_Thread_Mutex> guard(_regionSharedLock, _regionUpdate);
     if (c->_moveState == CREATURE_CELL_MOVE_NONE)
         _creaturesToMove.push_back(c);
     c->SetNewCellPosition(x, y, z, ang);
@@ -724,6 +1078,7 @@ void Map::MoveAllCreaturesInMoveList()
         {
             // update pos
             c->Relocate(c->_newPosition);
+            c->UpdateSpatialIndex();
             //c->SendMovementFlagUpdate(); possible creature crash fix.
             c->UpdateObjectVisibility(false);
         }
@@ -735,7 +1090,7 @@ void Map::MoveAllCreaturesInMoveList()
             {
                 // ... or unload (if respawn grid also not loaded)
                 #ifdef TRINITY_DEBUG
-                    sLog->outDebug(LOG_FILTER_MAPS, "Creature (GUID: %u Entry: %u) cannot be move to unloaded respawn grid.", c->GetGUIDLow(), c->GetEntry());
+                    TC_LOG_DEBUG(LOG_FILTER_MAPS, "Creature (GUID: %u Entry: %u) cannot be move to unloaded respawn grid.", c->GetGUIDLow(), c->GetEntry());
                 #endif
                 //AddObjectToRemoveList(Pet*) should only be called in Pet::Remove
                 //This may happen when a player just logs in and a pet moves to a nearby unloaded cell
@@ -763,7 +1118,7 @@ bool Map::CreatureCellRelocation(Creature* c, Cell new_cell)
         if (old_cell.DiffCell(new_cell))
         {
             #ifdef TRINITY_DEBUG
-                sLog->outDebug(LOG_FILTER_MAPS, "Creature (GUID: %u Entry: %u) moved in grid[%u, %u] from cell[%u, %u] to cell[%u, %u].", c->GetGUIDLow(), c->GetEntry(), old_cell.GridX(), old_cell.GridY(), old_cell.CellX(), old_cell.CellY(), new_cell.CellX(), new_cell.CellY());
+                TC_LOG_DEBUG(LOG_FILTER_MAPS, "Creature (GUID: %u Entry: %u) moved in grid[%u, %u] from cell[%u, %u] to cell[%u, %u].", c->GetGUIDLow(), c->GetEntry(), old_cell.GridX(), old_cell.GridY(), old_cell.CellX(), old_cell.CellY(), new_cell.CellX(), new_cell.CellY());
             #endif
 
             c->RemoveFromGrid();
@@ -772,7 +1127,7 @@ bool Map::CreatureCellRelocation(Creature* c, Cell new_cell)
         else
         {
             #ifdef TRINITY_DEBUG
-                sLog->outDebug(LOG_FILTER_MAPS, "Creature (GUID: %u Entry: %u) moved in same grid[%u, %u]cell[%u, %u].", c->GetGUIDLow(), c->GetEntry(), old_cell.GridX(), old_cell.GridY(), old_cell.CellX(), old_cell.CellY());
+                TC_LOG_DEBUG(LOG_FILTER_MAPS, "Creature (GUID: %u Entry: %u) moved in same grid[%u, %u]cell[%u, %u].", c->GetGUIDLow(), c->GetEntry(), old_cell.GridX(), old_cell.GridY(), old_cell.CellX(), old_cell.CellY());
             #endif
         }
 
@@ -785,7 +1140,7 @@ bool Map::CreatureCellRelocation(Creature* c, Cell new_cell)
         EnsureGridLoadedForActiveObject(new_cell, c);
 
         #ifdef TRINITY_DEBUG
-            sLog->outDebug(LOG_FILTER_MAPS, "Active creature (GUID: %u Entry: %u) moved from grid[%u, %u]cell[%u, %u] to grid[%u, %u]cell[%u, %u].", c->GetGUIDLow(), c->GetEntry(), old_cell.GridX(), old_cell.GridY(), old_cell.CellX(), old_cell.CellY(), new_cell.GridX(), new_cell.GridY(), new_cell.CellX(), new_cell.CellY());
+            TC_LOG_DEBUG(LOG_FILTER_MAPS, "Active creature (GUID: %u Entry: %u) moved from grid[%u, %u]cell[%u, %u] to grid[%u, %u]cell[%u, %u].", c->GetGUIDLow(), c->GetEntry(), old_cell.GridX(), old_cell.GridY(), old_cell.CellX(), old_cell.CellY(), new_cell.GridX(), new_cell.GridY(), new_cell.CellX(), new_cell.CellY());
         #endif
 
         c->RemoveFromGrid();
@@ -798,7 +1153,7 @@ bool Map::CreatureCellRelocation(Creature* c, Cell new_cell)
     if (IsGridLoaded(GridCoord(new_cell.GridX(), new_cell.GridY())))
     {
         #ifdef TRINITY_DEBUG
-            sLog->outDebug(LOG_FILTER_MAPS, "Creature (GUID: %u Entry: %u) moved from grid[%u, %u]cell[%u, %u] to grid[%u, %u]cell[%u, %u].", c->GetGUIDLow(), c->GetEntry(), old_cell.GridX(), old_cell.GridY(), old_cell.CellX(), old_cell.CellY(), new_cell.GridX(), new_cell.GridY(), new_cell.CellX(), new_cell.CellY());
+            TC_LOG_DEBUG(LOG_FILTER_MAPS, "Creature (GUID: %u Entry: %u) moved from grid[%u, %u]cell[%u, %u] to grid[%u, %u]cell[%u, %u].", c->GetGUIDLow(), c->GetEntry(), old_cell.GridX(), old_cell.GridY(), old_cell.CellX(), old_cell.CellY(), new_cell.GridX(), new_cell.GridY(), new_cell.CellX(), new_cell.CellY());
         #endif
 
         c->RemoveFromGrid();
@@ -810,7 +1165,7 @@ bool Map::CreatureCellRelocation(Creature* c, Cell new_cell)
 
     // fail to move: normal creature attempt move to unloaded grid
     #ifdef TRINITY_DEBUG
-        sLog->outDebug(LOG_FILTER_MAPS, "Creature (GUID: %u Entry: %u) attempted to move from grid[%u, %u]cell[%u, %u] to unloaded grid[%u, %u]cell[%u, %u].", c->GetGUIDLow(), c->GetEntry(), old_cell.GridX(), old_cell.GridY(), old_cell.CellX(), old_cell.CellY(), new_cell.GridX(), new_cell.GridY(), new_cell.CellX(), new_cell.CellY());
+        TC_LOG_DEBUG(LOG_FILTER_MAPS, "Creature (GUID: %u Entry: %u) attempted to move from grid[%u, %u]cell[%u, %u] to unloaded grid[%u, %u]cell[%u, %u].", c->GetGUIDLow(), c->GetEntry(), old_cell.GridX(), old_cell.GridY(), old_cell.CellX(), old_cell.CellY(), new_cell.GridX(), new_cell.GridY(), new_cell.CellX(), new_cell.CellY());
     #endif
     return false;
 }
@@ -829,13 +1184,14 @@ bool Map::CreatureRespawnRelocation(Creature* c, bool diffGridOnly)
     c->GetMotionMaster()->Clear();
 
     #ifdef TRINITY_DEBUG
-        sLog->outDebug(LOG_FILTER_MAPS, "Creature (GUID: %u Entry: %u) moved from grid[%u, %u]cell[%u, %u] to respawn grid[%u, %u]cell[%u, %u].", c->GetGUIDLow(), c->GetEntry(), c->GetCurrentCell().GridX(), c->GetCurrentCell().GridY(), c->GetCurrentCell().CellX(), c->GetCurrentCell().CellY(), resp_cell.GridX(), resp_cell.GridY(), resp_cell.CellX(), resp_cell.CellY());
+        TC_LOG_DEBUG(LOG_FILTER_MAPS, "Creature (GUID: %u Entry: %u) moved from grid[%u, %u]cell[%u, %u] to respawn grid[%u, %u]cell[%u, %u].", c->GetGUIDLow(), c->GetEntry(), c->GetCurrentCell().GridX(), c->GetCurrentCell().GridY(), c->GetCurrentCell().CellX(), c->GetCurrentCell().CellY(), resp_cell.GridX(), resp_cell.GridY(), resp_cell.CellX(), resp_cell.CellY());
     #endif
 
     // teleport it to respawn point (like normal respawn if player see)
     if (CreatureCellRelocation(c, resp_cell))
     {
         c->Relocate(resp_x, resp_y, resp_z, resp_o);
+        c->UpdateSpatialIndex();
         c->GetMotionMaster()->Initialize();                 // prevent possible problems with default move generators
         //CreatureRelocationNotify(c, resp_cell, resp_cell.GetCellCoord());
         c->UpdateObjectVisibility(false);
@@ -861,7 +1217,7 @@ bool Map::UnloadGrid(NGridType& ngrid, bool unloadAll)
                 return false;
         }
 
-        sLog->outDebug(LOG_FILTER_MAPS, "Unloading grid[%u, %u] for map %u", x, y, GetId());
+        TC_LOG_DEBUG(LOG_FILTER_MAPS, "Unloading grid[%u, %u] for map %u", x, y, GetId());
 
         if (!unloadAll)
         {
@@ -917,8 +1273,9 @@ bool Map::UnloadGrid(NGridType& ngrid, bool unloadAll)
             ((MapInstanced*)m_parentMap)->RemoveGridMapReference(GridCoord(gx, gy));
 
         GridMaps[gx][gy] = NULL;
+        _queryCache.InvalidateTerrain();
     }
-    sLog->outDebug(LOG_FILTER_MAPS, "Unloading grid[%u, %u] for map %u finished", x, y, GetId());
+    TC_LOG_DEBUG(LOG_FILTER_MAPS, "Unloading grid[%u, %u] for map %u finished", x, y, GetId());
     return true;
 }
 
@@ -976,6 +1333,7 @@ GridMap::GridMap()
     _liquidEntry = NULL;
     _liquidFlags = NULL;
     _liquidMap  = NULL;
+    _fileMapping = NULL;
 }
 
 GridMap::~GridMap()
@@ -988,6 +1346,9 @@ bool GridMap::loadData(char *filename)
     // Unload old data if exist
     unloadData();
 
+    if (sWorld->getBoolConfig(CONFIG_GRID_MAP_MEMORY_MAPPED))
+        return loadMappedData(filename);
+
     map_fileheader header;
     // Not return error if file not found
     FILE* in = fopen(filename, "rb");
@@ -1033,6 +1394,21 @@ bool GridMap::loadData(char *filename)
 
 void GridMap::unloadData()
 {
+    if (_fileMapping)
+    {
+        // the data belongs to the mapping, only drop our view of it
+        _fileMapping->close();
+        delete _fileMapping;
+        _fileMapping = NULL;
+
+        _areaMap = NULL;
+        m_V9 = NULL;
+        m_V8 = NULL;
+        _liquidEntry = NULL;
+        _liquidFlags = NULL;
+        _liquidMap  = NULL;
+    }
+
     delete[] _areaMap;
     delete[] m_V9;
     delete[] m_V8;
@@ -1048,6 +1424,164 @@ void GridMap::unloadData()
     _gridGetHeight = &GridMap::getHeightFromFlat;
 }
 
+// Returns a pointer to count elements of T at offset inside the mapped file, NULL if the file is too short
+template<class T>
+static T* GetMappedArray(uint8 const* data, size_t size, size_t offset, size_t count)
+{
+    if (offset > size || count * sizeof(T) > size - offset)
+        return NULL;
+
+    // the mapping is read only, the grid never writes through these pointers
+    return reinterpret_cast<T*>(const_cast<uint8*>(data + offset));
+}
+
+bool GridMap::loadMappedData(char const* filename)
+{
+    // Not return error if file not found
+    if (ACE_OS::access(filename, R_OK) == -1)
+        return true;
+
+    // The file is mapped read only and shared, nothing is read here: pages are faulted in
+    // on first access and the same physical pages back every instance and every worldserver
+    // process using this tile, the page cache takes care of evicting cold terrain
+    _fileMapping = new ACE_Mem_Map();
+    if (_fileMapping->map(filename, static_cast<size_t>(-1), O_RDONLY, ACE_DEFAULT_FILE_PERMS, PROT_READ, ACE_MAP_SHARED) == -1)
+    {
+        sLog->outError(LOG_FILTER_MAPS, "Error mapping map file '%s'", filename);
+        delete _fileMapping;
+        _fileMapping = NULL;
+        return false;
+    }
+
+    // the mapping stays valid without the descriptor, do not keep one open per loaded tile
+    _fileMapping->close_handle();
+
+    uint8 const* data = static_cast<uint8 const*>(_fileMapping->addr());
+    size_t size = _fileMapping->size();
+
+    map_fileheader const* header = GetMappedArray<map_fileheader const>(data, size, 0, 1);
+    if (!header || header->mapMagic != MapMagic.asUInt || header->versionMagic != MapVersionMagic.asUInt)
+    {
+        sLog->outError(LOG_FILTER_MAPS, "Map file '%s' is from an incompatible clientversion. Please recreate using the mapextractor.", filename);
+        unloadData();
+        return false;
+    }
+
+    // loadup area data
+    if (header->areaMapOffset)
+    {
+        map_areaHeader const* areaHeader = GetMappedArray<map_areaHeader const>(data, size, header->areaMapOffset, 1);
+        if (!areaHeader || areaHeader->fourcc != MapAreaMagic.asUInt)
+        {
+            sLog->outError(LOG_FILTER_MAPS, "Error loading map area data\n");
+            unloadData();
+            return false;
+        }
+
+        _gridArea = areaHeader->gridArea;
+        if (!(areaHeader->flags & MAP_AREA_NO_AREA))
+        {
+            _areaMap = GetMappedArray<uint16>(data, size, header->areaMapOffset + sizeof(map_areaHeader), 16*16);
+            if (!_areaMap)
+            {
+                sLog->outError(LOG_FILTER_MAPS, "Error loading map area data\n");
+                unloadData();
+                return false;
+            }
+        }
+    }
+
+    // loadup height data
+    if (header->heightMapOffset)
+    {
+        map_heightHeader const* heightHeader = GetMappedArray<map_heightHeader const>(data, size, header->heightMapOffset, 1);
+        if (!heightHeader || heightHeader->fourcc != MapHeightMagic.asUInt)
+        {
+            sLog->outError(LOG_FILTER_MAPS, "Error loading map height data\n");
+            unloadData();
+            return false;
+        }
+
+        size_t offset = header->heightMapOffset + sizeof(map_heightHeader);
+        _gridHeight = heightHeader->gridHeight;
+        if (!(heightHeader->flags & MAP_HEIGHT_NO_HEIGHT))
+        {
+            if ((heightHeader->flags & MAP_HEIGHT_AS_INT16))
+            {
+                m_uint16_V9 = GetMappedArray<uint16>(data, size, offset, 129*129);
+                m_uint16_V8 = GetMappedArray<uint16>(data, size, offset + 129*129 * sizeof(uint16), 128*128);
+                _gridIntHeightMultiplier = (heightHeader->gridMaxHeight - heightHeader->gridHeight) / 65535;
+                _gridGetHeight = &GridMap::getHeightFromUint16;
+            }
+            else if ((heightHeader->flags & MAP_HEIGHT_AS_INT8))
+            {
+                m_uint8_V9 = GetMappedArray<uint8>(data, size, offset, 129*129);
+                m_uint8_V8 = GetMappedArray<uint8>(data, size, offset + 129*129 * sizeof(uint8), 128*128);
+                _gridIntHeightMultiplier = (heightHeader->gridMaxHeight - heightHeader->gridHeight) / 255;
+                _gridGetHeight = &GridMap::getHeightFromUint8;
+            }
+            else
+            {
+                m_V9 = GetMappedArray<float>(data, size, offset, 129*129);
+                m_V8 = GetMappedArray<float>(data, size, offset + 129*129 * sizeof(float), 128*128);
+                _gridGetHeight = &GridMap::getHeightFromFloat;
+            }
+
+            if (!m_V9 || !m_V8)
+            {
+                sLog->outError(LOG_FILTER_MAPS, "Error loading map height data\n");
+                unloadData();
+                return false;
+            }
+        }
+        else
+            _gridGetHeight = &GridMap::getHeightFromFlat;
+    }
+
+    // loadup liquid data
+    if (header->liquidMapOffset)
+    {
+        map_liquidHeader const* liquidHeader = GetMappedArray<map_liquidHeader const>(data, size, header->liquidMapOffset, 1);
+        if (!liquidHeader || liquidHeader->fourcc != MapLiquidMagic.asUInt)
+        {
+            sLog->outError(LOG_FILTER_MAPS, "Error loading map liquids data\n");
+            unloadData();
+            return false;
+        }
+
+        _liquidType   = liquidHeader->liquidType;
+        _liquidOffX  = liquidHeader->offsetX;
+        _liquidOffY  = liquidHeader->offsetY;
+        _liquidWidth = liquidHeader->width;
+        _liquidHeight = liquidHeader->height;
+        _liquidLevel  = liquidHeader->liquidLevel;
+
+        size_t offset = header->liquidMapOffset + sizeof(map_liquidHeader);
+        bool valid = true;
+        if (!(liquidHeader->flags & MAP_LIQUID_NO_TYPE))
+        {
+            _liquidEntry = GetMappedArray<uint16>(data, size, offset, 16*16);
+            _liquidFlags = GetMappedArray<uint8>(data, size, offset + 16*16 * sizeof(uint16), 16*16);
+            valid = _liquidEntry && _liquidFlags;
+            offset += 16*16 * (sizeof(uint16) + sizeof(uint8));
+        }
+        if (valid && !(liquidHeader->flags & MAP_LIQUID_NO_HEIGHT))
+        {
+            _liquidMap = GetMappedArray<float>(data, size, offset, uint32(_liquidWidth) * uint32(_liquidHeight));
+            valid = _liquidMap != NULL;
+        }
+
+        if (!valid)
+        {
+            sLog->outError(LOG_FILTER_MAPS, "Error loading map liquids data\n");
+            unloadData();
+            return false;
+        }
+    }
+
+    return true;
+}
+
 bool GridMap::loadAreaData(FILE* in, uint32 offset, uint32 /*size*/)
 {
     map_areaHeader header;
@@ -1542,6 +2076,23 @@ float Map::GetWaterOrGroundLevel(float x, float y, float z, float* ground /*= NU
 }
 
 float Map::GetHeight(float x, float y, float z, bool checkVMap /*= true*/, float maxSearchDist /*= DEFAULT_HEIGHT_SEARCH*/) const
+{
+    MapQueryKey key;
+    if (!_queryCache.IsEnabled() || !MapQueryCache::MakeKey(key, x, y, z, maxSearchDist, 0.0f, 0.0f, checkVMap))
+        return ComputeHeight(x, y, z, checkVMap, maxSearchDist);
+
+    MapQueryResult result;
+    uint32 generation;
+    if (!_queryCache.Find(MAP_QUERY_HEIGHT, key, result, generation, IsQueryCacheShared()))
+    {
+        result.value = ComputeHeight(x, y, z, checkVMap, maxSearchDist);
+        _queryCache.Store(MAP_QUERY_HEIGHT, key, result, generation, IsQueryCacheShared());
+    }
+
+    return result.value;
+}
+
+float Map::ComputeHeight(float x, float y, float z, bool checkVMap /*= true*/, float maxSearchDist /*= DEFAULT_HEIGHT_SEARCH*/) const
 {
     // find raw .map surface under Z coordinates
     float mapHeight = VMAP_INVALID_HEIGHT_VALUE;
@@ -1629,13 +2180,34 @@ bool Map::IsOutdoors(float x, float y, float z) const
     WMOAreaTableEntry const* wmoEntry= GetWMOAreaTableEntryByTripple(rootId, adtId, groupId);
     if (wmoEntry)
     {
-        sLog->outDebug(LOG_FILTER_MAPS, "Got WMOAreaTableEntry! flag %u, areaid %u", wmoEntry->Flags, wmoEntry->areaId);
+        TC_LOG_DEBUG(LOG_FILTER_MAPS, "Got WMOAreaTableEntry! flag %u, areaid %u", wmoEntry->Flags, wmoEntry->areaId);
         atEntry = GetAreaEntryByAreaID(wmoEntry->areaId);
     }
     return IsOutdoorWMO(mogpFlags, adtId, rootId, groupId, wmoEntry, atEntry);
 }
 
 bool Map::GetAreaInfo(float x, float y, float z, uint32 &flags, int32 &adtId, int32 &rootId, int32 &groupId) const
+{
+    MapQueryKey key;
+    if (!_queryCache.IsEnabled() || !MapQueryCache::MakeKey(key, x, y, z))
+        return ComputeAreaInfo(x, y, z, flags, adtId, rootId, groupId);
+
+    MapQueryResult result;
+    uint32 generation;
+    if (!_queryCache.Find(MAP_QUERY_AREA_INFO, key, result, generation, IsQueryCacheShared()))
+    {
+        result.found = ComputeAreaInfo(x, y, z, result.flags, result.adtId, result.rootId, result.groupId);
+        _queryCache.Store(MAP_QUERY_AREA_INFO, key, result, generation, IsQueryCacheShared());
+    }
+
+    flags = result.flags;
+    adtId = result.adtId;
+    rootId = result.rootId;
+    groupId = result.groupId;
+    return result.found;
+}
+
+bool Map::ComputeAreaInfo(float x, float y, float z, uint32 &flags, int32 &adtId, int32 &rootId, int32 &groupId) const
 {
     float vmap_z = z;
     VMAP::IVMapManager* vmgr = VMAP::VMapFactory::createOrGetVMapManager();
@@ -1718,7 +2290,7 @@ ZLiquidStatus Map::getLiquidStatus(float x, float y, float z, uint8 ReqLiquidTyp
     uint32 liquid_type = 0;
     if (vmgr->GetLiquidLevel(GetId(), x, y, z, ReqLiquidType, liquid_level, ground_level, liquid_type))
     {
-        sLog->outDebug(LOG_FILTER_MAPS, "getLiquidStatus(): vmap liquid level: %f ground: %f type: %u", liquid_level, ground_level, liquid_type);
+        TC_LOG_DEBUG(LOG_FILTER_MAPS, "getLiquidStatus(): vmap liquid level: %f ground: %f type: %u", liquid_level, ground_level, liquid_type);
         // Check water level and ground level
         if (liquid_level > ground_level && z > ground_level - 2)
         {
@@ -1832,8 +2404,28 @@ void Map::GetZoneAndAreaIdByAreaFlag(uint32& zoneid, uint32& areaid, uint16 area
 
 bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask) const
 {
-    return VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2)
-        && _dynamicTree.isInLineOfSight(x1, y1, z1, x2, y2, z2, phasemask);
+    MapQueryKey key;
+    if (!_queryCache.IsEnabled() || !MapQueryCache::MakeKey(key, x1, y1, z1, x2, y2, z2, phasemask))
+        return ComputeLineOfSight(x1, y1, z1, x2, y2, z2, phasemask);
+
+    MapQueryResult result;
+    uint32 generation;
+    if (!_queryCache.Find(MAP_QUERY_LINE_OF_SIGHT, key, result, generation, IsQueryCacheShared()))
+    {
+        result.found = ComputeLineOfSight(x1, y1, z1, x2, y2, z2, phasemask);
+        _queryCache.Store(MAP_QUERY_LINE_OF_SIGHT, key, result, generation, IsQueryCacheShared());
+    }
+
+    return result.found;
+}
+
+bool Map::ComputeLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask) const
+{
+    if (!VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2))
+        return false;
+
+    MapRegionReadGuard<ACE_RW_Thread_Mutex> guard(_dynamicTreeLock, _regionUpdate);
+    return _dynamicTree.isInLineOfSight(x1, y1, z1, x2, y2, z2, phasemask);
 }
 
 bool Map::getObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist)
@@ -1842,7 +2434,11 @@ bool Map::getObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float
     G3D::Vector3 dstPos = G3D::Vector3(x2, y2, z2);
 
     G3D::Vector3 resultPos;
-    bool result = _dynamicTree.getObjectHitPos(phasemask, startPos, dstPos, resultPos, modifyDist);
+    bool result;
+    {
+        MapRegionReadGuard<ACE_RW_Thread_Mutex> guard(_dynamicTreeLock, _regionUpdate);
+        result = _dynamicTree.getObjectHitPos(phasemask, startPos, dstPos, resultPos, modifyDist);
+    }
 
     rx = resultPos.x;
     ry = resultPos.y;
@@ -1852,7 +2448,27 @@ bool Map::getObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float
 
 float Map::GetHeight(uint32 phasemask, float x, float y, float z, bool vmap/*=true*/, float maxSearchDist/*=DEFAULT_HEIGHT_SEARCH*/) const
 {
-    return std::max<float>(GetHeight(x, y, z, vmap, maxSearchDist), _dynamicTree.getHeight(x, y, z, maxSearchDist, phasemask));
+    MapQueryKey key;
+    if (!_queryCache.IsEnabled() || !MapQueryCache::MakeKey(key, x, y, z, maxSearchDist, 0.0f, 0.0f, vmap, phasemask))
+        return ComputeHeight(phasemask, x, y, z, vmap, maxSearchDist);
+
+    MapQueryResult result;
+    uint32 generation;
+    if (!_queryCache.Find(MAP_QUERY_DYNAMIC_HEIGHT, key, result, generation, IsQueryCacheShared()))
+    {
+        result.value = ComputeHeight(phasemask, x, y, z, vmap, maxSearchDist);
+        _queryCache.Store(MAP_QUERY_DYNAMIC_HEIGHT, key, result, generation, IsQueryCacheShared());
+    }
+
+    return result.value;
+}
+
+float Map::ComputeHeight(uint32 phasemask, float x, float y, float z, bool vmap/*=true*/, float maxSearchDist/*=DEFAULT_HEIGHT_SEARCH*/) const
+{
+    float staticHeight = ComputeHeight(x, y, z, vmap, maxSearchDist);
+
+    MapRegionReadGuard<ACE_RW_Thread_Mutex> guard(_dynamicTreeLock, _regionUpdate);
+    return std::max<float>(staticHeight, _dynamicTree.getHeight(x, y, z, maxSearchDist, phasemask));
 }
 
 bool Map::IsInWater(float x, float y, float pZ, LiquidData* data) const
@@ -1884,7 +2500,7 @@ bool Map::CheckGridIntegrity(Creature* c, bool moved) const
     Cell xy_cell(c->GetPositionX(), c->GetPositionY());
     if (xy_cell != cur_cell)
     {
-        sLog->outDebug(LOG_FILTER_MAPS, "Creature (GUID: %u) X: %f Y: %f (%s) is in grid[%u, %u]cell[%u, %u] instead of grid[%u, %u]cell[%u, %u]",
+        TC_LOG_DEBUG(LOG_FILTER_MAPS, "Creature (GUID: %u) X: %f Y: %f (%s) is in grid[%u, %u]cell[%u, %u] instead of grid[%u, %u]cell[%u, %u]",
             c->GetGUIDLow(),
             c->GetPositionX(), c->GetPositionY(), (moved ? "final" : "original"),
             cur_cell.GridX(), cur_cell.GridY(), cur_cell.CellX(), cur_cell.CellY(),
@@ -2039,8 +2655,9 @@ void Map::AddObjectToRemoveList(WorldObject* obj)
 
     obj->CleanupsBeforeDelete(false);                            // remove or simplify at least cross referenced links
 
+    MapRegionGuard<ACE_Thread_Mutex> guard(_regionSharedLock, _regionUpdate);
     i_objectsToRemove.insert(obj);
-    //sLog->outDebug(LOG_FILTER_MAPS, "Object (GUID: %u TypeId: %u) added to removing list.", obj->GetGUIDLow(), obj->GetTypeId());
+    //TC_LOG_DEBUG(LOG_FILTER_MAPS, "Object (GUID: %u TypeId: %u) added to removing list.", obj->GetGUIDLow(), obj->GetTypeId());
 }
 
 void Map::AddObjectToSwitchList(WorldObject* obj, bool on)
@@ -2051,6 +2668,7 @@ void Map::AddObjectToSwitchList(WorldObject* obj, bool on)
     if (obj->GetTypeId() != TYPEID_UNIT)
         return;
 
+    MapRegionGuard<ACE_Thread_Mutex> guard(_regionSharedLock, _regionUpdate);
     std::map<WorldObject*, bool>::iterator itr = i_objectsToSwitch.find(obj);
     if (itr == i_objectsToSwitch.end())
         i_objectsToSwitch.insert(itr, std::make_pair(obj, on));
@@ -2073,7 +2691,7 @@ void Map::RemoveAllObjectsInRemoveList()
             SwitchGridContainers(obj->ToCreature(), on);
     }
 
-    //sLog->outDebug(LOG_FILTER_MAPS, "Object remover 1 check.");
+    //TC_LOG_DEBUG(LOG_FILTER_MAPS, "Object remover 1 check.");
     while (!i_objectsToRemove.empty())
     {
         std::set<WorldObject*>::iterator itr = i_objectsToRemove.begin();
@@ -2116,7 +2734,7 @@ void Map::RemoveAllObjectsInRemoveList()
         i_objectsToRemove.erase(itr);
     }
 
-    //sLog->outDebug(LOG_FILTER_MAPS, "Object remover 2 check.");
+    //TC_LOG_DEBUG(LOG_FILTER_MAPS, "Object remover 2 check.");
 }
 
 uint32 Map::GetPlayersCountExceptGMs() const
@@ -2501,7 +3119,7 @@ void InstanceMap::CreateInstanceData(bool load)
             i_data->SetCompletedEncountersMask(fields[1].GetUInt32());
             if (data != "")
             {
-                sLog->outDebug(LOG_FILTER_MAPS, "Loading instance data for `%s` with id %u", sObjectMgr->GetScriptName(i_script_id), i_InstanceId);
+                TC_LOG_DEBUG(LOG_FILTER_MAPS, "Loading instance data for `%s` with id %u", sObjectMgr->GetScriptName(i_script_id), i_InstanceId);
                 i_data->Load(data.c_str());
             }
         }
@@ -2793,7 +3411,10 @@ void Map::SaveCreatureRespawnTime(uint32 dbGuid, time_t respawnTime)
         return;
     }
 
-    _creatureRespawnTimes[dbGuid] = respawnTime;
+    {
+        MapRegionGuard<ACE_Thread_Mutex> guard(_regionSharedLock, _regionUpdate);
+        _creatureRespawnTimes[dbGuid] = respawnTime;
+    }
 
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CREATURE_RESPAWN);
     stmt->setUInt32(0, dbGuid);
@@ -2805,7 +3426,10 @@ void Map::SaveCreatureRespawnTime(uint32 dbGuid, time_t respawnTime)
 
 void Map::RemoveCreatureRespawnTime(uint32 dbGuid)
 {
-    _creatureRespawnTimes.erase(dbGuid);
+    {
+        MapRegionGuard<ACE_Thread_Mutex> guard(_regionSharedLock, _regionUpdate);
+        _creatureRespawnTimes.erase(dbGuid);
+    }
 
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN);
     stmt->setUInt32(0, dbGuid);
@@ -2823,7 +3447,10 @@ void Map::SaveGORespawnTime(uint32 dbGuid, time_t respawnTime)
         return;
     }
 
-    _goRespawnTimes[dbGuid] = respawnTime;
+    {
+        MapRegionGuard<ACE_Thread_Mutex> guard(_regionSharedLock, _regionUpdate);
+        _goRespawnTimes[dbGuid] = respawnTime;
+    }
 
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_GO_RESPAWN);
     stmt->setUInt32(0, dbGuid);
@@ -22,6 +22,8 @@
 #include "Define.h"
 #include <ace/RW_Thread_Mutex.h>
 #include <ace/Thread_Mutex.h>
+#include <ace/Recursive_Thread_Mutex.h>
+#include <ace/Condition_Thread_Mutex.h>
 
 #include "DBCStructure.h"
 #include "GridDefines.h"
@@ -32,10 +34,12 @@
 #include "MapRefManager.h"
 #include "DynamicTree.h"
 #include "GameObjectModel.h"
+#include "MapQueryCache.h"
 
 #include <bitset>
 #include <list>
 
+class ACE_Mem_Map;
 class Unit;
 class WorldPacket;
 class InstanceScript;
@@ -183,7 +187,11 @@ class GridMap
     uint8 _liquidWidth;
     uint8 _liquidHeight;
 
+    // Read-only view of the whole .map file when the grid is memory mapped,
+    // the data pointers above then point into the mapping instead of owning buffers
+    ACE_Mem_Map* _fileMapping;
 
+    bool loadMappedData(char const* filename);
     bool loadAreaData(FILE* in, uint32 offset, uint32 size);
     bool loadHeihgtData(FILE* in, uint32 offset, uint32 size);
     bool loadLiquidData(FILE* in, uint32 offset, uint32 size);
@@ -231,6 +239,51 @@ struct InstanceTemplate
 
 typedef std::map<uint32/*leaderDBGUID*/, CreatureGroup*>        CreatureGroupHolderType;
 
+// Update cost of a map, sampled by MapUpdater and used to order the map update queues
+struct MapUpdateStats
+{
+    MapUpdateStats() : lastTime(0), avgTime(0), maxTime(0), updateCount(0), regions(0) { }
+
+    void AddSample(uint32 usec)
+    {
+        lastTime = usec;
+        avgTime = updateCount ? (avgTime * 7 + usec) / 8 : usec;
+        if (usec > maxTime)
+            maxTime = usec;
+        ++updateCount;
+    }
+
+    uint32 lastTime;                                        // microseconds
+    uint32 avgTime;                                         // moving average, microseconds
+    uint32 maxTime;                                         // microseconds
+    uint32 updateCount;
+    uint32 regions;                                         // regions updated in parallel during the last update, 0 if not split
+};
+
+// Locks the given mutex only while a map updates its regions in parallel (MapUpdate.RegionSplit),
+// the containers it protects are only touched by a single thread otherwise
+template<class MUTEX>
+class MapRegionGuard
+{
+    public:
+        MapRegionGuard(MUTEX& lock, bool active) : _lock(active ? &lock : NULL) { if (_lock) _lock->acquire(); }
+        ~MapRegionGuard() { if (_lock) _lock->release(); }
+
+    private:
+        MUTEX* _lock;
+};
+
+template<class MUTEX>
+class MapRegionReadGuard
+{
+    public:
+        MapRegionReadGuard(MUTEX& lock, bool active) : _lock(active ? &lock : NULL) { if (_lock) _lock->acquire_read(); }
+        ~MapRegionReadGuard() { if (_lock) _lock->release(); }
+
+    private:
+        MUTEX* _lock;
+};
+
 class Map : public GridRefManager<NGridType>
 {
     friend class MapReference;
@@ -258,9 +311,28 @@ class Map : public GridRefManager<NGridType>
         template<class T> bool AddToMap(T *);
         template<class T> void RemoveFromMap(T *, bool);
 
+        typedef std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP*TOTAL_NUMBER_OF_CELLS_PER_MAP> MarkedCells;
+
         void VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<MoPCore::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<MoPCore::ObjectUpdater, WorldTypeMapContainer> &worldVisitor);
+        void VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<MoPCore::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<MoPCore::ObjectUpdater, WorldTypeMapContainer> &worldVisitor, MarkedCells& markedCells);
         virtual void Update(const uint32);
 
+        // Updates regions of the current split update until none is left, called by the map thread and by idle map update workers
+        void UpdatePendingRegions(uint32 t_diff);
+
+        MapUpdateStats const& GetUpdateStats() const { return m_updateStats; }
+        void RecordUpdateTime(uint32 usec) { m_updateStats.AddSample(usec); }
+
+        ACE_Recursive_Thread_Mutex& GetRegionSerialLock() { return _regionSerialLock; }
+        bool IsUpdatingRegions() const { return _regionUpdate; }
+
+        // False if the calling thread updates a region of the object's map and the object lies outside of it
+        static bool IsRegionLocal(WorldObject const* obj);
+
+        // Updates the current regions count times on the calling thread and count times split over the map update
+        // workers, times are in milliseconds. Returns false if the map has less than two regions or no workers to split on
+        bool BenchmarkRegions(uint32 count, uint32& regions, uint32& serialTime, uint32& splitTime);
+
         float GetVisibilityRange() const
         {
             // HackFix : Terrasse of endless spring
@@ -278,6 +350,12 @@ class Map : public GridRefManager<NGridType>
 
         template<class T, class CONTAINER> void Visit(const Cell& cell, TypeContainerVisitor<T, CONTAINER> &visitor);
 
+        // Radius search over the positions stored for the cell, used for notifiers that implement VisitObject
+        template<class NOTIFIER> void VisitSpatialIndex(Cell const& cell, NOTIFIER& notifier, bool worldObjects, float x, float y, float radius);
+
+        // The grid of the cell must exist
+        CellSpatialIndex& GetCellSpatialIndex(Cell const& cell) { return getNGrid(cell.GridX(), cell.GridY())->GetGridType(cell.CellX(), cell.CellY()).GetSpatialIndex(); }
+
         bool IsRemovalGrid(float x, float y) const
         {
             GridCoord p = MoPCore::ComputeGridCoord(x, y);
@@ -314,11 +392,13 @@ class Map : public GridRefManager<NGridType>
         // some calls like isInWater should not use vmaps due to processor power
         // can return INVALID_HEIGHT if under z+2 z coord not found height
         float GetHeight(float x, float y, float z, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
+        float ComputeHeight(float x, float y, float z, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
 
         ZLiquidStatus getLiquidStatus(float x, float y, float z, uint8 ReqLiquidType, LiquidData* data = 0) const;
 
         uint16 GetAreaFlag(float x, float y, float z, bool *isOutdoors=0) const;
         bool GetAreaInfo(float x, float y, float z, uint32 &mogpflags, int32 &adtId, int32 &rootId, int32 &groupId) const;
+        bool ComputeAreaInfo(float x, float y, float z, uint32 &mogpflags, int32 &adtId, int32 &rootId, int32 &groupId) const;
 
         bool IsOutdoors(float x, float y, float z) const;
 
@@ -405,11 +485,35 @@ class Map : public GridRefManager<NGridType>
         uint32 GetPlayersCountExceptGMs() const;
         bool ActiveObjectsNearGrid(NGridType const& ngrid) const;
 
-        void AddWorldObject(WorldObject* obj) { i_worldObjects.insert(obj); }
-        void RemoveWorldObject(WorldObject* obj) { i_worldObjects.erase(obj); }
+        void AddWorldObject(WorldObject* obj)
+        {
+            MapRegionGuard<ACE_Thread_Mutex> guard(_regionSharedLock, _regionUpdate);
+            i_worldObjects.insert(obj);
+        }
+        void RemoveWorldObject(WorldObject* obj)
+        {
+            MapRegionGuard<ACE_Thread_Mutex> guard(_regionSharedLock, _regionUpdate);
+            i_worldObjects.erase(obj);
+        }
 
         void SendToPlayers(WorldPacket const* data) const;
 
+        // objects with changed fields, their updates are built and sent by SendObjectUpdates on a map update worker
+        void AddUpdateObject(Object* obj)
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, _updateObjectsLock);
+            _updateObjects.insert(obj);
+        }
+
+        void RemoveUpdateObject(Object* obj)
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, _updateObjectsLock);
+            _updateObjects.erase(obj);
+        }
+
+        bool HasUpdateObjects() const { return !_updateObjects.empty(); }
+        void SendObjectUpdates();
+
         typedef MapRefManager PlayerList;
         PlayerList const& GetPlayers() const { return m_mapRefManager; }
 
@@ -452,10 +556,32 @@ class Map : public GridRefManager<NGridType>
         float GetWaterOrGroundLevel(float x, float y, float z, float* ground = NULL, bool swim = false) const;
         float GetHeight(uint32 phasemask, float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
         bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask) const;
+        // Uncached versions of the queries above, the public ones go through _queryCache
+        float ComputeHeight(uint32 phasemask, float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
+        bool ComputeLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask) const;
+        MapQueryCache& GetQueryCache() { return _queryCache; }
+        // Base maps also answer zone and area lookups of other threads, instances only of their own update thread
+        bool IsQueryCacheShared() const { return _regionUpdate || !i_InstanceId; }
+        // Gameobject models changed outside of Insert/RemoveGameObjectModel, e.g. collision toggled
+        void InvalidateDynamicQueries() { _queryCache.InvalidateDynamic(); }
         void Balance() { _dynamicTree.balance(); }
-        void RemoveGameObjectModel(const GameObjectModel& model) { _dynamicTree.remove(model); }
-        void InsertGameObjectModel(const GameObjectModel& model) { _dynamicTree.insert(model); }
-        bool ContainsGameObjectModel(const GameObjectModel& model) const { return _dynamicTree.contains(model);}
+        void RemoveGameObjectModel(const GameObjectModel& model)
+        {
+            MapRegionGuard<ACE_RW_Thread_Mutex> guard(_dynamicTreeLock, _regionUpdate);
+            _dynamicTree.remove(model);
+            _queryCache.InvalidateDynamic();
+        }
+        void InsertGameObjectModel(const GameObjectModel& model)
+        {
+            MapRegionGuard<ACE_RW_Thread_Mutex> guard(_dynamicTreeLock, _regionUpdate);
+            _dynamicTree.insert(model);
+            _queryCache.InvalidateDynamic();
+        }
+        bool ContainsGameObjectModel(const GameObjectModel& model) const
+        {
+            MapRegionReadGuard<ACE_RW_Thread_Mutex> guard(_dynamicTreeLock, _regionUpdate);
+            return _dynamicTree.contains(model);
+        }
         bool getObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float &ry, float& rz, float modifyDist);
 
         virtual uint32 GetOwnerGuildId(uint32 /*team*/ = TEAM_OTHER) const { return 0; }
@@ -536,17 +662,42 @@ class Map : public GridRefManager<NGridType>
 
         void UpdateActiveCells(const float &x, const float &y, const uint32 t_diff);
 
+        // Region split update: players and active objects whose surroundings (activation range plus
+        // MapUpdate.RegionSplit.Margin) share no grid are put in different regions, whose cells are then
+        // updated in parallel. Sessions, players, scripts and cell changes of creatures stay in the serial part.
+        // Every grid belongs to at most one region, and a region only updates objects of its own grids. The
+        // invariant the split relies on: an object updated in a region only touches objects less than the
+        // margin away from it, those lie in grids of the same region. IsRegionLocal checks it.
+        struct MapRegion
+        {
+            std::vector<Player*> players;
+            std::vector<WorldObject*> objects;
+            MarkedCells* markedCells;                       // owned by _regionMarkedCells
+        };
+
+        bool CanUpdateRegions() const;
+        bool BuildRegions(float margin);
+        void UpdateRegions(uint32 t_diff);
+        void UpdateRegion(MapRegion& region, uint32 t_diff);
+
     protected:
         void SetUnloadReferenceLock(const GridCoord &p, bool on) { getNGrid(p.x_coord, p.y_coord)->setUnloadReferenceLock(on); }
 
         ACE_Thread_Mutex Lock;
 
+        // shared containers of the map touched by object updates, only locked during a region split update
+        ACE_Thread_Mutex _regionSharedLock;
+        mutable ACE_RW_Thread_Mutex _dynamicTreeLock;
+        ACE_Recursive_Thread_Mutex _regionSerialLock;
+        bool _regionUpdate;
+
         MapEntry const* i_mapEntry;
         uint8 i_spawnMode;
         uint32 i_InstanceId;
         uint32 m_unloadTimer;
         float m_VisibleDistance;
         DynamicMapTree _dynamicTree;
+        mutable MapQueryCache _queryCache;
 
         MapRefManager m_mapRefManager;
         MapRefManager::iterator m_mapRefIter;
@@ -575,7 +726,7 @@ class Map : public GridRefManager<NGridType>
 
         NGridType* i_grids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
         GridMap* GridMaps[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
-        std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP*TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
+        MarkedCells marked_cells;
 
         bool i_scriptLock;
         std::set<WorldObject*> i_objectsToRemove;
@@ -595,12 +746,15 @@ class Map : public GridRefManager<NGridType>
         template<class T>
         void AddToActiveHelper(T* obj)
         {
+            MapRegionGuard<ACE_Thread_Mutex> guard(_regionSharedLock, _regionUpdate);
             m_activeNonPlayers.insert(obj);
         }
 
         template<class T>
         void RemoveFromActiveHelper(T* obj)
         {
+            MapRegionGuard<ACE_Thread_Mutex> guard(_regionSharedLock, _regionUpdate);
+
             // Map::Update for active object in proccess
             if (m_activeNonPlayersIter != m_activeNonPlayers.end())
             {
@@ -617,6 +771,31 @@ class Map : public GridRefManager<NGridType>
 
         UNORDERED_MAP<uint32 /*dbGUID*/, time_t> _creatureRespawnTimes;
         UNORDERED_MAP<uint32 /*dbGUID*/, time_t> _goRespawnTimes;
+
+        MapUpdateStats m_updateStats;
+
+        std::set<Object*> _updateObjects;
+        ACE_Thread_Mutex _updateObjectsLock;
+
+        ACE_Thread_Mutex _regionLock;
+        ACE_Condition_Thread_Mutex _regionCondition;
+        std::vector<MapRegion> _regions;
+        std::vector<MarkedCells*> _regionMarkedCells;       // kept between updates, one per region of the largest split so far
+        std::vector<int32> _regionOfGrid;                   // region owning each grid of the current split, -1 for none
+        uint32 _nextRegion;
+        uint32 _finishedRegions;
+};
+
+// Serializes the map wide systems that are not bound to a region (zone scripts, outdoor pvp, battlefields,
+// creature formations) while the given map updates its regions in parallel, a NULL map locks nothing
+class MapRegionSerialGuard
+{
+    public:
+        explicit MapRegionSerialGuard(Map* map) : _lock(map && map->IsUpdatingRegions() ? &map->GetRegionSerialLock() : NULL) { if (_lock) _lock->acquire(); }
+        ~MapRegionSerialGuard() { if (_lock) _lock->release(); }
+
+    private:
+        ACE_Recursive_Thread_Mutex* _lock;
 };
 
 enum InstanceResetMethod
@@ -693,6 +872,19 @@ inline void Map::Visit(Cell const& cell, TypeContainerVisitor<T, CONTAINER>& vis
     }
 }
 
+template<class NOTIFIER>
+inline void Map::VisitSpatialIndex(Cell const& cell, NOTIFIER& notifier, bool worldObjects, float x, float y, float radius)
+{
+    const uint32 grid_x = cell.GridX();
+    const uint32 grid_y = cell.GridY();
+
+    if (!cell.NoCreate() || IsGridLoaded(GridCoord(grid_x, grid_y)))
+    {
+        EnsureGridLoaded(cell);
+        getNGrid(grid_x, grid_y)->GetGridType(cell.CellX(), cell.CellY()).GetSpatialIndex().Visit(notifier, worldObjects, x, y, radius);
+    }
+}
+
 template<class NOTIFIER>
 inline void Map::VisitAll(float const& x, float const& y, float radius, NOTIFIER& notifier, bool loadGrids)
 {
@@ -223,15 +223,15 @@ bool MapManager::CanPlayerEnter(uint32 mapid, Player* player, bool loginCheck)
             {
                 WorldPacket data(SMSG_CORPSE_NOT_IN_INSTANCE);
                 player->GetSession()->SendPacket(&data);
-                sLog->outDebug(LOG_FILTER_MAPS, "MAP: Player '%s' does not have a corpse in instance '%s' and cannot enter.", player->GetName(), mapName);
+                TC_LOG_DEBUG(LOG_FILTER_MAPS, "MAP: Player '%s' does not have a corpse in instance '%s' and cannot enter.", player->GetName(), mapName);
                 return false;
             }
-            sLog->outDebug(LOG_FILTER_MAPS, "MAP: Player '%s' has corpse in instance '%s' and can enter.", player->GetName(), mapName);
+            TC_LOG_DEBUG(LOG_FILTER_MAPS, "MAP: Player '%s' has corpse in instance '%s' and can enter.", player->GetName(), mapName);
             player->ResurrectPlayer(0.5f, false);
             player->SpawnCorpseBones();
         }
         else
-            sLog->outDebug(LOG_FILTER_MAPS, "Map::CanPlayerEnter - player '%s' is dead but does not have a corpse!", player->GetName());
+            TC_LOG_DEBUG(LOG_FILTER_MAPS, "Map::CanPlayerEnter - player '%s' is dead but does not have a corpse!", player->GetName());
     }
     
     Group* group = player->GetGroup();
@@ -242,7 +242,7 @@ bool MapManager::CanPlayerEnter(uint32 mapid, Player* player, bool loginCheck)
         {
             // Can also use ChatHandler(player).PSendSysMessage(player->GetSession()->GetTrinityString(LANG_INSTANCE_RAID_GROUP_ONLY), mapName);. Opcode better.
             player->SendTransferAborted(entry->MapID, TRANSFER_ABORT_NEED_GROUP);
-            sLog->outDebug(LOG_FILTER_MAPS, "MAP: Player '%s' must be in a raid group to enter instance '%s'", player->GetName(), mapName);
+            TC_LOG_DEBUG(LOG_FILTER_MAPS, "MAP: Player '%s' must be in a raid group to enter instance '%s'", player->GetName(), mapName);
             return false;
         }
     }
@@ -370,26 +370,81 @@ bool MapManager::CanPlayerEnter(uint32 mapid, Player* player, bool loginCheck)
     return player->Satisfy(sObjectMgr->GetAccessRequirement(mapid, targetDifficulty), mapid, true);
 }
 
+class MapObjectUpdateRequest : public ACE_Method_Request
+{
+    public:
+
+        explicit MapObjectUpdateRequest(Map& m) : m_map(m) { }
+
+        virtual int call()
+        {
+            m_map.SendObjectUpdates();
+            return 0;
+        }
+
+    private:
+
+        Map& m_map;
+};
+
 void MapManager::Update(uint32 diff)
 {
     i_timer.Update(diff);
     if (!i_timer.Passed())
         return;
 
-    MapMapType::iterator iter = i_maps.begin();
-    for (; iter != i_maps.end(); ++iter)
-    {
-        if (m_updater.activated())
-            m_updater.schedule_update(*iter->second, uint32(i_timer.GetCurrent()));
-        else
-            iter->second->Update(uint32(i_timer.GetCurrent()));
-    }
+    MapMapType::iterator iter;
     if (m_updater.activated())
+    {
+        // hand out the most expensive maps first, so every worker starts with one of them
+        std::vector<Map*> maps;
+        maps.reserve(i_maps.size());
+        for (iter = i_maps.begin(); iter != i_maps.end(); ++iter)
+            maps.push_back(iter->second);
+
+        std::sort(maps.begin(), maps.end(), MapUpdateCostOrder());
+
+        for (std::vector<Map*>::const_iterator itr = maps.begin(); itr != maps.end(); ++itr)
+            m_updater.schedule_update(**itr, uint32(i_timer.GetCurrent()));
+
         m_updater.wait();
+    }
+    else
+        for (iter = i_maps.begin(); iter != i_maps.end(); ++iter)
+            MapUpdater::update_map(*iter->second, uint32(i_timer.GetCurrent()));
 
     for (iter = i_maps.begin(); iter != i_maps.end(); ++iter)
         iter->second->DelayedUpdate(uint32(i_timer.GetCurrent()));
 
+    // changed objects are sent by their own map, in parallel on the map update workers
+    std::vector<Map*> updateMaps;
+    for (iter = i_maps.begin(); iter != i_maps.end(); ++iter)
+    {
+        Map* map = iter->second;
+        if (map->HasUpdateObjects())
+            updateMaps.push_back(map);
+
+        if (!map->Instanceable())
+            continue;
+
+        MapInstanced::InstancedMaps &maps = ((MapInstanced*)map)->GetInstancedMaps();
+        for (MapInstanced::InstancedMaps::iterator mitr = maps.begin(); mitr != maps.end(); ++mitr)
+            if (mitr->second->HasUpdateObjects())
+                updateMaps.push_back(mitr->second);
+    }
+
+    if (m_updater.activated())
+    {
+        for (std::vector<Map*>::const_iterator itr = updateMaps.begin(); itr != updateMaps.end(); ++itr)
+            m_updater.schedule_task(new MapObjectUpdateRequest(**itr));
+
+        m_updater.wait();
+    }
+    else
+        for (std::vector<Map*>::const_iterator itr = updateMaps.begin(); itr != updateMaps.end(); ++itr)
+            (*itr)->SendObjectUpdates();
+
+    // objects that are not sent by any map, e.g. items of a player who is not in world
     sObjectAccessor->Update(uint32(i_timer.GetCurrent()));
     for (TransportSet::iterator itr = m_Transports.begin(); itr != m_Transports.end(); ++itr)
         (*itr)->Update(uint32(i_timer.GetCurrent()));
@@ -467,6 +522,25 @@ uint32 MapManager::GetNumInstances()
     return ret;
 }
 
+void MapManager::GetMapUpdateStats(std::vector<MapUpdateStatsEntry>& stats)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, Lock);
+
+    for (MapMapType::iterator itr = i_maps.begin(); itr != i_maps.end(); ++itr)
+    {
+        Map* map = itr->second;
+        stats.push_back(MapUpdateStatsEntry(map));
+        if (!map->Instanceable())
+            continue;
+
+        MapInstanced::InstancedMaps &maps = ((MapInstanced*)map)->GetInstancedMaps();
+        for (MapInstanced::InstancedMaps::iterator mitr = maps.begin(); mitr != maps.end(); ++mitr)
+            stats.push_back(MapUpdateStatsEntry(mitr->second));
+    }
+
+    std::sort(stats.begin(), stats.end());
+}
+
 uint32 MapManager::GetNumPlayersInInstances()
 {
     TRINITY_GUARD(ACE_Thread_Mutex, Lock);
@@ -30,6 +30,28 @@
 class Transport;
 struct TransportCreatureProto;
 
+struct MapUpdateCostOrder
+{
+    bool operator()(Map const* left, Map const* right) const
+    {
+        return left->GetUpdateStats().avgTime > right->GetUpdateStats().avgTime;
+    }
+};
+
+struct MapUpdateStatsEntry
+{
+    explicit MapUpdateStatsEntry(Map const* map) : mapId(map->GetId()), instanceId(map->GetInstanceId()),
+        players(map->GetPlayers().getSize()), stats(map->GetUpdateStats()) { }
+
+    // most expensive first
+    bool operator<(MapUpdateStatsEntry const& right) const { return stats.avgTime > right.stats.avgTime; }
+
+    uint32 mapId;
+    uint32 instanceId;
+    uint32 players;
+    MapUpdateStats stats;
+};
+
 class MapManager
 {
     friend class ACE_Singleton<MapManager, ACE_Thread_Mutex>;
@@ -143,6 +165,7 @@ class MapManager
         /* statistics */
         uint32 GetNumInstances();
         uint32 GetNumPlayersInInstances();
+        void GetMapUpdateStats(std::vector<MapUpdateStatsEntry>& stats);   // all maps and instances, most expensive first
 
         // Instance ID management
         void InitInstanceIds();
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MapQueryCache.h"
+#include "Map.h"
+#include "World.h"
+
+#include <cmath>
+
+// beyond any map coordinate or height marker, keeps the quantized values inside int32
+#define MAP_QUERY_CACHE_MAX_COORD   1000000.0f
+
+static inline bool QuantizeCoord(float value, int32& result)
+{
+    if (!(std::fabs(value) < MAP_QUERY_CACHE_MAX_COORD))
+        return false;
+
+    result = int32(std::floor(value * MAP_QUERY_CACHE_PRECISION));
+    return true;
+}
+
+static inline uint32 HashKey(MapQueryKey const& key)
+{
+    uint32 hash = 2166136261u;
+    for (uint8 i = 0; i < 8; ++i)
+        hash = (hash ^ uint32(key.values[i])) * 16777619u;
+    return hash ^ (hash >> 15);
+}
+
+MapQueryCache::MapQueryCache() : _enabled(sWorld->getBoolConfig(CONFIG_MAP_QUERY_CACHE)), _allocated(false),
+    _dynamicGeneration(1), _terrainGeneration(1)
+{
+}
+
+// generation 0 marks empty slots
+static inline void NextGeneration(std::atomic<uint32>& generation)
+{
+    if (++generation == 0)
+        ++generation;
+}
+
+bool MapQueryCache::MakeKey(MapQueryKey& key, float x1, float y1, float z1, float x2, float y2, float z2, uint32 extra1, uint32 extra2)
+{
+    key.values[6] = int32(extra1);
+    key.values[7] = int32(extra2);
+    return QuantizeCoord(x1, key.values[0]) && QuantizeCoord(y1, key.values[1]) && QuantizeCoord(z1, key.values[2]) &&
+        QuantizeCoord(x2, key.values[3]) && QuantizeCoord(y2, key.values[4]) && QuantizeCoord(z2, key.values[5]);
+}
+
+// only the writer of a shard increments, a plain load and store avoids a locked instruction
+static inline void IncrementCounter(std::atomic<uint64>& counter)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+bool MapQueryCache::Find(MapQueryType type, MapQueryKey const& key, MapQueryResult& result, uint32& generation, bool shared)
+{
+    // generation 0 never matches, Store drops the result
+    generation = 0;
+    if (!_allocated.load(std::memory_order_acquire))
+        return false;
+
+    uint32 slot = HashKey(key) & (MAP_QUERY_CACHE_SIZE - 1);
+    Shard& shard = _shards[type][slot % MAP_QUERY_CACHE_SHARDS];
+    MapRegionGuard<ACE_Thread_Mutex> guard(shard.lock, shared);
+
+    generation = GetGeneration(type);
+    Entry const& entry = _entries[type][slot];
+    if (entry.generation != generation || !(entry.key == key))
+    {
+        IncrementCounter(shard.misses);
+        return false;
+    }
+
+    IncrementCounter(shard.hits);
+    result = entry.result;
+    return true;
+}
+
+void MapQueryCache::Store(MapQueryType type, MapQueryKey const& key, MapQueryResult const& result, uint32 generation, bool shared)
+{
+    if (!generation || !_allocated.load(std::memory_order_acquire))
+        return;
+
+    uint32 slot = HashKey(key) & (MAP_QUERY_CACHE_SIZE - 1);
+    Shard& shard = _shards[type][slot % MAP_QUERY_CACHE_SHARDS];
+    MapRegionGuard<ACE_Thread_Mutex> guard(shard.lock, shared);
+
+    // the map was invalidated while the result was computed, it may describe the old terrain or models
+    if (generation != GetGeneration(type))
+        return;
+
+    Entry& entry = _entries[type][slot];
+    entry.key = key;
+    entry.generation = generation;
+    entry.result = result;
+}
+
+void MapQueryCache::NextTick()
+{
+    if (!_enabled)
+        return;
+
+    // only the map thread allocates, other threads skip the cache until the flag is published
+    if (!_allocated.load(std::memory_order_relaxed))
+    {
+        Entry empty;
+        memset(&empty.key, 0, sizeof(empty.key));
+        empty.generation = 0;
+
+        for (uint8 i = 0; i < MAX_MAP_QUERY_TYPES; ++i)
+            _entries[i].assign(MAP_QUERY_CACHE_SIZE, empty);
+
+        _allocated.store(true, std::memory_order_release);
+    }
+
+    InvalidateDynamic();
+}
+
+void MapQueryCache::InvalidateDynamic()
+{
+    NextGeneration(_dynamicGeneration);
+}
+
+void MapQueryCache::InvalidateTerrain()
+{
+    // line of sight and dynamic height go through the terrain as well
+    NextGeneration(_terrainGeneration);
+    NextGeneration(_dynamicGeneration);
+}
+
+uint64 MapQueryCache::GetHits(MapQueryType type) const
+{
+    uint64 hits = 0;
+    for (uint8 i = 0; i < MAP_QUERY_CACHE_SHARDS; ++i)
+        hits += _shards[type][i].hits.load(std::memory_order_relaxed);
+    return hits;
+}
+
+uint64 MapQueryCache::GetMisses(MapQueryType type) const
+{
+    uint64 misses = 0;
+    for (uint8 i = 0; i < MAP_QUERY_CACHE_SHARDS; ++i)
+        misses += _shards[type][i].misses.load(std::memory_order_relaxed);
+    return misses;
+}
+
+void MapQueryCache::ResetCounters()
+{
+    for (uint8 i = 0; i < MAX_MAP_QUERY_TYPES; ++i)
+        for (uint8 j = 0; j < MAP_QUERY_CACHE_SHARDS; ++j)
+        {
+            _shards[i][j].hits.store(0, std::memory_order_relaxed);
+            _shards[i][j].misses.store(0, std::memory_order_relaxed);
+        }
+}
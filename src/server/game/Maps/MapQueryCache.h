@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_MAPQUERYCACHE_H
+#define TRINITY_MAPQUERYCACHE_H
+
+#include "Define.h"
+
+#include <ace/Thread_Mutex.h>
+
+#include <atomic>
+#include <vector>
+
+#define MAP_QUERY_CACHE_PRECISION   4.0f                    // key steps per yard
+#define MAP_QUERY_CACHE_SIZE        1024                    // entries per query type, power of two
+#define MAP_QUERY_CACHE_SHARDS      16                      // locks per query type
+
+enum MapQueryType
+{
+    MAP_QUERY_LINE_OF_SIGHT,                                // vmaps and gameobject models, cleared every tick
+    MAP_QUERY_DYNAMIC_HEIGHT,                               // static height and gameobject models, cleared every tick
+    MAP_QUERY_HEIGHT,                                       // .map and vmap height
+    MAP_QUERY_AREA_INFO,                                    // vmap area info
+    MAX_MAP_QUERY_TYPES
+};
+
+struct MapQueryKey
+{
+    int32 values[8];
+
+    bool operator==(MapQueryKey const& right) const
+    {
+        for (uint8 i = 0; i < 8; ++i)
+            if (values[i] != right.values[i])
+                return false;
+        return true;
+    }
+};
+
+struct MapQueryResult
+{
+    MapQueryResult() : value(0.0f), found(false), flags(0), adtId(0), rootId(0), groupId(0) { }
+
+    float value;                                            // height
+    bool found;                                             // in line of sight, or area info found
+    uint32 flags;
+    int32 adtId;
+    int32 rootId;
+    int32 groupId;
+};
+
+// Remembers recent line of sight, height and area info results of one map. Positions are
+// quantized to 1 / MAP_QUERY_CACHE_PRECISION yards, so queries repeated for the same pair of
+// objects during chase movement and target selection only traverse the trees once. Results that
+// depend on gameobject models are dropped every tick and whenever a model is added, removed or
+// toggled; terrain results stay until their slot is reused or a grid or vmap tile of the map is
+// loaded or unloaded. Base maps are also queried from other threads (zone and area lookups of
+// sMapMgr), their callers pass shared = true and lock the shard. Instances and battlegrounds are
+// only queried from their own update thread and skip the locks unless they update regions.
+// Callers take the generation from a missed Find before they compute the result and hand it back
+// to Store, a result computed while the map was invalidated is dropped instead of tagged current.
+class MapQueryCache
+{
+    public:
+
+        MapQueryCache();
+
+        // Builds the key of a query, returns false when a coordinate is out of range and the query can't be cached
+        static bool MakeKey(MapQueryKey& key, float x1, float y1, float z1, float x2 = 0.0f, float y2 = 0.0f, float z2 = 0.0f, uint32 extra1 = 0, uint32 extra2 = 0);
+
+        // On a miss, generation receives the generation the caller has to pass to Store
+        bool Find(MapQueryType type, MapQueryKey const& key, MapQueryResult& result, uint32& generation, bool shared);
+        void Store(MapQueryType type, MapQueryKey const& key, MapQueryResult const& result, uint32 generation, bool shared);
+
+        // Called at the start of the map update, allocates the tables on first use
+        void NextTick();
+        void InvalidateDynamic();
+        // Drops every result, called when terrain data of the map is loaded or unloaded
+        void InvalidateTerrain();
+
+        bool IsEnabled() const { return _enabled; }
+        uint64 GetHits(MapQueryType type) const;
+        uint64 GetMisses(MapQueryType type) const;
+        void ResetCounters();
+
+    private:
+
+        struct Entry
+        {
+            MapQueryKey key;
+            uint32 generation;                              // 0 for empty slots
+            MapQueryResult result;
+        };
+
+        struct Shard
+        {
+            Shard() : hits(0), misses(0) { }
+
+            ACE_Thread_Mutex lock;
+            // written by one thread at a time, atomic so the debug command can read them while unlocked maps update
+            std::atomic<uint64> hits;
+            std::atomic<uint64> misses;
+        };
+
+        uint32 GetGeneration(MapQueryType type) const { return type <= MAP_QUERY_DYNAMIC_HEIGHT ? uint32(_dynamicGeneration) : uint32(_terrainGeneration); }
+
+        bool _enabled;
+        std::atomic<bool> _allocated;                       // set once _entries are assigned, they are never resized after
+        std::vector<Entry> _entries[MAX_MAP_QUERY_TYPES];
+        mutable Shard _shards[MAX_MAP_QUERY_TYPES][MAP_QUERY_CACHE_SHARDS];
+        std::atomic<uint32> _dynamicGeneration;
+        std::atomic<uint32> _terrainGeneration;
+};
+
+#endif
@@ -1,64 +1,12 @@
 #include "MapUpdater.h"
-#include "DelayExecutor.h"
 #include "Map.h"
-#include "DatabaseEnv.h"
 
 #include <ace/Guard_T.h>
-#include <ace/Method_Request.h>
-
-class WDBThreadStartReq1 : public ACE_Method_Request
-{
-    public:
-
-        WDBThreadStartReq1()
-        {
-        }
-
-        virtual int call()
-        {
-            return 0;
-        }
-};
-
-class WDBThreadEndReq1 : public ACE_Method_Request
-{
-    public:
-
-        WDBThreadEndReq1()
-        {
-        }
-
-        virtual int call()
-        {
-            return 0;
-        }
-};
-
-class MapUpdateRequest : public ACE_Method_Request
-{
-    private:
-
-        Map& m_map;
-        MapUpdater& m_updater;
-        ACE_UINT32 m_diff;
-
-    public:
-
-        MapUpdateRequest(Map& m, MapUpdater& u, ACE_UINT32 d)
-            : m_map(m), m_updater(u), m_diff(d)
-        {
-        }
-
-        virtual int call()
-        {
-            m_map.Update (m_diff);
-            m_updater.update_finished();
-            return 0;
-        }
-};
+#include <ace/OS_NS_sys_time.h>
 
 MapUpdater::MapUpdater():
-m_executor(), m_mutex(), m_condition(m_mutex), pending_requests(0)
+m_mutex(), m_condition(m_mutex), m_workCondition(m_mutex), pending_requests(0), queued_requests(0),
+m_nextQueue(0), m_nextWorker(0), m_steals(0), m_shutdown(false), m_activated(false)
 {
 }
 
@@ -69,14 +17,49 @@ MapUpdater::~MapUpdater()
 
 int MapUpdater::activate(size_t num_threads)
 {
-    return m_executor.activate((int)num_threads, new WDBThreadStartReq1, new WDBThreadEndReq1);
+    if (activated() || num_threads < 1)
+        return -1;
+
+    for (size_t i = 0; i < num_threads; ++i)
+        m_queues.push_back(new WorkerQueue());
+
+    m_shutdown = false;
+    m_nextWorker = 0;
+
+    if (ACE_Task_Base::activate(THR_NEW_LWP | THR_JOINABLE | THR_INHERIT_SCHED, int(num_threads)) == -1)
+    {
+        for (size_t i = 0; i < m_queues.size(); ++i)
+            delete m_queues[i];
+
+        m_queues.clear();
+        return -1;
+    }
+
+    m_activated = true;
+    return 0;
 }
 
 int MapUpdater::deactivate()
 {
+    if (!activated())
+        return -1;
+
     wait();
 
-    return m_executor.deactivate();
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_mutex);
+        m_shutdown = true;
+        m_workCondition.broadcast();
+    }
+
+    ACE_Task_Base::wait();
+
+    for (size_t i = 0; i < m_queues.size(); ++i)
+        delete m_queues[i];
+
+    m_queues.clear();
+    m_activated = false;
+    return 0;
 }
 
 int MapUpdater::wait()
@@ -91,24 +74,142 @@ int MapUpdater::wait()
 
 int MapUpdater::schedule_update(Map& map, ACE_UINT32 diff)
 {
-    TRINITY_GUARD(ACE_Thread_Mutex, m_mutex);
+    if (!activated())
+        return -1;
 
-    ++pending_requests;
+    push_request(MapUpdateRequest(&map, diff, map.GetUpdateStats().avgTime));
+    return 0;
+}
 
-    if (m_executor.execute(new MapUpdateRequest(map, *this, diff)) == -1)
+int MapUpdater::schedule_task(ACE_Method_Request* task)
+{
+    if (!activated())
     {
-        ACE_DEBUG((LM_ERROR, ACE_TEXT("(%t) \n"), ACE_TEXT("Failed to schedule Map Update")));
-
-        --pending_requests;
+        delete task;
         return -1;
     }
 
+    push_request(MapUpdateRequest(task));
     return 0;
 }
 
+void MapUpdater::push_request(MapUpdateRequest const& request)
+{
+    WorkerQueue* queue;
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_mutex);
+
+        // count the request before it becomes visible, wait() must never see it finished before it is counted
+        ++pending_requests;
+        queue = m_queues[m_nextQueue++ % m_queues.size()];
+    }
+
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, queue->lock);
+
+        // most expensive maps first, so they start as early as possible in the tick
+        RequestQueue::iterator itr = queue->requests.begin();
+        while (itr != queue->requests.end() && itr->cost >= request.cost)
+            ++itr;
+
+        queue->requests.insert(itr, request);
+    }
+
+    TRINITY_GUARD(ACE_Thread_Mutex, m_mutex);
+    ++queued_requests;
+    m_workCondition.signal();
+}
+
 bool MapUpdater::activated()
 {
-    return m_executor.activated();
+    return m_activated;
+}
+
+void MapUpdater::update_map(Map& map, ACE_UINT32 diff)
+{
+    ACE_Time_Value start = ACE_OS::gettimeofday();
+
+    map.Update(diff);
+
+    ACE_Time_Value elapsed = ACE_OS::gettimeofday() - start;
+    map.RecordUpdateTime(uint32(elapsed.sec() * IN_MILLISECONDS * IN_MILLISECONDS + elapsed.usec()));
+}
+
+bool MapUpdater::pop_request(size_t worker, MapUpdateRequest& request)
+{
+    // own queue first, from the front (most expensive)
+    {
+        WorkerQueue* queue = m_queues[worker];
+        TRINITY_GUARD(ACE_Thread_Mutex, queue->lock);
+        if (!queue->requests.empty())
+        {
+            request = queue->requests.front();
+            queue->requests.pop_front();
+            return true;
+        }
+    }
+
+    // then steal the cheapest request of another worker
+    for (size_t i = 1; i < m_queues.size(); ++i)
+    {
+        WorkerQueue* queue = m_queues[(worker + i) % m_queues.size()];
+        TRINITY_GUARD(ACE_Thread_Mutex, queue->lock);
+        if (!queue->requests.empty())
+        {
+            request = queue->requests.back();
+            queue->requests.pop_back();
+
+            TRINITY_GUARD(ACE_Thread_Mutex, m_mutex);
+            ++m_steals;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+int MapUpdater::svc()
+{
+    size_t worker;
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_mutex);
+        worker = m_nextWorker++;
+    }
+
+    MapUpdateRequest request(NULL, 0, 0);
+    for (;;)
+    {
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, m_mutex);
+
+            while (queued_requests <= 0 && !m_shutdown)
+                m_workCondition.wait();
+
+            if (queued_requests <= 0 && m_shutdown)
+                break;
+        }
+
+        // a request counted in queued_requests may still be on its way into a queue, just retry
+        if (!pop_request(worker, request))
+            continue;
+
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, m_mutex);
+            --queued_requests;
+        }
+
+        if (request.task)
+        {
+            request.task->call();
+            delete request.task;
+        }
+        else
+            update_map(*request.map, request.diff);
+
+        update_finished();
+    }
+
+    return 0;
 }
 
 void MapUpdater::update_finished()
@@ -123,5 +224,6 @@ void MapUpdater::update_finished()
 
     --pending_requests;
 
-    m_condition.broadcast();
+    if (pending_requests == 0)
+        m_condition.broadcast();
 }
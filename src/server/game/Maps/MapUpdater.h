@@ -1,24 +1,35 @@
 #ifndef _MAP_UPDATER_H_INCLUDED
 #define _MAP_UPDATER_H_INCLUDED
 
+#include <ace/Task.h>
 #include <ace/Thread_Mutex.h>
 #include <ace/Condition_Thread_Mutex.h>
+#include <ace/Method_Request.h>
 
-#include "DelayExecutor.h"
+#include <deque>
+#include <vector>
+
+#include "Define.h"
 
 class Map;
 
-class MapUpdater
+// Map updates are spread over per-worker queues. Every queue keeps the most
+// expensive maps (by measured update cost) at its front; an idle worker first
+// drains its own queue and then steals the cheapest request from the back of
+// another worker's queue, so one busy continent no longer leaves the other
+// workers waiting for the end of the tick.
+class MapUpdater : protected ACE_Task_Base
 {
     public:
 
         MapUpdater();
         virtual ~MapUpdater();
 
-        friend class MapUpdateRequest;
-
         int schedule_update(Map& map, ACE_UINT32 diff);
 
+        // Runs a part of a map update on any worker, the updater takes ownership of the task
+        int schedule_task(ACE_Method_Request* task);
+
         int wait();
 
         int activate(size_t num_threads);
@@ -27,14 +38,50 @@ class MapUpdater
 
         bool activated();
 
+        // Updates the map and records how long it took, used by the workers and by the single threaded fallback
+        static void update_map(Map& map, ACE_UINT32 diff);
+
+        size_t worker_count() const { return m_queues.size(); }
+        uint64 steal_count() const { return m_steals; }
+
+        virtual int svc();
+
     private:
 
-        DelayExecutor m_executor;
-        ACE_Thread_Mutex m_mutex;
-        ACE_Condition_Thread_Mutex m_condition;
-        size_t pending_requests;
+        struct MapUpdateRequest
+        {
+            MapUpdateRequest(Map* m, ACE_UINT32 d, uint32 c) : map(m), task(NULL), diff(d), cost(c) { }
+            explicit MapUpdateRequest(ACE_Method_Request* t) : map(NULL), task(t), diff(0), cost(0) { }
+
+            Map* map;
+            ACE_Method_Request* task;
+            ACE_UINT32 diff;
+            uint32 cost;                                    // estimated update cost in microseconds
+        };
+
+        typedef std::deque<MapUpdateRequest> RequestQueue;
 
+        struct WorkerQueue
+        {
+            ACE_Thread_Mutex lock;
+            RequestQueue requests;
+        };
+
+        void push_request(MapUpdateRequest const& request);
+        bool pop_request(size_t worker, MapUpdateRequest& request);
         void update_finished();
+
+        std::vector<WorkerQueue*> m_queues;
+        ACE_Thread_Mutex m_mutex;
+        ACE_Condition_Thread_Mutex m_condition;             // signalled when all pending requests are done
+        ACE_Condition_Thread_Mutex m_workCondition;         // signalled when a new request is queued
+        size_t pending_requests;                            // scheduled but not yet finished
+        int32 queued_requests;                              // scheduled but not yet picked up by a worker
+        size_t m_nextQueue;
+        size_t m_nextWorker;
+        uint64 m_steals;
+        bool m_shutdown;
+        bool m_activated;
 };
 
 #endif //_MAP_UPDATER_H_INCLUDED
@@ -0,0 +1,450 @@
+/*
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MOVEMENT_CODEC_H
+#define _MOVEMENT_CODEC_H
+
+#include "MovementStructures.h"
+#include "Object.h"
+
+/*
+ * Turns a constexpr MovementStatusElements sequence into one reader and one writer function per opcode.
+ * MovementSequenceCodec walks the sequence at compile time and calls ReadMovementElement / WriteMovementElement
+ * for every element, each instantiated for its element, so the switch below collapses to the few statements of
+ * that element and the whole packet layout ends up unrolled in a single function.
+ * Only included by MovementStructures.cpp, which owns the sequences.
+ */
+
+template <MovementStatusElements Element>
+inline void ReadMovementElement(WorldPacket& data, MovementReadState& state)
+{
+    MovementInfo* mi = state.mi;
+
+    if (Element >= MSEHasGuidByte0 && Element <= MSEHasGuidByte7)
+    {
+        state.guid[Element - MSEHasGuidByte0] = data.ReadBit();
+        return;
+    }
+
+    if (Element >= MSEHasTransportGuidByte0 && Element <= MSEHasTransportGuidByte7)
+    {
+        if (state.hasTransportData)
+            state.tguid[Element - MSEHasTransportGuidByte0] = data.ReadBit();
+        return;
+    }
+
+    if (Element >= MSEGuidByte0 && Element <= MSEGuidByte7)
+    {
+        data.ReadByteSeq(state.guid[Element - MSEGuidByte0]);
+        return;
+    }
+
+    if (Element >= MSETransportGuidByte0 && Element <= MSETransportGuidByte7)
+    {
+        if (state.hasTransportData)
+            data.ReadByteSeq(state.tguid[Element - MSETransportGuidByte0]);
+        return;
+    }
+
+    if (Element >= MSEGenericDword0 && Element <= MSEGenericDword7)
+    {
+        data.read_skip<uint32>();
+        return;
+    }
+
+    switch (Element)
+    {
+        case MSEExtraElement:
+            state.extras->ReadNextElement(data);
+            break;
+        case MSEGeneric2bits0:
+            data.ReadBits(2);
+            break;
+        case MSEUnkUIntCount:
+            state.bitcounterLoop = data.ReadBits(22);
+            break;
+        case MSEUnkUIntLoop:
+            for (uint32 i = 0; i != state.bitcounterLoop; i++)
+                data.read_skip<uint32>();
+            break;
+        case MSEFlushBits:
+            data.FlushBits();
+            break;
+        case MSEHasMovementFlags:
+            mi->flags = !data.ReadBit();
+            break;
+        case MSEHasMovementFlags2:
+            mi->flags2 = !data.ReadBit();
+            break;
+        case MSEHasTimestamp:
+            mi->time = !data.ReadBit();
+            break;
+        case MSEHasOrientation:
+            mi->pos.m_orientation = !data.ReadBit() ? 1.0f : 0.0f;
+            break;
+        case MSEHasTransportData:
+            state.hasTransportData = data.ReadBit();
+            break;
+        case MSEHasTransportTime2:
+            if (state.hasTransportData)
+                mi->has_t_time2 = data.ReadBit();
+            break;
+        case MSEHasTransportTime3:
+            if (state.hasTransportData)
+                mi->has_t_time3 = data.ReadBit();
+            break;
+        case MSEHasPitch:
+            mi->HavePitch = !data.ReadBit();
+            break;
+        case MSEHasFallData:
+            mi->hasFallData = data.ReadBit();
+            break;
+        case MSEHasFallDirection:
+            if (mi->hasFallData)
+                mi->hasFallDirection = data.ReadBit();
+            break;
+        case MSEHasSplineElevation:
+            mi->HaveSplineElevation = !data.ReadBit();
+            break;
+        case MSEHasSpline:
+            state.hasSpline = data.ReadBit();
+            break;
+        case MSEMovementFlags:
+            if (mi->flags)
+                mi->flags = data.ReadBits(30);
+            break;
+        case MSEMovementFlags2:
+            if (mi->flags2)
+                mi->flags2 = data.ReadBits(13);
+            break;
+        case MSETimestamp:
+            if (mi->time)
+                data >> mi->time;
+            break;
+        case MSEPositionX:
+            data >> mi->pos.m_positionX;
+            break;
+        case MSEPositionY:
+            data >> mi->pos.m_positionY;
+            break;
+        case MSEPositionZ:
+            data >> mi->pos.m_positionZ;
+            break;
+        case MSEOrientation:
+            if (mi->pos.m_orientation != 0.0f)
+                mi->pos.SetOrientation(data.read<float>());
+            break;
+        case MSETransportPositionX:
+            if (state.hasTransportData)
+                data >> mi->t_pos.m_positionX;
+            break;
+        case MSETransportPositionY:
+            if (state.hasTransportData)
+                data >> mi->t_pos.m_positionY;
+            break;
+        case MSETransportPositionZ:
+            if (state.hasTransportData)
+                data >> mi->t_pos.m_positionZ;
+            break;
+        case MSETransportOrientation:
+            if (state.hasTransportData)
+                mi->t_pos.SetOrientation(data.read<float>());
+            break;
+        case MSETransportSeat:
+            if (state.hasTransportData)
+                data >> mi->t_seat;
+            break;
+        case MSETransportTime:
+            if (state.hasTransportData)
+                data >> mi->t_time;
+            break;
+        case MSETransportTime2:
+            if (state.hasTransportData && mi->has_t_time2)
+                data >> mi->t_time2;
+            break;
+        case MSETransportTime3:
+            if (state.hasTransportData && mi->has_t_time3)
+                data >> mi->t_time3;
+            break;
+        case MSEPitch:
+            if (mi->HavePitch)
+                data >> mi->pitch;
+            break;
+        case MSEFallTime:
+            if (mi->hasFallData)
+                data >> mi->fallTime;
+            break;
+        case MSEFallVerticalSpeed:
+            if (mi->hasFallData)
+                data >> mi->j_zspeed;
+            break;
+        case MSEFallCosAngle:
+            if (mi->hasFallData && mi->hasFallDirection)
+                data >> mi->j_cosAngle;
+            break;
+        case MSEFallSinAngle:
+            if (mi->hasFallData && mi->hasFallDirection)
+                data >> mi->j_sinAngle;
+            break;
+        case MSEFallHorizontalSpeed:
+            if (mi->hasFallData && mi->hasFallDirection)
+                data >> mi->j_xyspeed;
+            break;
+        case MSESplineElevation:
+            if (mi->HaveSplineElevation)
+                data >> mi->splineElevation;
+            break;
+        case MSEZeroBit:
+        case MSEOneBit:
+            data.ReadBit();
+            break;
+        case MSEHasUnkTime:
+            mi->Alive32 = !data.ReadBit();
+            break;
+        case MSEUnkTime:
+            if (mi->Alive32)
+                data >> mi->Alive32;
+            break;
+        case MSECounter:
+            data.read_skip<uint32>();
+            break;
+        default:
+            ASSERT(PrintInvalidSequenceElement(Element, __FUNCTION__));
+            break;
+    }
+}
+
+template <MovementStatusElements Element>
+inline void WriteMovementElement(WorldPacket& data, MovementWriteState const& state)
+{
+    MovementInfo const* mi = state.mi;
+
+    if (Element >= MSEHasGuidByte0 && Element <= MSEHasGuidByte7)
+    {
+        data.WriteBit(state.guid[Element - MSEHasGuidByte0]);
+        return;
+    }
+
+    if (Element >= MSEHasTransportGuidByte0 && Element <= MSEHasTransportGuidByte7)
+    {
+        if (state.hasTransportData)
+            data.WriteBit(state.tguid[Element - MSEHasTransportGuidByte0]);
+        return;
+    }
+
+    if (Element >= MSEGuidByte0 && Element <= MSEGuidByte7)
+    {
+        data.WriteByteSeq(state.guid[Element - MSEGuidByte0]);
+        return;
+    }
+
+    if (Element >= MSETransportGuidByte0 && Element <= MSETransportGuidByte7)
+    {
+        if (state.hasTransportData)
+            data.WriteByteSeq(state.tguid[Element - MSETransportGuidByte0]);
+        return;
+    }
+
+    switch (Element)
+    {
+        case MSEExtraElement:
+            state.extras->WriteNextElement(data);
+            break;
+        case MSEUnkUIntCount:
+            data.WriteBits(0, 22);
+            break;
+        case MSEUnkUIntLoop:
+            break;
+        case MSECounter:
+            data << uint32(0); // movement counter
+            break;
+        case MSEFlushBits:
+            data.FlushBits();
+            break;
+        case MSEHasMovementFlags:
+            data.WriteBit(!state.hasMovementFlags);
+            break;
+        case MSEHasMovementFlags2:
+            data.WriteBit(!state.hasMovementFlags2);
+            break;
+        case MSEHasTimestamp:
+            data.WriteBit(!mi->time);
+            break;
+        case MSEHasOrientation:
+            data.WriteBit(!mi->pos.HasOrientation());
+            break;
+        case MSEHasTransportData:
+            data.WriteBit(state.hasTransportData);
+            break;
+        case MSEHasTransportTime2:
+            if (state.hasTransportData)
+                data.WriteBit(mi->has_t_time2);
+            break;
+        case MSEHasTransportTime3:
+            if (state.hasTransportData)
+                data.WriteBit(mi->has_t_time3);
+            break;
+        case MSEHasPitch:
+            data.WriteBit(!mi->HavePitch);
+            break;
+        case MSEHasFallData:
+            data.WriteBit(mi->hasFallData);
+            break;
+        case MSEHasFallDirection:
+            if (mi->hasFallData)
+                data.WriteBit(mi->hasFallDirection);
+            break;
+        case MSEHasSplineElevation:
+            data.WriteBit(!mi->HaveSplineElevation);
+            break;
+        case MSEHasSpline:
+            data.WriteBit(state.hasSpline);
+            break;
+        case MSEMovementFlags:
+            if (state.hasMovementFlags)
+                data.WriteBits(mi->flags, 30);
+            break;
+        case MSEMovementFlags2:
+            if (state.hasMovementFlags2)
+                data.WriteBits(mi->flags2, 13);
+            break;
+        case MSETimestamp:
+            if (mi->time)
+                data << mi->time;
+            break;
+        case MSEPositionX:
+            data << mi->pos.m_positionX;
+            break;
+        case MSEPositionY:
+            data << mi->pos.m_positionY;
+            break;
+        case MSEPositionZ:
+            data << mi->pos.m_positionZ;
+            break;
+        case MSEOrientation:
+            if (mi->pos.HasOrientation())
+                data << mi->pos.GetOrientation();
+            break;
+        case MSETransportPositionX:
+            if (state.hasTransportData)
+                data << mi->t_pos.m_positionX;
+            break;
+        case MSETransportPositionY:
+            if (state.hasTransportData)
+                data << mi->t_pos.m_positionY;
+            break;
+        case MSETransportPositionZ:
+            if (state.hasTransportData)
+                data << mi->t_pos.m_positionZ;
+            break;
+        case MSETransportOrientation:
+            if (state.hasTransportData)
+                data << mi->t_pos.GetOrientation();
+            break;
+        case MSETransportSeat:
+            if (state.hasTransportData)
+                data << mi->t_seat;
+            break;
+        case MSETransportTime:
+            if (state.hasTransportData)
+                data << mi->t_time;
+            break;
+        case MSETransportTime2:
+            if (state.hasTransportData && mi->has_t_time2)
+                data << mi->t_time2;
+            break;
+        case MSETransportTime3:
+            if (state.hasTransportData && mi->has_t_time3)
+                data << mi->t_time3;
+            break;
+        case MSEPitch:
+            if (mi->HavePitch)
+                data << mi->pitch;
+            break;
+        case MSEFallTime:
+            if (mi->hasFallData)
+                data << mi->fallTime;
+            break;
+        case MSEFallVerticalSpeed:
+            if (mi->hasFallData)
+                data << mi->j_zspeed;
+            break;
+        case MSEFallCosAngle:
+            if (mi->hasFallData && mi->hasFallDirection)
+                data << mi->j_cosAngle;
+            break;
+        case MSEFallSinAngle:
+            if (mi->hasFallData && mi->hasFallDirection)
+                data << mi->j_sinAngle;
+            break;
+        case MSEFallHorizontalSpeed:
+            if (mi->hasFallData && mi->hasFallDirection)
+                data << mi->j_xyspeed;
+            break;
+        case MSESplineElevation:
+            if (mi->HaveSplineElevation)
+                data << mi->splineElevation;
+            break;
+        case MSEZeroBit:
+            data.WriteBit(0);
+            break;
+        case MSEOneBit:
+            data.WriteBit(1);
+            break;
+        case MSEHasUnkTime:
+            data.WriteBit(!mi->Alive32);
+            break;
+        case MSEUnkTime:
+            if (mi->Alive32)
+                data << mi->Alive32;
+            break;
+        default:
+            ASSERT(PrintInvalidSequenceElement(Element, __FUNCTION__));
+            break;
+    }
+}
+
+// handles Sequence[Index] and recurses to the next element, the specialization below ends the recursion at MSEEnd
+template <MovementStatusElements const* Sequence, uint32 Index = 0, MovementStatusElements Element = Sequence[Index]>
+struct MovementSequenceCodec
+{
+    static void Read(WorldPacket& data, MovementReadState& state)
+    {
+        ReadMovementElement<Element>(data, state);
+        MovementSequenceCodec<Sequence, Index + 1>::Read(data, state);
+    }
+
+    static void Write(WorldPacket& data, MovementWriteState const& state)
+    {
+        WriteMovementElement<Element>(data, state);
+        MovementSequenceCodec<Sequence, Index + 1>::Write(data, state);
+    }
+};
+
+template <MovementStatusElements const* Sequence, uint32 Index>
+struct MovementSequenceCodec<Sequence, Index, MSEEnd>
+{
+    static void Read(WorldPacket& /*data*/, MovementReadState& /*state*/) { }
+    static void Write(WorldPacket& /*data*/, MovementWriteState const& /*state*/) { }
+};
+
+template <MovementStatusElements const* Sequence>
+MovementCodec const* GetMovementSequenceCodec()
+{
+    static MovementCodec const codec = { &MovementSequenceCodec<Sequence>::Read, &MovementSequenceCodec<Sequence>::Write, Sequence };
+    return &codec;
+}
+
+#endif
@@ -24,6 +24,7 @@
 #include "MoveSplineInit.h"
 #include "MoveSpline.h"
 #include "VMapFactory.h"
+#include "PathGenerator.h"
 
 #define MIN_QUIET_DISTANCE 28.0f
 #define MAX_QUIET_DISTANCE 43.0f
@@ -98,21 +99,31 @@ void FleeingMovementGenerator<T>::_setTargetLocation(T* owner)
     if (!_getPoint(owner, x, y, z))
         return;
 
-    // Add LOS check for target point.
-    Position mypos;
-    owner->GetPosition(&mypos);
-
-    bool isInLOS = VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(owner->GetMapId(), mypos.m_positionX, mypos.m_positionY, mypos.m_positionZ + 2.0f, x, y, z + 2.0f);
-    if (!isInLOS)
+    PathGenerator path(owner);
+    if (!path.CalculatePath(x, y, z))
     {
         i_nextCheckTime.Reset(200);
         return;
     }
 
+    // Without navigation data the path is a straight line, add LOS check for target point.
+    if (path.GetPathType() & PATHFIND_SHORTCUT)
+    {
+        Position mypos;
+        owner->GetPosition(&mypos);
+
+        bool isInLOS = VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(owner->GetMapId(), mypos.m_positionX, mypos.m_positionY, mypos.m_positionZ + 2.0f, x, y, z + 2.0f);
+        if (!isInLOS)
+        {
+            i_nextCheckTime.Reset(200);
+            return;
+        }
+    }
+
     owner->AddUnitState(UNIT_STATE_FLEEING_MOVE);
 
     Movement::MoveSplineInit init(owner);
-    init.MoveTo(x, y, z);
+    init.MovebyPath(path.GetPath());
     init.SetWalk(false);
     init.Launch();
 }
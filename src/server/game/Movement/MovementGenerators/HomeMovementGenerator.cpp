@@ -22,6 +22,7 @@
 #include "WorldPacket.h"
 #include "MoveSplineInit.h"
 #include "MoveSpline.h"
+#include "PathGenerator.h"
 
 // ========== HomeMovementGenerator ============ //
 
@@ -46,9 +47,13 @@ void HomeMovementGenerator<Creature>::_setTargetLocation(Creature* owner)
     float x, y, z, o;
     owner->GetHomePosition(x, y, z, o);
 
+    // The creature has to arrive at home even when the last part of the way is not walkable.
+    PathGenerator path(owner);
+    path.CalculatePath(x, y, z, true);
+
     Movement::MoveSplineInit init(owner);
     init.SetFacing(o);
-    init.MoveTo(x, y, z);
+    init.MovebyPath(path.GetPath());
     init.SetWalk(false);
     init.Launch();
 
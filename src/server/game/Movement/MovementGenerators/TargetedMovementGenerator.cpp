@@ -28,6 +28,8 @@
 
 #include <cmath>
 
+#define PATH_RETRY_DELAY 1000                           // ms of straight chase after the target could not be reached by a path
+
 // ========== ChaseMovementGenerator ============ //
 
 template<>
@@ -142,14 +144,31 @@ void TargetedMovementGeneratorMedium<T,D>::_setTargetLocation(T* owner)
             return;
     */
 
+    owner->UpdateAllowedPositionZ(x, y, z);
+
+    if (!i_path)
+        i_path = new PathGenerator(owner);
+
+    // Walk around obstacles. A target that can not be reached (off the navigation data, on a ledge...) is
+    // chased in a straight line as before, and the search is only retried after a delay: an unreachable
+    // destination makes the search expand every reachable node.
+    bool pathFound = false;
+    if (i_pathRetry.Passed())
+    {
+        pathFound = i_path->CalculatePath(x, y, z);
+        if (!pathFound)
+            i_pathRetry.Reset(PATH_RETRY_DELAY);
+    }
+
     D::_addUnitStateMove(owner);
     i_targetReached = false;
     i_recalculateTravel = false;
 
-    owner->UpdateAllowedPositionZ(x, y, z);
-
     Movement::MoveSplineInit init(owner);
-    init.MoveTo(x, y, z);
+    if (pathFound)
+        init.MovebyPath(i_path->GetPath());
+    else
+        init.MoveTo(x, y, z);
     init.SetWalk(((D*)this)->EnableWalking());
     // Using the same condition for facing target as the one that is used for SetInFront on movement end - applies to ChaseMovementGenerator mostly.
     if (i_angle == 0.f)
@@ -225,6 +244,7 @@ bool TargetedMovementGeneratorMedium<T,D>::DoUpdate(T* owner, uint32 diff)
         return true;
     }
 
+    i_pathRetry.Update(diff);
     i_recheckDistance.Update(diff);
     if (i_recheckDistance.Passed())
     {
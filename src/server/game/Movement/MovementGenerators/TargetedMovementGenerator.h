@@ -23,6 +23,7 @@
 #include "FollowerReference.h"
 #include "Timer.h"
 #include "Unit.h"
+#include "PathGenerator.h"
 
 class TargetedMovementGeneratorBase
 {
@@ -39,9 +40,9 @@ class TargetedMovementGeneratorMedium : public MovementGeneratorMedium< T, D >,
 {
     protected:
         TargetedMovementGeneratorMedium(Unit* owner, float offset, float angle, bool useExactTargetLocation = false) :
-			TargetedMovementGeneratorBase(owner), i_recheckDistance(0), i_offset(offset),
+			TargetedMovementGeneratorBase(owner), i_path(NULL), i_recheckDistance(0), i_pathRetry(0), i_offset(offset),
 			i_angle(angle), i_recalculateTravel(false), i_targetReached(false) { }
-        ~TargetedMovementGeneratorMedium() { }
+        ~TargetedMovementGeneratorMedium() { delete i_path; }
 
     public:
         bool DoUpdate(T* owner, uint32 diff);
@@ -53,7 +54,9 @@ class TargetedMovementGeneratorMedium : public MovementGeneratorMedium< T, D >,
     protected:
         void _setTargetLocation(T* owner);
 
+        PathGenerator* i_path;
         TimeTrackerSmall i_recheckDistance;
+        TimeTrackerSmall i_pathRetry;                   // straight chase without path search until it passes
         float i_offset;
         float i_angle;
         bool i_recalculateTravel : 1;
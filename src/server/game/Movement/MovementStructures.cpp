@@ -17,9 +17,14 @@
  */
 
 #include "MovementStructures.h"
+#include "MovementCodec.h"
 #include "Player.h"
+#include "Timer.h"
+#include "Util.h"
 
-MovementStatusElements const PlayerMove[] =
+#include <set>
+
+constexpr MovementStatusElements PlayerMove[] =
 {
     MSEHasMovementFlags,       // 24
     MSEMovementFlags,          // 24
@@ -103,7 +108,7 @@ MovementStatusElements const PlayerMove[] =
     MSEEnd
 };
 
-MovementStatusElements const SetCanFly[] =
+constexpr MovementStatusElements SetCanFly[] =
 {
     MSEPositionY,
     MSEPositionX,
@@ -181,7 +186,7 @@ MovementStatusElements const SetCanFly[] =
 
 };
 
-MovementStatusElements const MovementFallLand[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementFallLand[] = // 5.4.7 18019
 {
     MSEPositionZ,              // 44
     MSEPositionX,              // 36
@@ -258,7 +263,7 @@ MovementStatusElements const MovementFallLand[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementHeartBeat[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementHeartBeat[] = // 5.4.7 18019
 {
     MSEPositionZ,              // 44
     MSEPositionX,              // 36
@@ -335,7 +340,7 @@ MovementStatusElements const MovementHeartBeat[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementJump[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementJump[] = // 5.4.7 18019
 {
     MSEPositionY,              // 40
     MSEPositionX,              // 36
@@ -412,7 +417,7 @@ MovementStatusElements const MovementJump[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementSetFacing[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementSetFacing[] = // 5.4.7 18019
 {
     MSEPositionY,              // 40
     MSEPositionX,              // 36
@@ -489,7 +494,7 @@ MovementStatusElements const MovementSetFacing[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementSetPitch[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementSetPitch[] = // 5.4.7 18019
 {
     MSEPositionX,              // 36
     MSEPositionZ,              // 44
@@ -567,7 +572,7 @@ MovementStatusElements const MovementSetPitch[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementStartBackward[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementStartBackward[] = // 5.4.7 18019
 {
     MSEPositionY,              // 40
     MSEPositionZ,              // 44
@@ -644,7 +649,7 @@ MovementStatusElements const MovementStartBackward[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementStartForward[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementStartForward[] = // 5.4.7 18019
 {
     MSEPositionY,              // 40
     MSEPositionZ,              // 44
@@ -721,7 +726,7 @@ MovementStatusElements const MovementStartForward[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementStartStrafeLeft[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementStartStrafeLeft[] = // 5.4.7 18019
 {
     MSEPositionZ,              // 44
     MSEPositionY,              // 40
@@ -798,7 +803,7 @@ MovementStatusElements const MovementStartStrafeLeft[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementStartStrafeRight[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementStartStrafeRight[] = // 5.4.7 18019
 {
     MSEPositionX,              // 36
     MSEPositionZ,              // 44
@@ -875,7 +880,7 @@ MovementStatusElements const MovementStartStrafeRight[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementStartTurnLeft[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementStartTurnLeft[] = // 5.4.7 18019
 {
     MSEPositionY,              // 40
     MSEPositionX,              // 36
@@ -952,7 +957,7 @@ MovementStatusElements const MovementStartTurnLeft[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementStartTurnRight[] = // 5.4.7  18019
+constexpr MovementStatusElements MovementStartTurnRight[] = // 5.4.7  18019
 {
     MSEPositionX,              // 36
     MSEPositionZ,              // 44
@@ -1029,7 +1034,7 @@ MovementStatusElements const MovementStartTurnRight[] = // 5.4.7  18019
     MSEEnd
 };
 
-MovementStatusElements const MovementStop[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementStop[] = // 5.4.7 18019
 {
     MSEPositionX,              // 36
     MSEPositionY,              // 40
@@ -1106,7 +1111,7 @@ MovementStatusElements const MovementStop[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementStopStrafe[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementStopStrafe[] = // 5.4.7 18019
 {
     MSEPositionX,              // 36
     MSEPositionY,              // 40
@@ -1183,7 +1188,7 @@ MovementStatusElements const MovementStopStrafe[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementStopTurn[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementStopTurn[] = // 5.4.7 18019
 {
     MSEPositionX,              // 36
     MSEPositionY,              // 40
@@ -1260,7 +1265,7 @@ MovementStatusElements const MovementStopTurn[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementStartAscend[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementStartAscend[] = // 5.4.7 18019
 {
     MSEPositionX,              // 36
     MSEPositionZ,              // 44
@@ -1337,7 +1342,7 @@ MovementStatusElements const MovementStartAscend[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementStartDescend[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementStartDescend[] = // 5.4.7 18019
 {
     MSEPositionY,              // 40
     MSEPositionZ,              // 44
@@ -1414,7 +1419,7 @@ MovementStatusElements const MovementStartDescend[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementStartSwim[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementStartSwim[] = // 5.4.7 18019
 {
     MSEPositionX,              // 36
     MSEPositionZ,              // 44
@@ -1491,7 +1496,7 @@ MovementStatusElements const MovementStartSwim[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementStopSwim[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementStopSwim[] = // 5.4.7 18019
 {
     MSEPositionZ,              // 44
     MSEPositionY,              // 40
@@ -1568,7 +1573,7 @@ MovementStatusElements const MovementStopSwim[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementStopAscend[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementStopAscend[] = // 5.4.7 18019
 {
     MSEPositionZ,              // 44
     MSEPositionX,              // 36
@@ -1645,7 +1650,7 @@ MovementStatusElements const MovementStopAscend[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementStopPitch[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementStopPitch[] = // 5.4.7 18019
 {
     MSEPositionZ,              // 44
     MSEPositionX,              // 36
@@ -1722,7 +1727,7 @@ MovementStatusElements const MovementStopPitch[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementStartPitchDown[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementStartPitchDown[] = // 5.4.7 18019
 {
     MSEPositionY,              // 40
     MSEPositionX,              // 36
@@ -1799,7 +1804,7 @@ MovementStatusElements const MovementStartPitchDown[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementStartPitchUp[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementStartPitchUp[] = // 5.4.7 18019
 {
     MSEPositionZ,              // 44
     MSEPositionY,              // 40
@@ -1876,7 +1881,7 @@ MovementStatusElements const MovementStartPitchUp[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MoveChngTransport[]=
+constexpr MovementStatusElements MoveChngTransport[]=
 {
     MSEPositionY,
     MSEPositionZ,
@@ -1953,7 +1958,7 @@ MovementStatusElements const MoveChngTransport[]=
     MSEEnd,
 };
 
-MovementStatusElements const MoveSplineDone[] =
+constexpr MovementStatusElements MoveSplineDone[] =
 {
     MSEPositionY,
     MSEPositionX,
@@ -2032,7 +2037,7 @@ MovementStatusElements const MoveSplineDone[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveNotActiveMover[] =
+constexpr MovementStatusElements MoveNotActiveMover[] =
 {
     MSEPositionZ,
     MSEPositionX,
@@ -2111,7 +2116,7 @@ MovementStatusElements const MoveNotActiveMover[] =
     MSEEnd,
 };
 
-MovementStatusElements const DismissControlledVehicle[] =
+constexpr MovementStatusElements DismissControlledVehicle[] =
 {
     MSEPositionY,
     MSEPositionZ,
@@ -2188,7 +2193,7 @@ MovementStatusElements const DismissControlledVehicle[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveUpdateTeleport[] =
+constexpr MovementStatusElements MoveUpdateTeleport[] =
 {
     MSEPositionZ,
     MSEPositionY,
@@ -2270,7 +2275,7 @@ MovementStatusElements const MoveUpdateTeleport[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementSetRunMode[] =
+constexpr MovementStatusElements MovementSetRunMode[] =
 {
     MSEPositionY,              // 40
     MSEPositionX,              // 36
@@ -2347,7 +2352,7 @@ MovementStatusElements const MovementSetRunMode[] =
     MSEEnd
 };
 
-MovementStatusElements const MovementSetWalkMode[] =
+constexpr MovementStatusElements MovementSetWalkMode[] =
 {
     MSEPositionZ,              // 44
     MSEPositionY,              // 40
@@ -2424,7 +2429,7 @@ MovementStatusElements const MovementSetWalkMode[] =
     MSEEnd
 };
 
-MovementStatusElements const MovementSetCanFly[] =
+constexpr MovementStatusElements MovementSetCanFly[] =
 {
     MSEPositionY,              // 40
     MSEPositionX,              // 36
@@ -2501,7 +2506,7 @@ MovementStatusElements const MovementSetCanFly[] =
     MSEEnd
 };
 
-MovementStatusElements const MovementSetCanTransitionBetweenSwimAndFlyAck[] =
+constexpr MovementStatusElements MovementSetCanTransitionBetweenSwimAndFlyAck[] =
 {
     MSEPositionZ,
     MSEPositionY,
@@ -2574,7 +2579,7 @@ MovementStatusElements const MovementSetCanTransitionBetweenSwimAndFlyAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementUpdateWalkSpeed[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementUpdateWalkSpeed[] = // 5.4.7 18019
 {
     MSEHasGuidByte3,
     MSEHasGuidByte5,
@@ -2659,7 +2664,7 @@ MovementStatusElements const MovementUpdateWalkSpeed[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementUpdateRunSpeed[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementUpdateRunSpeed[] = // 5.4.7 18019
 {
     MSEHasGuidByte4,
     MSEHasGuidByte1,
@@ -2742,7 +2747,7 @@ MovementStatusElements const MovementUpdateRunSpeed[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementUpdateRunBackSpeed[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementUpdateRunBackSpeed[] = // 5.4.7 18019
 {
     MSEHasGuidByte3,
     MSEHasGuidByte2,
@@ -2827,7 +2832,7 @@ MovementStatusElements const MovementUpdateRunBackSpeed[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementUpdateSwimSpeed[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementUpdateSwimSpeed[] = // 5.4.7 18019
 {
     MSEPositionY,
     MSEPositionX,
@@ -2912,7 +2917,7 @@ MovementStatusElements const MovementUpdateSwimSpeed[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementUpdateFlightSpeed[] = // 5.4.7 18019
+constexpr MovementStatusElements MovementUpdateFlightSpeed[] = // 5.4.7 18019
 {
     MSEHasTransportData,     // hasTransport
 
@@ -2995,7 +3000,7 @@ MovementStatusElements const MovementUpdateFlightSpeed[] = // 5.4.7 18019
     MSEEnd
 };
 
-MovementStatusElements const MovementUpdateCollisionHeight[] =
+constexpr MovementStatusElements MovementUpdateCollisionHeight[] =
 {
     MSEPositionZ,
     MSEExtraElement,
@@ -3055,7 +3060,7 @@ MovementStatusElements const MovementUpdateCollisionHeight[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementForceRunSpeedChangeAck[] =
+constexpr MovementStatusElements MovementForceRunSpeedChangeAck[] =
 {
     MSECounter,
     MSEPositionX,
@@ -3129,7 +3134,7 @@ MovementStatusElements const MovementForceRunSpeedChangeAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementSetCollisionHeightAck[] =
+constexpr MovementStatusElements MovementSetCollisionHeightAck[] =
 {
     MSEPositionX,
     MSEGenericDword0,
@@ -3210,7 +3215,7 @@ MovementStatusElements const MovementSetCollisionHeightAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementForceFlightSpeedChangeAck[] =
+constexpr MovementStatusElements MovementForceFlightSpeedChangeAck[] =
 {
     MSECounter,
     MSEPositionZ,
@@ -3284,7 +3289,7 @@ MovementStatusElements const MovementForceFlightSpeedChangeAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementSetCanFlyAck[] =
+constexpr MovementStatusElements MovementSetCanFlyAck[] =
 {
     MSEPositionY,
     MSEPositionX,
@@ -3362,7 +3367,7 @@ MovementStatusElements const MovementSetCanFlyAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementForceSwimSpeedChangeAck[] =
+constexpr MovementStatusElements MovementForceSwimSpeedChangeAck[] =
 {
     MSEPositionX,
     MSECounter,
@@ -3436,7 +3441,7 @@ MovementStatusElements const MovementForceSwimSpeedChangeAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementForceWalkSpeedChangeAck[] =
+constexpr MovementStatusElements MovementForceWalkSpeedChangeAck[] =
 {
     MSEPositionZ,
     MSEPositionY,
@@ -3510,7 +3515,7 @@ MovementStatusElements const MovementForceWalkSpeedChangeAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementForceRunBackSpeedChangeAck[] =
+constexpr MovementStatusElements MovementForceRunBackSpeedChangeAck[] =
 {
     MSEExtraElement,
     MSECounter,
@@ -3584,7 +3589,7 @@ MovementStatusElements const MovementForceRunBackSpeedChangeAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const ForceMoveRootAck[] =
+constexpr MovementStatusElements ForceMoveRootAck[] =
 {
     MSEPositionY,
     MSEPositionZ,
@@ -3657,7 +3662,7 @@ MovementStatusElements const ForceMoveRootAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const ForceMoveUnrootAck[] =
+constexpr MovementStatusElements ForceMoveUnrootAck[] =
 {
     MSECounter,
     MSEPositionZ,
@@ -3730,7 +3735,7 @@ MovementStatusElements const ForceMoveUnrootAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementFallReset[] =
+constexpr MovementStatusElements MovementFallReset[] =
 {
     MSEPositionY,              // 40
     MSEPositionZ,              // 44
@@ -3807,7 +3812,7 @@ MovementStatusElements const MovementFallReset[] =
     MSEEnd
 };
 
-MovementStatusElements const MovementFeatherFallAck[] =
+constexpr MovementStatusElements MovementFeatherFallAck[] =
 {
     MSEPositionZ,
     MSECounter,
@@ -3880,7 +3885,7 @@ MovementStatusElements const MovementFeatherFallAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementGravityDisableAck[] =
+constexpr MovementStatusElements MovementGravityDisableAck[] =
 {
     MSEPositionZ,
     MSEPositionY,
@@ -3953,7 +3958,7 @@ MovementStatusElements const MovementGravityDisableAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementGravityEnableAck[] =
+constexpr MovementStatusElements MovementGravityEnableAck[] =
 {
     MSEPositionZ,
     MSEPositionX,
@@ -4026,7 +4031,7 @@ MovementStatusElements const MovementGravityEnableAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementHoverAck[] =
+constexpr MovementStatusElements MovementHoverAck[] =
 {
     MSECounter,
     MSEPositionZ,
@@ -4099,7 +4104,7 @@ MovementStatusElements const MovementHoverAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementKnockBackAck[] =
+constexpr MovementStatusElements MovementKnockBackAck[] =
 {
     MSEPositionX,              // 36
     MSEPositionY,              // 40
@@ -4177,7 +4182,7 @@ MovementStatusElements const MovementKnockBackAck[] =
     MSEEnd
 };
 
-MovementStatusElements const MovementWaterWalkAck[] =
+constexpr MovementStatusElements MovementWaterWalkAck[] =
 {
     MSEPositionY,
     MSEPositionZ,
@@ -4250,7 +4255,7 @@ MovementStatusElements const MovementWaterWalkAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementUpdateKnockBack[] =
+constexpr MovementStatusElements MovementUpdateKnockBack[] =
 {
     MSEZeroBit,
     MSEHasGuidByte4,
@@ -4309,7 +4314,7 @@ MovementStatusElements const MovementUpdateKnockBack[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetWalkSpeed[] =
+constexpr MovementStatusElements SplineMoveSetWalkSpeed[] =
 {
     MSEHasGuidByte6,
     MSEHasGuidByte7,
@@ -4331,7 +4336,7 @@ MovementStatusElements const SplineMoveSetWalkSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetRunSpeed[] =
+constexpr MovementStatusElements SplineMoveSetRunSpeed[] =
 {
     MSEHasGuidByte2,
     MSEHasGuidByte7,
@@ -4353,7 +4358,7 @@ MovementStatusElements const SplineMoveSetRunSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetRunBackSpeed[] =
+constexpr MovementStatusElements SplineMoveSetRunBackSpeed[] =
 {
     MSEHasGuidByte5,
     MSEHasGuidByte0,
@@ -4375,7 +4380,7 @@ MovementStatusElements const SplineMoveSetRunBackSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetSwimSpeed[] =
+constexpr MovementStatusElements SplineMoveSetSwimSpeed[] =
 {
     MSEHasGuidByte6,
     MSEHasGuidByte4,
@@ -4397,7 +4402,7 @@ MovementStatusElements const SplineMoveSetSwimSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetSwimBackSpeed[] =
+constexpr MovementStatusElements SplineMoveSetSwimBackSpeed[] =
 {
     MSEHasGuidByte4,
     MSEHasGuidByte3,
@@ -4419,7 +4424,7 @@ MovementStatusElements const SplineMoveSetSwimBackSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetTurnRate[] =
+constexpr MovementStatusElements SplineMoveSetTurnRate[] =
 {
     MSEHasGuidByte7,
     MSEHasGuidByte2,
@@ -4441,7 +4446,7 @@ MovementStatusElements const SplineMoveSetTurnRate[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetFlightSpeed[] =
+constexpr MovementStatusElements SplineMoveSetFlightSpeed[] =
 {
     MSEHasGuidByte2,
     MSEHasGuidByte7,
@@ -4463,7 +4468,7 @@ MovementStatusElements const SplineMoveSetFlightSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetFlightBackSpeed[] =
+constexpr MovementStatusElements SplineMoveSetFlightBackSpeed[] =
 {
     MSEHasGuidByte0,
     MSEHasGuidByte4,
@@ -4485,7 +4490,7 @@ MovementStatusElements const SplineMoveSetFlightBackSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetPitchRate[] =
+constexpr MovementStatusElements SplineMoveSetPitchRate[] =
 {
     MSEExtraElement,
     MSEHasGuidByte5,
@@ -4507,7 +4512,7 @@ MovementStatusElements const SplineMoveSetPitchRate[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetWalkSpeed[] = // 5.4.7 18019
+constexpr MovementStatusElements MoveSetWalkSpeed[] = // 5.4.7 18019
 {
     MSEHasGuidByte1,
     MSEHasGuidByte0,
@@ -4530,7 +4535,7 @@ MovementStatusElements const MoveSetWalkSpeed[] = // 5.4.7 18019
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetRunSpeed[] = // 5.4.7 18019
+constexpr MovementStatusElements MoveSetRunSpeed[] = // 5.4.7 18019
 {
     MSEHasGuidByte1,
     MSEHasGuidByte5,
@@ -4553,7 +4558,7 @@ MovementStatusElements const MoveSetRunSpeed[] = // 5.4.7 18019
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetRunBackSpeed[] =
+constexpr MovementStatusElements MoveSetRunBackSpeed[] =
 {
     MSEHasGuidByte7,
     MSEHasGuidByte2,
@@ -4576,7 +4581,7 @@ MovementStatusElements const MoveSetRunBackSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetSwimSpeed[] = // 5.4.7 18019
+constexpr MovementStatusElements MoveSetSwimSpeed[] = // 5.4.7 18019
 {
     MSEExtraElement,
     MSECounter,
@@ -4599,7 +4604,7 @@ MovementStatusElements const MoveSetSwimSpeed[] = // 5.4.7 18019
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetSwimBackSpeed[] =
+constexpr MovementStatusElements MoveSetSwimBackSpeed[] =
 {
     MSECounter,
     MSEExtraElement,
@@ -4622,7 +4627,7 @@ MovementStatusElements const MoveSetSwimBackSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetTurnRate[] =
+constexpr MovementStatusElements MoveSetTurnRate[] =
 {
     MSEHasGuidByte0,
     MSEHasGuidByte1,
@@ -4645,7 +4650,7 @@ MovementStatusElements const MoveSetTurnRate[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetFlightSpeed[] = //5.4.7 18019
+constexpr MovementStatusElements MoveSetFlightSpeed[] = //5.4.7 18019
 {
     MSEHasGuidByte2,
     MSEHasGuidByte1,
@@ -4668,7 +4673,7 @@ MovementStatusElements const MoveSetFlightSpeed[] = //5.4.7 18019
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetFlightBackSpeed[] =
+constexpr MovementStatusElements MoveSetFlightBackSpeed[] =
 {
     MSEHasGuidByte3,
     MSEHasGuidByte5,
@@ -4691,7 +4696,7 @@ MovementStatusElements const MoveSetFlightBackSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetPitchRate[] =
+constexpr MovementStatusElements MoveSetPitchRate[] =
 {
     MSEHasGuidByte3,
     MSEHasGuidByte5,
@@ -4714,7 +4719,7 @@ MovementStatusElements const MoveSetPitchRate[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetWalkMode[] =
+constexpr MovementStatusElements SplineMoveSetWalkMode[] =
 {
     MSEHasGuidByte0,
     MSEHasGuidByte2,
@@ -4735,7 +4740,7 @@ MovementStatusElements const SplineMoveSetWalkMode[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetRunMode[] =
+constexpr MovementStatusElements SplineMoveSetRunMode[] =
 {
     MSEHasGuidByte0,
     MSEHasGuidByte5,
@@ -4756,7 +4761,7 @@ MovementStatusElements const SplineMoveSetRunMode[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveGravityDisable[] =
+constexpr MovementStatusElements SplineMoveGravityDisable[] =
 {
     MSEHasGuidByte7,
     MSEHasGuidByte3,
@@ -4777,7 +4782,7 @@ MovementStatusElements const SplineMoveGravityDisable[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveGravityEnable[] =
+constexpr MovementStatusElements SplineMoveGravityEnable[] =
 {
     MSEHasGuidByte5,
     MSEHasGuidByte4,
@@ -4798,7 +4803,7 @@ MovementStatusElements const SplineMoveGravityEnable[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetHover[] =
+constexpr MovementStatusElements SplineMoveSetHover[] =
 {
     MSEHasGuidByte5,
     MSEHasGuidByte6,
@@ -4819,7 +4824,7 @@ MovementStatusElements const SplineMoveSetHover[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveUnsetHover[] =
+constexpr MovementStatusElements SplineMoveUnsetHover[] =
 {
     MSEHasGuidByte0,
     MSEHasGuidByte2,
@@ -4840,7 +4845,7 @@ MovementStatusElements const SplineMoveUnsetHover[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveStartSwim[] =
+constexpr MovementStatusElements SplineMoveStartSwim[] =
 {
     MSEHasGuidByte1,
     MSEHasGuidByte6,
@@ -4861,7 +4866,7 @@ MovementStatusElements const SplineMoveStartSwim[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveStopSwim[] =
+constexpr MovementStatusElements SplineMoveStopSwim[] =
 {
     MSEHasGuidByte4,
     MSEHasGuidByte1,
@@ -4882,7 +4887,7 @@ MovementStatusElements const SplineMoveStopSwim[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetFlying[] =
+constexpr MovementStatusElements SplineMoveSetFlying[] =
 {
     MSEHasGuidByte4,
     MSEHasGuidByte2,
@@ -4903,7 +4908,7 @@ MovementStatusElements const SplineMoveSetFlying[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveUnsetFlying[] =
+constexpr MovementStatusElements SplineMoveUnsetFlying[] =
 {
     MSEHasGuidByte5,
     MSEHasGuidByte3,
@@ -4924,7 +4929,7 @@ MovementStatusElements const SplineMoveUnsetFlying[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetWaterWalk[] =
+constexpr MovementStatusElements SplineMoveSetWaterWalk[] =
 {
     MSEHasGuidByte5,
     MSEHasGuidByte1,
@@ -4945,7 +4950,7 @@ MovementStatusElements const SplineMoveSetWaterWalk[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetLandWalk[] =
+constexpr MovementStatusElements SplineMoveSetLandWalk[] =
 {
     MSEHasGuidByte6,
     MSEHasGuidByte3,
@@ -4966,7 +4971,7 @@ MovementStatusElements const SplineMoveSetLandWalk[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetFeatherFall[] =
+constexpr MovementStatusElements SplineMoveSetFeatherFall[] =
 {
     MSEHasGuidByte6,
     MSEHasGuidByte7,
@@ -4987,7 +4992,7 @@ MovementStatusElements const SplineMoveSetFeatherFall[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetNormalFall[] =
+constexpr MovementStatusElements SplineMoveSetNormalFall[] =
 {
     MSEHasGuidByte4,
     MSEHasGuidByte0,
@@ -5008,7 +5013,7 @@ MovementStatusElements const SplineMoveSetNormalFall[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveRoot[] =
+constexpr MovementStatusElements SplineMoveRoot[] =
 {
     MSEHasGuidByte4,
     MSEHasGuidByte3,
@@ -5029,7 +5034,7 @@ MovementStatusElements const SplineMoveRoot[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveUnroot[] =
+constexpr MovementStatusElements SplineMoveUnroot[] =
 {
     MSEHasGuidByte7,
     MSEHasGuidByte4,
@@ -5050,7 +5055,7 @@ MovementStatusElements const SplineMoveUnroot[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetCanFly[] = // 5.4.7 18019
+constexpr MovementStatusElements MoveSetCanFly[] = // 5.4.7 18019
 {
     MSEHasGuidByte4,
     MSEHasGuidByte2,
@@ -5072,7 +5077,7 @@ MovementStatusElements const MoveSetCanFly[] = // 5.4.7 18019
     MSEEnd,
 };
 
-MovementStatusElements const MoveUnsetCanFly[] = // 5.4.7 18019
+constexpr MovementStatusElements MoveUnsetCanFly[] = // 5.4.7 18019
 {
     MSEHasGuidByte5,
     MSEHasGuidByte3,
@@ -5094,7 +5099,7 @@ MovementStatusElements const MoveUnsetCanFly[] = // 5.4.7 18019
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetHover[] =
+constexpr MovementStatusElements MoveSetHover[] =
 {
     MSEHasGuidByte1,
     MSEHasGuidByte3,
@@ -5116,7 +5121,7 @@ MovementStatusElements const MoveSetHover[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveUnsetHover[] =
+constexpr MovementStatusElements MoveUnsetHover[] =
 {
     MSEHasGuidByte5,
     MSEHasGuidByte3,
@@ -5138,7 +5143,7 @@ MovementStatusElements const MoveUnsetHover[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveWaterWalk[] =
+constexpr MovementStatusElements MoveWaterWalk[] =
 {
     MSEHasGuidByte2,
     MSEHasGuidByte3,
@@ -5160,7 +5165,7 @@ MovementStatusElements const MoveWaterWalk[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveLandWalk[] =
+constexpr MovementStatusElements MoveLandWalk[] =
 {
     MSEHasGuidByte7,
     MSEHasGuidByte5,
@@ -5182,7 +5187,7 @@ MovementStatusElements const MoveLandWalk[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveFeatherFall[] =
+constexpr MovementStatusElements MoveFeatherFall[] =
 {
     MSECounter,
     MSEHasGuidByte0,
@@ -5204,7 +5209,7 @@ MovementStatusElements const MoveFeatherFall[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveNormalFall[] =
+constexpr MovementStatusElements MoveNormalFall[] =
 {
     MSEHasGuidByte7,
     MSEHasGuidByte4,
@@ -5226,7 +5231,7 @@ MovementStatusElements const MoveNormalFall[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveRoot[] =
+constexpr MovementStatusElements MoveRoot[] =
 {
     MSEHasGuidByte5,
     MSEHasGuidByte3,
@@ -5248,7 +5253,7 @@ MovementStatusElements const MoveRoot[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveUnroot[] =
+constexpr MovementStatusElements MoveUnroot[] =
 {
     MSEHasGuidByte0,
     MSEHasGuidByte6,
@@ -5270,7 +5275,7 @@ MovementStatusElements const MoveUnroot[] =
     MSEEnd,
 };
 
-MovementStatusElements const ChangeSeatsOnControlledVehicle[] =
+constexpr MovementStatusElements ChangeSeatsOnControlledVehicle[] =
 {
     MSEPositionY,
     MSEPositionX,
@@ -5359,7 +5364,7 @@ MovementStatusElements const ChangeSeatsOnControlledVehicle[] =
     MSEEnd,
 };
 
-MovementStatusElements const CastSpellEmbeddedMovement[] =
+constexpr MovementStatusElements CastSpellEmbeddedMovement[] =
 {
     MSEPositionZ,
     MSEPositionY,
@@ -5571,7 +5576,7 @@ void PacketSender::Send() const
     }*/
 }
 
-MovementStatusElements const* GetMovementStatusElementsSequence(Opcodes opcode)
+MovementCodec const* GetMovementCodec(Opcodes opcode)
 {
     switch (opcode)
     {
@@ -5582,66 +5587,66 @@ MovementStatusElements const* GetMovementStatusElementsSequence(Opcodes opcode)
             // MOVE
 
         case CMSG_MOVE_CHNG_TRANSPORT:
-            return MoveChngTransport;
+            return GetMovementSequenceCodec<MoveChngTransport>();
         case CMSG_MOVE_FALL_LAND:
-            return MovementFallLand;
+            return GetMovementSequenceCodec<MovementFallLand>();
         //case CMSG_MOVE_FALL_RESET:
         //    return MovementFallReset;
         case CMSG_MOVE_HEARTBEAT:
-            return MovementHeartBeat;
+            return GetMovementSequenceCodec<MovementHeartBeat>();
         case CMSG_MOVE_JUMP:
-            return MovementJump;
+            return GetMovementSequenceCodec<MovementJump>();
         //case CMSG_MOVE_NOT_ACTIVE_MOVER:
         //    return MoveNotActiveMover;
         //case CMSG_MOVE_SPLINE_DONE:
         //    return MoveSplineDone;
         case CMSG_MOVE_STOP:
-            return MovementStop;
+            return GetMovementSequenceCodec<MovementStop>();
 
             // MOVE_START / MOVE_STOP
 
         case CMSG_MOVE_START_ASCEND:
-           return MovementStartAscend;
+           return GetMovementSequenceCodec<MovementStartAscend>();
         case CMSG_MOVE_START_BACKWARD:
-           return MovementStartBackward;
+           return GetMovementSequenceCodec<MovementStartBackward>();
         case CMSG_MOVE_START_DESCEND:
-            return MovementStartDescend;
+            return GetMovementSequenceCodec<MovementStartDescend>();
         case CMSG_MOVE_START_FORWARD:
-            return MovementStartForward;
+            return GetMovementSequenceCodec<MovementStartForward>();
         case CMSG_MOVE_START_PITCH_DOWN:
-            return MovementStartPitchDown;
+            return GetMovementSequenceCodec<MovementStartPitchDown>();
         case CMSG_MOVE_START_PITCH_UP:
-            return MovementStartPitchUp;
+            return GetMovementSequenceCodec<MovementStartPitchUp>();
         case CMSG_MOVE_START_STRAFE_LEFT:
-            return MovementStartStrafeLeft;
+            return GetMovementSequenceCodec<MovementStartStrafeLeft>();
         case CMSG_MOVE_START_STRAFE_RIGHT:
-            return MovementStartStrafeRight;
+            return GetMovementSequenceCodec<MovementStartStrafeRight>();
         case CMSG_MOVE_START_SWIM:
-            return MovementStartSwim;
+            return GetMovementSequenceCodec<MovementStartSwim>();
         case CMSG_MOVE_START_TURN_LEFT:
-            return MovementStartTurnLeft;
+            return GetMovementSequenceCodec<MovementStartTurnLeft>();
         case CMSG_MOVE_START_TURN_RIGHT:
-            return MovementStartTurnRight;
+            return GetMovementSequenceCodec<MovementStartTurnRight>();
 
         case CMSG_MOVE_STOP_ASCEND:
-            return MovementStopAscend;
+            return GetMovementSequenceCodec<MovementStopAscend>();
         case CMSG_MOVE_STOP_PITCH:
-            return MovementStopPitch;
+            return GetMovementSequenceCodec<MovementStopPitch>();
         case CMSG_MOVE_STOP_STRAFE:
-            return MovementStopStrafe;
+            return GetMovementSequenceCodec<MovementStopStrafe>();
         case CMSG_MOVE_STOP_SWIM:
-            return MovementStopSwim;
+            return GetMovementSequenceCodec<MovementStopSwim>();
         case CMSG_MOVE_STOP_TURN:
-            return MovementStopTurn;
+            return GetMovementSequenceCodec<MovementStopTurn>();
 
             // MOVE_SET / MOVE_UNSET
 
         case CMSG_MOVE_SET_FACING:
-            return MovementSetFacing;
+            return GetMovementSequenceCodec<MovementSetFacing>();
         case CMSG_MOVE_SET_FLY:
-            return SetCanFly;
+            return GetMovementSequenceCodec<SetCanFly>();
         case CMSG_MOVE_SET_PITCH:
-            return MovementSetPitch;
+            return GetMovementSequenceCodec<MovementSetPitch>();
         //case CMSG_MOVE_SET_RUN_MODE:
         //    return MovementSetRunMode;
         //case CMSG_MOVE_SET_WALK_MODE:
@@ -5662,14 +5667,14 @@ MovementStatusElements const* GetMovementStatusElementsSequence(Opcodes opcode)
         //case CMSG_MOVE_WATER_WALK_ACK:
         //    return MovementWaterWalkAck;
         case CMSG_MOVE_KNOCK_BACK_ACK:
-            return MovementKnockBackAck;
+            return GetMovementSequenceCodec<MovementKnockBackAck>();
 
         case CMSG_MOVE_SET_CAN_FLY_ACK:
-            return MovementSetCanFlyAck;
+            return GetMovementSequenceCodec<MovementSetCanFlyAck>();
         //case CMSG_MOVE_SET_CAN_TRANSITION_BETWEEN_SWIM_AND_FLY_ACK:
         //    return MovementSetCanTransitionBetweenSwimAndFlyAck;
         case CMSG_MOVE_SET_COLLISION_HEIGHT_ACK:
-            return MovementSetCollisionHeightAck;
+            return GetMovementSequenceCodec<MovementSetCollisionHeightAck>();
 
         //case CMSG_FORCE_MOVE_ROOT_ACK:
         //    return ForceMoveRootAck;
@@ -5691,62 +5696,62 @@ MovementStatusElements const* GetMovementStatusElementsSequence(Opcodes opcode)
             // MOVE
 
         case SMSG_MOVE_FEATHER_FALL:
-            return MoveFeatherFall;
+            return GetMovementSequenceCodec<MoveFeatherFall>();
         case SMSG_MOVE_LAND_WALK:
-            return MoveLandWalk;
+            return GetMovementSequenceCodec<MoveLandWalk>();
         case SMSG_MOVE_NORMAL_FALL:
-            return MoveNormalFall;
+            return GetMovementSequenceCodec<MoveNormalFall>();
         case SMSG_MOVE_ROOT:
-            return MoveRoot;
+            return GetMovementSequenceCodec<MoveRoot>();
         case SMSG_MOVE_UNROOT:
-            return MoveUnroot;
+            return GetMovementSequenceCodec<MoveUnroot>();
         case SMSG_MOVE_UPDATE:
-            return PlayerMove;
+            return GetMovementSequenceCodec<PlayerMove>();
         case SMSG_MOVE_WATER_WALK:
-            return MoveWaterWalk;
+            return GetMovementSequenceCodec<MoveWaterWalk>();
 
             // MOVE_SET / MOVE_UNSET
 
         case SMSG_MOVE_SET_WALK_SPEED:
-            return MoveSetWalkSpeed;
+            return GetMovementSequenceCodec<MoveSetWalkSpeed>();
         case SMSG_MOVE_SET_RUN_SPEED:
-            return MoveSetRunSpeed;
+            return GetMovementSequenceCodec<MoveSetRunSpeed>();
         case SMSG_MOVE_SET_RUN_BACK_SPEED:
-            return MoveSetRunBackSpeed;
+            return GetMovementSequenceCodec<MoveSetRunBackSpeed>();
         case SMSG_MOVE_SET_SWIM_SPEED:
-            return MoveSetSwimSpeed;
+            return GetMovementSequenceCodec<MoveSetSwimSpeed>();
         case SMSG_MOVE_SET_SWIM_BACK_SPEED:
-            return MoveSetSwimBackSpeed;
+            return GetMovementSequenceCodec<MoveSetSwimBackSpeed>();
         case SMSG_MOVE_SET_TURN_RATE:
-            return MoveSetTurnRate;
+            return GetMovementSequenceCodec<MoveSetTurnRate>();
         case SMSG_MOVE_SET_FLIGHT_SPEED:
-           return MoveSetFlightSpeed;
+           return GetMovementSequenceCodec<MoveSetFlightSpeed>();
         case SMSG_MOVE_SET_FLIGHT_BACK_SPEED:
-            return MoveSetFlightBackSpeed;
+            return GetMovementSequenceCodec<MoveSetFlightBackSpeed>();
         case SMSG_MOVE_SET_PITCH_RATE:
-            return MoveSetPitchRate;
+            return GetMovementSequenceCodec<MoveSetPitchRate>();
         case SMSG_MOVE_SET_CAN_FLY:
-            return MoveSetCanFly;
+            return GetMovementSequenceCodec<MoveSetCanFly>();
         case SMSG_MOVE_SET_HOVER:
-            return MoveSetHover;
+            return GetMovementSequenceCodec<MoveSetHover>();
 
         case SMSG_MOVE_UNSET_CAN_FLY:
-            return MoveUnsetCanFly;
+            return GetMovementSequenceCodec<MoveUnsetCanFly>();
         case SMSG_MOVE_UNSET_HOVER:
-            return MoveUnsetHover;
+            return GetMovementSequenceCodec<MoveUnsetHover>();
 
             // MOVE_UPDATE
 
         case SMSG_MOVE_UPDATE_WALK_SPEED:
-            return MovementUpdateWalkSpeed;
+            return GetMovementSequenceCodec<MovementUpdateWalkSpeed>();
         case SMSG_MOVE_UPDATE_RUN_SPEED:
-            return MovementUpdateRunSpeed;
+            return GetMovementSequenceCodec<MovementUpdateRunSpeed>();
         case SMSG_MOVE_UPDATE_RUN_BACK_SPEED:
-            return MovementUpdateRunBackSpeed;
+            return GetMovementSequenceCodec<MovementUpdateRunBackSpeed>();
         case SMSG_MOVE_UPDATE_SWIM_SPEED:
-            return MovementUpdateSwimSpeed;
+            return GetMovementSequenceCodec<MovementUpdateSwimSpeed>();
         case SMSG_MOVE_UPDATE_FLIGHT_SPEED:
-            return MovementUpdateFlightSpeed;
+            return GetMovementSequenceCodec<MovementUpdateFlightSpeed>();
         //case SMSG_MOVE_UPDATE_COLLISION_HEIGHT:
         //    return MovementUpdateCollisionHeight;
         //case SMSG_MOVE_UPDATE_KNOCK_BACK:
@@ -5766,9 +5771,9 @@ MovementStatusElements const* GetMovementStatusElementsSequence(Opcodes opcode)
         //case SMSG_SPLINE_MOVE_GRAVITY_DISABLE:
         //    return SplineMoveGravityDisable;
         case SMSG_SPLINE_MOVE_ROOT:
-            return SplineMoveRoot;
+            return GetMovementSequenceCodec<SplineMoveRoot>();
         case SMSG_SPLINE_MOVE_UNROOT:
-            return SplineMoveUnroot;
+            return GetMovementSequenceCodec<SplineMoveUnroot>();
 
             // MOVE_START / MOVE_STOP
 
@@ -5780,44 +5785,44 @@ MovementStatusElements const* GetMovementStatusElementsSequence(Opcodes opcode)
             // MOVE_SET / MOVE_UNSET
 
         case SMSG_SPLINE_MOVE_SET_WALK_SPEED:
-            return SplineMoveSetWalkSpeed;
+            return GetMovementSequenceCodec<SplineMoveSetWalkSpeed>();
         case SMSG_SPLINE_MOVE_SET_RUN_SPEED:
-            return SplineMoveSetRunSpeed;
+            return GetMovementSequenceCodec<SplineMoveSetRunSpeed>();
         case SMSG_SPLINE_MOVE_SET_RUN_BACK_SPEED:
-            return SplineMoveSetRunBackSpeed;
+            return GetMovementSequenceCodec<SplineMoveSetRunBackSpeed>();
         case SMSG_SPLINE_MOVE_SET_SWIM_SPEED:
-            return SplineMoveSetSwimSpeed;
+            return GetMovementSequenceCodec<SplineMoveSetSwimSpeed>();
         case SMSG_SPLINE_MOVE_SET_SWIM_BACK_SPEED:
-            return SplineMoveSetSwimBackSpeed;
+            return GetMovementSequenceCodec<SplineMoveSetSwimBackSpeed>();
         case SMSG_SPLINE_MOVE_SET_TURN_RATE:
-            return SplineMoveSetTurnRate;
+            return GetMovementSequenceCodec<SplineMoveSetTurnRate>();
         case SMSG_SPLINE_MOVE_SET_FLIGHT_SPEED:
-            return SplineMoveSetFlightSpeed;
+            return GetMovementSequenceCodec<SplineMoveSetFlightSpeed>();
         case SMSG_SPLINE_MOVE_SET_FLIGHT_BACK_SPEED:
-            return SplineMoveSetFlightBackSpeed;
+            return GetMovementSequenceCodec<SplineMoveSetFlightBackSpeed>();
         case SMSG_SPLINE_MOVE_SET_PITCH_RATE:
-            return SplineMoveSetPitchRate;
+            return GetMovementSequenceCodec<SplineMoveSetPitchRate>();
         case SMSG_SPLINE_MOVE_SET_WALK_MODE:
-            return SplineMoveSetWalkMode;
+            return GetMovementSequenceCodec<SplineMoveSetWalkMode>();
         case SMSG_SPLINE_MOVE_SET_RUN_MODE:
-            return SplineMoveSetRunMode;
+            return GetMovementSequenceCodec<SplineMoveSetRunMode>();
         case SMSG_SPLINE_MOVE_SET_HOVER:
-            return SplineMoveSetHover;
+            return GetMovementSequenceCodec<SplineMoveSetHover>();
         case SMSG_SPLINE_MOVE_SET_FLYING:
-            return SplineMoveSetFlying;
+            return GetMovementSequenceCodec<SplineMoveSetFlying>();
         case SMSG_SPLINE_MOVE_SET_WATER_WALK:
-            return SplineMoveSetWaterWalk;
+            return GetMovementSequenceCodec<SplineMoveSetWaterWalk>();
         case SMSG_SPLINE_MOVE_SET_LAND_WALK:
-            return SplineMoveSetLandWalk;
+            return GetMovementSequenceCodec<SplineMoveSetLandWalk>();
         case SMSG_SPLINE_MOVE_SET_FEATHER_FALL:
-            return SplineMoveSetFeatherFall;
+            return GetMovementSequenceCodec<SplineMoveSetFeatherFall>();
         case SMSG_SPLINE_MOVE_SET_NORMAL_FALL:
-            return SplineMoveSetNormalFall;
+            return GetMovementSequenceCodec<SplineMoveSetNormalFall>();
 
         case SMSG_SPLINE_MOVE_UNSET_HOVER:
-            return SplineMoveUnsetHover;
+            return GetMovementSequenceCodec<SplineMoveUnsetHover>();
         case SMSG_SPLINE_MOVE_UNSET_FLYING:
-            return SplineMoveUnsetFlying;
+            return GetMovementSequenceCodec<SplineMoveUnsetFlying>();
 
 
         /*** VEHICLES. ***/
@@ -5825,7 +5830,7 @@ MovementStatusElements const* GetMovementStatusElementsSequence(Opcodes opcode)
         //case CMSG_CHANGE_SEATS_ON_CONTROLLED_VEHICLE:
         //    return ChangeSeatsOnControlledVehicle;
         case CMSG_DISMISS_CONTROLLED_VEHICLE:
-            return DismissControlledVehicle;
+            return GetMovementSequenceCodec<DismissControlledVehicle>();
 
 
         /* Implemented in the handlers themselves:
@@ -5839,3 +5844,790 @@ MovementStatusElements const* GetMovementStatusElementsSequence(Opcodes opcode)
 
     return NULL;
 }
+
+/*
+ * Reference interpreter: the element loops Player::ReadMovementInfo and Unit::WriteMovementInfo ran before the
+ * codecs were generated. Only used by CheckMovementCodecs and BenchmarkMovementCodecs to compare the generated
+ * code against, keep it in sync with the element semantics of MovementCodec.h.
+ */
+static void InterpretMovementRead(MovementStatusElements const* sequence, WorldPacket& data, MovementReadState& state)
+{
+    MovementInfo* mi = state.mi;
+
+    for (; *sequence != MSEEnd; ++sequence)
+    {
+        MovementStatusElements const element = *sequence;
+
+        if (element >= MSEHasGuidByte0 && element <= MSEHasGuidByte7)
+        {
+            state.guid[element - MSEHasGuidByte0] = data.ReadBit();
+            continue;
+        }
+
+        if (element >= MSEHasTransportGuidByte0 && element <= MSEHasTransportGuidByte7)
+        {
+            if (state.hasTransportData)
+                state.tguid[element - MSEHasTransportGuidByte0] = data.ReadBit();
+            continue;
+        }
+
+        if (element >= MSEGuidByte0 && element <= MSEGuidByte7)
+        {
+            data.ReadByteSeq(state.guid[element - MSEGuidByte0]);
+            continue;
+        }
+
+        if (element >= MSETransportGuidByte0 && element <= MSETransportGuidByte7)
+        {
+            if (state.hasTransportData)
+                data.ReadByteSeq(state.tguid[element - MSETransportGuidByte0]);
+            continue;
+        }
+
+        if (element >= MSEGenericDword0 && element <= MSEGenericDword7)
+        {
+            data.read_skip<uint32>();
+            continue;
+        }
+
+        switch (element)
+        {
+            case MSEExtraElement:
+                state.extras->ReadNextElement(data);
+                break;
+            case MSEGeneric2bits0:
+                data.ReadBits(2);
+                break;
+            case MSEUnkUIntCount:
+                state.bitcounterLoop = data.ReadBits(22);
+                break;
+            case MSEUnkUIntLoop:
+                for (uint32 i = 0; i != state.bitcounterLoop; i++)
+                    data.read_skip<uint32>();
+                break;
+            case MSEFlushBits:
+                data.FlushBits();
+                break;
+            case MSEHasMovementFlags:
+                mi->flags = !data.ReadBit();
+                break;
+            case MSEHasMovementFlags2:
+                mi->flags2 = !data.ReadBit();
+                break;
+            case MSEHasTimestamp:
+                mi->time = !data.ReadBit();
+                break;
+            case MSEHasOrientation:
+                mi->pos.m_orientation = !data.ReadBit() ? 1.0f : 0.0f;
+                break;
+            case MSEHasTransportData:
+                state.hasTransportData = data.ReadBit();
+                break;
+            case MSEHasTransportTime2:
+                if (state.hasTransportData)
+                    mi->has_t_time2 = data.ReadBit();
+                break;
+            case MSEHasTransportTime3:
+                if (state.hasTransportData)
+                    mi->has_t_time3 = data.ReadBit();
+                break;
+            case MSEHasPitch:
+                mi->HavePitch = !data.ReadBit();
+                break;
+            case MSEHasFallData:
+                mi->hasFallData = data.ReadBit();
+                break;
+            case MSEHasFallDirection:
+                if (mi->hasFallData)
+                    mi->hasFallDirection = data.ReadBit();
+                break;
+            case MSEHasSplineElevation:
+                mi->HaveSplineElevation = !data.ReadBit();
+                break;
+            case MSEHasSpline:
+                state.hasSpline = data.ReadBit();
+                break;
+            case MSEMovementFlags:
+                if (mi->flags)
+                    mi->flags = data.ReadBits(30);
+                break;
+            case MSEMovementFlags2:
+                if (mi->flags2)
+                    mi->flags2 = data.ReadBits(13);
+                break;
+            case MSETimestamp:
+                if (mi->time)
+                    data >> mi->time;
+                break;
+            case MSEPositionX:
+                data >> mi->pos.m_positionX;
+                break;
+            case MSEPositionY:
+                data >> mi->pos.m_positionY;
+                break;
+            case MSEPositionZ:
+                data >> mi->pos.m_positionZ;
+                break;
+            case MSEOrientation:
+                if (mi->pos.m_orientation != 0.0f)
+                    mi->pos.SetOrientation(data.read<float>());
+                break;
+            case MSETransportPositionX:
+                if (state.hasTransportData)
+                    data >> mi->t_pos.m_positionX;
+                break;
+            case MSETransportPositionY:
+                if (state.hasTransportData)
+                    data >> mi->t_pos.m_positionY;
+                break;
+            case MSETransportPositionZ:
+                if (state.hasTransportData)
+                    data >> mi->t_pos.m_positionZ;
+                break;
+            case MSETransportOrientation:
+                if (state.hasTransportData)
+                    mi->t_pos.SetOrientation(data.read<float>());
+                break;
+            case MSETransportSeat:
+                if (state.hasTransportData)
+                    data >> mi->t_seat;
+                break;
+            case MSETransportTime:
+                if (state.hasTransportData)
+                    data >> mi->t_time;
+                break;
+            case MSETransportTime2:
+                if (state.hasTransportData && mi->has_t_time2)
+                    data >> mi->t_time2;
+                break;
+            case MSETransportTime3:
+                if (state.hasTransportData && mi->has_t_time3)
+                    data >> mi->t_time3;
+                break;
+            case MSEPitch:
+                if (mi->HavePitch)
+                    data >> mi->pitch;
+                break;
+            case MSEFallTime:
+                if (mi->hasFallData)
+                    data >> mi->fallTime;
+                break;
+            case MSEFallVerticalSpeed:
+                if (mi->hasFallData)
+                    data >> mi->j_zspeed;
+                break;
+            case MSEFallCosAngle:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data >> mi->j_cosAngle;
+                break;
+            case MSEFallSinAngle:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data >> mi->j_sinAngle;
+                break;
+            case MSEFallHorizontalSpeed:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data >> mi->j_xyspeed;
+                break;
+            case MSESplineElevation:
+                if (mi->HaveSplineElevation)
+                    data >> mi->splineElevation;
+                break;
+            case MSEZeroBit:
+            case MSEOneBit:
+                data.ReadBit();
+                break;
+            case MSEHasUnkTime:
+                mi->Alive32 = !data.ReadBit();
+                break;
+            case MSEUnkTime:
+                if (mi->Alive32)
+                    data >> mi->Alive32;
+                break;
+            case MSECounter:
+                data.read_skip<uint32>();
+                break;
+            default:
+                ASSERT(PrintInvalidSequenceElement(element, __FUNCTION__));
+                break;
+        }
+    }
+}
+
+static void InterpretMovementWrite(MovementStatusElements const* sequence, WorldPacket& data, MovementWriteState const& state)
+{
+    MovementInfo const* mi = state.mi;
+
+    for (; *sequence != MSEEnd; ++sequence)
+    {
+        MovementStatusElements const element = *sequence;
+
+        if (element >= MSEHasGuidByte0 && element <= MSEHasGuidByte7)
+        {
+            data.WriteBit(state.guid[element - MSEHasGuidByte0]);
+            continue;
+        }
+
+        if (element >= MSEHasTransportGuidByte0 && element <= MSEHasTransportGuidByte7)
+        {
+            if (state.hasTransportData)
+                data.WriteBit(state.tguid[element - MSEHasTransportGuidByte0]);
+            continue;
+        }
+
+        if (element >= MSEGuidByte0 && element <= MSEGuidByte7)
+        {
+            data.WriteByteSeq(state.guid[element - MSEGuidByte0]);
+            continue;
+        }
+
+        if (element >= MSETransportGuidByte0 && element <= MSETransportGuidByte7)
+        {
+            if (state.hasTransportData)
+                data.WriteByteSeq(state.tguid[element - MSETransportGuidByte0]);
+            continue;
+        }
+
+        switch (element)
+        {
+            case MSEExtraElement:
+                state.extras->WriteNextElement(data);
+                break;
+            case MSEUnkUIntCount:
+                data.WriteBits(0, 22);
+                break;
+            case MSEUnkUIntLoop:
+                break;
+            case MSECounter:
+                data << uint32(0); // movement counter
+                break;
+            case MSEFlushBits:
+                data.FlushBits();
+                break;
+            case MSEHasMovementFlags:
+                data.WriteBit(!state.hasMovementFlags);
+                break;
+            case MSEHasMovementFlags2:
+                data.WriteBit(!state.hasMovementFlags2);
+                break;
+            case MSEHasTimestamp:
+                data.WriteBit(!mi->time);
+                break;
+            case MSEHasOrientation:
+                data.WriteBit(!mi->pos.HasOrientation());
+                break;
+            case MSEHasTransportData:
+                data.WriteBit(state.hasTransportData);
+                break;
+            case MSEHasTransportTime2:
+                if (state.hasTransportData)
+                    data.WriteBit(mi->has_t_time2);
+                break;
+            case MSEHasTransportTime3:
+                if (state.hasTransportData)
+                    data.WriteBit(mi->has_t_time3);
+                break;
+            case MSEHasPitch:
+                data.WriteBit(!mi->HavePitch);
+                break;
+            case MSEHasFallData:
+                data.WriteBit(mi->hasFallData);
+                break;
+            case MSEHasFallDirection:
+                if (mi->hasFallData)
+                    data.WriteBit(mi->hasFallDirection);
+                break;
+            case MSEHasSplineElevation:
+                data.WriteBit(!mi->HaveSplineElevation);
+                break;
+            case MSEHasSpline:
+                data.WriteBit(state.hasSpline);
+                break;
+            case MSEMovementFlags:
+                if (state.hasMovementFlags)
+                    data.WriteBits(mi->flags, 30);
+                break;
+            case MSEMovementFlags2:
+                if (state.hasMovementFlags2)
+                    data.WriteBits(mi->flags2, 13);
+                break;
+            case MSETimestamp:
+                if (mi->time)
+                    data << mi->time;
+                break;
+            case MSEPositionX:
+                data << mi->pos.m_positionX;
+                break;
+            case MSEPositionY:
+                data << mi->pos.m_positionY;
+                break;
+            case MSEPositionZ:
+                data << mi->pos.m_positionZ;
+                break;
+            case MSEOrientation:
+                if (mi->pos.HasOrientation())
+                    data << mi->pos.GetOrientation();
+                break;
+            case MSETransportPositionX:
+                if (state.hasTransportData)
+                    data << mi->t_pos.m_positionX;
+                break;
+            case MSETransportPositionY:
+                if (state.hasTransportData)
+                    data << mi->t_pos.m_positionY;
+                break;
+            case MSETransportPositionZ:
+                if (state.hasTransportData)
+                    data << mi->t_pos.m_positionZ;
+                break;
+            case MSETransportOrientation:
+                if (state.hasTransportData)
+                    data << mi->t_pos.GetOrientation();
+                break;
+            case MSETransportSeat:
+                if (state.hasTransportData)
+                    data << mi->t_seat;
+                break;
+            case MSETransportTime:
+                if (state.hasTransportData)
+                    data << mi->t_time;
+                break;
+            case MSETransportTime2:
+                if (state.hasTransportData && mi->has_t_time2)
+                    data << mi->t_time2;
+                break;
+            case MSETransportTime3:
+                if (state.hasTransportData && mi->has_t_time3)
+                    data << mi->t_time3;
+                break;
+            case MSEPitch:
+                if (mi->HavePitch)
+                    data << mi->pitch;
+                break;
+            case MSEFallTime:
+                if (mi->hasFallData)
+                    data << mi->fallTime;
+                break;
+            case MSEFallVerticalSpeed:
+                if (mi->hasFallData)
+                    data << mi->j_zspeed;
+                break;
+            case MSEFallCosAngle:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data << mi->j_cosAngle;
+                break;
+            case MSEFallSinAngle:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data << mi->j_sinAngle;
+                break;
+            case MSEFallHorizontalSpeed:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data << mi->j_xyspeed;
+                break;
+            case MSESplineElevation:
+                if (mi->HaveSplineElevation)
+                    data << mi->splineElevation;
+                break;
+            case MSEZeroBit:
+                data.WriteBit(0);
+                break;
+            case MSEOneBit:
+                data.WriteBit(1);
+                break;
+            case MSEHasUnkTime:
+                data.WriteBit(!mi->Alive32);
+                break;
+            case MSEUnkTime:
+                if (mi->Alive32)
+                    data << mi->Alive32;
+                break;
+            default:
+                ASSERT(PrintInvalidSequenceElement(element, __FUNCTION__));
+                break;
+        }
+    }
+}
+
+static bool HasMovementElement(MovementStatusElements const* sequence, MovementStatusElements element)
+{
+    for (; *sequence != MSEEnd; ++sequence)
+        if (*sequence == element)
+            return true;
+
+    return false;
+}
+
+// compares the fields of `read` that `sequence` carries with `written`
+static bool CompareMovementRoundTrip(MovementStatusElements const* sequence, MovementWriteState const& written, MovementReadState const& read)
+{
+    #define HAS(element) HasMovementElement(sequence, element)
+    #define SAME(field) (memcmp(&written.mi->field, &read.mi->field, sizeof(written.mi->field)) == 0)
+
+    MovementInfo const* wmi = written.mi;
+    MovementInfo const* rmi = read.mi;
+
+    for (uint8 i = 0; i < 8; ++i)
+    {
+        if (HAS(MovementStatusElements(MSEHasGuidByte0 + i)) && HAS(MovementStatusElements(MSEGuidByte0 + i)) && written.guid[i] != read.guid[i])
+            return false;
+
+        if (HAS(MSEHasTransportData) && HAS(MovementStatusElements(MSEHasTransportGuidByte0 + i)) &&
+            HAS(MovementStatusElements(MSETransportGuidByte0 + i)) && written.tguid[i] != read.tguid[i])
+            return false;
+    }
+
+    if (HAS(MSEHasMovementFlags) && HAS(MSEMovementFlags) && wmi->flags != rmi->flags)
+        return false;
+    if (HAS(MSEHasMovementFlags2) && HAS(MSEMovementFlags2) && wmi->flags2 != rmi->flags2)
+        return false;
+    if (HAS(MSEHasTimestamp) && HAS(MSETimestamp) && !SAME(time))
+        return false;
+    if ((HAS(MSEPositionX) && !SAME(pos.m_positionX)) || (HAS(MSEPositionY) && !SAME(pos.m_positionY)) || (HAS(MSEPositionZ) && !SAME(pos.m_positionZ)))
+        return false;
+    if (HAS(MSEHasOrientation) && HAS(MSEOrientation) && !SAME(pos.m_orientation))
+        return false;
+
+    if (HAS(MSEHasTransportData))
+    {
+        if (read.hasTransportData != written.hasTransportData)
+            return false;
+        if ((HAS(MSETransportPositionX) && !SAME(t_pos.m_positionX)) || (HAS(MSETransportPositionY) && !SAME(t_pos.m_positionY)) ||
+            (HAS(MSETransportPositionZ) && !SAME(t_pos.m_positionZ)) || (HAS(MSETransportOrientation) && !SAME(t_pos.m_orientation)))
+            return false;
+        if ((HAS(MSETransportSeat) && !SAME(t_seat)) || (HAS(MSETransportTime) && !SAME(t_time)))
+            return false;
+        if (HAS(MSEHasTransportTime2) && HAS(MSETransportTime2) && !SAME(t_time2))
+            return false;
+        if (HAS(MSEHasTransportTime3) && HAS(MSETransportTime3) && !SAME(t_time3))
+            return false;
+    }
+
+    if (HAS(MSEHasPitch) && HAS(MSEPitch) && !SAME(pitch))
+        return false;
+
+    if (HAS(MSEHasFallData))
+    {
+        if (rmi->hasFallData != wmi->hasFallData)
+            return false;
+        if ((HAS(MSEFallTime) && !SAME(fallTime)) || (HAS(MSEFallVerticalSpeed) && !SAME(j_zspeed)))
+            return false;
+        if (HAS(MSEHasFallDirection) && ((HAS(MSEFallCosAngle) && !SAME(j_cosAngle)) || (HAS(MSEFallSinAngle) && !SAME(j_sinAngle)) ||
+            (HAS(MSEFallHorizontalSpeed) && !SAME(j_xyspeed))))
+            return false;
+    }
+
+    if (HAS(MSEHasSplineElevation) && HAS(MSESplineElevation) && !SAME(splineElevation))
+        return false;
+    if (HAS(MSEHasUnkTime) && HAS(MSEUnkTime) && !SAME(Alive32))
+        return false;
+    if (HAS(MSEHasSpline) && read.hasSpline != written.hasSpline)
+        return false;
+
+    #undef SAME
+    #undef HAS
+
+    return true;
+}
+
+// compares everything a reader fills in, `left` and `right` read the same bytes
+static bool SameMovementRead(MovementReadState const& left, MovementReadState const& right)
+{
+    #define SAME(field) (memcmp(&left.mi->field, &right.mi->field, sizeof(left.mi->field)) == 0)
+
+    if (memcmp(&left.guid, &right.guid, sizeof(ObjectGuid)) != 0 || memcmp(&left.tguid, &right.tguid, sizeof(ObjectGuid)) != 0 ||
+        left.hasTransportData != right.hasTransportData || left.hasSpline != right.hasSpline || left.bitcounterLoop != right.bitcounterLoop)
+        return false;
+
+    if (!SAME(flags) || !SAME(flags2) || !SAME(time) || !SAME(pos.m_positionX) || !SAME(pos.m_positionY) ||
+        !SAME(pos.m_positionZ) || !SAME(pos.m_orientation))
+        return false;
+
+    if (!SAME(t_pos.m_positionX) || !SAME(t_pos.m_positionY) || !SAME(t_pos.m_positionZ) || !SAME(t_pos.m_orientation) ||
+        !SAME(t_seat) || !SAME(t_time) || !SAME(t_time2) || !SAME(t_time3))
+        return false;
+
+    if (!SAME(pitch) || !SAME(fallTime) || !SAME(j_zspeed) || !SAME(j_cosAngle) || !SAME(j_sinAngle) || !SAME(j_xyspeed) ||
+        !SAME(splineElevation) || !SAME(Alive32))
+        return false;
+
+    #undef SAME
+
+    return left.mi->hasFallData == right.mi->hasFallData && left.mi->hasFallDirection == right.mi->hasFallDirection &&
+        left.mi->has_t_time2 == right.mi->has_t_time2 && left.mi->has_t_time3 == right.mi->has_t_time3;
+}
+
+// a zero guid byte is left out of the packet, so about a quarter of them are zero
+static uint64 RandomMovementGuid()
+{
+    uint64 guid = 0;
+    for (uint8 i = 0; i < 8; ++i)
+        if (urand(0, 3))
+            guid |= uint64(urand(1, 255)) << (i * 8);
+
+    return guid;
+}
+
+// fills `info` and `state` with random values, each optional part present or not
+static void RandomMovementInfo(MovementInfo& info, MovementWriteState& state)
+{
+    info = MovementInfo();
+    info.flags = urand(0, 1) ? urand(1, (1 << 30) - 1) : 0;
+    info.flags2 = urand(0, 1) ? uint16(urand(1, (1 << 13) - 1)) : 0;
+    info.pos.Relocate(frand(-10000.0f, 10000.0f), frand(-10000.0f, 10000.0f), frand(-500.0f, 500.0f), urand(0, 1) ? frand(0.1f, 6.2f) : 0.0f);
+    info.time = urand(0, 1) ? urand(1, 0xFFFFFFFF) : 0;
+    info.t_pos.Relocate(frand(-50.0f, 50.0f), frand(-50.0f, 50.0f), frand(-50.0f, 50.0f), frand(0.1f, 6.2f));
+    info.t_seat = int8(urand(0, 7));
+    info.t_time = urand(0, 0xFFFFFFFF);
+    info.has_t_time2 = urand(0, 1);
+    info.t_time2 = info.has_t_time2 ? urand(0, 0xFFFFFFFF) : 0;
+    info.has_t_time3 = urand(0, 1);
+    info.t_time3 = info.has_t_time3 ? urand(0, 0xFFFFFFFF) : 0;
+    info.pitch = urand(0, 1) ? frand(-1.5f, 1.5f) : 0.0f;
+    info.hasFallData = urand(0, 1);
+    info.hasFallDirection = info.hasFallData && urand(0, 1);
+    info.fallTime = info.hasFallData ? urand(0, 0xFFFFFFFF) : 0;
+    info.j_zspeed = info.hasFallData ? frand(-60.0f, 60.0f) : 0.0f;
+    info.j_cosAngle = info.hasFallDirection ? frand(-1.0f, 1.0f) : 0.0f;
+    info.j_sinAngle = info.hasFallDirection ? frand(-1.0f, 1.0f) : 0.0f;
+    info.j_xyspeed = info.hasFallDirection ? frand(0.0f, 60.0f) : 0.0f;
+    info.splineElevation = urand(0, 1) ? frand(-10.0f, 10.0f) : 0.0f;
+    info.Alive32 = urand(0, 1) ? urand(1, 0xFFFFFFFF) : 0;
+    info.guid = RandomMovementGuid();
+    info.t_guid = urand(0, 1) ? RandomMovementGuid() : 0;
+
+    state.mi = &info;
+    state.guid = info.guid;
+    state.tguid = info.t_guid;
+    state.hasMovementFlags = info.flags != 0;
+    state.hasMovementFlags2 = info.flags2 != 0;
+    state.hasTransportData = info.t_guid != 0;
+    state.hasSpline = urand(0, 1);
+}
+
+typedef std::vector<std::pair<Opcodes, MovementCodec const*> > MovementCodecList;
+
+// every distinct codec the writer can produce a packet for, layouts with elements only the reader knows are counted in skipped
+static void GetCheckableMovementCodecs(MovementCodecList& codecs, uint32& skipped)
+{
+    skipped = 0;
+
+    std::set<MovementCodec const*> seen;
+    for (uint32 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+    {
+        MovementCodec const* codec = GetMovementCodec(Opcodes(opcode));
+        if (!codec || !seen.insert(codec).second)
+            continue;
+
+        uint32 extras = 0;
+        bool writable = true;
+        for (MovementStatusElements const* element = codec->Elements; *element != MSEEnd; ++element)
+        {
+            if (*element == MSEExtraElement)
+                ++extras;
+            else if ((*element >= MSEGenericDword0 && *element <= MSEGenericDword7) || *element == MSEGeneric2bits0)
+                writable = false;
+        }
+
+        if (!writable || extras > 1)
+        {
+            ++skipped;
+            continue;
+        }
+
+        codecs.push_back(std::make_pair(Opcodes(opcode), codec));
+    }
+}
+
+// every extra element in use is a single float (speed, collision height)
+static MovementStatusElements const extraSequence = MSEExtraFloat;
+
+// writes `written` through the generated writer and the interpreter and reads the packet back through both readers
+static bool MatchesMovementInterpreter(Opcodes opcode, MovementCodec const* codec, MovementWriteState& written)
+{
+    ExtraMovementStatusElement codecExtras(&extraSequence);
+    ExtraMovementStatusElement interpreterExtras(&extraSequence);
+    codecExtras.Data.floatData = interpreterExtras.Data.floatData = frand(0.0f, 100.0f);
+
+    WorldPacket codecData(opcode, 128);
+    written.extras = &codecExtras;
+    codec->Write(codecData, written);
+    codecData.FlushBits();
+
+    WorldPacket interpreterData(opcode, 128);
+    written.extras = &interpreterExtras;
+    InterpretMovementWrite(codec->Elements, interpreterData, written);
+    interpreterData.FlushBits();
+
+    if (codecData.size() != interpreterData.size() || (codecData.size() && memcmp(codecData.contents(), interpreterData.contents(), codecData.size()) != 0))
+        return false;
+
+    MovementInfo codecInfo;
+    MovementInfo interpreterInfo;
+    codecExtras.ResetIndex();
+    interpreterExtras.ResetIndex();
+    codecExtras.Data.floatData = interpreterExtras.Data.floatData = 0.0f;
+    MovementReadState codecRead(&codecInfo, &codecExtras);
+    MovementReadState interpreterRead(&interpreterInfo, &interpreterExtras);
+
+    try
+    {
+        codec->Read(codecData, codecRead);
+        InterpretMovementRead(codec->Elements, interpreterData, interpreterRead);
+    }
+    catch (ByteBufferException const&)
+    {
+        return false;
+    }
+
+    return codecData.rpos() == interpreterData.rpos() && SameMovementRead(codecRead, interpreterRead) &&
+        memcmp(&codecExtras.Data.floatData, &interpreterExtras.Data.floatData, sizeof(float)) == 0;
+}
+
+void CheckMovementCodecs(MovementCodecCheckResult& result, uint32 fuzzCount)
+{
+    result.checked = 0;
+    result.fuzzed = 0;
+    result.failed.clear();
+    result.mismatched.clear();
+
+    MovementCodecList codecs;
+    GetCheckableMovementCodecs(codecs, result.skipped);
+
+    // every optional part present, every value distinct and without zero bytes (a zero guid byte is not sent)
+    MovementInfo info;
+    info.flags = 0x2AAAAAAA & ((1 << 30) - 1);
+    info.flags2 = 0x1555 & ((1 << 13) - 1);
+    info.pos.Relocate(1234.5f, -2345.25f, 56.75f, 2.5f);
+    info.time = 0x11223344;
+    info.t_pos.Relocate(1.5f, -2.25f, 3.125f, 0.75f);
+    info.t_seat = 3;
+    info.t_time = 0x22334455;
+    info.t_time2 = 0x33445566;
+    info.t_time3 = 0x44556677;
+    info.has_t_time2 = true;
+    info.has_t_time3 = true;
+    info.pitch = 0.375f;
+    info.fallTime = 0x55667788;
+    info.hasFallData = true;
+    info.hasFallDirection = true;
+    info.j_zspeed = -7.5f;
+    info.j_cosAngle = 0.6f;
+    info.j_sinAngle = 0.8f;
+    info.j_xyspeed = 9.25f;
+    info.splineElevation = 4.5f;
+    info.Alive32 = 0x66778899;
+
+    MovementWriteState written;
+    written.mi = &info;
+    written.guid = ObjectGuid(UI64LIT(0x1122334455667788));
+    written.tguid = ObjectGuid(UI64LIT(0x99AABBCCDDEEFF11));
+    written.hasMovementFlags = true;
+    written.hasMovementFlags2 = true;
+    written.hasTransportData = true;
+    written.hasSpline = true;
+
+    for (MovementCodecList::const_iterator itr = codecs.begin(); itr != codecs.end(); ++itr)
+    {
+        Opcodes opcode = itr->first;
+        MovementCodec const* codec = itr->second;
+        bool hasExtras = HasMovementElement(codec->Elements, MSEExtraElement);
+
+        ++result.checked;
+
+        ExtraMovementStatusElement writeExtras(&extraSequence);
+        writeExtras.Data.floatData = 12.5f;
+        written.mi = &info;
+        written.extras = &writeExtras;
+
+        WorldPacket data(opcode, 128);
+        codec->Write(data, written);
+        data.FlushBits();
+
+        MovementInfo readInfo;
+        ExtraMovementStatusElement readExtras(&extraSequence);
+        readExtras.Data.floatData = 0.0f;
+        MovementReadState read(&readInfo, &readExtras);
+
+        bool matches;
+        try
+        {
+            codec->Read(data, read);
+            matches = data.rpos() == data.wpos() && CompareMovementRoundTrip(codec->Elements, written, read) &&
+                (!hasExtras || readExtras.Data.floatData == writeExtras.Data.floatData);
+        }
+        catch (ByteBufferException const&)
+        {
+            matches = false;
+        }
+
+        if (!matches)
+            result.failed.push_back(opcode);
+
+        MovementInfo randomInfo;
+        MovementWriteState randomWritten;
+        for (uint32 i = 0; i < fuzzCount; ++i)
+        {
+            RandomMovementInfo(randomInfo, randomWritten);
+            ++result.fuzzed;
+            if (!MatchesMovementInterpreter(opcode, codec, randomWritten))
+            {
+                result.mismatched.push_back(opcode);
+                break;
+            }
+        }
+    }
+}
+
+void BenchmarkMovementCodecs(uint32 count, MovementCodecBenchmarkResult& result)
+{
+    MovementCodecList codecs;
+    uint32 skipped;
+    GetCheckableMovementCodecs(codecs, skipped);
+
+    result.packets = uint64(count) * codecs.size();
+
+    // one random movement info per layout, the same for both runs
+    std::vector<MovementInfo> infos(codecs.size());
+    std::vector<MovementWriteState> states(codecs.size());
+    for (size_t i = 0; i < codecs.size(); ++i)
+        RandomMovementInfo(infos[i], states[i]);
+
+    ExtraMovementStatusElement extras(&extraSequence);
+    extras.Data.floatData = 7.0f;
+    MovementInfo readInfo;
+    WorldPacket data(NULL_OPCODE, 128);
+
+    uint32 startTime = getMSTime();
+    for (size_t i = 0; i < codecs.size(); ++i)
+    {
+        states[i].extras = &extras;
+        for (uint32 j = 0; j < count; ++j)
+        {
+            data.clear();
+            extras.ResetIndex();
+            codecs[i].second->Write(data, states[i]);
+            data.FlushBits();
+
+            extras.ResetIndex();
+            MovementReadState read(&readInfo, &extras);
+            codecs[i].second->Read(data, read);
+        }
+    }
+    result.codecTime = GetMSTimeDiffToNow(startTime);
+
+    startTime = getMSTime();
+    for (size_t i = 0; i < codecs.size(); ++i)
+    {
+        for (uint32 j = 0; j < count; ++j)
+        {
+            data.clear();
+            extras.ResetIndex();
+            InterpretMovementWrite(codecs[i].second->Elements, data, states[i]);
+            data.FlushBits();
+
+            extras.ResetIndex();
+            MovementReadState read(&readInfo, &extras);
+            InterpretMovementRead(codecs[i].second->Elements, data, read);
+        }
+    }
+    result.interpreterTime = GetMSTimeDiffToNow(startTime);
+}
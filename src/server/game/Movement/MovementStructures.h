@@ -158,6 +158,69 @@ enum MovementStatusElements
 
     bool PrintInvalidSequenceElement(MovementStatusElements element, char const* function);
 
-MovementStatusElements const* GetMovementStatusElementsSequence(Opcodes opcode);
+struct MovementInfo;
+
+// What Player::ReadMovementInfo carries from one element of a sequence to the next
+struct MovementReadState
+{
+    MovementReadState(MovementInfo* info, ExtraMovementStatusElement* extraElements) : mi(info), extras(extraElements),
+        hasTransportData(false), hasSpline(false), bitcounterLoop(0) { }
+
+    MovementInfo* mi;
+    ExtraMovementStatusElement* extras;
+    ObjectGuid guid;
+    ObjectGuid tguid;
+    bool hasTransportData;
+    bool hasSpline;
+    uint32 bitcounterLoop;
+};
+
+// What Unit::WriteMovementInfo decides before the first element is written
+struct MovementWriteState
+{
+    MovementInfo const* mi;
+    ExtraMovementStatusElement* extras;
+    ObjectGuid guid;
+    ObjectGuid tguid;
+    bool hasMovementFlags;
+    bool hasMovementFlags2;
+    bool hasTransportData;
+    bool hasSpline;
+};
+
+// Reader and writer generated at compile time from the element sequence of one opcode, see MovementCodec.h
+struct MovementCodec
+{
+    void (*Read)(WorldPacket& data, MovementReadState& state);
+    void (*Write)(WorldPacket& data, MovementWriteState const& state);
+    MovementStatusElements const* Elements;                 // the sequence both functions were generated from
+};
+
+MovementCodec const* GetMovementCodec(Opcodes opcode);
+
+struct MovementCodecCheckResult
+{
+    uint32 checked;
+    uint32 skipped;                                         // sequences with elements only the reader knows
+    uint32 fuzzed;                                          // random movement infos compared with the interpreter
+    std::vector<Opcodes> failed;                            // full movement info did not round trip
+    std::vector<Opcodes> mismatched;                        // generated code differs from the reference interpreter
+};
+
+// Writes a movement info with every optional part present through the codec of every opcode and reads it back,
+// each field the sequence carries has to come back unchanged and the whole packet has to be consumed. Then writes
+// fuzzCount random movement infos through the codec and the reference interpreter, which have to produce the same
+// bytes and read them back into the same values.
+void CheckMovementCodecs(MovementCodecCheckResult& result, uint32 fuzzCount);
+
+struct MovementCodecBenchmarkResult
+{
+    uint64 packets;                                         // written and read back, per run
+    uint32 codecTime;                                       // ms
+    uint32 interpreterTime;                                 // ms
+};
+
+// Writes and reads count packets of every layout CheckMovementCodecs checks, through the generated codecs and the interpreter
+void BenchmarkMovementCodecs(uint32 count, MovementCodecBenchmarkResult& result);
 
 #endif
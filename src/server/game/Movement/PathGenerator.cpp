@@ -0,0 +1,441 @@
+/*
+ * Copyright (C) 2008-2013 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PathGenerator.h"
+#include "GridDefines.h"
+#include "NavMapManager.h"
+#include "NavTile.h"
+#include "Unit.h"
+#include "World.h"
+
+#include <ace/Atomic_Op.h>
+#include <ace/OS_NS_sys_time.h>
+
+#include <algorithm>
+#include <queue>
+
+using namespace NAV;
+
+// a position snaps to a surface of its cell when it is at most this far above or below it
+#define PATHFIND_SNAP_DISTANCE  4.0f
+
+static ACE_Atomic_Op<ACE_Thread_Mutex, uint64> s_pathQueries = 0;
+static ACE_Atomic_Op<ACE_Thread_Mutex, uint64> s_failedPathQueries = 0;
+static ACE_Atomic_Op<ACE_Thread_Mutex, uint64> s_expandedNodes = 0;
+static ACE_Atomic_Op<ACE_Thread_Mutex, uint64> s_pathTime = 0;
+
+// a node is one surface of one cell: 14 bits cell x, 14 bits cell y, 3 bits layer
+static inline uint32 MakeNode(int32 cellX, int32 cellY, uint32 layer) { return (uint32(cellX) << 17) | (uint32(cellY) << 3) | layer; }
+static inline int32 NodeCellX(uint32 node) { return int32(node >> 17); }
+static inline int32 NodeCellY(uint32 node) { return int32((node >> 3) & 0x3FFF); }
+static inline uint32 NodeLayer(uint32 node) { return node & 7; }
+
+static inline uint32 GetDirection(int32 stepX, int32 stepY)
+{
+    static uint32 const directions[3][3] =
+    {
+        { 5, 4, 3 },
+        { 6, 8, 2 },
+        { 7, 0, 1 }
+    };
+    return directions[stepX + 1][stepY + 1];
+}
+
+// lower bound of the walking distance between two cells, diagonal steps included
+static inline float GetCellDistance(int32 x1, int32 y1, int32 x2, int32 y2)
+{
+    float dx = float(std::abs(x1 - x2));
+    float dy = float(std::abs(y1 - y2));
+    return (dx + dy + (float(M_SQRT2) - 2.0f) * std::min(dx, dy)) * NAV_CELL_SIZE;
+}
+
+PathGenerator::PathGenerator(Unit const* owner) :
+    _type(PATHFIND_BLANK), _owner(owner), _mapId(owner->GetMapId()), _navManager(NULL)
+{
+    if (sWorld->getBoolConfig(CONFIG_ENABLE_PATHFINDING))
+        _navManager = NavMapFactory::createOrGetNavMapManager();
+}
+
+bool PathGenerator::CalculatePath(float destX, float destY, float destZ, bool forceDest)
+{
+    if (!MoPCore::IsValidMapCoord(destX, destY, destZ))
+    {
+        _pathPoints.clear();
+        _type = PATHFIND_NOPATH;
+        return false;
+    }
+
+    ACE_Time_Value startTime = ACE_OS::gettimeofday();
+
+    _startPosition = G3D::Vector3(_owner->GetPositionX(), _owner->GetPositionY(), _owner->GetPositionZ());
+    _endPosition = G3D::Vector3(destX, destY, destZ);
+    _pathPoints.clear();
+    _type = PATHFIND_BLANK;
+
+    uint32 startNode = 0;
+    uint32 endNode = 0;
+    uint32 expanded = 0;
+
+    // swimming, flying and transported units do not walk on the ground surfaces
+    if (!_navManager || _owner->GetTransport() || _owner->CanFly() || _owner->IsInWater() ||
+        !FindNode(_startPosition.x, _startPosition.y, _startPosition.z, startNode))
+        BuildShortcut();
+    else
+    {
+        bool endOnMesh = FindNode(destX, destY, destZ, endNode);
+        if (endOnMesh && IsWalkableLine(startNode, endNode))
+        {
+            _pathPoints.push_back(_startPosition);
+            _pathPoints.push_back(_endPosition);
+            _actualEndPosition = _endPosition;
+            _type = PATHFIND_NORMAL;
+        }
+        else
+        {
+            std::vector<uint32> nodes;
+            bool complete = FindNodePath(startNode, endOnMesh ? endNode : startNode, nodes, expanded) && endOnMesh;
+
+            if (complete || nodes.size() > 1)
+            {
+                BuildPointPath(nodes);
+                _type = complete ? PATHFIND_NORMAL : PATHFIND_INCOMPLETE;
+
+                // the last node is the center of the destination cell, end at the exact destination
+                if (complete)
+                {
+                    _pathPoints.back() = _endPosition;
+                    _actualEndPosition = _endPosition;
+                }
+            }
+            else
+                _type = PATHFIND_NOPATH;
+
+            if (_type != PATHFIND_NORMAL && forceDest)
+            {
+                if (_type == PATHFIND_NOPATH)
+                    BuildShortcut();
+                else
+                {
+                    _pathPoints.push_back(_endPosition);
+                    _actualEndPosition = _endPosition;
+                }
+            }
+        }
+    }
+
+    ACE_Time_Value elapsed = ACE_OS::gettimeofday() - startTime;
+    ++s_pathQueries;
+    s_expandedNodes += expanded;
+    s_pathTime += uint64(elapsed.sec()) * IN_MILLISECONDS * IN_MILLISECONDS + elapsed.usec();
+
+    if (_type == PATHFIND_NOPATH)
+    {
+        ++s_failedPathQueries;
+        return false;
+    }
+
+    return true;
+}
+
+float PathGenerator::GetPathLength() const
+{
+    float length = 0.0f;
+    for (size_t i = 1; i < _pathPoints.size(); ++i)
+        length += (_pathPoints[i] - _pathPoints[i - 1]).length();
+
+    return length;
+}
+
+PathGeneratorStats PathGenerator::GetStats()
+{
+    PathGeneratorStats stats;
+    stats.queries = s_pathQueries.value();
+    stats.failedQueries = s_failedPathQueries.value();
+    stats.expandedNodes = s_expandedNodes.value();
+    stats.totalTime = s_pathTime.value();
+    return stats;
+}
+
+NavLayer const* PathGenerator::GetCellLayers(int32 cellX, int32 cellY, uint32& count)
+{
+    if (cellX < 0 || cellY < 0 || cellX >= int32(NAV_MAP_CELLS) || cellY >= int32(NAV_MAP_CELLS))
+        return NULL;
+
+    uint32 tileX = uint32(cellX) / NAV_TILE_CELLS;
+    uint32 tileY = uint32(cellY) / NAV_TILE_CELLS;
+
+    // a path touches only a few tiles, avoid locking the manager for every cell
+    NavTile const* tile = NULL;
+    bool cached = false;
+    for (std::vector<CachedTile>::const_iterator itr = _tileCache.begin(); itr != _tileCache.end(); ++itr)
+    {
+        if (itr->tileX == tileX && itr->tileY == tileY)
+        {
+            tile = itr->tile;
+            cached = true;
+            break;
+        }
+    }
+
+    if (!cached)
+    {
+        CachedTile entry;
+        entry.tileX = tileX;
+        entry.tileY = tileY;
+        entry.tile = tile = _navManager->GetTile(_mapId, tileX, tileY);
+        _tileCache.push_back(entry);
+    }
+
+    if (!tile)
+        return NULL;
+
+    uint32 localX = uint32(cellX) % NAV_TILE_CELLS;
+    uint32 localY = uint32(cellY) % NAV_TILE_CELLS;
+    count = tile->GetLayerCount(localX, localY);
+    return count ? tile->GetLayers(localX, localY) : NULL;
+}
+
+bool PathGenerator::FindNode(float x, float y, float z, uint32& node)
+{
+    int32 cellX = int32(floor(WorldToCell(x)));
+    int32 cellY = int32(floor(WorldToCell(y)));
+
+    // the own cell first, the neighbours only if the position is not above a surface (next to a wall or a ledge)
+    float bestDist = PATHFIND_SNAP_DISTANCE;
+    bool found = false;
+    for (int32 dir = -1; dir < 8 && !found; ++dir)
+    {
+        int32 nearX = dir < 0 ? cellX : cellX + NAV_DIR_X[dir];
+        int32 nearY = dir < 0 ? cellY : cellY + NAV_DIR_Y[dir];
+
+        uint32 count = 0;
+        NavLayer const* layers = GetCellLayers(nearX, nearY, count);
+        for (uint32 i = 0; i < count; ++i)
+        {
+            float dist = std::fabs(layers[i].z - z);
+            if (dist < bestDist)
+            {
+                bestDist = dist;
+                node = MakeNode(nearX, nearY, i);
+                // neighbours are only a fallback, the first hit there is good enough
+                found = dir >= 0;
+            }
+        }
+
+        if (dir < 0 && bestDist < PATHFIND_SNAP_DISTANCE)
+            return true;
+    }
+
+    return found;
+}
+
+NavLayer const* PathGenerator::GetNodeLayer(uint32 node)
+{
+    uint32 count = 0;
+    NavLayer const* layers = GetCellLayers(NodeCellX(node), NodeCellY(node), count);
+    return layers && NodeLayer(node) < count ? layers + NodeLayer(node) : NULL;
+}
+
+bool PathGenerator::IsWalkableLine(uint32 from, uint32 to)
+{
+    int32 x = NodeCellX(from);
+    int32 y = NodeCellY(from);
+    int32 targetX = NodeCellX(to);
+    int32 targetY = NodeCellY(to);
+
+    NavLayer const* layer = GetNodeLayer(from);
+    uint32 layerIndex = NodeLayer(from);
+    if (!layer)
+        return false;
+
+    int32 dx = std::abs(targetX - x);
+    int32 dy = std::abs(targetY - y);
+    int32 sx = targetX > x ? 1 : -1;
+    int32 sy = targetY > y ? 1 : -1;
+    int32 err = dx - dy;
+
+    // follow the cells along the line, every step must be linked
+    while (x != targetX || y != targetY)
+    {
+        int32 stepX = 0;
+        int32 stepY = 0;
+        int32 e2 = 2 * err;
+        if (e2 > -dy)
+        {
+            err -= dy;
+            stepX = sx;
+        }
+        if (e2 < dx)
+        {
+            err += dx;
+            stepY = sy;
+        }
+
+        int32 link = layer->GetLink(GetDirection(stepX, stepY));
+        if (link < 0)
+            return false;
+
+        x += stepX;
+        y += stepY;
+
+        uint32 count = 0;
+        NavLayer const* layers = GetCellLayers(x, y, count);
+        if (!layers || uint32(link) >= count)
+            return false;
+
+        layer = layers + link;
+        layerIndex = uint32(link);
+    }
+
+    return layerIndex == NodeLayer(to);
+}
+
+bool PathGenerator::FindNodePath(uint32 start, uint32 end, std::vector<uint32>& nodes, uint32& expanded)
+{
+    struct NodeInfo
+    {
+        float cost;
+        uint32 parent;
+        bool closed;
+    };
+
+    typedef std::pair<float, uint32> OpenNode;
+    typedef UNORDERED_MAP<uint32, NodeInfo> NodeMap;
+
+    // when the destination is not on the mesh the search heads for its cell and keeps the closest node
+    int32 goalX = int32(floor(WorldToCell(_endPosition.x)));
+    int32 goalY = int32(floor(WorldToCell(_endPosition.y)));
+    uint32 maxNodes = sWorld->getIntConfig(CONFIG_PATHFINDING_MAX_NODES);
+
+    std::priority_queue<OpenNode, std::vector<OpenNode>, std::greater<OpenNode> > open;
+    NodeMap info;
+
+    NodeInfo& startInfo = info[start];
+    startInfo.cost = 0.0f;
+    startInfo.parent = start;
+    startInfo.closed = false;
+
+    uint32 best = start;
+    float bestDist = GetCellDistance(NodeCellX(start), NodeCellY(start), goalX, goalY);
+    open.push(OpenNode(bestDist, start));
+
+    bool found = false;
+    while (!open.empty() && expanded < maxNodes)
+    {
+        uint32 node = open.top().second;
+        open.pop();
+
+        NodeInfo& current = info[node];
+        if (current.closed)
+            continue;
+
+        current.closed = true;
+        float cost = current.cost;
+        ++expanded;
+
+        int32 cellX = NodeCellX(node);
+        int32 cellY = NodeCellY(node);
+
+        float dist = GetCellDistance(cellX, cellY, goalX, goalY);
+        if (dist < bestDist)
+        {
+            best = node;
+            bestDist = dist;
+        }
+
+        if (node == end && end != start)
+        {
+            best = node;
+            found = true;
+            break;
+        }
+
+        NavLayer const* layer = GetNodeLayer(node);
+        if (!layer)
+            continue;
+
+        for (uint32 dir = 0; dir < 8; ++dir)
+        {
+            int32 link = layer->GetLink(dir);
+            if (link < 0)
+                continue;
+
+            int32 nextX = cellX + NAV_DIR_X[dir];
+            int32 nextY = cellY + NAV_DIR_Y[dir];
+
+            uint32 count = 0;
+            NavLayer const* layers = GetCellLayers(nextX, nextY, count);
+            if (!layers || uint32(link) >= count)
+                continue;
+
+            uint32 next = MakeNode(nextX, nextY, uint32(link));
+            float step = (dir & 1) ? NAV_CELL_SIZE * float(M_SQRT2) : NAV_CELL_SIZE;
+            float dz = layers[link].z - layer->z;
+            float nextCost = cost + std::sqrt(step * step + dz * dz);
+
+            NodeMap::iterator itr = info.find(next);
+            if (itr != info.end() && (itr->second.closed || itr->second.cost <= nextCost))
+                continue;
+
+            NodeInfo& nextInfo = info[next];
+            nextInfo.cost = nextCost;
+            nextInfo.parent = node;
+            nextInfo.closed = false;
+            open.push(OpenNode(nextCost + GetCellDistance(nextX, nextY, goalX, goalY), next));
+        }
+    }
+
+    nodes.clear();
+    for (uint32 node = best; ; node = info[node].parent)
+    {
+        nodes.push_back(node);
+        if (node == start)
+            break;
+    }
+
+    std::reverse(nodes.begin(), nodes.end());
+    return found;
+}
+
+void PathGenerator::BuildPointPath(std::vector<uint32> const& nodes)
+{
+    _pathPoints.push_back(_startPosition);
+
+    // keep only the corners: extend every straight segment as long as it stays walkable
+    size_t anchor = 0;
+    while (anchor + 1 < nodes.size())
+    {
+        size_t next = anchor + 1;
+        while (next + 1 < nodes.size() && IsWalkableLine(nodes[anchor], nodes[next + 1]))
+            ++next;
+
+        NavLayer const* layer = GetNodeLayer(nodes[next]);
+        _pathPoints.push_back(G3D::Vector3(CellToWorld(NodeCellX(nodes[next])), CellToWorld(NodeCellY(nodes[next])), layer->z));
+        anchor = next;
+    }
+
+    _actualEndPosition = _pathPoints.back();
+}
+
+void PathGenerator::BuildShortcut()
+{
+    _pathPoints.clear();
+    _pathPoints.push_back(_startPosition);
+    _pathPoints.push_back(_endPosition);
+    _actualEndPosition = _endPosition;
+    _type = PATHFIND_SHORTCUT;
+}
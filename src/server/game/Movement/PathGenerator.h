@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2008-2013 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PATH_GENERATOR_H
+#define _PATH_GENERATOR_H
+
+#include "MoveSplineInitArgs.h"
+#include <G3D/Vector3.h>
+
+class Unit;
+
+namespace NAV
+{
+    class NavMapManager;
+    class NavTile;
+    struct NavLayer;
+}
+
+enum PathType
+{
+    PATHFIND_BLANK          = 0x00,     // path not built yet
+    PATHFIND_NORMAL         = 0x01,     // walkable path to the destination
+    PATHFIND_SHORTCUT       = 0x02,     // no navigation data, straight line to the destination
+    PATHFIND_INCOMPLETE     = 0x04,     // the path ends at the reachable point closest to the destination
+    PATHFIND_NOPATH         = 0x08      // the destination can not be reached
+};
+
+struct PathGeneratorStats
+{
+    uint64 queries;
+    uint64 failedQueries;
+    uint64 expandedNodes;
+    uint64 totalTime;                   // microseconds spent in CalculatePath
+};
+
+// Finds walkable paths on the navigation tiles built by the navgenerator tool.
+// Without navigation data for the map every path is a straight line, the same as before.
+class PathGenerator
+{
+    public:
+        explicit PathGenerator(Unit const* owner);
+
+        // Calculates a path from the owner to the destination; with forceDest the path always
+        // ends at the destination, even if the last part of it is not walkable
+        bool CalculatePath(float destX, float destY, float destZ, bool forceDest = false);
+
+        Movement::PointsArray const& GetPath() const { return _pathPoints; }
+        G3D::Vector3 const& GetStartPosition() const { return _startPosition; }
+        G3D::Vector3 const& GetEndPosition() const { return _endPosition; }
+        G3D::Vector3 const& GetActualEndPosition() const { return _actualEndPosition; }
+        PathType GetPathType() const { return _type; }
+        float GetPathLength() const;
+
+        static PathGeneratorStats GetStats();
+
+    private:
+        struct CachedTile
+        {
+            uint32 tileX;
+            uint32 tileY;
+            NAV::NavTile const* tile;
+        };
+
+        NAV::NavLayer const* GetCellLayers(int32 cellX, int32 cellY, uint32& count);
+        bool FindNode(float x, float y, float z, uint32& node);
+        NAV::NavLayer const* GetNodeLayer(uint32 node);
+        bool IsWalkableLine(uint32 from, uint32 to);
+        bool FindNodePath(uint32 start, uint32 end, std::vector<uint32>& nodes, uint32& expanded);
+        void BuildPointPath(std::vector<uint32> const& nodes);
+        void BuildShortcut();
+
+        Movement::PointsArray _pathPoints;
+        PathType _type;
+
+        G3D::Vector3 _startPosition;
+        G3D::Vector3 _endPosition;          // the requested destination
+        G3D::Vector3 _actualEndPosition;    // the last point of the path
+
+        Unit const* _owner;
+        uint32 _mapId;
+        NAV::NavMapManager* _navManager;
+        std::vector<CachedTile> _tileCache;
+};
+
+#endif
@@ -54,7 +54,10 @@ void Map::ScriptsStart(ScriptMapMap const& scripts, uint32 id, Object* source, O
         sa.ownerGUID  = ownerGUID;
 
         sa.script = &iter->second;
-        m_scriptSchedule.insert(ScriptScheduleMap::value_type(time_t(sWorld->GetGameTime() + iter->first), sa));
+        {
+            MapRegionGuard<ACE_Thread_Mutex> guard(_regionSharedLock, _regionUpdate);
+            m_scriptSchedule.insert(ScriptScheduleMap::value_type(time_t(sWorld->GetGameTime() + iter->first), sa));
+        }
         if (iter->first == 0)
             immedScript = true;
 
@@ -84,7 +87,10 @@ void Map::ScriptCommandStart(ScriptInfo const& script, uint32 delay, Object* sou
     sa.ownerGUID  = ownerGUID;
 
     sa.script = &script;
-    m_scriptSchedule.insert(ScriptScheduleMap::value_type(time_t(sWorld->GetGameTime() + delay), sa));
+    {
+        MapRegionGuard<ACE_Thread_Mutex> guard(_regionSharedLock, _regionUpdate);
+        m_scriptSchedule.insert(ScriptScheduleMap::value_type(time_t(sWorld->GetGameTime() + delay), sa));
+    }
 
     sScriptMgr->IncreaseScheduledScriptsCount();
 
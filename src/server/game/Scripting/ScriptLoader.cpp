@@ -76,6 +76,7 @@ void AddSC_lookup_commandscript();
 void AddSC_message_commandscript();
 void AddSC_misc_commandscript();
 void AddSC_modify_commandscript();
+void AddSC_nav_commandscript();
 void AddSC_npc_commandscript();
 void AddSC_quest_commandscript();
 void AddSC_reload_commandscript();
@@ -1162,6 +1163,7 @@ void AddCommandScripts()
     AddSC_message_commandscript();
     AddSC_misc_commandscript();
     AddSC_modify_commandscript();
+    AddSC_nav_commandscript();
     AddSC_npc_commandscript();
     AddSC_quest_commandscript();
     AddSC_reload_commandscript();
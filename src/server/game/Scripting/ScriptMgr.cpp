@@ -194,7 +194,7 @@ void DoScriptText(int32 iTextEntry, WorldObject* pSource, Unit* target)
         return;
     }
 
-    sLog->outDebug(LOG_FILTER_TSCR, "DoScriptText: text entry=%i, Sound=%u, Type=%u, Language=%u, Emote=%u", iTextEntry, pData->uiSoundId, pData->uiType, pData->uiLanguage, pData->uiEmote);
+    TC_LOG_DEBUG(LOG_FILTER_TSCR, "DoScriptText: text entry=%i, Sound=%u, Type=%u, Language=%u, Emote=%u", iTextEntry, pData->uiSoundId, pData->uiType, pData->uiLanguage, pData->uiEmote);
 
     if (pData->uiSoundId)
     {
@@ -276,6 +276,7 @@ void ScriptMgr::Initialize()
 
     FillSpellSummary();
     AddScripts();
+    LoadPacketHooks();
 
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded %u C++ scripts in %u ms", GetScriptCount(), GetMSTimeDiffToNow(oldMSTime));
 }
@@ -290,6 +291,8 @@ void ScriptMgr::Unload()
     // Clear scripts for every script type.
     SCR_CLEAR(SpellScriptLoader);
     SCR_CLEAR(ServerScript);
+    _packetSendHooks.clear();
+    _packetReceiveHooks.clear();
     SCR_CLEAR(WorldScript);
     SCR_CLEAR(FormulaScript);
     SCR_CLEAR(WorldMapScript);
@@ -330,6 +333,44 @@ void ScriptMgr::LoadDatabase()
     sScriptSystemMgr->LoadScriptWaypoints();
 }
 
+void ScriptMgr::LoadPacketHooks()
+{
+    _packetSendHooks.clear();
+    _packetReceiveHooks.clear();
+
+    for (SCR_REG_ITR(ServerScript) itr = SCR_REG_LST(ServerScript).begin(); itr != SCR_REG_LST(ServerScript).end(); ++itr)
+    {
+        std::vector<uint32> sendOpcodes;
+        std::vector<uint32> receiveOpcodes;
+        itr->second->GetPacketHooks(sendOpcodes, receiveOpcodes);
+
+        for (std::vector<uint32>::const_iterator opcode = sendOpcodes.begin(); opcode != sendOpcodes.end(); ++opcode)
+        {
+            if (*opcode >= NUM_OPCODE_HANDLERS)
+            {
+                sLog->outError(LOG_FILTER_TSCR, "Script %s hooks invalid send opcode %u, skipped", itr->second->GetName().c_str(), *opcode);
+                continue;
+            }
+
+            // only sized once something is hooked, the lookup stays a size check otherwise
+            _packetSendHooks.resize(NUM_OPCODE_HANDLERS);
+            _packetSendHooks[*opcode].push_back(itr->second);
+        }
+
+        for (std::vector<uint32>::const_iterator opcode = receiveOpcodes.begin(); opcode != receiveOpcodes.end(); ++opcode)
+        {
+            if (*opcode >= NUM_OPCODE_HANDLERS)
+            {
+                sLog->outError(LOG_FILTER_TSCR, "Script %s hooks invalid receive opcode %u, skipped", itr->second->GetName().c_str(), *opcode);
+                continue;
+            }
+
+            _packetReceiveHooks.resize(NUM_OPCODE_HANDLERS);
+            _packetReceiveHooks[*opcode].push_back(itr->second);
+        }
+    }
+}
+
 void ScriptMgr::FillSpellSummary()
 {
     UnitAI::FillAISpellInfo();
@@ -498,21 +539,33 @@ void ScriptMgr::OnSocketClose(WorldSocket* socket, bool wasNew)
     FOREACH_SCRIPT(ServerScript)->OnSocketClose(socket, wasNew);
 }
 
-void ScriptMgr::OnPacketReceive(WorldSocket* socket, WorldPacket packet)
+void ScriptMgr::OnPacketReceive(WorldSocket* socket, WorldPacket const& packet)
 {
     ASSERT(socket);
 
-    FOREACH_SCRIPT(ServerScript)->OnPacketReceive(socket, packet);
+    uint32 opcode = packet.GetOpcode();
+    if (opcode >= _packetReceiveHooks.size())
+        return;
+
+    PacketHookList const& hooks = _packetReceiveHooks[opcode];
+    for (PacketHookList::const_iterator itr = hooks.begin(); itr != hooks.end(); ++itr)
+        (*itr)->OnPacketReceive(socket, packet);
 }
 
-void ScriptMgr::OnPacketSend(WorldSocket* socket, WorldPacket packet)
+void ScriptMgr::OnPacketSend(WorldSocket* socket, WorldPacket const& packet)
 {
     ASSERT(socket);
 
-    FOREACH_SCRIPT(ServerScript)->OnPacketSend(socket, packet);
+    uint32 opcode = packet.GetOpcode();
+    if (opcode >= _packetSendHooks.size())
+        return;
+
+    PacketHookList const& hooks = _packetSendHooks[opcode];
+    for (PacketHookList::const_iterator itr = hooks.begin(); itr != hooks.end(); ++itr)
+        (*itr)->OnPacketSend(socket, packet);
 }
 
-void ScriptMgr::OnUnknownPacketReceive(WorldSocket* socket, WorldPacket packet)
+void ScriptMgr::OnUnknownPacketReceive(WorldSocket* socket, WorldPacket const& packet)
 {
     ASSERT(socket);
 
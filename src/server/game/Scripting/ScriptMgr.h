@@ -229,17 +229,20 @@ class ServerScript : public ScriptObject
         // being open; it is not.
         virtual void OnSocketClose(WorldSocket* /*socket*/, bool /*wasNew*/) { }
 
-        // Called when a packet is sent to a client. The packet object is a copy of the original packet, so reading
-        // and modifying it is safe.
-        virtual void OnPacketSend(WorldSocket* /*socket*/, WorldPacket& /*packet*/) { }
+        // Fills the opcodes for which OnPacketSend and OnPacketReceive are called. Asked once after all scripts are
+        // loaded; opcodes no script lists are not hooked at all.
+        virtual void GetPacketHooks(std::vector<uint32>& /*sendOpcodes*/, std::vector<uint32>& /*receiveOpcodes*/) const { }
 
-        // Called when a (valid) packet is received by a client. The packet object is a copy of the original packet, so
-        // reading and modifying it is safe.
-        virtual void OnPacketReceive(WorldSocket* /*socket*/, WorldPacket& /*packet*/) { }
+        // Called when a packet is sent to a client. The packet is the original one, read it with read<T>(pos) and
+        // copy it if it has to be kept. Called from map and network threads.
+        virtual void OnPacketSend(WorldSocket* /*socket*/, WorldPacket const& /*packet*/) { }
 
-        // Called when an invalid (unknown opcode) packet is received by a client. The packet is a reference to the orignal
-        // packet; not a copy. This allows you to actually handle unknown packets (for whatever purpose).
-        virtual void OnUnknownPacketReceive(WorldSocket* /*socket*/, WorldPacket& /*packet*/) { }
+        // Called when a (valid) packet is received by a client, before its handler. The packet is the original one,
+        // read it with read<T>(pos) and copy it if it has to be kept.
+        virtual void OnPacketReceive(WorldSocket* /*socket*/, WorldPacket const& /*packet*/) { }
+
+        // Called when an invalid (unknown opcode) packet is received by a client, for every script.
+        virtual void OnUnknownPacketReceive(WorldSocket* /*socket*/, WorldPacket const& /*packet*/) { }
 };
 
 class WorldScript : public ScriptObject
@@ -855,9 +858,9 @@ class ScriptMgr
         void OnNetworkStop();
         void OnSocketOpen(WorldSocket* socket);
         void OnSocketClose(WorldSocket* socket, bool wasNew);
-        void OnPacketReceive(WorldSocket* socket, WorldPacket packet);
-        void OnPacketSend(WorldSocket* socket, WorldPacket packet);
-        void OnUnknownPacketReceive(WorldSocket* socket, WorldPacket packet);
+        void OnPacketReceive(WorldSocket* socket, WorldPacket const& packet);
+        void OnPacketSend(WorldSocket* socket, WorldPacket const& packet);
+        void OnUnknownPacketReceive(WorldSocket* socket, WorldPacket const& packet);
 
     public: /* WorldScript */
 
@@ -1049,8 +1052,15 @@ class ScriptMgr
 
     private:
 
+        void LoadPacketHooks();
+
         uint32 _scriptCount;
 
+        // ServerScripts hooking each opcode, indexed by opcode; empty if no script hooks any
+        typedef std::vector<ServerScript*> PacketHookList;
+        std::vector<PacketHookList> _packetSendHooks;
+        std::vector<PacketHookList> _packetReceiveHooks;
+
         //atomic op counter for active scripts amount
         ACE_Atomic_Op<ACE_Thread_Mutex, long> _scheduledScripts;
 };
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SharedWorldPacket.h"
+#include "Log.h"
+
+#include <ace/Message_Block.h>
+#include <ace/Lock_Adapter_T.h>
+#include <ace/Thread_Mutex.h>
+
+namespace
+{
+    // Data block of one shared payload with the lock guarding its reference count, the network threads
+    // release their references concurrently but never wait for the references of other payloads.
+    // ACE_Data_Block::release frees the block after leaving the lock, so the block can own it.
+    class SharedPayloadBlock : public ACE_Data_Block
+    {
+        public:
+            SharedPayloadBlock(size_t size, ACE_Allocator* allocator) :
+                ACE_Data_Block(size, ACE_Message_Block::MB_DATA, NULL, NULL, &_lock, 0, allocator) { }
+
+        private:
+            ACE_Lock_Adapter<ACE_Thread_Mutex> _lock;
+    };
+}
+
+SharedWorldPacket::SharedWorldPacket(WorldPacket const& packet) : m_packet(packet), m_payload(NULL), m_canSend(true)
+{
+    Opcodes opcode = packet.GetOpcode();
+    if (opcode == NULL_OPCODE || opcode == UNKNOWN_OPCODE)
+        m_canSend = false;
+    else
+    {
+        OpcodeHandler* handler = opcodeTable[WOW_SERVER][opcode];
+        if (!handler || handler->status == STATUS_UNHANDLED)
+            m_canSend = false;
+    }
+
+    if (!m_canSend)
+        sLog->outError(LOG_FILTER_OPCODES, "Prevented broadcast of opcode %s", GetOpcodeNameForLogging(opcode, WOW_SERVER).c_str());
+}
+
+SharedWorldPacket::~SharedWorldPacket()
+{
+    if (m_payload)
+        m_payload->release();
+}
+
+ACE_Message_Block* SharedWorldPacket::DuplicatePayload() const
+{
+    if (m_packet.empty())
+        return NULL;
+
+    if (!m_payload)
+    {
+        // ACE_Data_Block::release frees the block through its allocator
+        ACE_Allocator* allocator = ACE_Allocator::instance();
+        SharedPayloadBlock* block;
+        ACE_NEW_MALLOC_RETURN(block, static_cast<SharedPayloadBlock*>(allocator->malloc(sizeof(SharedPayloadBlock))),
+            SharedPayloadBlock(m_packet.size(), allocator), NULL);
+
+        m_payload = new ACE_Message_Block(block);
+        m_payload->copy((char const*)m_packet.contents(), m_packet.size());
+    }
+
+    return m_payload->duplicate();
+}
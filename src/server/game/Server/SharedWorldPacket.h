@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_SHAREDWORLDPACKET_H
+#define TRINITY_SHAREDWORLDPACKET_H
+
+#include "WorldPacket.h"
+
+class ACE_Message_Block;
+
+// A packet sent unchanged to many sessions: chat channels, guilds, groups and area messages.
+// The opcode is checked once for all receivers. Every socket still writes its own encrypted
+// header and links a reference counted copy of the payload behind it instead of copying the
+// payload again, so it is copied once per broadcast.
+// The packet must not change while this object exists.
+class SharedWorldPacket
+{
+    public:
+
+        explicit SharedWorldPacket(WorldPacket const& packet);
+        ~SharedWorldPacket();
+
+        WorldPacket const& GetPacket() const { return m_packet; }
+
+        // False for the opcodes WorldSession::SendPacket refuses to send
+        bool CanSend() const { return m_canSend; }
+
+        // New block sharing the payload, the socket releases it once written; NULL for empty packets.
+        // Only called by the thread that owns this object.
+        ACE_Message_Block* DuplicatePayload() const;
+
+    private:
+
+        SharedWorldPacket(SharedWorldPacket const&);
+        SharedWorldPacket& operator=(SharedWorldPacket const&);
+
+        WorldPacket const& m_packet;
+        mutable ACE_Message_Block* m_payload;               // built when the first socket queues the packet
+        bool m_canSend;
+};
+
+#endif
@@ -27,6 +27,7 @@
 #include "Log.h"
 #include "Opcodes.h"
 #include "WorldPacket.h"
+#include "SharedWorldPacket.h"
 #include "WorldSession.h"
 #include "Player.h"
 #include "Vehicle.h"
@@ -270,6 +271,16 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
         m_Socket->CloseSocket();
 }
 
+/// Send a packet built once for many sessions, the opcode was already checked by SharedWorldPacket
+void WorldSession::SendPacket(SharedWorldPacket const& packet)
+{
+    if (!m_Socket || !packet.CanSend())
+        return;
+
+    if (m_Socket->SendPacket(packet) == -1)
+        m_Socket->CloseSocket();
+}
+
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
@@ -356,13 +367,13 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                             deletePacket = false;
                             QueuePacket(packet);
                             //! Log
-                                sLog->outDebug(LOG_FILTER_NETWORKIO, "Re-enqueueing packet with opcode %s with with status STATUS_LOGGEDIN. "
+                                TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Re-enqueueing packet with opcode %s with with status STATUS_LOGGEDIN. "
                                     "Player is currently not in world yet.", GetOpcodeNameForLogging(packet->GetOpcode(), WOW_CLIENT).c_str());
                         }
                     }
                     else if (_player->IsInWorld())
                     {
-                        sScriptMgr->OnPacketReceive(m_Socket, WorldPacket(*packet));
+                        sScriptMgr->OnPacketReceive(m_Socket, *packet);
                         (this->*opHandle->handler)(*packet);
                         if (sLog->ShouldLog(LOG_FILTER_NETWORKIO, LOG_LEVEL_TRACE) && packet->rpos() < packet->wpos())
                             LogUnprocessedTail(packet);
@@ -376,7 +387,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     else
                     {
                         // not expected _player or must checked in packet hanlder
-                        sScriptMgr->OnPacketReceive(m_Socket, WorldPacket(*packet));
+                        sScriptMgr->OnPacketReceive(m_Socket, *packet);
                         (this->*opHandle->handler)(*packet);
                         if (sLog->ShouldLog(LOG_FILTER_NETWORKIO, LOG_LEVEL_TRACE) && packet->rpos() < packet->wpos())
                             LogUnprocessedTail(packet);
@@ -389,7 +400,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                         LogUnexpectedOpcode(packet, "STATUS_TRANSFER", "the player is still in world");
                     else
                     {
-                        sScriptMgr->OnPacketReceive(m_Socket, WorldPacket(*packet));
+                        sScriptMgr->OnPacketReceive(m_Socket, *packet);
                         (this->*opHandle->handler)(*packet);
                         if (sLog->ShouldLog(LOG_FILTER_NETWORKIO, LOG_LEVEL_TRACE) && packet->rpos() < packet->wpos())
                             LogUnprocessedTail(packet);
@@ -408,7 +419,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     if (packet->GetOpcode() == CMSG_CHAR_ENUM)
                         m_playerRecentlyLogout = false;
 
-                    sScriptMgr->OnPacketReceive(m_Socket, WorldPacket(*packet));
+                    sScriptMgr->OnPacketReceive(m_Socket, *packet);
                     (this->*opHandle->handler)(*packet);
                     if (sLog->ShouldLog(LOG_FILTER_NETWORKIO, LOG_LEVEL_TRACE) && packet->rpos() < packet->wpos())
                         LogUnprocessedTail(packet);
@@ -714,7 +725,7 @@ void WorldSession::LogoutPlayer(bool Save)
 
         SendPacket(&data);
 
-        sLog->outDebug(LOG_FILTER_NETWORKIO, "SESSION: Sent SMSG_LOGOUT_COMPLETE Message");
+        TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "SESSION: Sent SMSG_LOGOUT_COMPLETE Message");
 
         //! Since each account can only have one online character at any given time, ensure all characters for active account are marked as offline
         CharacterDatabase.PExecute("UPDATE characters SET online = 0 WHERE account = '%u'", GetAccountId());
@@ -1003,10 +1014,10 @@ void WorldSession::ReadAddonsInfo(WorldPacket &data)
 
         uint32 currentTime;
         addonInfo >> currentTime;
-        sLog->outDebug(LOG_FILTER_NETWORKIO, "ADDON: CurrentTime: %u", currentTime);
+        TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "ADDON: CurrentTime: %u", currentTime);
 
         if (addonInfo.rpos() != addonInfo.size())
-            sLog->outDebug(LOG_FILTER_NETWORKIO, "packet under-read!");
+            TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "packet under-read!");
     }
     else
         sLog->outError(LOG_FILTER_GENERAL, "Addon packet uncompress error!");
@@ -1120,14 +1131,14 @@ bool WorldSession::IsAddonRegistered(const std::string& prefix) const
 
 void WorldSession::HandleUnregisterAddonPrefixesOpcode(WorldPacket& /*recvPacket*/) // empty packet
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: Received CMSG_UNREGISTER_ALL_ADDON_PREFIXES");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: Received CMSG_UNREGISTER_ALL_ADDON_PREFIXES");
 
     _registeredAddonPrefixes.clear();
 }
 
 void WorldSession::HandleAddonRegisteredPrefixesOpcode(WorldPacket& recvPacket)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: Received CMSG_ADDON_REGISTERED_PREFIXES");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: Received CMSG_ADDON_REGISTERED_PREFIXES");
 
     // This is always sent after CMSG_UNREGISTER_ALL_ADDON_PREFIXES
 
@@ -1259,6 +1270,33 @@ void WorldSession::ProcessQueryCallbacks()
         HandleStableSetPetSlotCallback(result, param);
         _setPetSlotCallback.FreeResult();
     }
+
+    for (std::list<PendingQueryContinuation>::iterator itr = _queryContinuations.begin(); itr != _queryContinuations.end();)
+    {
+        if (!itr->result.ready())
+        {
+            ++itr;
+            continue;
+        }
+
+        itr->result.get(result);
+        QueryContinuation continuation = std::move(itr->continuation);
+        uint64 playerGuid = itr->playerGuid;
+        itr = _queryContinuations.erase(itr);
+
+        // a continuation may queue the next query of its chain, it is appended behind the current one
+        if (!playerGuid || (_player && _player->GetGUID() == playerGuid))
+            continuation(result);
+    }
+}
+
+void WorldSession::AddQueryCallback(PreparedQueryResultFuture future, QueryContinuation continuation)
+{
+    PendingQueryContinuation pending;
+    pending.result = future;
+    pending.continuation = std::move(continuation);
+    pending.playerGuid = _player ? _player->GetGUID() : 0;
+    _queryContinuations.push_back(std::move(pending));
 }
 
 void WorldSession::InitWarden(BigNumber* k, std::string os)
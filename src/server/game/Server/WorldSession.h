@@ -33,6 +33,11 @@
 #include "Opcodes.h"
 #include "Object.h"
 
+#include <functional>
+#include <memory>
+#include <list>
+
+class AnticheatData;
 class CalendarEvent;
 class CalendarInvite;
 class Creature;
@@ -43,6 +48,7 @@ class LoginQueryHolder;
 class Object;
 class Player;
 class Quest;
+class SharedWorldPacket;
 class SpellCastTargets;
 class Unit;
 class Warden;
@@ -287,6 +293,15 @@ class WorldSession
         void SendTimezoneInformation();
 
         void SendPacket(WorldPacket const* packet, bool forced = false);
+        void SendPacket(SharedWorldPacket const& packet);
+
+        typedef std::function<void(PreparedQueryResult)> QueryContinuation;
+
+        /// Resumes a handler once its query ran on the async database workers, instead of blocking the map thread:
+        /// the continuation is called from a later Update() of this session, not from the calling thread.
+        /// It is dropped if the player that was logged in when the query was issued is no longer.
+        void AddQueryCallback(PreparedQueryResultFuture future, QueryContinuation continuation);
+
         void SendNotification(const char *format, ...) ATTR_PRINTF(2, 3);
         void SendNotification(uint32 string_id, ...);
         void SendPetNameInvalid(uint32 error, const std::string& name, DeclinedName *declinedName);
@@ -307,12 +322,18 @@ class WorldSession
         uint32 GetGuidLow() const;
         void SetSecurity(AccountTypes security) { _security = security; }
         std::string const& GetRemoteAddress() { return m_Address; }
+        WorldSocket* GetSocket() const { return m_Socket; }
         void SetPlayer(Player* player);
         uint8 Expansion() const { return m_expansion; }
 		uint8 GetVipLevel() const { return m_viplevel; }
 
         void InitWarden(BigNumber* k, std::string os);
 
+        // anticheat state of the logged in character, shared with the anticheat analysis thread,
+        // read from other threads (GM commands, daily reset) while login and logout replace it
+        std::shared_ptr<AnticheatData> GetAnticheatData() const { return std::atomic_load(&m_anticheatData); }
+        void SetAnticheatData(std::shared_ptr<AnticheatData> const& data) { std::atomic_store(&m_anticheatData, data); }
+
         /// Session in auth.queue currently
         void SetInQueue(bool state) { m_inQueue = state; }
 
@@ -360,6 +381,8 @@ class WorldSession
         void SendCancelTrade();
 
         void SendPetitionQueryOpcode(uint64 petitionguid);
+        void SendPetitionQueryCallback(PreparedQueryResult result, uint64 petitionguid);
+        void SendPetitionSignatures(PreparedQueryResult result, ObjectGuid petitionguid);
 
         // Spell
         void HandleClientCastFlags(WorldPacket& recvPacket, uint8 castFlags, SpellCastTargets & targets);
@@ -650,6 +673,11 @@ class WorldSession
         void HandlePetitionDeclineOpcode(WorldPacket& recvData);
         void HandleOfferPetitionOpcode(WorldPacket& recvData);
         void HandleTurnInPetitionOpcode(WorldPacket& recvData);
+        void HandlePetitionShowSignCallback(PreparedQueryResult result, ObjectGuid petitionguid);
+        void HandlePetitionSignCallback(PreparedQueryResult result, ObjectGuid petitionGuid);
+        void HandleOfferPetitionCallback(PreparedQueryResult result, ObjectGuid petitionGuid, ObjectGuid playerGuid);
+        void HandleTurnInPetitionCallback(PreparedQueryResult result, ObjectGuid petitionGuid);
+        void HandleTurnInPetitionSignaturesCallback(PreparedQueryResult result, ObjectGuid petitionGuid, std::string const& name);
 
         void HandleGuildQueryOpcode(WorldPacket& recvPacket);
         void HandleGuildInviteOpcode(WorldPacket& recvPacket);
@@ -737,6 +765,7 @@ class WorldSession
         void HandleAuctionListPendingSales(WorldPacket& recvData);
 
         void HandleGetMailList(WorldPacket& recvData);
+        void SendMailList();
         void HandleSendMail(WorldPacket& recvData);
         void HandleMailTakeMoney(WorldPacket& recvData);
         void HandleMailTakeItem(WorldPacket& recvData);
@@ -746,6 +775,7 @@ class WorldSession
         void HandleItemTextQuery(WorldPacket& recvData);
         void HandleMailCreateTextItem(WorldPacket& recvData);
         void HandleQueryNextMailTime(WorldPacket& recvData);
+        void SendQueryNextMailTime();
         void HandleCancelChanneling(WorldPacket& recvData);
 
         void SendItemPageInfo(ItemTemplate* itemProto);
@@ -1057,6 +1087,7 @@ class WorldSession
         void HandleAlterAppearance(WorldPacket& recvData);
         void HandleRemoveGlyph(WorldPacket& recvData);
         void HandleCharCustomize(WorldPacket& recvData);
+        void HandleCharCustomizeCallback(PreparedQueryResult result, ObjectGuid playerGuid, std::string newName, uint8 gender, uint8 skin, uint8 face, uint8 hairStyle, uint8 hairColor, uint8 facialHair);
         void HandleQueryInspectAchievements(WorldPacket& recvData);
         void HandleGuildAchievementProgressQuery(WorldPacket& recvData);
         void HandleEquipmentSetSave(WorldPacket& recvData);
@@ -1102,6 +1133,14 @@ class WorldSession
         QueryCallback<PreparedQueryResult, CharacterCreateInfo*, true> _charCreateCallback;
         QueryResultHolderFuture _charLoginCallback;
 
+        struct PendingQueryContinuation
+        {
+            PreparedQueryResultFuture result;
+            QueryContinuation continuation;
+            uint64 playerGuid;                              // 0 if the query was issued without a player
+        };
+        std::list<PendingQueryContinuation> _queryContinuations;
+
     private:
         // private trade methods
         void moveItems(Item* myItems[], Item* hisItems[]);
@@ -1136,6 +1175,8 @@ class WorldSession
         // Warden
         Warden* _warden;                                    // Remains NULL if Warden system is not enabled by config
 
+        std::shared_ptr<AnticheatData> m_anticheatData;
+
         time_t _logoutTime;
         bool m_inQueue;                                     // session wait in auth.queue
         bool m_playerLoading;                               // code processed in LoginPlayer
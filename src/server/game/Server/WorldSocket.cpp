@@ -26,6 +26,7 @@
 #include <ace/OS_NS_string.h>
 #include <ace/Reactor.h>
 #include <ace/Auto_Ptr.h>
+#include <ace/OS_NS_sys_time.h>
 
 #include "WorldSocket.h"
 #include "Common.h"
@@ -33,6 +34,7 @@
 #include "Util.h"
 #include "World.h"
 #include "WorldPacket.h"
+#include "SharedWorldPacket.h"
 #include "SharedDefines.h"
 #include "ByteBuffer.h"
 #include "Opcodes.h"
@@ -102,7 +104,7 @@ WorldSocket::WorldSocket (void): WorldHandler(),
     m_LastPingTime(ACE_Time_Value::zero), m_OverSpeedPings(0), m_Session(0),
     m_RecvWPct(0), m_RecvPct(), m_Header(sizeof(AuthClientPktHeader)),
     m_WorldHeader(sizeof(WorldClientPktHeader)), m_OutBuffer(0), m_OutBufferSize(65536),
-    m_OutActive(false), m_Seed(static_cast<uint32> (rand32())), m_zstream()
+    m_OutActive(false), m_Seed(static_cast<uint32> (rand32())), m_zstream(), m_CompressingCount(0)
 {
     reference_counting_policy().value (ACE_Event_Handler::Reference_Counting_Policy::ENABLED);
 
@@ -129,6 +131,9 @@ WorldSocket::~WorldSocket (void)
     if (m_OutBuffer)
         m_OutBuffer->release();
 
+    for (std::deque<WorldPacket*>::iterator itr = m_CompressQueue.begin(); itr != m_CompressQueue.end(); ++itr)
+        delete *itr;
+
     int z_res = deflateEnd(m_zstream);
     if (z_res != Z_OK && z_res != Z_DATA_ERROR)
     {
@@ -171,9 +176,22 @@ const std::string& WorldSocket::GetRemoteAddress (void) const
 }
 
 int WorldSocket::SendPacket(WorldPacket const* pct)
+{
+    return QueuePacket(pct, NULL);
+}
+
+int WorldSocket::SendPacket(SharedWorldPacket const& pct)
+{
+    return QueuePacket(&pct.GetPacket(), &pct);
+}
+
+int WorldSocket::QueuePacket(WorldPacket const* pct, SharedWorldPacket const* shared)
 {
     ASSERT(!(pct->GetOpcode() & COMPRESSED_OPCODE_MASK)); // Packet not compressed
 
+    // outside of the lock, hooks may send packets themselves
+    sScriptMgr->OnPacketSend(this, *pct);
+
     ACE_GUARD_RETURN (LockType, Guard, m_OutBufferLock, -1);
 
     if (closing_)
@@ -183,73 +201,44 @@ int WorldSocket::SendPacket(WorldPacket const* pct)
     if (sPacketLog->CanLogPacket() && pct->GetOpcode() == SMSG_UPDATE_OBJECT)
         sPacketLog->LogPacket(*pct, SERVER_TO_CLIENT);
 
-    sLog->outInfo(LOG_FILTER_OPCODES, "S->C: %s", GetOpcodeNameForLogging(pct->GetOpcode(), WOW_SERVER).c_str());
-
-    WorldPacket compressed;
-    size_t size = pct->size();
+    TC_LOG_INFO(LOG_FILTER_OPCODES, "S->C: %s", GetOpcodeNameForLogging(pct->GetOpcode(), WOW_SERVER).c_str());
 
-    if (false && size >= 45
-        && pct->GetOpcode() != MSG_VERIFY_CONNECTIVITY
-        && pct->GetOpcode() != SMSG_MOTD
-        )
+    // Leave the deflate to the network thread, a packet sent while one is still waiting for it has to
+    // queue behind it; with nothing pending the packet goes out directly
+    if (CanCompress(pct) || !m_CompressQueue.empty() || m_CompressingCount)
     {
-        size += sizeof(uint32);
-
-        size_t reserved_size = deflateBound(m_zstream, size) + 12;
-        compressed.resize(reserved_size);
-        compressed.put<uint32>(0, size);
-        
-        ByteBuffer buff(size);
-        {
-            buff.append((uint32)pct->GetOpcode());
-            buff.append(pct->contents(), pct->size());
-        }
+        m_CompressQueue.push_back(new WorldPacket(*pct));
+        return 0;
+    }
 
-        uint32 adler_1 = (uint32)adler32(2552748273u, (const Bytef*)buff.contents(), buff.size());
-        
-        compressed.put<uint32>(4, adler_1);
+    return WritePacket(pct, shared);
+}
 
-        m_zstream->next_in = (Bytef*)buff.contents();
-        m_zstream->avail_in = buff.size();
+int WorldSocket::WritePacket(WorldPacket const* pct, SharedWorldPacket const* shared)
+{
+    ServerPktHeader header(!m_Crypt.IsInitialized() ? pct->size() + 2 : pct->size(), pct->GetOpcode(), &m_Crypt);
 
-        m_zstream->next_out = (Bytef*)(compressed.contents() + 12);
-        m_zstream->avail_out = reserved_size - 12;
+    if (shared)
+    {
+        // Enqueue our header followed by the payload shared with the other receivers, never copied into
+        // m_OutBuffer. handle_output sends the buffer before the queue and nothing is put in the buffer
+        // while the queue holds packets, so the order is kept. handle_output_queue writes both blocks
+        // with one gather write
+        ACE_Message_Block* mb;
 
-        int z_res = deflate(m_zstream, Z_SYNC_FLUSH);
+        ACE_NEW_RETURN(mb, ACE_Message_Block(header.getHeaderLength()), -1);
 
-        size_t totalOut = m_zstream->next_out - compressed.contents();
-        sLog->outError(LOG_FILTER_NETWORKIO, "totalOut = %u, reserved_size = %u, m_zstream->avail_out = %u", (uint32)totalOut, (uint32)reserved_size, (uint32)m_zstream->avail_out);
-        ASSERT(totalOut == reserved_size - m_zstream->avail_out);
-        
-        uint32 adler_2 = (uint32)adler32(2552748273u, (const Bytef*)(compressed.contents() + 12), totalOut - 12);
-        
-        compressed.put<uint32>(8, adler_2);
+        mb->copy((char*) header.header, header.getHeaderLength());
+        mb->cont(shared->DuplicatePayload());
 
-        if (z_res != Z_OK)
-        {
-            sLog->outError(LOG_FILTER_NETWORKIO, "Can't compress packet (zlib: deflate) Error code: %i (%s)",z_res,zError(z_res));
-        }
-        else if (m_zstream->avail_in != 0)
-        {
-            sLog->outError(LOG_FILTER_NETWORKIO, "Can't compress packet (zlib: deflate not greedy)");
-        }
-        else
+        if (msg_queue()->enqueue_tail(mb, (ACE_Time_Value*)&ACE_Time_Value::zero) == -1)
         {
-            compressed.resize(totalOut + 12);
-            compressed.SetOpcode(SMSG_COMPRESSED_DATA);
-            pct = &compressed;
-            size = pct->size();
+            sLog->outError(LOG_FILTER_NETWORKIO, "WorldSocket::SendPacket enqueue_tail failed");
+            mb->release();
+            return -1;
         }
-
-        m_zstream->next_in = NULL;
-        m_zstream->next_out = NULL;
-        m_zstream->avail_in = 0;
-        m_zstream->avail_out = 0;
     }
-
-    ServerPktHeader header(!m_Crypt.IsInitialized() ? pct->size() + 2 : pct->size(), pct->GetOpcode(), &m_Crypt);
-
-    if (m_OutBuffer->space() >= pct->size() + header.getHeaderLength() && msg_queue()->is_empty())
+    else if (m_OutBuffer->space() >= pct->size() + header.getHeaderLength() && msg_queue()->is_empty())
     {
         // Put the packet on the buffer.
         if (m_OutBuffer->copy((char*) header.header, header.getHeaderLength()) == -1)
@@ -282,6 +271,133 @@ int WorldSocket::SendPacket(WorldPacket const* pct)
     return 0;
 }
 
+bool WorldSocket::CanCompress(WorldPacket const* pct) const
+{
+    // the client sets up its inflate stream with the session key
+    if (!m_Crypt.IsInitialized())
+        return false;
+
+    uint32 minSize = sWorldSocketMgr->GetCompressionMinSize();
+    return minSize && pct->size() >= minSize && sWorldSocketMgr->CanCompressOpcode(pct->GetOpcode());
+}
+
+bool WorldSocket::CompressPacket(WorldPacket const* pct, WorldPacket& compressed)
+{
+    // uncompressed size, adler32 of the uncompressed data, adler32 of the compressed data, deflate stream
+    uint32 const headerSize = 3 * sizeof(uint32);
+
+    ByteBuffer buff(pct->size() + sizeof(uint32));
+    buff.append(uint32(pct->GetOpcode()));
+    buff.append(pct->contents(), pct->size());
+
+    size_t reservedSize = deflateBound(m_zstream, buff.size()) + headerSize;
+    compressed.Initialize(SMSG_COMPRESSED_DATA, reservedSize);
+    compressed.resize(reservedSize);
+    compressed.put<uint32>(0, buff.size());
+    compressed.put<uint32>(4, uint32(adler32(2552748273u, (Bytef const*)buff.contents(), buff.size())));
+
+    m_zstream->next_in = (Bytef*)buff.contents();
+    m_zstream->avail_in = buff.size();
+    m_zstream->next_out = (Bytef*)(compressed.contents() + headerSize);
+    m_zstream->avail_out = reservedSize - headerSize;
+
+    int z_res = deflate(m_zstream, Z_SYNC_FLUSH);
+    size_t deflatedSize = reservedSize - headerSize - m_zstream->avail_out;
+    uInt remainingIn = m_zstream->avail_in;
+
+    m_zstream->next_in = NULL;
+    m_zstream->next_out = NULL;
+    m_zstream->avail_in = 0;
+    m_zstream->avail_out = 0;
+
+    if (z_res != Z_OK)
+    {
+        sLog->outError(LOG_FILTER_NETWORKIO, "Can't compress packet (zlib: deflate) Error code: %i (%s)", z_res, zError(z_res));
+        return false;
+    }
+
+    if (remainingIn != 0)
+    {
+        sLog->outError(LOG_FILTER_NETWORKIO, "Can't compress packet (zlib: deflate not greedy)");
+        return false;
+    }
+
+    compressed.put<uint32>(8, uint32(adler32(2552748273u, (Bytef const*)(compressed.contents() + headerSize), deflatedSize)));
+    compressed.resize(deflatedSize + headerSize);
+    return true;
+}
+
+int WorldSocket::FlushCompressQueue (void)
+{
+    ACE_GUARD_RETURN (LockType, CompressGuard, m_CompressLock, -1);
+
+    std::deque<WorldPacket*> packets;
+    {
+        ACE_GUARD_RETURN (LockType, Guard, m_OutBufferLock, -1);
+
+        if (m_CompressQueue.empty())
+            return 0;
+
+        packets.swap(m_CompressQueue);
+        m_CompressingCount = packets.size();
+    }
+
+    WorldSocketMgr::CompressionStatsMap stats;
+    int result = 0;
+    size_t written = 0;
+    for (size_t i = 0; i <= packets.size(); ++i)
+    {
+        // also queued are the packets that only waited behind a compressed one
+        if (i < packets.size() && !CanCompress(packets[i]))
+            continue;
+
+        // write everything up to the next packet to compress, packets that only waited behind
+        // the previous one go out now instead of waiting for the whole batch
+        if (i > written)
+        {
+            ACE_GUARD_RETURN (LockType, Guard, m_OutBufferLock, -1);
+
+            for (; written < i; ++written)
+            {
+                if (!result && !closing_)
+                    result = WritePacket(packets[written]);
+
+                delete packets[written];
+                --m_CompressingCount;
+            }
+        }
+
+        if (i == packets.size())
+            break;
+
+        ACE_Time_Value start = ACE_OS::gettimeofday();
+
+        WorldPacket* compressed = new WorldPacket();
+        if (!CompressPacket(packets[i], *compressed))
+        {
+            // sent uncompressed with the next write
+            delete compressed;
+            continue;
+        }
+
+        ACE_Time_Value elapsed = ACE_OS::gettimeofday() - start;
+
+        WorldSocketMgr::CompressionStats& opcodeStats = stats[packets[i]->GetOpcode()];
+        ++opcodeStats.packets;
+        opcodeStats.bytesIn += packets[i]->size();
+        opcodeStats.bytesOut += compressed->size();
+        opcodeStats.time += uint64(elapsed.sec()) * 1000000 + elapsed.usec();
+
+        delete packets[i];
+        packets[i] = compressed;
+    }
+
+    if (!stats.empty())
+        sWorldSocketMgr->AddCompressionStats(stats);
+
+    return closing_ ? -1 : result;
+}
+
 long WorldSocket::AddReference (void)
 {
     return static_cast<long> (add_reference());
@@ -369,14 +485,14 @@ int WorldSocket::handle_input (ACE_HANDLE)
                 return Update();                           // interesting line, isn't it ?
             }
 
-            sLog->outDebug(LOG_FILTER_NETWORKIO, "WorldSocket::handle_input: Peer error closing connection errno = %s", ACE_OS::strerror (errno));
+            TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WorldSocket::handle_input: Peer error closing connection errno = %s", ACE_OS::strerror (errno));
 
             errno = ECONNRESET;
             return -1;
         }
     case 0:
         {
-            sLog->outDebug(LOG_FILTER_NETWORKIO, "WorldSocket::handle_input: Peer has closed connection");
+            TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WorldSocket::handle_input: Peer has closed connection");
 
             errno = ECONNRESET;
             return -1;
@@ -449,13 +565,38 @@ int WorldSocket::handle_output_queue (GuardType& g)
         return -1;
     }
 
-    const size_t send_len = mblk->length();
+    // the header of a shared packet is followed by its payload
+    ACE_Message_Block* payload = mblk->cont();
+    const size_t header_len = mblk->length();
+    const size_t send_len = header_len + (payload ? payload->length() : 0);
+
+    ssize_t n;
+    if (payload)
+    {
+        iovec iov[2];
+        iov[0].iov_base = mblk->rd_ptr();
+        iov[0].iov_len = header_len;
+        iov[1].iov_base = payload->rd_ptr();
+        iov[1].iov_len = payload->length();
 
 #ifdef MSG_NOSIGNAL
-    ssize_t n = peer().send (mblk->rd_ptr(), send_len, MSG_NOSIGNAL);
+        msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = iov;
+        msg.msg_iovlen = 2;
+        n = ACE_OS::sendmsg(peer().get_handle(), &msg, MSG_NOSIGNAL);
 #else
-    ssize_t n = peer().send (mblk->rd_ptr(), send_len);
+        n = peer().sendv(iov, 2);
 #endif // MSG_NOSIGNAL
+    }
+    else
+    {
+#ifdef MSG_NOSIGNAL
+        n = peer().send (mblk->rd_ptr(), send_len, MSG_NOSIGNAL);
+#else
+        n = peer().send (mblk->rd_ptr(), send_len);
+#endif // MSG_NOSIGNAL
+    }
 
     if (n == 0)
     {
@@ -476,6 +617,15 @@ int WorldSocket::handle_output_queue (GuardType& g)
     }
     else if (n < (ssize_t)send_len) //now n > 0
     {
+        // the header went out completely, only the rest of the payload stays queued
+        if (payload && static_cast<size_t> (n) >= header_len)
+        {
+            mblk->cont(NULL);
+            mblk->release();
+            mblk = payload;
+            n -= header_len;
+        }
+
         mblk->rd_ptr(static_cast<size_t> (n));
 
         if (msg_queue()->enqueue_head(mblk, (ACE_Time_Value*) &ACE_Time_Value::zero) == -1)
@@ -489,6 +639,7 @@ int WorldSocket::handle_output_queue (GuardType& g)
     }
     else //now n == send_len
     {
+        // releases the shared payload block too
         mblk->release();
 
         return msg_queue()->is_empty() ? cancel_wakeup_output(g) : ACE_Event_Handler::WRITE_MASK;
@@ -525,6 +676,9 @@ int WorldSocket::Update (void)
     if (closing_)
         return -1;
 
+    if (FlushCompressQueue() == -1)
+        return -1;
+
     if (m_OutActive)
         return 0;
 
@@ -835,9 +989,8 @@ int WorldSocket::ProcessIncoming(WorldPacket* new_pct)
     //if (sPacketLog->CanLogPacket())
     //    sPacketLog->LogPacket(*new_pct, CLIENT_TO_SERVER);
 
-    std::string opcodeName = GetOpcodeNameForLogging(opcode, WOW_CLIENT);
     if (opcode != CMSG_PLAYER_MOVE)
-        sLog->outInfo(LOG_FILTER_OPCODES, "C->S: %s", opcodeName.c_str());
+        TC_LOG_INFO(LOG_FILTER_OPCODES, "C->S: %s", GetOpcodeNameForLogging(opcode, WOW_CLIENT).c_str());
 
     try
     {
@@ -853,25 +1006,25 @@ int WorldSocket::ProcessIncoming(WorldPacket* new_pct)
                     return -1;
                 }
 
-                sScriptMgr->OnPacketReceive(this, WorldPacket(*new_pct));
+                sScriptMgr->OnPacketReceive(this, *new_pct);
                 return HandleAuthSession(*new_pct);
             }
             case CMSG_KEEP_ALIVE:
             {
-                sLog->outDebug(LOG_FILTER_NETWORKIO, "%s", GetOpcodeNameForLogging(opcode, WOW_CLIENT).c_str());
-                sScriptMgr->OnPacketReceive(this, WorldPacket(*new_pct));
+                TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "%s", GetOpcodeNameForLogging(opcode, WOW_CLIENT).c_str());
+                sScriptMgr->OnPacketReceive(this, *new_pct);
                 return 0;
             }
             case CMSG_LOG_DISCONNECT:
             {
                 new_pct->rfinish(); // contains uint32 disconnectReason;
-                sLog->outDebug(LOG_FILTER_NETWORKIO, "%s", opcodeName.c_str());
-                sScriptMgr->OnPacketReceive(this, WorldPacket(*new_pct));
+                TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "%s", GetOpcodeNameForLogging(opcode, WOW_CLIENT).c_str());
+                sScriptMgr->OnPacketReceive(this, *new_pct);
                 return 0;
             }
             /*case CMSG_REORDER_CHARACTERS:
             {
-                sScriptMgr->OnPacketReceive(this, WorldPacket(*new_pct));
+                sScriptMgr->OnPacketReceive(this, *new_pct);
 
                 if (m_Session)
                     if (OpcodeHandler* opHandle = opcodeTable[CMSG_REORDER_CHARACTERS])
@@ -883,8 +1036,8 @@ int WorldSocket::ProcessIncoming(WorldPacket* new_pct)
             // first 4 bytes become the opcode (2 dropped)
             case MSG_VERIFY_CONNECTIVITY:
             {
-                sLog->outDebug(LOG_FILTER_NETWORKIO, "%s", opcodeName.c_str());
-                sScriptMgr->OnPacketReceive(this, WorldPacket(*new_pct));
+                TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "%s", GetOpcodeNameForLogging(opcode, WOW_CLIENT).c_str());
+                sScriptMgr->OnPacketReceive(this, *new_pct);
                 std::string str;
                 *new_pct >> str;
                 if (str != "D OF WARCRAFT CONNECTION - CLIENT TO SERVER")
@@ -893,8 +1046,8 @@ int WorldSocket::ProcessIncoming(WorldPacket* new_pct)
             }
             /*case CMSG_ENABLE_NAGLE:
             {
-                sLog->outDebug(LOG_FILTER_NETWORKIO, "%s", opcodeName.c_str());
-                sScriptMgr->OnPacketReceive(this, WorldPacket(*new_pct));
+                TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "%s", GetOpcodeNameForLogging(opcode, WOW_CLIENT).c_str());
+                sScriptMgr->OnPacketReceive(this, *new_pct);
                 return m_Session ? m_Session->HandleEnableNagleAlgorithm() : -1;
             }*/
             default:
@@ -933,7 +1086,7 @@ int WorldSocket::ProcessIncoming(WorldPacket* new_pct)
     catch (ByteBufferException &)
     {
         sLog->outError(LOG_FILTER_NETWORKIO, "WorldSocket::ProcessIncoming ByteBufferException occured while parsing an instant handled packet %s from client %s, accountid=%i. Disconnected client.",
-            opcodeName.c_str(), GetRemoteAddress().c_str(), m_Session ? int32(m_Session->GetAccountId()) : -1);
+            GetOpcodeNameForLogging(opcode, WOW_CLIENT).c_str(), GetRemoteAddress().c_str(), m_Session ? int32(m_Session->GetAccountId()) : -1);
         new_pct->hexlike();
         return -1;
     }
@@ -1143,7 +1296,7 @@ int WorldSocket::HandleAuthSession(WorldPacket& recvPacket)
     if (expansion > world_expansion)
         expansion = world_expansion;
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WorldSocket::HandleAuthSession: (s,v) check s: %s v: %s",
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WorldSocket::HandleAuthSession: (s,v) check s: %s v: %s",
         fields[5].GetCString(),
         fields[4].GetCString());
 
@@ -1153,7 +1306,7 @@ int WorldSocket::HandleAuthSession(WorldPacket& recvPacket)
         if (strcmp (fields[2].GetCString(), GetRemoteAddress().c_str()))
         {
             SendAuthResponse(AUTH_FAILED, false, 0);
-            sLog->outDebug(LOG_FILTER_NETWORKIO, "WorldSocket::HandleAuthSession: Sent Auth Response (Account IP differs).");
+            TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WorldSocket::HandleAuthSession: Sent Auth Response (Account IP differs).");
             return -1;
         }
     }
@@ -1238,7 +1391,7 @@ int WorldSocket::HandleAuthSession(WorldPacket& recvPacket)
 
     // Check locked state for server
     AccountTypes allowedAccountType = sWorld->GetPlayerSecurityLimit();
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Allowed Level: %u Player Level %u", allowedAccountType, AccountTypes(security));
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Allowed Level: %u Player Level %u", allowedAccountType, AccountTypes(security));
     if (allowedAccountType > SEC_PLAYER && AccountTypes(security) < allowedAccountType)
     {
         SendAuthResponse(AUTH_UNAVAILABLE, false, 0);
@@ -1271,7 +1424,7 @@ int WorldSocket::HandleAuthSession(WorldPacket& recvPacket)
         return -1;
     }*/
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WorldSocket::HandleAuthSession: Client '%s' authenticated successfully from %s.",
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WorldSocket::HandleAuthSession: Client '%s' authenticated successfully from %s.",
         account.c_str(),
         address.c_str());
 
@@ -34,6 +34,8 @@
 #include <ace/Unbounded_Queue.h>
 #include <ace/Message_Block.h>
 
+#include <deque>
+
 #if !defined (ACE_LACKS_PRAGMA_ONCE)
 #pragma once
 #endif /* ACE_LACKS_PRAGMA_ONCE */
@@ -44,6 +46,7 @@
 class ACE_Message_Block;
 class WorldPacket;
 class WorldSession;
+class SharedWorldPacket;
 
 struct z_stream_s;
 
@@ -85,6 +88,12 @@ typedef ACE_Svc_Handler<ACE_SOCK_STREAM, ACE_NULL_SYNCH> WorldHandler;
  * which is ok for using with Level and Edge Triggered IO
  * notification.
  *
+ * Packets selected for SMSG_COMPRESSED_DATA are not deflated
+ * by the sending thread. They are queued and compressed by the
+ * network thread in Update(), outside of m_OutBufferLock. Every
+ * packet sent after them waits in the same queue, so the client
+ * still receives them in order.
+ *
  */
 class WorldSocket : public WorldHandler
 {
@@ -112,6 +121,10 @@ class WorldSocket : public WorldHandler
         /// @return -1 of failure
         int SendPacket(const WorldPacket* pct);
 
+        /// Send a packet shared with other sockets, the queued header references its payload instead of copying it.
+        /// @return -1 of failure
+        int SendPacket(SharedWorldPacket const& pct);
+
         /// Add reference to this object.
         long AddReference (void);
 
@@ -153,6 +166,21 @@ class WorldSocket : public WorldHandler
         /// Drain the queue if its not empty.
         int handle_output_queue (GuardType& g);
 
+        /// Common part of both SendPacket, shared is NULL for packets owned by the caller.
+        int QueuePacket (WorldPacket const* pct, SharedWorldPacket const* shared);
+
+        /// Put a packet on the output buffer or queue, m_OutBufferLock must be held.
+        int WritePacket (WorldPacket const* pct, SharedWorldPacket const* shared = NULL);
+
+        /// Compress the packets waiting in m_CompressQueue and write them out, called by the network thread.
+        int FlushCompressQueue (void);
+
+        /// True if the packet should be sent as SMSG_COMPRESSED_DATA.
+        bool CanCompress (WorldPacket const* pct) const;
+
+        /// Deflate pct into compressed, returns false if it has to be sent as is.
+        bool CompressPacket (WorldPacket const* pct, WorldPacket& compressed);
+
         /// process one incoming packet.
         /// @param new_pct received packet, note that you need to delete it.
         int ProcessIncoming (WorldPacket* new_pct);
@@ -213,7 +241,18 @@ class WorldSocket : public WorldHandler
 
         uint32 m_Seed;
 
+        /// Only used by the network thread, in FlushCompressQueue().
         z_stream_s* m_zstream;
+
+        /// Packets waiting for the network thread, protected by m_OutBufferLock.
+        std::deque<WorldPacket*> m_CompressQueue;
+
+        /// Packets taken from m_CompressQueue that are not written out yet, protected by m_OutBufferLock.
+        /// FlushCompressQueue() lowers it as it writes, so later packets only wait for the ones really pending.
+        size_t m_CompressingCount;
+
+        /// Serializes FlushCompressQueue() callers.
+        LockType m_CompressLock;
 };
 
 #endif  /* _WORLDSOCKET_H */
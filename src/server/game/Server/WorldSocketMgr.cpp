@@ -45,6 +45,8 @@
 #include "WorldSocket.h"
 #include "WorldSocketAcceptor.h"
 #include "ScriptMgr.h"
+#include "Opcodes.h"
+#include "Util.h"
 
 /**
 * This is a helper class to WorldSocketMgr, that manages
@@ -155,7 +157,7 @@ class ReactorRunnable : protected ACE_Task_Base
 
         virtual int svc()
         {
-            sLog->outDebug(LOG_FILTER_GENERAL, "Network Thread Starting");
+            TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Network Thread Starting");
 
             ACE_ASSERT (m_Reactor);
 
@@ -192,7 +194,7 @@ class ReactorRunnable : protected ACE_Task_Base
                 }
             }
 
-            sLog->outDebug(LOG_FILTER_GENERAL, "Network Thread exits");
+            TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Network Thread exits");
 
             return 0;
         }
@@ -217,7 +219,8 @@ WorldSocketMgr::WorldSocketMgr() :
     m_SockOutKBuff(-1),
     m_SockOutUBuff(65536),
     m_UseNoDelay(true),
-    m_Acceptor (0)
+    m_Acceptor (0),
+    m_CompressionMinSize(0)
 {
 }
 
@@ -244,7 +247,7 @@ WorldSocketMgr::StartReactiveIO (ACE_UINT16 port, const char* address)
 
     m_NetThreads = new ReactorRunnable[m_NetThreadsCount];
 
-    sLog->outDebug(LOG_FILTER_GENERAL, "Max allowed socket connections %d", ACE::max_handles());
+    TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Max allowed socket connections %d", ACE::max_handles());
 
     // -1 means use default
     m_SockOutKBuff = ConfigMgr::GetIntDefault ("Network.OutKBuff", -1);
@@ -257,6 +260,9 @@ WorldSocketMgr::StartReactiveIO (ACE_UINT16 port, const char* address)
         return -1;
     }
 
+    m_CompressionMinSize = uint32(std::max(ConfigMgr::GetIntDefault("Network.Compression.MinSize", 0), 0));
+    LoadCompressionOpcodes();
+
     m_Acceptor = new WorldSocketAcceptor;
 
     ACE_INET_Addr listen_addr (port, address);
@@ -306,6 +312,69 @@ WorldSocketMgr::StopNetwork()
     sScriptMgr->OnNetworkStop();
 }
 
+void
+WorldSocketMgr::LoadCompressionOpcodes()
+{
+    m_CompressedOpcodes.assign(NUM_OPCODE_HANDLERS, false);
+
+    std::string opcodes = ConfigMgr::GetStringDefault("Network.Compression.Opcodes", "SMSG_UPDATE_OBJECT SMSG_INITIAL_SPELLS "
+        "SMSG_ALL_ACHIEVEMENT_DATA SMSG_INIT_WORLD_STATES SMSG_INITIALIZE_FACTIONS SMSG_CHAR_ENUM SMSG_GUILD_ROSTER "
+        "SMSG_AUCTION_LIST_RESULT SMSG_DB_REPLY SMSG_HOTFIX_INFO");
+    Tokenizer tokens(opcodes, ' ');
+    if (tokens.size() == 0)
+    {
+        // no list, everything but the opcodes that were never sent compressed
+        m_CompressedOpcodes.assign(NUM_OPCODE_HANDLERS, true);
+        m_CompressedOpcodes[MSG_VERIFY_CONNECTIVITY] = false;
+        m_CompressedOpcodes[SMSG_MOTD] = false;
+        return;
+    }
+
+    for (Tokenizer::const_iterator itr = tokens.begin(); itr != tokens.end(); ++itr)
+    {
+        if (!**itr)
+            continue;
+
+        bool found = false;
+        for (uint32 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+        {
+            OpcodeHandler const* handler = opcodeTable[WOW_SERVER][opcode];
+            if (handler && strcmp(handler->name, *itr) == 0)
+            {
+                m_CompressedOpcodes[opcode] = true;
+                found = true;
+                break;
+            }
+        }
+
+        if (!found)
+            sLog->outError(LOG_FILTER_GENERAL, "Network.Compression.Opcodes: unknown server opcode %s, skipped", *itr);
+    }
+}
+
+void
+WorldSocketMgr::AddCompressionStats(CompressionStatsMap const& stats)
+{
+    ACE_GUARD(ACE_Thread_Mutex, Guard, m_CompressionStatsLock);
+
+    for (CompressionStatsMap::const_iterator itr = stats.begin(); itr != stats.end(); ++itr)
+    {
+        CompressionStats& total = m_CompressionStats[itr->first];
+        total.packets += itr->second.packets;
+        total.bytesIn += itr->second.bytesIn;
+        total.bytesOut += itr->second.bytesOut;
+        total.time += itr->second.time;
+    }
+}
+
+void
+WorldSocketMgr::GetCompressionStats(CompressionStatsMap& stats)
+{
+    ACE_GUARD(ACE_Thread_Mutex, Guard, m_CompressionStatsLock);
+
+    stats = m_CompressionStats;
+}
+
 void
 WorldSocketMgr::Wait()
 {
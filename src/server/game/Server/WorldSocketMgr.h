@@ -29,6 +29,11 @@
 #include <ace/Singleton.h>
 #include <ace/Thread_Mutex.h>
 
+#include <map>
+#include <vector>
+
+#include "Define.h"
+
 class WorldSocket;
 class ReactorRunnable;
 class ACE_Event_Handler;
@@ -49,11 +54,37 @@ public:
     /// Wait untill all network threads have "joined" .
     void Wait();
 
+    /// SMSG_COMPRESSED_DATA totals of one opcode
+    struct CompressionStats
+    {
+        CompressionStats() : packets(0), bytesIn(0), bytesOut(0), time(0) { }
+
+        uint64 packets;
+        uint64 bytesIn;
+        uint64 bytesOut;
+        uint64 time;                                        // microseconds spent in deflate
+    };
+
+    typedef std::map<uint32, CompressionStats> CompressionStatsMap;
+
+    /// Copy of the compression counters, keyed by opcode.
+    void GetCompressionStats(CompressionStatsMap& stats);
+
+    /// Packets of at least this size are sent compressed, 0 if compression is disabled.
+    uint32 GetCompressionMinSize() const { return m_CompressionMinSize; }
+
 private:
     int OnSocketOpen(WorldSocket* sock);
 
     int StartReactiveIO(ACE_UINT16 port, const char* address);
 
+    void LoadCompressionOpcodes();
+
+    /// Called by the network threads after every batch of compressed packets.
+    void AddCompressionStats(CompressionStatsMap const& stats);
+
+    bool CanCompressOpcode(uint32 opcode) const { return opcode < m_CompressedOpcodes.size() && m_CompressedOpcodes[opcode]; }
+
 private:
     WorldSocketMgr();
     virtual ~WorldSocketMgr();
@@ -66,6 +97,12 @@ private:
     bool m_UseNoDelay;
 
     class WorldSocketAcceptor* m_Acceptor;
+
+    uint32 m_CompressionMinSize;
+    std::vector<bool> m_CompressedOpcodes;                  // indexed by opcode
+
+    CompressionStatsMap m_CompressionStats;
+    ACE_Thread_Mutex m_CompressionStatsLock;
 };
 
 #define sWorldSocketMgr ACE_Singleton<WorldSocketMgr, ACE_Thread_Mutex>::instance()
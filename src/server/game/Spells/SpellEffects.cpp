@@ -283,7 +283,7 @@ pEffect SpellEffects[TOTAL_SPELL_EFFECTS] =
 };
 void Spell::EffectNULL(SpellEffIndex /*effIndex*/)
 {
-      sLog->outDebug(LOG_FILTER_SPELLS_AURAS, "WORLD: Spell Effect DUMMY");
+      TC_LOG_DEBUG(LOG_FILTER_SPELLS_AURAS, "WORLD: Spell Effect DUMMY");
 }
 
 void Spell::EffectUnused(SpellEffIndex /*effIndex*/)
@@ -2213,7 +2213,10 @@ void Spell::EffectSendEvent(SpellEffIndex effIndex)
       }
 
       if (ZoneScript* zoneScript = m_caster->GetZoneScript())
+      {
+            MapRegionSerialGuard guard(m_caster->FindMap());
             zoneScript->ProcessEvent(target, m_spellInfo->Effects[effIndex].MiscValue);
+      }
       else if (InstanceScript* instanceScript = m_caster->GetInstanceScript())    // needed in case Player is the caster
             instanceScript->ProcessEvent(target, m_spellInfo->Effects[effIndex].MiscValue);
 
@@ -3703,8 +3706,12 @@ void Spell::EffectOpenLock(SpellEffIndex effIndex)
             // TODO: Add script for spell 41920 - Filling, becouse server it freze when use this spell
             // handle outdoor pvp object opening, return true if go was registered for handling
             // these objects must have been spawned by outdoorpvp!
-            else if (gameObjTarget->GetGOInfo()->type == GAMEOBJECT_TYPE_GOOBER && sOutdoorPvPMgr->HandleOpenGo(player, gameObjTarget->GetGUID()))
-                  return;
+            else if (gameObjTarget->GetGOInfo()->type == GAMEOBJECT_TYPE_GOOBER)
+            {
+                  MapRegionSerialGuard guard(gameObjTarget->FindMap());
+                  if (sOutdoorPvPMgr->HandleOpenGo(player, gameObjTarget->GetGUID()))
+                        return;
+            }
             lockId = goInfo->GetLockId();
             guid = gameObjTarget->GetGUID();
       }
@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StartupLoader.h"
+#include "Log.h"
+#include "Timer.h"
+#include "Util.h"
+#include "Errors.h"
+
+#include <ace/Guard_T.h>
+
+StartupLoader::StartupLoader() : m_mutex(), m_condition(m_mutex), m_finished(0), m_runTime(0)
+{
+}
+
+StartupLoader::~StartupLoader()
+{
+}
+
+void StartupLoader::AddStep(std::string const& name, std::string const& description, StartupStepFunction const& function,
+    StartupDependencyList const& dependsOn)
+{
+    ASSERT(m_stepIndex.find(name) == m_stepIndex.end());
+
+    uint32 index = uint32(m_steps.size());
+
+    Step step;
+    step.name = name;
+    step.description = description;
+    step.function = function;
+    step.pendingDependencies = 0;
+    step.duration = 0;
+    step.memoryDelta = 0;
+
+    for (StartupDependencyList::const_iterator itr = dependsOn.begin(); itr != dependsOn.end(); ++itr)
+    {
+        std::map<std::string, uint32>::const_iterator dep = m_stepIndex.find(*itr);
+        if (dep == m_stepIndex.end())
+        {
+            sLog->outError(LOG_FILTER_SERVER_LOADING, "Startup step %s depends on %s which is not declared before it", name.c_str(), itr->c_str());
+            ASSERT(false);
+        }
+
+        step.dependsOn.push_back(dep->second);
+        m_steps[dep->second].dependents.push_back(index);
+    }
+
+    m_steps.push_back(step);
+    m_stepIndex[name] = index;
+}
+
+void StartupLoader::RunStep(Step& step)
+{
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "%s", step.description.c_str());
+
+    uint64 memoryBefore = GetResidentMemorySize();
+    uint32 startTime = getMSTime();
+
+    step.function();
+
+    step.duration = GetMSTimeDiffToNow(startTime);
+    step.memoryDelta = int64(GetResidentMemorySize()) - int64(memoryBefore);
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Step %s done in %u ms, resident memory %+d KB", step.name.c_str(), step.duration, int32(step.memoryDelta / 1024));
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
+}
+
+void StartupLoader::Run(uint32 threads)
+{
+    uint32 startTime = getMSTime();
+
+    if (threads <= 1 || m_steps.size() <= 1)
+    {
+        for (std::vector<Step>::iterator itr = m_steps.begin(); itr != m_steps.end(); ++itr)
+            RunStep(*itr);
+    }
+    else
+    {
+        m_finished = 0;
+        m_ready.clear();
+        for (uint32 i = 0; i < m_steps.size(); ++i)
+        {
+            m_steps[i].pendingDependencies = uint32(m_steps[i].dependsOn.size());
+            if (!m_steps[i].pendingDependencies)
+                m_ready.insert(i);
+        }
+
+        if (activate(THR_NEW_LWP | THR_JOINABLE | THR_INHERIT_SCHED, int(threads)) == -1)
+        {
+            sLog->outError(LOG_FILTER_SERVER_LOADING, "Could not start %u startup loader threads, loading sequentially", threads);
+            for (std::vector<Step>::iterator itr = m_steps.begin(); itr != m_steps.end(); ++itr)
+                RunStep(*itr);
+        }
+        else
+            ACE_Task_Base::wait();
+    }
+
+    m_runTime = GetMSTimeDiffToNow(startTime);
+
+    // steps running side by side share the database connections, their own durations grow with the thread count
+    uint64 stepTime = 0;
+    for (std::vector<Step>::const_iterator itr = m_steps.begin(); itr != m_steps.end(); ++itr)
+        stepTime += itr->duration;
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded %u startup steps in %u ms using %u thread(s), " UI64FMTD " ms of step time",
+        uint32(m_steps.size()), m_runTime, threads > 1 ? threads : 1, stepTime);
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
+}
+
+int StartupLoader::svc()
+{
+    for (;;)
+    {
+        uint32 index;
+
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, m_mutex);
+
+            while (m_ready.empty() && m_finished < m_steps.size())
+                m_condition.wait();
+
+            if (m_ready.empty())
+                return 0;
+
+            index = *m_ready.begin();
+            m_ready.erase(m_ready.begin());
+        }
+
+        RunStep(m_steps[index]);
+
+        TRINITY_GUARD(ACE_Thread_Mutex, m_mutex);
+
+        ++m_finished;
+        std::vector<uint32> const& dependents = m_steps[index].dependents;
+        for (std::vector<uint32>::const_iterator itr = dependents.begin(); itr != dependents.end(); ++itr)
+            if (--m_steps[*itr].pendingDependencies == 0)
+                m_ready.insert(*itr);
+
+        m_condition.broadcast();
+    }
+
+    return 0;
+}
+
+void StartupLoader::PrintCriticalPath() const
+{
+    if (m_steps.empty())
+        return;
+
+    // Steps are declared after their dependencies, so one pass in declaration order is enough
+    std::vector<uint32> pathTime(m_steps.size(), 0);
+    std::vector<int32> previous(m_steps.size(), -1);
+    uint32 last = 0;
+
+    for (uint32 i = 0; i < m_steps.size(); ++i)
+    {
+        for (std::vector<uint32>::const_iterator itr = m_steps[i].dependsOn.begin(); itr != m_steps[i].dependsOn.end(); ++itr)
+        {
+            if (previous[i] < 0 || pathTime[*itr] > pathTime[previous[i]])
+                previous[i] = int32(*itr);
+        }
+
+        pathTime[i] = m_steps[i].duration + (previous[i] < 0 ? 0 : pathTime[previous[i]]);
+        if (pathTime[i] > pathTime[last])
+            last = i;
+    }
+
+    std::vector<uint32> path;
+    for (int32 i = int32(last); i >= 0; i = previous[i])
+        path.push_back(uint32(i));
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Startup critical path: %u ms over %u of %u steps, loading took %u ms",
+        pathTime[last], uint32(path.size()), uint32(m_steps.size()), m_runTime);
+
+    for (std::vector<uint32>::reverse_iterator itr = path.rbegin(); itr != path.rend(); ++itr)
+    {
+        Step const& step = m_steps[*itr];
+        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "    %-32s %6u ms %+8d KB", step.name.c_str(), step.duration, int32(step.memoryDelta / 1024));
+    }
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_STARTUPLOADER_H
+#define TRINITY_STARTUPLOADER_H
+
+#include <ace/Task.h>
+#include <ace/Thread_Mutex.h>
+#include <ace/Condition_Thread_Mutex.h>
+
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Define.h"
+
+typedef std::function<void()> StartupStepFunction;
+typedef std::vector<std::string> StartupDependencyList;
+
+// Runs the world data loaders as a graph of named steps. A step may only
+// depend on steps declared before it, so the declaration order is always a
+// valid sequential order; with more than one thread every step whose
+// dependencies are done is handed to an idle worker. Each step records how
+// long it took and how much the resident memory grew while it ran.
+class StartupLoader : protected ACE_Task_Base
+{
+    public:
+
+        StartupLoader();
+        virtual ~StartupLoader();
+
+        void AddStep(std::string const& name, std::string const& description, StartupStepFunction const& function,
+            StartupDependencyList const& dependsOn = StartupDependencyList());
+
+        // Runs all steps and returns once the last one is done, threads <= 1 runs them in declaration order
+        void Run(uint32 threads);
+
+        // Logs the chain of dependent steps with the longest measured duration
+        void PrintCriticalPath() const;
+
+        uint32 GetStepCount() const { return uint32(m_steps.size()); }
+
+        virtual int svc();
+
+    private:
+
+        struct Step
+        {
+            std::string name;
+            std::string description;
+            StartupStepFunction function;
+            std::vector<uint32> dependsOn;
+            std::vector<uint32> dependents;
+            uint32 pendingDependencies;
+            uint32 duration;                                // milliseconds
+            int64 memoryDelta;                              // bytes, process wide
+        };
+
+        void RunStep(Step& step);
+
+        std::vector<Step> m_steps;
+        std::map<std::string, uint32> m_stepIndex;
+
+        ACE_Thread_Mutex m_mutex;
+        ACE_Condition_Thread_Mutex m_condition;             // signalled when a step becomes ready or the last step is done
+        std::set<uint32> m_ready;                           // lowest index first, keeps the declared order when possible
+        uint32 m_finished;
+        uint32 m_runTime;
+};
+
+#endif
@@ -34,6 +34,7 @@
 #include "SkillExtraItems.h"
 #include "SkillDiscovery.h"
 #include "World.h"
+#include "StartupLoader.h"
 #include "AccountMgr.h"
 #include "AchievementMgr.h"
 #include "AuctionHouseMgr.h"
@@ -55,6 +56,7 @@
 #include "TemporarySummon.h"
 #include "WaypointMovementGenerator.h"
 #include "VMapFactory.h"
+#include "NavMapManager.h"
 #include "GameEventMgr.h"
 #include "PoolMgr.h"
 #include "GridNotifiersImpl.h"
@@ -120,6 +122,9 @@ World::World()
 
     m_updateTimeSum = 0;
     m_updateTimeCount = 0;
+    m_synchQueries = 0;
+    m_synchQueriesLastTick = 0;
+    m_synchQueriesMaxTick = 0;
 
     m_isClosed = false;
 
@@ -145,6 +150,7 @@ World::~World()
         delete command;
 
     VMAP::VMapFactory::clear();
+    NAV::NavMapFactory::clear();
 
     //TODO free addSessQueue
 }
@@ -629,6 +635,8 @@ void World::LoadConfigSettings(bool reload)
     m_bool_configs[CONFIG_PRESERVE_CUSTOM_CHANNELS] = ConfigMgr::GetBoolDefault("PreserveCustomChannels", false);
     m_int_configs[CONFIG_PRESERVE_CUSTOM_CHANNEL_DURATION] = ConfigMgr::GetIntDefault("PreserveCustomChannelDuration", 14);
     m_bool_configs[CONFIG_GRID_UNLOAD] = ConfigMgr::GetBoolDefault("GridUnload", true);
+    m_bool_configs[CONFIG_GRID_MAP_MEMORY_MAPPED] = ConfigMgr::GetBoolDefault("GridMap.MemoryMapped", true);
+    m_bool_configs[CONFIG_MAP_QUERY_CACHE] = ConfigMgr::GetBoolDefault("Map.QueryCache", true);
     m_int_configs[CONFIG_INTERVAL_SAVE] = ConfigMgr::GetIntDefault("PlayerSaveInterval", 15 * MINUTE * IN_MILLISECONDS);
     m_int_configs[CONFIG_INTERVAL_DISCONNECT_TOLERANCE] = ConfigMgr::GetIntDefault("DisconnectToleranceInterval", 0);
     m_bool_configs[CONFIG_STATS_SAVE_ONLY_ON_LOGOUT] = ConfigMgr::GetBoolDefault("PlayerSave.Stats.SaveOnlyOnLogout", true);
@@ -1221,6 +1229,16 @@ void World::LoadConfigSettings(bool reload)
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "VMap support included. LineOfSight:%i, getHeight:%i, indoorCheck:%i PetLOS:%i", enableLOS, enableHeight, enableIndoor, enablePetLOS);
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "VMap data directory is: %svmaps", m_dataPath.c_str());
 
+    m_bool_configs[CONFIG_ENABLE_PATHFINDING] = ConfigMgr::GetBoolDefault("nav.enablePathFinding", true);
+    m_int_configs[CONFIG_PATHFINDING_MAX_NODES] = ConfigMgr::GetIntDefault("nav.maxSearchNodes", 4096);
+    if (m_int_configs[CONFIG_PATHFINDING_MAX_NODES] < 64)
+    {
+        sLog->outError(LOG_FILTER_SERVER_LOADING, "nav.maxSearchNodes (%u) must be at least 64. Using 64 instead.", m_int_configs[CONFIG_PATHFINDING_MAX_NODES]);
+        m_int_configs[CONFIG_PATHFINDING_MAX_NODES] = 64;
+    }
+    NAV::NavMapFactory::createOrGetNavMapManager()->Initialize(m_dataPath + "nav/");
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Pathfinding %s, navigation data directory is: %snav", m_bool_configs[CONFIG_ENABLE_PATHFINDING] ? "enabled" : "disabled", m_dataPath.c_str());
+
     m_int_configs[CONFIG_MAX_WHO] = ConfigMgr::GetIntDefault("MaxWhoListReturns", 49);
     m_bool_configs[CONFIG_LIMIT_WHO_ONLINE] = ConfigMgr::GetBoolDefault("LimitWhoOnline", true);
     m_bool_configs[CONFIG_PET_LOS] = ConfigMgr::GetBoolDefault("vmap.petLOS", true);
@@ -1242,7 +1260,18 @@ void World::LoadConfigSettings(bool reload)
     m_bool_configs[CONFIG_SHOW_KICK_IN_WORLD] = ConfigMgr::GetBoolDefault("ShowKickInWorld", false);
     m_int_configs[CONFIG_INTERVAL_LOG_UPDATE] = ConfigMgr::GetIntDefault("RecordUpdateTimeDiffInterval", 60000);
     m_int_configs[CONFIG_MIN_LOG_UPDATE] = ConfigMgr::GetIntDefault("MinRecordUpdateTimeDiff", 100);
+    m_int_configs[CONFIG_SYNCH_QUERY_LOG_THRESHOLD] = ConfigMgr::GetIntDefault("SynchQueryLogThreshold", 10);
     m_int_configs[CONFIG_NUMTHREADS] = ConfigMgr::GetIntDefault("MapUpdate.Threads", 1);
+    m_bool_configs[CONFIG_MAPUPDATE_REGION_SPLIT] = ConfigMgr::GetBoolDefault("MapUpdate.RegionSplit.Enabled", false);
+    m_int_configs[CONFIG_MAPUPDATE_REGION_MIN_PLAYERS] = ConfigMgr::GetIntDefault("MapUpdate.RegionSplit.MinPlayers", 200);
+    m_float_configs[CONFIG_MAPUPDATE_REGION_MARGIN] = ConfigMgr::GetFloatDefault("MapUpdate.RegionSplit.Margin", 250.0f);
+    if (m_float_configs[CONFIG_MAPUPDATE_REGION_MARGIN] < m_MaxVisibleDistanceOnContinents)
+    {
+        sLog->outError(LOG_FILTER_SERVER_LOADING, "MapUpdate.RegionSplit.Margin (%f) must be at least the continent visibility distance (%f). Use this minimal value.", m_float_configs[CONFIG_MAPUPDATE_REGION_MARGIN], m_MaxVisibleDistanceOnContinents);
+        m_float_configs[CONFIG_MAPUPDATE_REGION_MARGIN] = m_MaxVisibleDistanceOnContinents;
+    }
+    m_int_configs[CONFIG_STARTUP_LOAD_THREADS] = ConfigMgr::GetIntDefault("Startup.LoadThreads", 1);
+    m_bool_configs[CONFIG_STARTUP_PRINT_CRITICAL_PATH] = ConfigMgr::GetBoolDefault("Startup.PrintCriticalPath", false);
     m_int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] = ConfigMgr::GetIntDefault("Command.LookupMaxResults", 0);
 
     // chat logging
@@ -1441,508 +1470,303 @@ void World::SetInitialWorldSettings()
     LoadDBCStores(m_dataPath);
     LoadDB2Stores(m_dataPath);
     DetectDBCLang();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading SpellInfo store...");
-    sSpellMgr->LoadSpellInfoStore();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading TalentSpellInfo store....");
-    sSpellMgr->LoadTalentSpellInfo();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading SpellPowerInfo store....");
-    sSpellMgr->LoadSpellPowerInfo();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading SkillLineAbilityMultiMap Data...");
-    sSpellMgr->LoadSkillLineAbilityMap();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading spell custom attributes...");
-    sSpellMgr->LoadSpellCustomAttr();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Research Site Zones...");
-    sObjectMgr->LoadResearchSiteZones();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Research Site Loot...");
-    sObjectMgr->LoadResearchSiteLoot();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading GameObject models...");
-    LoadGameObjectModelList();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Script Names...");
-    sObjectMgr->LoadScriptNames();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Instance Template...");
-    sObjectMgr->LoadInstanceTemplate();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    // Must be called before `creature_respawn`/`gameobject_respawn` tables
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading instances...");
-    sInstanceSaveMgr->LoadInstances();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Localization strings...");
-    uint32 oldMSTime = getMSTime();
-    sObjectMgr->LoadCreatureLocales();
-    sObjectMgr->LoadGameObjectLocales();
-    sObjectMgr->LoadItemLocales();
-    sObjectMgr->LoadQuestLocales();
-    sObjectMgr->LoadNpcTextLocales();
-    sObjectMgr->LoadPageTextLocales();
-    sObjectMgr->LoadGossipMenuItemsLocales();
-    sObjectMgr->LoadPointOfInterestLocales();
-
     sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Localization strings loaded in %u ms", GetMSTimeDiffToNow(oldMSTime));
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Page Texts...");
-    sObjectMgr->LoadPageTexts();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Game Object Templates...");         // must be after LoadPageTexts
-    sObjectMgr->LoadGameObjectTemplate();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Rank Data...");
-    sSpellMgr->LoadSpellRanks();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Required Data...");
-    sSpellMgr->LoadSpellRequired();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Group types...");
-    sSpellMgr->LoadSpellGroups();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Learn Skills...");
-    sSpellMgr->LoadSpellLearnSkills();                           // must be after LoadSpellRanks
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Learn Spells...");
-    sSpellMgr->LoadSpellLearnSpells();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Proc Event conditions...");
-    sSpellMgr->LoadSpellProcEvents();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Proc conditions and data...");
-    sSpellMgr->LoadSpellProcs();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Bonus Data...");
-    sSpellMgr->LoadSpellBonusess();
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Aggro Spells Definitions...");
-    sSpellMgr->LoadSpellThreats();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Group Stack Rules...");
-    sSpellMgr->LoadSpellGroupStackRules();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading forbidden spells...");
-    sSpellMgr->LoadForbiddenSpells();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Phase Dbc Info...");
-    sObjectMgr->LoadSpellPhaseInfo();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading NPC Texts...");
-    sObjectMgr->LoadGossipText();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Enchant Spells Proc datas...");
-    sSpellMgr->LoadSpellEnchantProcData();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Item Random Enchantments Table...");
-    LoadRandomEnchantmentsTable();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Disables");
-    DisableMgr::LoadDisables();                                 // must be before loading quests and items
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Items...");                         // must be after LoadRandomEnchantmentsTable and LoadPageTexts
-    sObjectMgr->LoadItemTemplates();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Item set names...");                // must be after LoadItemPrototypes
-    sObjectMgr->LoadItemTemplateAddon();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_GENERAL, "Loading Item Scripts...");                 // must be after LoadItemPrototypes
-    sObjectMgr->LoadItemScriptNames();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Model Based Info Data...");
-    sObjectMgr->LoadCreatureModelInfo();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Equipment templates...");
-    sObjectMgr->LoadEquipmentTemplates();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature templates...");
-    sObjectMgr->LoadCreatureTemplates();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature template addons...");
-    sObjectMgr->LoadCreatureTemplateAddons();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Reputation Reward Rates...");
-    sObjectMgr->LoadReputationRewardRate();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Currency Loot Templates...");
-    sObjectMgr->LoadCurrencyOnKill();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Reputation OnKill Data...");
-    sObjectMgr->LoadReputationOnKill();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Reputation Spillover Data...");
-    sObjectMgr->LoadReputationSpilloverTemplate();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Points Of Interest Data...");
-    sObjectMgr->LoadPointsOfInterest();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Base Stats...");
-    sObjectMgr->LoadCreatureClassLevelStats();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Restructuring Creatures GUIDs...");
-    sObjectMgr->RestructCreatureGUID(10000);
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Data...");
-    sObjectMgr->LoadCreatures();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Temporary Summon Data...");
-    sObjectMgr->LoadTempSummons();                               // must be after LoadCreatureTemplates() and LoadGameObjectTemplates()
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading pet levelup spells...");
-    sSpellMgr->LoadPetLevelupSpellMap();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading pet default spells additional to levelup spells...");
-    sSpellMgr->LoadPetDefaultSpells();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Addon Data...");
-    sObjectMgr->LoadCreatureAddons();                            // must be after LoadCreatureTemplates() and LoadCreatures()
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Restructuring Gameobjects GUIDs...");
-    sObjectMgr->RestructGameObjectGUID(10000);
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Gameobject Data...");
-    sObjectMgr->LoadGameobjects();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Linked Respawn...");
-    sObjectMgr->LoadLinkedRespawn();                             // must be after LoadCreatures(), LoadGameObjects()
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Weather Data...");
-    WeatherMgr::LoadWeatherData();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Quests...");
-    sObjectMgr->LoadQuests();                                    // must be loaded after DBCs, creature_template, item_template, gameobject tables
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Checking Quest Disables");
-    DisableMgr::CheckQuestDisables();                           // must be after loading quests
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Quest POI");
-    sObjectMgr->LoadQuestPOI();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Quests Relations...");
-    sObjectMgr->LoadQuestRelations();                            // must be after quest load
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Objects Pooling Data...");
-    sPoolMgr->LoadFromDB();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Game Event Data...");               // must be after loading pools fully
-    sGameEventMgr->LoadFromDB();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading UNIT_NPC_FLAG_SPELLCLICK Data..."); // must be after LoadQuests
-    sObjectMgr->LoadNPCSpellClickSpells();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Vehicle Template Accessories...");
-    sObjectMgr->LoadVehicleTemplateAccessories();                // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Vehicle Accessories...");
-    sObjectMgr->LoadVehicleAccessories();                       // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Dungeon boss data...");
-    sObjectMgr->LoadInstanceEncounters();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading LFG rewards...");
-    sLFGMgr->LoadRewards();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading LFG entrance positions...");
-    sLFGMgr->LoadEntrancePositions();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading SpellArea Data...");                // must be after quest load
-    sSpellMgr->LoadSpellAreas();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Classes Info...");
-    sSpellMgr->LoadSpellClassInfo();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading AreaTrigger definitions...");
-    sObjectMgr->LoadAreaTriggerTeleports();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Access Requirements...");
-    sObjectMgr->LoadAccessRequirements();                        // must be after item template load
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Quest Area Triggers...");
-    sObjectMgr->LoadQuestAreaTriggers();                         // must be after LoadQuests
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Tavern Area Triggers...");
-    sObjectMgr->LoadTavernAreaTriggers();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading AreaTrigger script names...");
-    sObjectMgr->LoadAreaTriggerScripts();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Graveyard-zone links...");
-    sObjectMgr->LoadGraveyardZones();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading spell pet auras...");
-    sSpellMgr->LoadSpellPetAuras();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell target coordinates...");
-    sSpellMgr->LoadSpellTargetPositions();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading enchant custom attributes...");
-    sSpellMgr->LoadEnchantCustomAttr();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading linked spells...");
-    sSpellMgr->LoadSpellLinked();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Player Create Data...");
-    sObjectMgr->LoadPlayerInfo();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Exploration BaseXP Data...");
-    sObjectMgr->LoadExplorationBaseXP();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Pet Name Parts...");
-    sObjectMgr->LoadPetNames();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    CharacterDatabaseCleaner::CleanDatabase();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading the max pet number...");
-    sObjectMgr->LoadPetNumber();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading pet level stats...");
-    sObjectMgr->LoadPetLevelInfo();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Player Corpses...");
-    sObjectMgr->LoadCorpses();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Player level dependent mail rewards...");
-    sObjectMgr->LoadMailLevelRewards();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    // Loot tables
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading loot tables...");
-    LoadLootTables();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Skill Discovery Table...");
-    LoadSkillDiscoveryTable();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Skill Extra Item Table...");
-    LoadSkillExtraItemTable();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Skill Fishing base level requirements...");
-    sObjectMgr->LoadFishingBaseSkillLevel();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievements...");
-    sAchievementMgr->LoadAchievementReferenceList();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievement Criteria Lists...");
-    sAchievementMgr->LoadAchievementCriteriaList();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievement Criteria Data...");
-    sAchievementMgr->LoadAchievementCriteriaData();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievement Rewards...");
-    sAchievementMgr->LoadRewards();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievement Reward Locales...");
-    sAchievementMgr->LoadRewardLocales();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Completed Achievements...");
-    sAchievementMgr->LoadCompletedAchievements();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    // Delete expired auctions before loading
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Deleting expired auctions...");
-    sAuctionMgr->DeleteExpiredAuctionsAtStartup();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    ///- Load dynamic data tables from the database
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Item Auctions...");
-    sAuctionMgr->LoadAuctionItems();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Auctions...");
-    sAuctionMgr->LoadAuctions();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Guild XP for level...");
-    sGuildMgr->LoadGuildXpForLevel();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Guild rewards...");
-    sGuildMgr->LoadGuildRewards();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Guilds...");
-    sGuildMgr->LoadGuilds();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Guild Finder...");
-    sGuildFinderMgr->LoadFromDB();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Groups...");
-    sGroupMgr->LoadGroups();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading ReservedNames...");
-    sObjectMgr->LoadReservedPlayersNames();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading GameObjects for quests...");
-    sObjectMgr->LoadGameObjectForQuests();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading BattleMasters...");
-    sBattlegroundMgr->LoadBattleMastersEntry();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading GameTeleports...");
-    sObjectMgr->LoadGameTele();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Gossip menu...");
-    sObjectMgr->LoadGossipMenu();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Gossip menu options...");
-    sObjectMgr->LoadGossipMenuItems();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Vendors...");
-    sObjectMgr->LoadVendors();                                   // must be after load CreatureTemplate and ItemTemplate
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Trainers...");
-    sObjectMgr->LoadTrainerSpell();                              // must be after load CreatureTemplate
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Waypoints...");
-    sWaypointMgr->Load();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading SmartAI Waypoints...");
-    sSmartWaypointMgr->LoadFromDB();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Formations...");
-    sFormationMgr->LoadCreatureFormations();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading World States...");              // must be loaded before battleground, outdoor PvP and conditions
-    LoadWorldStates();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Phase definitions...");
-    sObjectMgr->LoadPhaseDefinitions();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Conditions...");
-    sConditionMgr->LoadConditions();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change achievement pairs...");
-    sObjectMgr->LoadFactionChangeAchievements();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change spell pairs...");
-    sObjectMgr->LoadFactionChangeSpells();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change item pairs...");
-    sObjectMgr->LoadFactionChangeItems();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change reputation pairs...");
-    sObjectMgr->LoadFactionChangeReputations();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change title pairs...");
-    sObjectMgr->LoadFactionChangeTitles();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
+    ///- Load the world data as a graph of startup steps, independent steps run in parallel when Startup.LoadThreads > 1
+    StartupLoader loader;
+
+    loader.AddStep("SpellInfoStore", "Loading SpellInfo store...",
+        []() { sSpellMgr->LoadSpellInfoStore(); });
+    loader.AddStep("TalentSpellInfo", "Loading TalentSpellInfo store....",
+        []() { sSpellMgr->LoadTalentSpellInfo(); });
+    loader.AddStep("SpellPowerInfo", "Loading SpellPowerInfo store....",
+        []() { sSpellMgr->LoadSpellPowerInfo(); });
+    loader.AddStep("SkillLineAbilityMap", "Loading SkillLineAbilityMultiMap Data...",
+        []() { sSpellMgr->LoadSkillLineAbilityMap(); });
+    loader.AddStep("SpellCustomAttr", "Loading spell custom attributes...",
+        []() { sSpellMgr->LoadSpellCustomAttr(); }, { "SpellInfoStore", "SkillLineAbilityMap" });
+    loader.AddStep("ResearchSiteZones", "Loading Research Site Zones...",
+        []() { sObjectMgr->LoadResearchSiteZones(); });
+    loader.AddStep("ResearchSiteLoot", "Loading Research Site Loot...",
+        []() { sObjectMgr->LoadResearchSiteLoot(); });
+    loader.AddStep("GameObjectModelList", "Loading GameObject models...",
+        []() { LoadGameObjectModelList(); });
+    loader.AddStep("ScriptNames", "Loading Script Names...",
+        []() { sObjectMgr->LoadScriptNames(); });
+    loader.AddStep("InstanceTemplate", "Loading Instance Template...",
+        []() { sObjectMgr->LoadInstanceTemplate(); }, { "ScriptNames" });
+    loader.AddStep("Instances", "Loading instances...",
+        []() { sInstanceSaveMgr->LoadInstances(); });
+    loader.AddStep("CreatureLocales", "Loading Creature Locales...",
+        []() { sObjectMgr->LoadCreatureLocales(); });
+    loader.AddStep("GameObjectLocales", "Loading Game Object Locales...",
+        []() { sObjectMgr->LoadGameObjectLocales(); });
+    loader.AddStep("ItemLocales", "Loading Item Locales...",
+        []() { sObjectMgr->LoadItemLocales(); });
+    loader.AddStep("QuestLocales", "Loading Quest Locales...",
+        []() { sObjectMgr->LoadQuestLocales(); });
+    loader.AddStep("NpcTextLocales", "Loading NPC Text Locales...",
+        []() { sObjectMgr->LoadNpcTextLocales(); });
+    loader.AddStep("PageTextLocales", "Loading Page Text Locales...",
+        []() { sObjectMgr->LoadPageTextLocales(); });
+    loader.AddStep("GossipMenuItemsLocales", "Loading Gossip Menu Items Locales...",
+        []() { sObjectMgr->LoadGossipMenuItemsLocales(); });
+    loader.AddStep("PointOfInterestLocales", "Loading Point Of Interest Locales...",
+        []() { sObjectMgr->LoadPointOfInterestLocales(); });
+    loader.AddStep("PageTexts", "Loading Page Texts...",
+        []() { sObjectMgr->LoadPageTexts(); });
+    // must be after LoadPageTexts
+    loader.AddStep("GameObjectTemplate", "Loading Game Object Templates...",
+        []() { sObjectMgr->LoadGameObjectTemplate(); }, { "SpellCustomAttr", "InstanceTemplate", "PageTexts" });
+    loader.AddStep("SpellRanks", "Loading Spell Rank Data...",
+        []() { sSpellMgr->LoadSpellRanks(); }, { "GameObjectTemplate" });
+    loader.AddStep("SpellRequired", "Loading Spell Required Data...",
+        []() { sSpellMgr->LoadSpellRequired(); }, { "SpellRanks" });
+    loader.AddStep("SpellGroups", "Loading Spell Group types...",
+        []() { sSpellMgr->LoadSpellGroups(); }, { "SpellRequired" });
+    // must be after LoadSpellRanks
+    loader.AddStep("SpellLearnSkills", "Loading Spell Learn Skills...",
+        []() { sSpellMgr->LoadSpellLearnSkills(); }, { "SpellGroups" });
+    loader.AddStep("SpellLearnSpells", "Loading Spell Learn Spells...",
+        []() { sSpellMgr->LoadSpellLearnSpells(); }, { "SpellLearnSkills" });
+    loader.AddStep("SpellProcEvents", "Loading Spell Proc Event conditions...",
+        []() { sSpellMgr->LoadSpellProcEvents(); }, { "SpellLearnSpells" });
+    loader.AddStep("SpellProcs", "Loading Spell Proc conditions and data...",
+        []() { sSpellMgr->LoadSpellProcs(); }, { "SpellProcEvents" });
+    loader.AddStep("SpellBonusess", "Loading Spell Bonus Data...",
+        []() { sSpellMgr->LoadSpellBonusess(); }, { "SpellProcs" });
+    loader.AddStep("SpellThreats", "Loading Aggro Spells Definitions...",
+        []() { sSpellMgr->LoadSpellThreats(); }, { "SpellBonusess" });
+    loader.AddStep("SpellGroupStackRules", "Loading Spell Group Stack Rules...",
+        []() { sSpellMgr->LoadSpellGroupStackRules(); }, { "SpellGroups" });
+    loader.AddStep("ForbiddenSpells", "Loading forbidden spells...",
+        []() { sSpellMgr->LoadForbiddenSpells(); });
+    loader.AddStep("SpellPhaseInfo", "Loading Spell Phase Dbc Info...",
+        []() { sObjectMgr->LoadSpellPhaseInfo(); }, { "SpellThreats" });
+    loader.AddStep("GossipText", "Loading NPC Texts...",
+        []() { sObjectMgr->LoadGossipText(); });
+    loader.AddStep("SpellEnchantProcData", "Loading Enchant Spells Proc datas...",
+        []() { sSpellMgr->LoadSpellEnchantProcData(); });
+    loader.AddStep("RandomEnchantmentsTable", "Loading Item Random Enchantments Table...",
+        []() { LoadRandomEnchantmentsTable(); });
+    // must be before loading quests and items
+    loader.AddStep("Disables", "Loading Disables",
+        []() { DisableMgr::LoadDisables(); }, { "Instances", "SpellPhaseInfo" });
+    // must be after LoadRandomEnchantmentsTable and LoadPageTexts
+    loader.AddStep("ItemTemplates", "Loading Items...",
+        []() { sObjectMgr->LoadItemTemplates(); }, { "RandomEnchantmentsTable", "Disables" });
+    // must be after LoadItemPrototypes
+    loader.AddStep("ItemTemplateAddon", "Loading Item set names...",
+        []() { sObjectMgr->LoadItemTemplateAddon(); }, { "ItemTemplates" });
+    // must be after LoadItemPrototypes
+    loader.AddStep("ItemScriptNames", "Loading Item Scripts...",
+        []() { sObjectMgr->LoadItemScriptNames(); }, { "ItemTemplateAddon" });
+    loader.AddStep("CreatureModelInfo", "Loading Creature Model Based Info Data...",
+        []() { sObjectMgr->LoadCreatureModelInfo(); });
+    loader.AddStep("EquipmentTemplates", "Loading Equipment templates...",
+        []() { sObjectMgr->LoadEquipmentTemplates(); });
+    loader.AddStep("CreatureTemplates", "Loading Creature templates...",
+        []() { sObjectMgr->LoadCreatureTemplates(); }, { "ItemScriptNames", "CreatureModelInfo", "EquipmentTemplates" });
+    loader.AddStep("CreatureTemplateAddons", "Loading Creature template addons...",
+        []() { sObjectMgr->LoadCreatureTemplateAddons(); }, { "CreatureTemplates" });
+    loader.AddStep("ReputationRewardRate", "Loading Reputation Reward Rates...",
+        []() { sObjectMgr->LoadReputationRewardRate(); });
+    loader.AddStep("CurrencyOnKill", "Loading Currency Loot Templates...",
+        []() { sObjectMgr->LoadCurrencyOnKill(); }, { "CreatureTemplateAddons" });
+    loader.AddStep("ReputationOnKill", "Loading Creature Reputation OnKill Data...",
+        []() { sObjectMgr->LoadReputationOnKill(); }, { "CurrencyOnKill" });
+    loader.AddStep("ReputationSpilloverTemplate", "Loading Reputation Spillover Data...",
+        []() { sObjectMgr->LoadReputationSpilloverTemplate(); });
+    loader.AddStep("PointsOfInterest", "Loading Points Of Interest Data...",
+        []() { sObjectMgr->LoadPointsOfInterest(); });
+    loader.AddStep("CreatureClassLevelStats", "Loading Creature Base Stats...",
+        []() { sObjectMgr->LoadCreatureClassLevelStats(); }, { "ReputationOnKill" });
+    loader.AddStep("RestructCreatureGUID", "Restructuring Creatures GUIDs...",
+        []() { sObjectMgr->RestructCreatureGUID(10000); });
+    loader.AddStep("Creatures", "Loading Creature Data...",
+        []() { sObjectMgr->LoadCreatures(); }, { "CreatureClassLevelStats", "RestructCreatureGUID" });
+    // must be after LoadCreatureTemplates() and LoadGameObjectTemplates()
+    loader.AddStep("TempSummons", "Loading Temporary Summon Data...",
+        []() { sObjectMgr->LoadTempSummons(); }, { "Creatures" });
+    loader.AddStep("PetLevelupSpellMap", "Loading pet levelup spells...",
+        []() { sSpellMgr->LoadPetLevelupSpellMap(); }, { "CreatureTemplateAddons" });
+    loader.AddStep("PetDefaultSpells", "Loading pet default spells additional to levelup spells...",
+        []() { sSpellMgr->LoadPetDefaultSpells(); }, { "TempSummons", "PetLevelupSpellMap" });
+    // must be after LoadCreatureTemplates() and LoadCreatures()
+    loader.AddStep("CreatureAddons", "Loading Creature Addon Data...",
+        []() { sObjectMgr->LoadCreatureAddons(); }, { "PetDefaultSpells" });
+    loader.AddStep("RestructGameObjectGUID", "Restructuring Gameobjects GUIDs...",
+        []() { sObjectMgr->RestructGameObjectGUID(10000); }, { "Creatures" });
+    loader.AddStep("Gameobjects", "Loading Gameobject Data...",
+        []() { sObjectMgr->LoadGameobjects(); }, { "TempSummons", "RestructGameObjectGUID" });
+    // must be after LoadCreatures(), LoadGameObjects()
+    loader.AddStep("LinkedRespawn", "Loading Creature Linked Respawn...",
+        []() { sObjectMgr->LoadLinkedRespawn(); }, { "CreatureAddons", "Gameobjects" });
+    loader.AddStep("WeatherData", "Loading Weather Data...",
+        []() { WeatherMgr::LoadWeatherData(); }, { "CreatureTemplates" });
+    // must be loaded after DBCs, creature_template, item_template, gameobject tables
+    loader.AddStep("Quests", "Loading Quests...",
+        []() { sObjectMgr->LoadQuests(); }, { "CreatureAddons", "Gameobjects" });
+    // must be after loading quests
+    loader.AddStep("CheckQuestDisables", "Checking Quest Disables",
+        []() { DisableMgr::CheckQuestDisables(); }, { "Quests" });
+    loader.AddStep("QuestPOI", "Loading Quest POI",
+        []() { sObjectMgr->LoadQuestPOI(); });
+    // must be after quest load
+    loader.AddStep("QuestRelations", "Loading Quests Relations...",
+        []() { sObjectMgr->LoadQuestRelations(); }, { "CheckQuestDisables" });
+    loader.AddStep("Pools", "Loading Objects Pooling Data...",
+        []() { sPoolMgr->LoadFromDB(); }, { "LinkedRespawn", "QuestRelations" });
+    // must be after loading pools fully
+    loader.AddStep("GameEvents", "Loading Game Event Data...",
+        []() { sGameEventMgr->LoadFromDB(); }, { "Pools" });
+    // must be after LoadQuests
+    loader.AddStep("NPCSpellClickSpells", "Loading UNIT_NPC_FLAG_SPELLCLICK Data...",
+        []() { sObjectMgr->LoadNPCSpellClickSpells(); }, { "GameEvents" });
+    // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
+    loader.AddStep("VehicleTemplateAccessories", "Loading Vehicle Template Accessories...",
+        []() { sObjectMgr->LoadVehicleTemplateAccessories(); }, { "NPCSpellClickSpells" });
+    // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
+    loader.AddStep("VehicleAccessories", "Loading Vehicle Accessories...",
+        []() { sObjectMgr->LoadVehicleAccessories(); }, { "VehicleTemplateAccessories" });
+    loader.AddStep("InstanceEncounters", "Loading Dungeon boss data...",
+        []() { sObjectMgr->LoadInstanceEncounters(); }, { "VehicleAccessories" });
+    loader.AddStep("LfgRewards", "Loading LFG rewards...",
+        []() { sLFGMgr->LoadRewards(); }, { "GameEvents" });
+    loader.AddStep("LfgEntrancePositions", "Loading LFG entrance positions...",
+        []() { sLFGMgr->LoadEntrancePositions(); });
+    // must be after quest load
+    loader.AddStep("SpellAreas", "Loading SpellArea Data...",
+        []() { sSpellMgr->LoadSpellAreas(); }, { "InstanceEncounters", "LfgRewards" });
+    loader.AddStep("SpellClassInfo", "Loading Spell Classes Info...",
+        []() { sSpellMgr->LoadSpellClassInfo(); }, { "TalentSpellInfo", "SpellAreas" });
+    loader.AddStep("AreaTriggerTeleports", "Loading AreaTrigger definitions...",
+        []() { sObjectMgr->LoadAreaTriggerTeleports(); });
+    // must be after item template load
+    loader.AddStep("AccessRequirements", "Loading Access Requirements...",
+        []() { sObjectMgr->LoadAccessRequirements(); }, { "SpellAreas" });
+    // must be after LoadQuests
+    loader.AddStep("QuestAreaTriggers", "Loading Quest Area Triggers...",
+        []() { sObjectMgr->LoadQuestAreaTriggers(); }, { "AccessRequirements" });
+    loader.AddStep("TavernAreaTriggers", "Loading Tavern Area Triggers...",
+        []() { sObjectMgr->LoadTavernAreaTriggers(); }, { "AreaTriggerTeleports" });
+    loader.AddStep("AreaTriggerScripts", "Loading AreaTrigger script names...",
+        []() { sObjectMgr->LoadAreaTriggerScripts(); }, { "WeatherData", "TavernAreaTriggers" });
+    loader.AddStep("GraveyardZones", "Loading Graveyard-zone links...",
+        []() { sObjectMgr->LoadGraveyardZones(); });
+    loader.AddStep("SpellPetAuras", "Loading spell pet auras...",
+        []() { sSpellMgr->LoadSpellPetAuras(); }, { "SpellClassInfo" });
+    loader.AddStep("SpellTargetPositions", "Loading Spell target coordinates...",
+        []() { sSpellMgr->LoadSpellTargetPositions(); }, { "SpellPetAuras" });
+    loader.AddStep("EnchantCustomAttr", "Loading enchant custom attributes...",
+        []() { sSpellMgr->LoadEnchantCustomAttr(); }, { "SpellTargetPositions" });
+    loader.AddStep("SpellLinked", "Loading linked spells...",
+        []() { sSpellMgr->LoadSpellLinked(); }, { "EnchantCustomAttr" });
+    loader.AddStep("PlayerInfo", "Loading Player Create Data...",
+        []() { sObjectMgr->LoadPlayerInfo(); }, { "AccessRequirements" });
+    loader.AddStep("ExplorationBaseXP", "Loading Exploration BaseXP Data...",
+        []() { sObjectMgr->LoadExplorationBaseXP(); });
+    loader.AddStep("PetNames", "Loading Pet Name Parts...",
+        []() { sObjectMgr->LoadPetNames(); });
+    loader.AddStep("CharacterDatabaseCleanup", "Cleaning character database...",
+        []() { CharacterDatabaseCleaner::CleanDatabase(); }, { "Instances" });
+    loader.AddStep("PetNumber", "Loading the max pet number...",
+        []() { sObjectMgr->LoadPetNumber(); }, { "CharacterDatabaseCleanup" });
+    loader.AddStep("PetLevelInfo", "Loading pet level stats...",
+        []() { sObjectMgr->LoadPetLevelInfo(); }, { "InstanceEncounters" });
+    loader.AddStep("Corpses", "Loading Player Corpses...",
+        []() { sObjectMgr->LoadCorpses(); }, { "Gameobjects", "CharacterDatabaseCleanup" });
+    loader.AddStep("MailLevelRewards", "Loading Player level dependent mail rewards...",
+        []() { sObjectMgr->LoadMailLevelRewards(); }, { "PetLevelInfo" });
+    loader.AddStep("LootTables", "Loading loot tables...",
+        []() { LoadLootTables(); }, { "QuestAreaTriggers", "SpellLinked", "PlayerInfo", "MailLevelRewards" });
+    loader.AddStep("SkillDiscoveryTable", "Loading Skill Discovery Table...",
+        []() { LoadSkillDiscoveryTable(); }, { "LootTables" });
+    loader.AddStep("SkillExtraItemTable", "Loading Skill Extra Item Table...",
+        []() { LoadSkillExtraItemTable(); }, { "SkillDiscoveryTable" });
+    loader.AddStep("FishingBaseSkillLevel", "Loading Skill Fishing base level requirements...",
+        []() { sObjectMgr->LoadFishingBaseSkillLevel(); });
+    loader.AddStep("AchievementReferenceList", "Loading Achievements...",
+        []() { sAchievementMgr->LoadAchievementReferenceList(); });
+    loader.AddStep("AchievementCriteriaList", "Loading Achievement Criteria Lists...",
+        []() { sAchievementMgr->LoadAchievementCriteriaList(); });
+    loader.AddStep("AchievementCriteriaData", "Loading Achievement Criteria Data...",
+        []() { sAchievementMgr->LoadAchievementCriteriaData(); }, { "AreaTriggerScripts" });
+    loader.AddStep("AchievementRewards", "Loading Achievement Rewards...",
+        []() { sAchievementMgr->LoadRewards(); }, { "LootTables" });
+    loader.AddStep("AchievementRewardLocales", "Loading Achievement Reward Locales...",
+        []() { sAchievementMgr->LoadRewardLocales(); }, { "AchievementRewards" });
+    loader.AddStep("CompletedAchievements", "Loading Completed Achievements...",
+        []() { sAchievementMgr->LoadCompletedAchievements(); }, { "CharacterDatabaseCleanup" });
+    loader.AddStep("DeleteExpiredAuctionsAtStartup", "Deleting expired auctions...",
+        []() { sAuctionMgr->DeleteExpiredAuctionsAtStartup(); }, { "CharacterDatabaseCleanup", "Creatures" });
+    loader.AddStep("AuctionItems", "Loading Item Auctions...",
+        []() { sAuctionMgr->LoadAuctionItems(); }, { "AchievementRewards", "DeleteExpiredAuctionsAtStartup" });
+    loader.AddStep("Auctions", "Loading Auctions...",
+        []() { sAuctionMgr->LoadAuctions(); }, { "DeleteExpiredAuctionsAtStartup", "AuctionItems", "Creatures" });
+    loader.AddStep("GuildXpForLevel", "Loading Guild XP for level...",
+        []() { sGuildMgr->LoadGuildXpForLevel(); });
+    loader.AddStep("GuildRewards", "Loading Guild rewards...",
+        []() { sGuildMgr->LoadGuildRewards(); }, { "AuctionItems" });
+    loader.AddStep("Guilds", "Loading Guilds...",
+        []() { sGuildMgr->LoadGuilds(); }, { "DeleteExpiredAuctionsAtStartup", "ItemTemplates", "AchievementReferenceList",
+            "AchievementCriteriaList", "AchievementCriteriaData", "AchievementRewards", "CompletedAchievements" });
+    loader.AddStep("GuildFinder", "Loading Guild Finder...",
+        []() { sGuildFinderMgr->LoadFromDB(); }, { "Guilds" });
+    loader.AddStep("Groups", "Loading Groups...",
+        []() { sGroupMgr->LoadGroups(); }, { "GuildFinder" });
+    loader.AddStep("ReservedPlayersNames", "Loading ReservedNames...",
+        []() { sObjectMgr->LoadReservedPlayersNames(); }, { "CharacterDatabaseCleanup" });
+    loader.AddStep("GameObjectForQuests", "Loading GameObjects for quests...",
+        []() { sObjectMgr->LoadGameObjectForQuests(); }, { "LootTables" });
+    loader.AddStep("BattleMastersEntry", "Loading BattleMasters...",
+        []() { sBattlegroundMgr->LoadBattleMastersEntry(); });
+    loader.AddStep("GameTele", "Loading GameTeleports...",
+        []() { sObjectMgr->LoadGameTele(); }, { "PlayerInfo" });
+    loader.AddStep("GossipMenu", "Loading Gossip menu...",
+        []() { sObjectMgr->LoadGossipMenu(); }, { "GossipText" });
+    loader.AddStep("GossipMenuItems", "Loading Gossip menu options...",
+        []() { sObjectMgr->LoadGossipMenuItems(); }, { "PointsOfInterest" });
+    // must be after load CreatureTemplate and ItemTemplate
+    loader.AddStep("Vendors", "Loading Vendors...",
+        []() { sObjectMgr->LoadVendors(); }, { "GuildRewards" });
+    // must be after load CreatureTemplate
+    loader.AddStep("TrainerSpell", "Loading Trainers...",
+        []() { sObjectMgr->LoadTrainerSpell(); }, { "SkillExtraItemTable", "Vendors" });
+    loader.AddStep("Waypoints", "Loading Waypoints...",
+        []() { sWaypointMgr->Load(); });
+    loader.AddStep("SmartWaypoints", "Loading SmartAI Waypoints...",
+        []() { sSmartWaypointMgr->LoadFromDB(); });
+    loader.AddStep("CreatureFormations", "Loading Creature Formations...",
+        []() { sFormationMgr->LoadCreatureFormations(); }, { "GameEvents" });
+    // must be loaded before battleground, outdoor PvP and conditions
+    loader.AddStep("WorldStates", "Loading World States...",
+        [this]() { LoadWorldStates(); }, { "CharacterDatabaseCleanup" });
+    loader.AddStep("PhaseDefinitions", "Loading Phase definitions...",
+        []() { sObjectMgr->LoadPhaseDefinitions(); });
+    loader.AddStep("Conditions", "Loading Conditions...",
+        []() { sConditionMgr->LoadConditions(); }, { "AchievementCriteriaData", "GameObjectForQuests", "GossipMenu", "GossipMenuItems", "TrainerSpell", "WorldStates" });
+    loader.AddStep("FactionChangeAchievements", "Loading faction change achievement pairs...",
+        []() { sObjectMgr->LoadFactionChangeAchievements(); });
+    loader.AddStep("FactionChangeSpells", "Loading faction change spell pairs...",
+        []() { sObjectMgr->LoadFactionChangeSpells(); }, { "Conditions" });
+    loader.AddStep("FactionChangeItems", "Loading faction change item pairs...",
+        []() { sObjectMgr->LoadFactionChangeItems(); }, { "Conditions" });
+    loader.AddStep("FactionChangeReputations", "Loading faction change reputation pairs...",
+        []() { sObjectMgr->LoadFactionChangeReputations(); });
+    loader.AddStep("FactionChangeTitles", "Loading faction change title pairs...",
+        []() { sObjectMgr->LoadFactionChangeTitles(); });
+
+    ///- Workers reach these singletons while loading, create them here so they are never constructed concurrently
+    sSpellMgr; sObjectMgr; sObjectAccessor; sMapMgr; sInstanceSaveMgr; sPoolMgr; sGameEventMgr; sLFGMgr;
+    sAchievementMgr; sAuctionMgr; sGuildMgr; sGuildFinderMgr; sGroupMgr; sBattlegroundMgr; sConditionMgr;
+    sWaypointMgr; sSmartWaypointMgr; sFormationMgr; sScriptMgr;
+
+    loader.Run(getIntConfig(CONFIG_STARTUP_LOAD_THREADS));
+
+    if (getBoolConfig(CONFIG_STARTUP_PRINT_CRITICAL_PATH))
+        loader.PrintCriticalPath();
 
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading GM tickets...");
     sTicketMgr->LoadTickets();
@@ -2183,6 +2007,14 @@ void World::SetInitialWorldSettings()
     sSpellMgr->InitializeItemUpgradeDatas();
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
 
+    // from here on the map threads read the spawn data and grid cells without locking
+    sObjectMgr->FreezeSpawnStores();
+
+    // the loaders above query synchronously on purpose, only count from the first update on
+    UpdateSynchQueryCount();
+    m_synchQueriesLastTick = 0;
+    m_synchQueriesMaxTick = 0;
+
     uint32 startupDuration = GetMSTimeDiffToNow(startupBegin);
 
     sLog->outInfo(LOG_FILTER_WORLDSERVER, "World initialized in %u minutes %u seconds", (startupDuration / 60000), ((startupDuration % 60000) / 1000));
@@ -2291,11 +2123,27 @@ void World::LoadAutobroadcasts()
 
 }
 
+/// Counts the synchronous queries issued by any thread since the previous world update
+void World::UpdateSynchQueryCount()
+{
+    uint64 synchQueries = LoginDatabase.GetSynchQueryCount() + CharacterDatabase.GetSynchQueryCount() + WorldDatabase.GetSynchQueryCount();
+    m_synchQueriesLastTick = uint32(synchQueries - m_synchQueries);
+    m_synchQueriesMaxTick = std::max(m_synchQueriesMaxTick, m_synchQueriesLastTick);
+    m_synchQueries = synchQueries;
+
+    // handlers are expected to go through AddQueryCallback, a jump here means one blocks again
+    if (m_int_configs[CONFIG_SYNCH_QUERY_LOG_THRESHOLD] && m_synchQueriesLastTick > m_int_configs[CONFIG_SYNCH_QUERY_LOG_THRESHOLD])
+        sLog->outError(LOG_FILTER_GENERAL, "World::Update: %u synchronous database queries during the last update (threshold %u)",
+            m_synchQueriesLastTick, m_int_configs[CONFIG_SYNCH_QUERY_LOG_THRESHOLD]);
+}
+
 /// Update the World !
 void World::Update(uint32 diff)
 {
     m_updateTime = diff;
 
+    UpdateSynchQueryCount();
+
     if (m_int_configs[CONFIG_INTERVAL_LOG_UPDATE] && diff > m_int_configs[CONFIG_MIN_LOG_UPDATE])
     {
         if (m_updateTimeSum > m_int_configs[CONFIG_INTERVAL_LOG_UPDATE])
@@ -2428,6 +2276,10 @@ void World::Update(uint32 diff)
     RecordTimeDiff(NULL);
     sMapMgr->Update(diff);
 
+    // the map threads are idle until the next map update, free the spawn data and disables they may have been reading
+    sObjectMgr->ReclaimSpawnStores();
+    DisableMgr::ReclaimDisables();
+
     SetRecordDiff(RECORD_DIFF_MAP, getMSTime() - diffTime);
     diffTime = getMSTime();
     RecordTimeDiff("UpdateMapMgr");
@@ -2494,7 +2346,7 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_PINGDB].Passed())
     {
         m_timers[WUPDATE_PINGDB].Reset();
-        sLog->outDebug(LOG_FILTER_GENERAL, "Ping MySQL to keep connection alive");
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Ping MySQL to keep connection alive");
         CharacterDatabase.KeepAlive();
         LoginDatabase.KeepAlive();
         WorldDatabase.KeepAlive();
@@ -3034,7 +2886,7 @@ void World::ShutdownMsg(bool show, Player* player)
         ServerMessageType msgid = (m_ShutdownMask & SHUTDOWN_MASK_RESTART) ? SERVER_MSG_RESTART_TIME : SERVER_MSG_SHUTDOWN_TIME;
 
         SendServerMessage(msgid, str.c_str(), player);
-        sLog->outDebug(LOG_FILTER_GENERAL, "Server is %s in %s", (m_ShutdownMask & SHUTDOWN_MASK_RESTART ? "restart" : "shuttingdown"), str.c_str());
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Server is %s in %s", (m_ShutdownMask & SHUTDOWN_MASK_RESTART ? "restart" : "shuttingdown"), str.c_str());
     }
 
     if (m_ShutdownTimer == 5)
@@ -3060,7 +2912,7 @@ void World::ShutdownCancel()
     m_ExitCode = SHUTDOWN_EXIT_CODE;                       // to default value
     SendServerMessage(msgid);
 
-    sLog->outDebug(LOG_FILTER_GENERAL, "Server %s cancelled.", (m_ShutdownMask & SHUTDOWN_MASK_RESTART ? "restart" : "shuttingdown"));
+    TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Server %s cancelled.", (m_ShutdownMask & SHUTDOWN_MASK_RESTART ? "restart" : "shuttingdown"));
 
     sScriptMgr->OnShutdownCancel();
 }
@@ -3160,7 +3012,7 @@ void World::SendAutoBroadcast()
         sWorld->SendGlobalMessage(&data);
     }
 
-    sLog->outDebug(LOG_FILTER_GENERAL, "AutoBroadcast: '%s'", msg.c_str());
+    TC_LOG_DEBUG(LOG_FILTER_GENERAL, "AutoBroadcast: '%s'", msg.c_str());
 }
 
 void World::UpdateRealmCharCount(uint32 accountId)
@@ -3618,6 +3470,31 @@ void World::ProcessQueryCallbacks()
             lResult.cancel();
         }
     }
+
+    // taken out under the lock, a continuation may add the next query of its chain
+    QueryContinuationList ready;
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_queryContinuationsLock);
+        for (QueryContinuationList::iterator itr = m_queryContinuations.begin(); itr != m_queryContinuations.end();)
+        {
+            if (itr->first.ready())
+                ready.splice(ready.end(), m_queryContinuations, itr++);
+            else
+                ++itr;
+        }
+    }
+
+    for (QueryContinuationList::iterator itr = ready.begin(); itr != ready.end(); ++itr)
+    {
+        itr->first.get(result);
+        itr->second(result);
+    }
+}
+
+void World::AddQueryCallback(PreparedQueryResultFuture future, QueryContinuation continuation)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_queryContinuationsLock);
+    m_queryContinuations.push_back(std::make_pair(future, std::move(continuation)));
 }
 
 void World::LoadCharacterNameData()
@@ -35,6 +35,7 @@
 #include <map>
 #include <set>
 #include <list>
+#include <functional>
 
 class Object;
 class WorldPacket;
@@ -106,6 +107,8 @@ enum WorldBoolConfigs
     CONFIG_ALLOW_PLAYER_COMMANDS,
     CONFIG_CLEAN_CHARACTER_DB,
     CONFIG_GRID_UNLOAD,
+    CONFIG_GRID_MAP_MEMORY_MAPPED,
+    CONFIG_MAP_QUERY_CACHE,
     CONFIG_STATS_SAVE_ONLY_ON_LOGOUT,
     CONFIG_ALLOW_TWO_SIDE_ACCOUNTS,
     CONFIG_ALLOW_TWO_SIDE_INTERACTION_CALENDAR,
@@ -206,6 +209,9 @@ enum WorldBoolConfigs
     CONFIG_VIP_EXCHANGE_FROST_COMMAND,
     CONFIG_ANTISPAM_ENABLED,
     CONFIG_DISABLE_RESTART,
+    CONFIG_MAPUPDATE_REGION_SPLIT,
+    CONFIG_ENABLE_PATHFINDING,
+    CONFIG_STARTUP_PRINT_CRITICAL_PATH,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -226,6 +232,7 @@ enum WorldFloatConfigs
     CONFIG_STATS_LIMITS_PARRY,
     CONFIG_STATS_LIMITS_BLOCK,
     CONFIG_STATS_LIMITS_CRIT,
+    CONFIG_MAPUPDATE_REGION_MARGIN,
     FLOAT_CONFIG_VALUE_COUNT
 };
 
@@ -345,6 +352,7 @@ enum WorldIntConfigs
     CONFIG_PVP_TOKEN_COUNT,
     CONFIG_INTERVAL_LOG_UPDATE,
     CONFIG_MIN_LOG_UPDATE,
+    CONFIG_SYNCH_QUERY_LOG_THRESHOLD,
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_PLAYER_ALLOW_COMMANDS,
     CONFIG_NUMTHREADS,
@@ -393,6 +401,9 @@ enum WorldIntConfigs
     CONFIG_ANTISPAM_MAIL_TIMER,
     CONFIG_ANTISPAM_MAIL_COUNT,
     CONFIG_AUTO_SERVER_RESTART_HOUR,
+    CONFIG_MAPUPDATE_REGION_MIN_PLAYERS,
+    CONFIG_PATHFINDING_MAX_NODES,
+    CONFIG_STARTUP_LOAD_THREADS,
     INT_CONFIG_VALUE_COUNT
 };
 
@@ -723,6 +734,15 @@ class World
         uint32 GetUptime() const { return uint32(m_gameTime - m_startTime); }
         /// Update time
         uint32 GetUpdateTime() const { return m_updateTime; }
+        /// Synchronous database queries of the last update and the most of any update since startup
+        uint32 GetSynchQueriesLastTick() const { return m_synchQueriesLastTick; }
+        uint32 GetSynchQueriesMaxTick() const { return m_synchQueriesMaxTick; }
+
+        typedef std::function<void(PreparedQueryResult)> QueryContinuation;
+
+        /// Like WorldSession::AddQueryCallback for work without a session, the continuation is called from a later World::Update.
+        /// May be called from the map threads.
+        void AddQueryCallback(PreparedQueryResultFuture future, QueryContinuation continuation);
         void SetRecordDiffInterval(int32 t) { if (t >= 0) m_int_configs[CONFIG_INTERVAL_LOG_UPDATE] = (uint32)t; }
 
         /// Next daily quests and random bg reset time
@@ -848,6 +868,7 @@ class World
         char const* GetDBVersion() const { return m_DBVersion.c_str(); }
 
         void RecordTimeDiff(const char * text, ...);
+        void UpdateSynchQueryCount();
 
         void LoadAutobroadcasts();
 
@@ -924,6 +945,9 @@ class World
         uint32 m_updateTime, m_updateTimeSum;
         uint32 m_updateTimeCount;
         uint32 m_currentTime;
+        uint64 m_synchQueries;
+        uint32 m_synchQueriesLastTick;
+        uint32 m_synchQueriesMaxTick;
 
         SessionMap m_sessions;
         typedef UNORDERED_MAP<uint32, time_t> DisconnectMap;
@@ -991,6 +1015,9 @@ class World
 
         void ProcessQueryCallbacks();
         ACE_Future_Set<PreparedQueryResult> m_realmCharCallbacks;
+        typedef std::list<std::pair<PreparedQueryResultFuture, QueryContinuation> > QueryContinuationList;
+        QueryContinuationList m_queryContinuations;
+        ACE_Thread_Mutex m_queryContinuationsLock;
         uint32 m_recordDiff[RECORD_DIFF_MAX];
 };
 
@@ -32,9 +32,33 @@ EndScriptData */
 #include "GridNotifiersImpl.h"
 #include "GossipDef.h"
 #include "MapManager.h"
-
+#include "DisableMgr.h"
+#include "SpellMgr.h"
+#include "SmartAI.h"
+#include "AuctionSearchIndex.h"
+#include "AuctionHouseMgr.h"
+#include "SharedWorldPacket.h"
+
+#include <ace/Message_Block.h>
 #include <fstream>
 
+// Hides VisitObject of the wrapped searcher, so Cell::Visit walks the object lists of every cell
+template<class SEARCHER>
+struct GridQueryListScan
+{
+    SEARCHER& i_searcher;
+
+    explicit GridQueryListScan(SEARCHER& searcher) : i_searcher(searcher) { }
+
+    template<class T> void Visit(GridRefManager<T>& m) { i_searcher.Visit(m); }
+};
+
+// One result line of the .debug benchmarks: elapsed time and the rate of count operations
+static void SendDebugTiming(ChatHandler* handler, char const* label, uint32 ms, uint64 count, char const* unit)
+{
+    handler->PSendSysMessage("%s: %u ms, " UI64FMTD " %s/s", label, ms, count * IN_MILLISECONDS / std::max<uint32>(ms, 1), unit);
+}
+
 class debug_commandscript : public CommandScript
 {
     public:
@@ -90,6 +114,19 @@ class debug_commandscript : public CommandScript
                 { "itemexpire",     SEC_ADMINISTRATOR,  false, &HandleDebugItemExpireCommand,      "", NULL },
                 { "areatriggers",   SEC_ADMINISTRATOR,  false, &HandleDebugAreaTriggersCommand,    "", NULL },
                 { "los",            SEC_MODERATOR,      false, &HandleDebugLoSCommand,             "", NULL },
+                { "regionupdate",   SEC_ADMINISTRATOR,  false, &HandleDebugRegionUpdateCommand,    "", NULL },
+                { "gridquery",      SEC_ADMINISTRATOR,  false, &HandleDebugGridQueryCommand,       "", NULL },
+                { "querycache",     SEC_ADMINISTRATOR,  false, &HandleDebugQueryCacheCommand,      "", NULL },
+                { "disablelookup",  SEC_ADMINISTRATOR,  true,  &HandleDebugDisableLookupCommand,   "", NULL },
+                { "procreplay",     SEC_ADMINISTRATOR,  false, &HandleDebugProcReplayCommand,      "", NULL },
+                { "healdamagelog",  SEC_ADMINISTRATOR,  true,  &HandleDebugHealDamageLogCommand,   "", NULL },
+                { "smartdispatch",  SEC_ADMINISTRATOR,  false, &HandleDebugSmartDispatchCommand,   "", NULL },
+                { "auctionsearch",  SEC_ADMINISTRATOR,  true,  &HandleDebugAuctionSearchCommand,   "", NULL },
+                { "broadcast",      SEC_ADMINISTRATOR,  true,  &HandleDebugBroadcastCommand,       "", NULL },
+                { "packethooks",    SEC_ADMINISTRATOR,  false, &HandleDebugPacketHooksCommand,     "", NULL },
+                { "movecodec",      SEC_ADMINISTRATOR,  true,  &HandleDebugMoveCodecCommand,       "", NULL },
+                { "logworker",      SEC_ADMINISTRATOR,  true,  &HandleDebugLogWorkerCommand,       "", NULL },
+                { "dbbatch",        SEC_ADMINISTRATOR,  true,  &HandleDebugDbBatchCommand,         "", NULL },
                 { "moveflags",      SEC_ADMINISTRATOR,  false, &HandleDebugMoveflagsCommand,       "", NULL },
                 { "phase",          SEC_MODERATOR,      false, &HandleDebugPhaseCommand,           "", NULL },
                 { "tradestatus",    SEC_ADMINISTRATOR,  false, &HandleSendTradeStatus,             "", NULL },
@@ -740,7 +777,7 @@ class debug_commandscript : public CommandScript
                     break;
                 }
             }
-            sLog->outDebug(LOG_FILTER_NETWORKIO, "Sending opcode %u", data.GetOpcode());
+            TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Sending opcode %u", data.GetOpcode());
             data.hexlike();
             player->GetSession()->SendPacket(&data, true);
             handler->PSendSysMessage(LANG_COMMAND_OPCODESENT, data.GetOpcode(), unit->GetName());
@@ -1631,6 +1668,634 @@ class debug_commandscript : public CommandScript
             return true;
         }
 
+        // .debug regionupdate [count]
+        // Times count updates of the current map regions on this thread and split over the map update workers
+        static bool HandleDebugRegionUpdateCommand(ChatHandler* handler, char const* args)
+        {
+            uint32 count = *args ? uint32(atoi(args)) : 100;
+            if (!count)
+                return false;
+
+            Map* map = handler->GetSession()->GetPlayer()->GetMap();
+
+            uint32 regions, serialTime, splitTime;
+            if (!map->BenchmarkRegions(count, regions, serialTime, splitTime))
+            {
+                handler->SendSysMessage("The map has less than two regions or MapUpdate.Threads is below 2");
+                handler->SetSentErrorMessage(true);
+                return false;
+            }
+
+            handler->PSendSysMessage("Map %u, %u regions, %u updates", map->GetId(), regions, count);
+            SendDebugTiming(handler, "Single thread", serialTime, count, "updates");
+            SendDebugTiming(handler, "Region split", splitTime, count, "updates");
+            return true;
+        }
+
+        // .debug packethooks [opcode] [count]
+        // Times count dispatches of a received packet (CMSG_MOVE_HEARTBEAT by default) to the packet hooks of its opcode
+        static bool HandleDebugPacketHooksCommand(ChatHandler* handler, char const* args)
+        {
+            uint32 opcode = CMSG_MOVE_HEARTBEAT;
+            uint32 count = 1000000;
+
+            if (char* opcodeStr = strtok((char*)args, " "))
+            {
+                opcode = uint32(atoi(opcodeStr));
+                if (char* countStr = strtok(NULL, " "))
+                    count = uint32(atoi(countStr));
+            }
+
+            if (!opcode || opcode >= NUM_OPCODE_HANDLERS || !count)
+                return false;
+
+            WorldSocket* socket = handler->GetSession()->GetSocket();
+            if (!socket)
+                return false;
+
+            WorldPacket packet(Opcodes(opcode), 64);
+            packet.resize(64);
+
+            uint32 startTime = getMSTime();
+            for (uint32 i = 0; i < count; ++i)
+                sScriptMgr->OnPacketReceive(socket, packet);
+            uint32 hookTime = GetMSTimeDiffToNow(startTime);
+
+            handler->PSendSysMessage("Opcode %u, %u packets of %u bytes", opcode, count, uint32(packet.size()));
+            SendDebugTiming(handler, "Packet hooks", hookTime, count, "packets");
+            return true;
+        }
+
+        // .debug movecodec [count]
+        // Checks the codec of every movement opcode for round trips and against the reference interpreter with count random
+        // movement infos each, lists the layouts that fail, then times count packets per layout through both
+        static bool HandleDebugMoveCodecCommand(ChatHandler* handler, char const* args)
+        {
+            uint32 count = 1000;
+            if (*args)
+                count = uint32(atoi(args));
+
+            if (!count)
+                return false;
+
+            MovementCodecCheckResult result;
+            CheckMovementCodecs(result, count);
+
+            for (std::vector<Opcodes>::const_iterator itr = result.failed.begin(); itr != result.failed.end(); ++itr)
+            {
+                int direction = opcodeTable[WOW_CLIENT][*itr & 0x7FFF] ? WOW_CLIENT : WOW_SERVER;
+                handler->PSendSysMessage("Round trip failed: %s", GetOpcodeNameForLogging(*itr, direction).c_str());
+            }
+
+            for (std::vector<Opcodes>::const_iterator itr = result.mismatched.begin(); itr != result.mismatched.end(); ++itr)
+            {
+                int direction = opcodeTable[WOW_CLIENT][*itr & 0x7FFF] ? WOW_CLIENT : WOW_SERVER;
+                handler->PSendSysMessage("Differs from the interpreter: %s", GetOpcodeNameForLogging(*itr, direction).c_str());
+            }
+
+            handler->PSendSysMessage("Movement codecs: %u checked, %u skipped, %u failed, %u random infos, %u differ from the interpreter",
+                result.checked, result.skipped, uint32(result.failed.size()), result.fuzzed, uint32(result.mismatched.size()));
+
+            MovementCodecBenchmarkResult timing;
+            BenchmarkMovementCodecs(count, timing);
+            SendDebugTiming(handler, "Generated codecs", timing.codecTime, timing.packets, "packets");
+            SendDebugTiming(handler, "Reference interpreter", timing.interpreterTime, timing.packets, "packets");
+            return true;
+        }
+
+        // .debug logworker [threads] [count]
+        // Times count log calls from each of threads threads at once through the per thread log rings
+        static bool HandleDebugLogWorkerCommand(ChatHandler* handler, char const* args)
+        {
+            uint32 threads = 8;
+            uint32 count = 100000;
+
+            if (char* threadsStr = strtok((char*)args, " "))
+            {
+                threads = uint32(atoi(threadsStr));
+                if (char* countStr = strtok(NULL, " "))
+                    count = uint32(atoi(countStr));
+            }
+
+            if (!threads || threads > 64 || !count)
+                return false;
+
+            uint32 logTime = sLog->BenchmarkWorker(threads, count);
+
+            handler->PSendSysMessage("%u threads, %u log calls each", threads, count);
+            SendDebugTiming(handler, "Log calls", logTime, uint64(threads) * count, "calls");
+            return true;
+        }
+
+        // Inserts rows character_spell rows for character guid 0, which no character uses, in one direct transaction and removes them again.
+        // Returns false when the transaction failed.
+        static bool TimeSpellRowInserts(uint32 rows, bool batched, uint32& insertTime)
+        {
+            PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL);
+            stmt->setUInt32(0, 0);
+            CharacterDatabase.DirectExecute(stmt);
+
+            SQLTransaction trans = CharacterDatabase.BeginTransaction();
+            SQLTransactionResult result = trans->GetResult();
+            BatchedStatement* batch = batched ? CharacterDatabase.GetBatchedStatement(CHAR_INS_CHAR_SPELL) : NULL;
+
+            for (uint32 i = 0; i < rows; ++i)
+            {
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_SPELL);
+                stmt->setUInt32(0, 0);
+                stmt->setUInt32(1, i + 1);
+                stmt->setBool(2, true);
+                stmt->setBool(3, false);
+                if (batch)
+                    batch->AddRow(stmt);
+                else
+                    trans->Append(stmt);
+            }
+
+            if (batch)
+                trans->Append(batch);
+
+            uint32 startTime = getMSTime();
+            CharacterDatabase.DirectCommitTransaction(trans);
+            insertTime = GetMSTimeDiffToNow(startTime);
+
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL);
+            stmt->setUInt32(0, 0);
+            CharacterDatabase.DirectExecute(stmt);
+
+            return result->GetState() == TransactionResult::TRANSACTION_COMMITTED;
+        }
+
+        // .debug dbbatch [rows]
+        // Times rows character_spell inserts as one batched statement and as one statement per row, each in a direct transaction.
+        // With Database.BatchedStatements = 0 both runs send one statement per row.
+        static bool HandleDebugDbBatchCommand(ChatHandler* handler, char const* args)
+        {
+            uint32 rows = 1000;
+            if (*args)
+                rows = uint32(atoi(args));
+
+            if (!rows || rows > 100000)
+                return false;
+
+            uint32 batchTime;
+            uint32 singleTime;
+            if (!TimeSpellRowInserts(rows, true, batchTime) || !TimeSpellRowInserts(rows, false, singleTime))
+            {
+                handler->SendSysMessage("Insert transaction failed, see the database log");
+                handler->SetSentErrorMessage(true);
+                return false;
+            }
+
+            handler->PSendSysMessage("%u character_spell rows per transaction", rows);
+            SendDebugTiming(handler, "Batched statement", batchTime, rows, "rows");
+            SendDebugTiming(handler, "Single row statements", singleTime, rows, "rows");
+            return true;
+        }
+
+        // .debug gridquery [radius] [count]
+        // Times radius queries around the player through the cell spatial index and through the cell object lists
+        static bool HandleDebugGridQueryCommand(ChatHandler* handler, char const* args)
+        {
+            float radius = 30.0f;
+            uint32 count = 1000;
+
+            if (char* radiusStr = strtok((char*)args, " "))
+            {
+                radius = float(atof(radiusStr));
+                if (char* countStr = strtok(NULL, " "))
+                    count = uint32(atoi(countStr));
+            }
+
+            if (radius <= 0.0f || !count)
+                return false;
+
+            Player* player = handler->GetSession()->GetPlayer();
+            Map* map = player->GetMap();
+
+            CellCoord p(MoPCore::ComputeCellCoord(player->GetPositionX(), player->GetPositionY()));
+            Cell cell(p);
+            cell.SetNoCreate();
+
+            typedef MoPCore::WorldObjectListSearcher<MoPCore::AllWorldObjectsInRange> Searcher;
+
+            std::list<WorldObject*> targets;
+            MoPCore::AllWorldObjectsInRange check(player, radius);
+            Searcher searcher(player, targets, check);
+
+            TypeContainerVisitor<Searcher, WorldTypeMapContainer> indexWorldVisitor(searcher);
+            TypeContainerVisitor<Searcher, GridTypeMapContainer> indexGridVisitor(searcher);
+
+            uint32 startTime = getMSTime();
+            for (uint32 i = 0; i < count; ++i)
+            {
+                targets.clear();
+                cell.Visit(p, indexWorldVisitor, *map, *player, radius);
+                cell.Visit(p, indexGridVisitor, *map, *player, radius);
+            }
+            uint32 indexTime = GetMSTimeDiffToNow(startTime);
+            uint32 indexFound = uint32(targets.size());
+
+            GridQueryListScan<Searcher> listScan(searcher);
+            TypeContainerVisitor<GridQueryListScan<Searcher>, WorldTypeMapContainer> listWorldVisitor(listScan);
+            TypeContainerVisitor<GridQueryListScan<Searcher>, GridTypeMapContainer> listGridVisitor(listScan);
+
+            startTime = getMSTime();
+            for (uint32 i = 0; i < count; ++i)
+            {
+                targets.clear();
+                cell.Visit(p, listWorldVisitor, *map, *player, radius);
+                cell.Visit(p, listGridVisitor, *map, *player, radius);
+            }
+            uint32 listTime = GetMSTimeDiffToNow(startTime);
+
+            handler->PSendSysMessage("Grid query radius %.1f, %u queries, %u objects found (%u by the list scan)", radius, count, indexFound, uint32(targets.size()));
+            SendDebugTiming(handler, "Spatial index", indexTime, count, "queries");
+            SendDebugTiming(handler, "Object lists", listTime, count, "queries");
+            return true;
+        }
+
+        // .debug querycache [reset | count]
+        // Shows the hit rates of the line of sight and height cache of the current map, or times
+        // count cached and uncached queries from the player to a point in front of them
+        static bool HandleDebugQueryCacheCommand(ChatHandler* handler, char const* args)
+        {
+            Player* player = handler->GetSession()->GetPlayer();
+            Map* map = player->GetMap();
+            MapQueryCache& cache = map->GetQueryCache();
+
+            if (!*args)
+            {
+                static char const* const queryNames[MAX_MAP_QUERY_TYPES] = { "line of sight", "dynamic height", "height", "area info" };
+
+                handler->PSendSysMessage("Query cache of map %u instance %u is %s", map->GetId(), map->GetInstanceId(), cache.IsEnabled() ? "enabled" : "disabled");
+                for (uint8 i = 0; i < MAX_MAP_QUERY_TYPES; ++i)
+                {
+                    uint64 hits = cache.GetHits(MapQueryType(i));
+                    uint64 total = hits + cache.GetMisses(MapQueryType(i));
+                    handler->PSendSysMessage("%s: " UI64FMTD " hits of " UI64FMTD " queries (%.1f%%)", queryNames[i], hits, total, total ? float(hits) * 100.0f / float(total) : 0.0f);
+                }
+                return true;
+            }
+
+            if (!strcmp(args, "reset"))
+            {
+                cache.ResetCounters();
+                handler->SendSysMessage("Query cache counters reset");
+                return true;
+            }
+
+            uint32 count = uint32(atoi(args));
+            if (!count)
+                return false;
+
+            float x, y, z;
+            player->GetPosition(x, y, z);
+            z += 2.0f;
+            float targetX = x + 20.0f * std::cos(player->GetOrientation());
+            float targetY = y + 20.0f * std::sin(player->GetOrientation());
+            uint32 phaseMask = player->GetPhaseMask();
+
+            uint32 startTime = getMSTime();
+            for (uint32 i = 0; i < count; ++i)
+            {
+                map->isInLineOfSight(x, y, z, targetX, targetY, z, phaseMask);
+                map->GetHeight(phaseMask, targetX, targetY, z);
+            }
+            uint32 cachedTime = GetMSTimeDiffToNow(startTime);
+
+            startTime = getMSTime();
+            for (uint32 i = 0; i < count; ++i)
+            {
+                map->ComputeLineOfSight(x, y, z, targetX, targetY, z, phaseMask);
+                map->ComputeHeight(phaseMask, targetX, targetY, z);
+            }
+            uint32 uncachedTime = GetMSTimeDiffToNow(startTime);
+
+            handler->PSendSysMessage("%u line of sight and height query pairs", count);
+            SendDebugTiming(handler, "Cached", cachedTime, count, "pairs");
+            SendDebugTiming(handler, "Uncached", uncachedTime, count, "pairs");
+            return true;
+        }
+
+        // .debug disablelookup [count]
+        // Times count spell and vmap disable lookups, the checks done for every cast and line of sight query
+        static bool HandleDebugDisableLookupCommand(ChatHandler* handler, char const* args)
+        {
+            uint32 count = *args ? uint32(atoi(args)) : 1000000;
+            if (!count)
+                return false;
+
+            uint32 spellCount = std::max<uint32>(sSpellMgr->GetSpellInfoStoreSize(), 1);
+            uint32 mapCount = std::max<uint32>(sMapStore.GetNumRows(), 1);
+
+            uint32 disabled = 0;
+            uint32 startTime = getMSTime();
+            for (uint32 i = 0; i < count; ++i)
+            {
+                if (DisableMgr::IsDisabledFor(DISABLE_TYPE_SPELL, i % spellCount, NULL))
+                    ++disabled;
+                if (DisableMgr::IsDisabledFor(DISABLE_TYPE_VMAP, i % mapCount, NULL, VMAP_DISABLE_LOS))
+                    ++disabled;
+            }
+            uint32 lookupTime = GetMSTimeDiffToNow(startTime);
+
+            handler->PSendSysMessage("%u disable lookups, %u disabled", count * 2, disabled);
+            SendDebugTiming(handler, "Disable lookups", lookupTime, uint64(count) * 2, "lookups");
+            return true;
+        }
+
+        // .debug procreplay [count]
+        // Replays count rounds of the proc events of a melee and caster rotation through the proc index of the selected unit
+        static bool HandleDebugProcReplayCommand(ChatHandler* handler, char const* args)
+        {
+            static uint32 const replayEvents[] =
+            {
+                PROC_FLAG_DONE_MELEE_AUTO_ATTACK | PROC_FLAG_DONE_MAINHAND_ATTACK,
+                PROC_FLAG_DONE_SPELL_MELEE_DMG_CLASS | PROC_FLAG_DONE_MAINHAND_ATTACK,
+                PROC_FLAG_DONE_SPELL_MAGIC_DMG_CLASS_NEG,
+                PROC_FLAG_DONE_SPELL_MAGIC_DMG_CLASS_POS,
+                PROC_FLAG_DONE_PERIODIC,
+                PROC_FLAG_TAKEN_MELEE_AUTO_ATTACK | PROC_FLAG_TAKEN_DAMAGE,
+                PROC_FLAG_TAKEN_SPELL_MAGIC_DMG_CLASS_NEG | PROC_FLAG_TAKEN_DAMAGE,
+                PROC_FLAG_TAKEN_PERIODIC | PROC_FLAG_TAKEN_DAMAGE
+            };
+            uint32 const eventCount = sizeof(replayEvents) / sizeof(replayEvents[0]);
+
+            uint32 count = *args ? uint32(atoi(args)) : 10000;
+            if (!count)
+                return false;
+
+            Unit* unit = handler->getSelectedUnit();
+            if (!unit)
+                unit = handler->GetSession()->GetPlayer();
+
+            uint64 candidates = 0;
+            Unit::ProcAuraCandidates eventCandidates;
+            uint32 startTime = getMSTime();
+            for (uint32 i = 0; i < count; ++i)
+            {
+                for (uint32 j = 0; j < eventCount; ++j)
+                {
+                    eventCandidates.clear();
+                    unit->GetProcAuraCandidates(replayEvents[j], eventCandidates);
+                    candidates += eventCandidates.size();
+                }
+            }
+            uint32 indexTime = GetMSTimeDiffToNow(startTime);
+
+            uint64 events = uint64(count) * eventCount;
+            handler->PSendSysMessage("%s: %u applied auras, " UI64FMTD " proc events replayed, " UI64FMTD " candidate auras",
+                unit->GetName(), uint32(unit->GetAppliedAuras().size()), events, candidates);
+            SendDebugTiming(handler, "Proc index", indexTime, events, "events");
+            return true;
+        }
+
+        // .debug healdamagelog [units] [seconds]
+        // Simulates an AoE fight where every unit takes a hit every 100 ms and asks for the damage of the last 5 seconds
+        static bool HandleDebugHealDamageLogCommand(ChatHandler* handler, char const* args)
+        {
+            uint32 units = 200;
+            uint32 seconds = 120;
+
+            if (char* unitsStr = strtok((char*)args, " "))
+            {
+                units = uint32(atoi(unitsStr));
+                if (char* secondsStr = strtok(NULL, " "))
+                    seconds = uint32(atoi(secondsStr));
+            }
+
+            if (!units || !seconds)
+                return false;
+
+            uint32 const steps = seconds * 10;
+            uint64 hits = uint64(units) * steps;
+            uint64 checksum = 0;
+
+            std::vector<HealDamageLog> logs(units);
+            uint32 startTime = getMSTime();
+            for (uint32 step = 0; step < steps; ++step)
+            {
+                uint32 now = step * 100;
+                for (uint32 i = 0; i < units; ++i)
+                {
+                    logs[i].Add(DAMAGE_TAKE_LOG, 1000 + i, now);
+                    checksum += logs[i].GetSum(DAMAGE_TAKE_LOG, 5, now);
+                }
+            }
+            uint32 ringTime = GetMSTimeDiffToNow(startTime);
+
+            handler->PSendSysMessage("%u units, %u simulated seconds, " UI64FMTD " hits and queries (checksum " UI64FMTD "), %u bytes per unit",
+                units, seconds, hits, checksum, uint32(sizeof(HealDamageLog)));
+            SendDebugTiming(handler, "Bucket ring", ringTime, hits, "hits");
+            return true;
+        }
+
+        // .debug smartdispatch [radius] [count]
+        // Counts the SmartAI events of the creatures around the player and times count target searches per script
+        static bool HandleDebugSmartDispatchCommand(ChatHandler* handler, char const* args)
+        {
+            float radius = 100.0f;
+            uint32 count = 100;
+
+            if (char* radiusStr = strtok((char*)args, " "))
+            {
+                radius = float(atof(radiusStr));
+                if (char* countStr = strtok(NULL, " "))
+                    count = uint32(atoi(countStr));
+            }
+
+            if (radius <= 0.0f || !count)
+                return false;
+
+            Player* player = handler->GetSession()->GetPlayer();
+
+            std::list<Creature*> creatures;
+            MoPCore::AnyUnitInObjectRangeCheck check(player, radius);
+            MoPCore::CreatureListSearcher<MoPCore::AnyUnitInObjectRangeCheck> searcher(player, creatures, check);
+            player->VisitNearbyGridObject(radius, searcher);
+
+            std::vector<SmartScript*> scripts;
+            uint64 events = 0;
+            for (std::list<Creature*>::const_iterator itr = creatures.begin(); itr != creatures.end(); ++itr)
+            {
+                SmartAI* ai = dynamic_cast<SmartAI*>((*itr)->AI());
+                if (!ai)
+                    continue;
+
+                SmartScript* script = ai->GetScript();
+                scripts.push_back(script);
+                events += script->GetEventCount();
+            }
+
+            if (scripts.empty())
+            {
+                handler->PSendSysMessage("No SmartAI creatures within %.1f yards", radius);
+                return true;
+            }
+
+            uint64 searches = uint64(scripts.size()) * count;
+            uint64 found = 0;
+
+            uint32 startTime = getMSTime();
+            for (uint32 i = 0; i < count; ++i)
+            {
+                for (std::vector<SmartScript*>::const_iterator itr = scripts.begin(); itr != scripts.end(); ++itr)
+                {
+                    ObjectList* targets = (*itr)->GetWorldObjectsInDist(30.0f);
+                    found += targets->size();
+                    (*itr)->ReleaseTargetList(targets);
+                }
+            }
+            uint32 searchTime = GetMSTimeDiffToNow(startTime);
+
+            handler->PSendSysMessage("%u SmartAI creatures within %.1f yards, " UI64FMTD " events", uint32(scripts.size()), radius, events);
+            handler->PSendSysMessage("Target search 30 yd, " UI64FMTD " searches, " UI64FMTD " targets", searches, found);
+            SendDebugTiming(handler, "Target search", searchTime, searches, "searches");
+            return true;
+        }
+
+        // .debug auctionsearch [auctions] [queries]
+        // Fills a detached search index with random item templates and times browse queries through it
+        static bool HandleDebugAuctionSearchCommand(ChatHandler* handler, char const* args)
+        {
+            uint32 auctionCount = 200000;
+            uint32 queryCount = 40;
+
+            if (char* auctionsStr = strtok((char*)args, " "))
+            {
+                auctionCount = uint32(atoi(auctionsStr));
+                if (char* queriesStr = strtok(NULL, " "))
+                    queryCount = uint32(atoi(queriesStr));
+            }
+
+            if (!auctionCount || !queryCount)
+                return false;
+
+            std::vector<ItemTemplate const*> templates;
+            ItemTemplateContainer const* store = sObjectMgr->GetItemTemplateStore();
+            for (ItemTemplateContainer::const_iterator itr = store->begin(); itr != store->end(); ++itr)
+                if (!itr->second.Name1.empty())
+                    templates.push_back(&itr->second);
+
+            if (templates.empty())
+                return false;
+
+            std::vector<int32> properties;
+            for (uint32 i = 0; i < sItemRandomPropertiesStore.GetNumRows(); ++i)
+                if (sItemRandomPropertiesStore.LookupEntry(i))
+                    properties.push_back(int32(i));
+
+            std::vector<AuctionEntry> auctions(auctionCount);
+
+            AuctionSearchIndex index;
+            uint32 startTime = getMSTime();
+            for (uint32 i = 0; i < auctionCount; ++i)
+            {
+                auctions[i].Id = i + 1;
+                int32 property = 0;
+                if (!properties.empty() && roll_chance_i(20))
+                    property = properties[urand(0, properties.size() - 1)];
+
+                index.Insert(&auctions[i], templates[urand(0, templates.size() - 1)], property);
+            }
+            uint32 buildTime = GetMSTimeDiffToNow(startTime);
+
+            // a mix of category, quality, level range and name searches
+            std::vector<AuctionSearchQuery> queries(queryCount);
+            for (uint32 i = 0; i < queryCount; ++i)
+            {
+                AuctionSearchQuery& query = queries[i];
+                ItemTemplate const* proto = templates[urand(0, templates.size() - 1)];
+                switch (i % 4)
+                {
+                    case 0:
+                        query.itemClass = proto->Class;
+                        break;
+                    case 1:
+                        query.itemClass = proto->Class;
+                        query.itemSubClass = proto->SubClass;
+                        query.quality = proto->Quality;
+                        break;
+                    case 2:
+                        query.levelMin = uint8(urand(1, 85));
+                        query.levelMax = query.levelMin + 5;
+                        break;
+                    default:
+                    {
+                        AuctionSearchIndex::BuildSearchName(proto, 0, LOCALE_enUS, query.name);
+                        if (query.name.size() > 4)
+                            query.name = query.name.substr(urand(0, query.name.size() - 4), 4);
+                        break;
+                    }
+                }
+            }
+
+            uint64 indexMatches = 0;
+            std::vector<AuctionEntry*> result;
+            startTime = getMSTime();
+            for (uint32 i = 0; i < queryCount; ++i)
+            {
+                result.clear();
+                index.Search(queries[i], result);
+                indexMatches += result.size();
+            }
+            uint32 indexTime = GetMSTimeDiffToNow(startTime);
+
+            handler->PSendSysMessage("%u synthetic auctions, %u distinct names, %u queries, " UI64FMTD " matches",
+                auctionCount, index.GetNameCount(), queryCount, indexMatches);
+            SendDebugTiming(handler, "Index build", buildTime, auctionCount, "auctions");
+            SendDebugTiming(handler, "Index search", indexTime, queryCount, "queries");
+            return true;
+        }
+
+        // .debug broadcast [listeners] [bytes]
+        // Builds the queued blocks of 100 messages sent to every listener, a header per listener in front of the shared payload
+        static bool HandleDebugBroadcastCommand(ChatHandler* handler, char const* args)
+        {
+            uint32 listenerCount = 3000;
+            uint32 packetSize = 256;
+            uint32 const messageCount = 100;
+
+            if (char* listenersStr = strtok((char*)args, " "))
+            {
+                listenerCount = uint32(atoi(listenersStr));
+                if (char* bytesStr = strtok(NULL, " "))
+                    packetSize = uint32(atoi(bytesStr));
+            }
+
+            if (!listenerCount || !packetSize)
+                return false;
+
+            WorldPacket packet(SMSG_MESSAGE_CHAT, packetSize);
+            packet.resize(packetSize);
+
+            char const header[4] = { 0, 0, 0, 0 };
+            std::vector<ACE_Message_Block*> blocks(listenerCount);
+
+            uint32 startTime = getMSTime();
+            for (uint32 i = 0; i < messageCount; ++i)
+            {
+                SharedWorldPacket shared(packet);
+                for (uint32 j = 0; j < listenerCount; ++j)
+                {
+                    blocks[j] = new ACE_Message_Block(sizeof(header));
+                    blocks[j]->copy(header, sizeof(header));
+                    blocks[j]->cont(shared.DuplicatePayload());
+                }
+
+                for (uint32 j = 0; j < listenerCount; ++j)
+                    blocks[j]->release();
+            }
+            uint32 sharedTime = GetMSTimeDiffToNow(startTime);
+
+            uint64 sharedBytes = uint64(messageCount) * (listenerCount * sizeof(header) + packet.size());
+
+            handler->PSendSysMessage("%u messages of %u bytes to %u listeners, " UI64FMTD " bytes queued", messageCount, packetSize, listenerCount, sharedBytes);
+            SendDebugTiming(handler, "Shared payload", sharedTime, messageCount, "messages");
+            return true;
+        }
+
         static bool HandleDebugMoveflagsCommand(ChatHandler* handler, char const* args)
         {
             Unit* target = handler->getSelectedUnit();
@@ -1749,10 +2414,8 @@ class debug_commandscript : public CommandScript
 
         static bool HandleDebugLoadZ(ChatHandler* handler, char const* args)
         {
-            for (auto gameobject: sObjectMgr->_gameObjectDataStore)
+            sObjectMgr->_gameObjectDataStore.Visit([handler](uint32 guid, GameObjectData const& data)
             {
-                GameObjectData data = gameobject.second;
-
                 if (!data.posZ)
                 {
                     Map* map = sMapMgr->FindMap(data.mapid, 0);
@@ -1765,10 +2428,10 @@ class debug_commandscript : public CommandScript
                         float newPosZ = map->GetHeight(data.phaseMask, data.posX, data.posY, MAX_HEIGHT, true);
 
                         if (newPosZ && newPosZ != -200000.0f)
-                            WorldDatabase.PExecute("UPDATE gameobject SET position_z = %f WHERE guid = %u", newPosZ, gameobject.first);
+                            WorldDatabase.PExecute("UPDATE gameobject SET position_z = %f WHERE guid = %u", newPosZ, guid);
                     }
                 }
-            }
+            });
 
             return true;
         }
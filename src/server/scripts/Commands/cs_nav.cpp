@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2008-2013 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* ScriptData
+Name: nav_commandscript
+%Complete: 100
+Comment: Navigation data and pathfinding commands
+Category: commandscripts
+EndScriptData */
+
+#include "ScriptMgr.h"
+#include "Chat.h"
+#include "Player.h"
+#include "PathGenerator.h"
+#include "NavMapManager.h"
+#include "NavTile.h"
+
+#include <ace/OS_NS_sys_time.h>
+
+class nav_commandscript : public CommandScript
+{
+public:
+    nav_commandscript() : CommandScript("nav_commandscript") { }
+
+    ChatCommand* GetCommands() const
+    {
+        static ChatCommand navCommandTable[] =
+        {
+            { "path",           SEC_ADMINISTRATOR,  false, &HandleNavPathCommand,              "", NULL },
+            { "loc",            SEC_ADMINISTRATOR,  false, &HandleNavLocCommand,               "", NULL },
+            { "stats",          SEC_ADMINISTRATOR,  true,  &HandleNavStatsCommand,             "", NULL },
+            { "bench",          SEC_ADMINISTRATOR,  false, &HandleNavBenchCommand,             "", NULL },
+            { NULL,             0,                  false, NULL,                               "", NULL }
+        };
+
+        static ChatCommand commandTable[] =
+        {
+            { "nav",            SEC_ADMINISTRATOR,  true,  NULL,                               "", navCommandTable },
+            { NULL,             0,                  false, NULL,                               "", NULL }
+        };
+        return commandTable;
+    }
+
+    static char const* GetPathTypeName(PathType type)
+    {
+        switch (type)
+        {
+            case PATHFIND_NORMAL:       return "normal";
+            case PATHFIND_SHORTCUT:     return "shortcut (no navigation data)";
+            case PATHFIND_INCOMPLETE:   return "incomplete";
+            case PATHFIND_NOPATH:       return "no path";
+            default:                    return "blank";
+        }
+    }
+
+    // Path from the selected unit to the player
+    static bool HandleNavPathCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        Player* player = handler->GetSession()->GetPlayer();
+        Unit* unit = handler->getSelectedUnit();
+        if (!unit || unit == player)
+        {
+            handler->SendSysMessage(LANG_SELECT_CHAR_OR_CREATURE);
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        PathGenerator path(unit);
+        path.CalculatePath(player->GetPositionX(), player->GetPositionY(), player->GetPositionZ());
+
+        Movement::PointsArray const& points = path.GetPath();
+        handler->PSendSysMessage("Path type: %s, points: %u, length: %.2f", GetPathTypeName(path.GetPathType()), uint32(points.size()), path.GetPathLength());
+        for (size_t i = 0; i < points.size(); ++i)
+            handler->PSendSysMessage("  %u: %.2f %.2f %.2f", uint32(i), points[i].x, points[i].y, points[i].z);
+
+        G3D::Vector3 const& end = path.GetActualEndPosition();
+        handler->PSendSysMessage("Actual end: %.2f %.2f %.2f", end.x, end.y, end.z);
+        return true;
+    }
+
+    static bool HandleNavLocCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        Player* player = handler->GetSession()->GetPlayer();
+
+        int32 cellX = int32(floor(NAV::WorldToCell(player->GetPositionX())));
+        int32 cellY = int32(floor(NAV::WorldToCell(player->GetPositionY())));
+        uint32 tileX = uint32(cellX) / NAV::NAV_TILE_CELLS;
+        uint32 tileY = uint32(cellY) / NAV::NAV_TILE_CELLS;
+
+        handler->PSendSysMessage("%03u%02u%02u.nav, cell [%u, %u]", player->GetMapId(), tileX, tileY,
+            uint32(cellX) % NAV::NAV_TILE_CELLS, uint32(cellY) % NAV::NAV_TILE_CELLS);
+
+        NAV::NavTile const* tile = NAV::NavMapFactory::createOrGetNavMapManager()->GetTile(player->GetMapId(), tileX, tileY);
+        if (!tile)
+        {
+            handler->PSendSysMessage("No navigation data for this tile");
+            return true;
+        }
+
+        uint32 count = tile->GetLayerCount(uint32(cellX) % NAV::NAV_TILE_CELLS, uint32(cellY) % NAV::NAV_TILE_CELLS);
+        NAV::NavLayer const* layers = tile->GetLayers(uint32(cellX) % NAV::NAV_TILE_CELLS, uint32(cellY) % NAV::NAV_TILE_CELLS);
+        for (uint32 i = 0; i < count; ++i)
+        {
+            std::string links;
+            for (uint32 dir = 0; dir < 8; ++dir)
+            {
+                int32 link = layers[i].GetLink(dir);
+                links += link < 0 ? '-' : char('0' + link);
+            }
+
+            handler->PSendSysMessage("  layer %u: z %.2f, links %s", i, layers[i].z, links.c_str());
+        }
+
+        return true;
+    }
+
+    static bool HandleNavStatsCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        NAV::NavMapManager* manager = NAV::NavMapFactory::createOrGetNavMapManager();
+        PathGeneratorStats stats = PathGenerator::GetStats();
+
+        handler->PSendSysMessage("Pathfinding: %s", sWorld->getBoolConfig(CONFIG_ENABLE_PATHFINDING) ? "enabled" : "disabled");
+        handler->PSendSysMessage("Loaded tiles: %u (%u KB mapped)", manager->GetLoadedTileCount(), uint32(manager->GetLoadedSize() / 1024));
+        handler->PSendSysMessage("Path queries: " UI64FMTD ", without path: " UI64FMTD ", expanded nodes: " UI64FMTD,
+            stats.queries, stats.failedQueries, stats.expandedNodes);
+        if (stats.queries)
+            handler->PSendSysMessage("Average query time: %.1f us", double(stats.totalTime) / stats.queries);
+        return true;
+    }
+
+    // Runs path queries from the player to random points around, measures queries per second
+    static bool HandleNavBenchCommand(ChatHandler* handler, char const* args)
+    {
+        uint32 count = 1000;
+        float radius = 50.0f;
+        if (*args)
+        {
+            char* countStr = strtok((char*)args, " ");
+            char* radiusStr = strtok(NULL, " ");
+
+            int32 value = countStr ? atoi(countStr) : 0;
+            if (value <= 0)
+                return false;
+
+            count = uint32(value);
+            if (radiusStr)
+                radius = std::max(float(atof(radiusStr)), 1.0f);
+        }
+
+        Player* player = handler->GetSession()->GetPlayer();
+        Map* map = player->GetMap();
+
+        // the destinations are prepared first, the height queries are not part of the measurement
+        std::vector<G3D::Vector3> destinations;
+        destinations.reserve(count);
+        for (uint32 i = 0; i < count; ++i)
+        {
+            float x = player->GetPositionX() + frand(-radius, radius);
+            float y = player->GetPositionY() + frand(-radius, radius);
+            float z = map->GetHeight(player->GetPhaseMask(), x, y, player->GetPositionZ() + 10.0f);
+            if (z > INVALID_HEIGHT)
+                destinations.push_back(G3D::Vector3(x, y, z));
+        }
+
+        if (destinations.empty())
+        {
+            handler->PSendSysMessage("No ground found around the player");
+            return true;
+        }
+
+        PathGeneratorStats before = PathGenerator::GetStats();
+        uint32 types[PATHFIND_NOPATH + 1] = { };
+
+        ACE_Time_Value start = ACE_OS::gettimeofday();
+        PathGenerator path(player);
+        for (std::vector<G3D::Vector3>::const_iterator itr = destinations.begin(); itr != destinations.end(); ++itr)
+        {
+            path.CalculatePath(itr->x, itr->y, itr->z);
+            ++types[path.GetPathType()];
+        }
+        ACE_Time_Value elapsed = ACE_OS::gettimeofday() - start;
+
+        PathGeneratorStats after = PathGenerator::GetStats();
+        double seconds = std::max(elapsed.sec() + elapsed.usec() / 1000000.0, 0.000001);
+
+        handler->PSendSysMessage("%u path queries in %.3f s: %.0f queries/s, %.1f expanded nodes per query", uint32(destinations.size()), seconds,
+            destinations.size() / seconds, double(after.expandedNodes - before.expandedNodes) / destinations.size());
+        handler->PSendSysMessage("normal: %u, incomplete: %u, no path: %u, shortcut: %u", types[PATHFIND_NORMAL], types[PATHFIND_INCOMPLETE],
+            types[PATHFIND_NOPATH], types[PATHFIND_SHORTCUT]);
+        return true;
+    }
+};
+
+void AddSC_nav_commandscript()
+{
+    new nav_commandscript();
+}
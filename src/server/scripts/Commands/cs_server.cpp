@@ -27,6 +27,8 @@ EndScriptData */
 #include "SystemConfig.h"
 #include "Config.h"
 #include "ObjectAccessor.h"
+#include "MapManager.h"
+#include "WorldSocketMgr.h"
 
 class server_commandscript : public CommandScript
 {
@@ -74,11 +76,14 @@ public:
 
         static ChatCommand serverCommandTable[] =
         {
+            { "compression",      SEC_ADMINISTRATOR,  true,  &HandleServerCompressionCommand,         "", NULL },
             { "corpses",          SEC_GAMEMASTER,     true,  &HandleServerCorpsesCommand,             "", NULL },
+            { "dbqueues",         SEC_ADMINISTRATOR,  true,  &HandleServerDBQueuesCommand,            "", NULL },
             { "exit",             SEC_CONSOLE,        true,  &HandleServerExitCommand,                "", NULL },
             { "idlerestart",      SEC_ADMINISTRATOR,  true,  NULL,                                    "", serverIdleRestartCommandTable },
             { "idleshutdown",     SEC_ADMINISTRATOR,  true,  NULL,                                    "", serverIdleShutdownCommandTable },
             { "info",             SEC_PLAYER,         true,  &HandleServerInfoCommand,                "", NULL },
+            { "maps",             SEC_ADMINISTRATOR,  true,  &HandleServerMapsCommand,                "", NULL },
             { "motd",             SEC_PLAYER,         true,  &HandleServerMotdCommand,                "", NULL },
             { "plimit",           SEC_ADMINISTRATOR,  true,  &HandleServerPLimitCommand,              "", NULL },
             { "restart",          SEC_ADMINISTRATOR,  true,  NULL,                                    "", serverRestartCommandTable },
@@ -111,6 +116,42 @@ public:
         return true;
     }
 
+    template <class T>
+    static void ShowDatabaseQueues(ChatHandler* handler, DatabaseWorkerPool<T>& database)
+    {
+        static char const* const classNames[MAX_SQL_QUEUE_CLASS] = { "bulk", "save", "interactive" };
+
+        SQLQueueCounters counters[MAX_SQL_QUEUE_CLASS];
+        database.GetQueueCounters(counters);
+
+        for (uint8 i = MAX_SQL_QUEUE_CLASS; i-- > 0;)
+        {
+            SQLQueueCounters const& queue = counters[i];
+            handler->PSendSysMessage("%s queue %s: depth %u, executed " UI64FMTD ", avg wait %u ms, max wait %u ms",
+                database.GetDatabaseName(), classNames[i], queue.depth, queue.executed,
+                queue.executed ? uint32(queue.totalWait / queue.executed) : 0, queue.maxWait);
+
+            // character saves go to the save class, compare with Database.BatchedStatements on and off
+            if (queue.transactions)
+                handler->PSendSysMessage("  transactions " UI64FMTD ": " UI64FMTD " rows in " UI64FMTD " statements, " UI64FMTD " rows/s",
+                    queue.transactions, queue.transactionRows, queue.transactionStatements,
+                    queue.transactionTime ? queue.transactionRows * IN_MILLISECONDS / queue.transactionTime : queue.transactionRows * IN_MILLISECONDS);
+        }
+    }
+
+    // Display depth and latency of the async database queues
+    static bool HandleServerDBQueuesCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        ShowDatabaseQueues(handler, LoginDatabase);
+        ShowDatabaseQueues(handler, CharacterDatabase);
+        ShowDatabaseQueues(handler, WorldDatabase);
+
+        // every one of these blocked a map or the world thread, handler and map code should use AsyncQuery
+        handler->PSendSysMessage("Synchronous queries: %u in the last update, at most %u in one update",
+            sWorld->GetSynchQueriesLastTick(), sWorld->GetSynchQueriesMaxTick());
+        return true;
+    }
+
     static bool HandleServerInfoCommand(ChatHandler* handler, char const* /*args*/)
     {
         uint32 playersNum           = sWorld->GetPlayerCount();
@@ -147,6 +188,69 @@ public:
 
         return true;
     }
+    // Display the update cost of the most expensive maps, .server maps [count]
+    static bool HandleServerMapsCommand(ChatHandler* handler, char const* args)
+    {
+        uint32 count = 10;
+        if (*args)
+        {
+            int32 value = atoi(args);
+            if (value <= 0)
+                return false;
+
+            count = uint32(value);
+        }
+
+        MapUpdater* updater = sMapMgr->GetMapUpdater();
+        if (updater->activated())
+            handler->PSendSysMessage("Map update workers: %u, stolen updates: " UI64FMTD, uint32(updater->worker_count()), updater->steal_count());
+        else
+            handler->PSendSysMessage("Map updates run on the world thread");
+
+        std::vector<MapUpdateStatsEntry> stats;
+        sMapMgr->GetMapUpdateStats(stats);
+
+        for (std::vector<MapUpdateStatsEntry>::const_iterator itr = stats.begin(); itr != stats.end() && count; ++itr, --count)
+        {
+            MapEntry const* mapEntry = sMapStore.LookupEntry(itr->mapId);
+            handler->PSendSysMessage("Map %u (%s) instance %u, players %u: last %u us, avg %u us, max %u us, updates %u, regions %u",
+                itr->mapId, mapEntry ? mapEntry->name : "<unknown>", itr->instanceId, itr->players,
+                itr->stats.lastTime, itr->stats.avgTime, itr->stats.maxTime, itr->stats.updateCount, itr->stats.regions);
+        }
+
+        return true;
+    }
+
+    // Display the SMSG_COMPRESSED_DATA counters per opcode
+    static bool HandleServerCompressionCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        uint32 minSize = sWorldSocketMgr->GetCompressionMinSize();
+        if (minSize)
+            handler->PSendSysMessage("Packet compression: packets of %u bytes or more", minSize);
+        else
+            handler->PSendSysMessage("Packet compression: disabled");
+
+        WorldSocketMgr::CompressionStatsMap stats;
+        sWorldSocketMgr->GetCompressionStats(stats);
+
+        uint64 totalIn = 0;
+        uint64 totalOut = 0;
+        for (WorldSocketMgr::CompressionStatsMap::const_iterator itr = stats.begin(); itr != stats.end(); ++itr)
+        {
+            WorldSocketMgr::CompressionStats const& opcodeStats = itr->second;
+            handler->PSendSysMessage("%s: " UI64FMTD " packets, " UI64FMTD " bytes saved (%.1f%%), " UI64FMTD " us deflate",
+                GetOpcodeNameForLogging(Opcodes(itr->first), WOW_SERVER).c_str(), opcodeStats.packets,
+                opcodeStats.bytesIn - std::min(opcodeStats.bytesOut, opcodeStats.bytesIn),
+                opcodeStats.bytesIn ? 100.0 * (1.0 - double(opcodeStats.bytesOut) / opcodeStats.bytesIn) : 0.0, opcodeStats.time);
+
+            totalIn += opcodeStats.bytesIn;
+            totalOut += opcodeStats.bytesOut;
+        }
+
+        handler->PSendSysMessage("Total: " UI64FMTD " bytes compressed to " UI64FMTD, totalIn, totalOut);
+        return true;
+    }
+
     // Display the 'Message of the day' for the realm
     static bool HandleServerMotdCommand(ChatHandler* handler, char const* /*args*/)
     {
@@ -26,129 +26,76 @@ DB2FileLoader::DB2FileLoader()
 {
     data = NULL;
     fieldsOffset = NULL;
+    unk2 = 0;
+    maxIndex = 0;
 }
 
 bool DB2FileLoader::Load(const char *filename, const char *fmt)
 {
-    uint32 header = 48;
-    if (data)
-    {
-        delete [] data;
-        data=NULL;
-    }
-
-    FILE * f = fopen(filename, "rb");
-    if (!f)
-        return false;
-
-    if (fread(&header, 4, 1, f) != 1)                        // Signature
-    {
-        fclose(f);
-        return false;
-    }
-
-    EndianConvert(header);
-
-    if (header != 0x32424457)
-    {
-        fclose(f);
-        return false;                                       //'WDB2'
-    }
-
-    if (fread(&recordCount, 4, 1, f) != 1)                 // Number of records
-    {
-        fclose(f);
-        return false;
-    }
-
-    EndianConvert(recordCount);
-
-    if (fread(&fieldCount, 4, 1, f) != 1)                 // Number of fields
-    {
-        fclose(f);
-        return false;
-    }
-
-    EndianConvert(fieldCount);
-
-    if (fread(&recordSize, 4, 1, f) != 1)                 // Size of a record
-    {
-        fclose(f);
-        return false;
-    }
-
-    EndianConvert(recordSize);
-
-    if (fread(&stringSize, 4, 1, f) != 1)                 // String size
-    {
-        fclose(f);
-        return false;
-    }
-
-    EndianConvert(stringSize);
+    mapping.reset();
+    data = NULL;
+    delete [] fieldsOffset;
+    fieldsOffset = NULL;
 
-    /* NEW WDB2 FIELDS*/
-    if (fread(&tableHash, 4, 1, f) != 1)                  // Table hash
-    {
-        fclose(f);
+    DBCFileMappingPtr file(new DBCFileMapping());
+    if (!file->Map(filename))
         return false;
-    }
 
-    EndianConvert(tableHash);
+    unsigned char const* cursor = file->GetData();
+    unsigned char const* end = cursor + file->GetSize();
 
-    if (fread(&build, 4, 1, f) != 1)                     // Build
-    {
-        fclose(f);
+    // signature, number of records, number of fields, size of a record, string size, table hash, build, unk1
+    uint32 header[8];
+    if (size_t(end - cursor) < sizeof(header))
         return false;
-    }
 
-    EndianConvert(build);
+    memcpy(header, cursor, sizeof(header));
+    cursor += sizeof(header);
+    for (uint8 i = 0; i < 8; ++i)
+        EndianConvert(header[i]);
 
-    if (fread(&unk1, 4, 1, f) != 1)                     // Unknown WDB2
-    {
-        fclose(f);
+    if (header[0] != 0x32424457)                            //'WDB2'
         return false;
-    }
 
-    EndianConvert(unk1);
+    recordCount = header[1];
+    fieldCount = header[2];
+    recordSize = header[3];
+    stringSize = header[4];
+    tableHash = header[5];
+    build = header[6];
+    unk1 = header[7];
 
     if (build > 12880)
     {
-        if (fread(&unk2, 4, 1, f) != 1)                // Unknown WDB2
-        {
-            fclose(f);
-            return false;
-        }
-        EndianConvert(unk2);
-
-        if (fread(&maxIndex, 4, 1, f) != 1)                           // MaxIndex WDB2
-        {
-            fclose(f);
+        // unk2, MaxIndex, Locales, unk5
+        uint32 extra[4];
+        if (size_t(end - cursor) < sizeof(extra))
             return false;
-        }
-        EndianConvert(maxIndex);
 
-        if (fread(&locale, 4, 1, f) != 1)                             // Locales
-        {
-            fclose(f);
-            return false;
-        }
-        EndianConvert(locale);
+        memcpy(extra, cursor, sizeof(extra));
+        cursor += sizeof(extra);
+        for (uint8 i = 0; i < 4; ++i)
+            EndianConvert(extra[i]);
 
-        if (fread(&unk5, 4, 1, f) != 1)                               // Unknown WDB2
-        {
-            fclose(f);
-            return false;
-        }
-        EndianConvert(unk5);
+        unk2 = extra[0];
+        maxIndex = extra[1];
+        locale = extra[2];
+        unk5 = extra[3];
     }
 
     if (maxIndex != 0)
     {
-        int32 diff = maxIndex - unk2 + 1;
-        fseek(f, diff * 4 + diff * 2, SEEK_CUR);    // diff * 4: an index for rows, diff * 2: a memory allocation bank
+        // diff * 4: an index for rows, diff * 2: a memory allocation bank
+        int64 diff = int64(maxIndex) - int64(unk2) + 1;
+        if (diff < 0 || uint64(diff) * 6 > uint64(end - cursor))
+            return false;
+
+        cursor += diff * 4 + diff * 2;
     }
 
+    if (cursor > end || uint64(end - cursor) < uint64(recordSize) * recordCount + stringSize)
+        return false;
+
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
     for (uint32 i = 1; i < fieldCount; i++)
@@ -160,23 +107,16 @@ bool DB2FileLoader::Load(const char *filename, const char *fmt)
             fieldsOffset[i] += 4;
     }
 
-    data = new unsigned char[recordSize*recordCount+stringSize];
+    // nothing is copied, records and strings are read in place from the mapping
+    mapping = file;
+    data = const_cast<unsigned char*>(cursor);
     stringTable = data + recordSize*recordCount;
 
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
-    {
-        fclose(f);
-        return false;
-    }
-
-    fclose(f);
     return true;
 }
 
 DB2FileLoader::~DB2FileLoader()
 {
-    if (data)
-        delete [] data;
     if (fieldsOffset)
         delete [] fieldsOffset;
 }
@@ -187,6 +127,76 @@ DB2FileLoader::Record DB2FileLoader::getRecord(size_t id)
     return Record(*this, data + id*recordSize);
 }
 
+bool DB2FileLoader::CanUseRecordsInPlace(const char* format) const
+{
+#if TRINITY_ENDIAN == TRINITY_BIGENDIAN
+    return false;
+#else
+    if (strlen(format) != fieldCount)
+        return false;
+
+    // every field of the file must be a field of the structure, with the same size
+    for (uint32 x = 0; format[x]; ++x)
+    {
+        switch (format[x])
+        {
+            case FT_FLOAT:
+            case FT_INT:
+            case FT_IND:
+            case FT_BYTE:
+                break;
+            default:
+                return false;
+        }
+    }
+
+    // the index table of newer files may leave the records unaligned
+    return GetFormatRecordSize(format) == recordSize && recordSize % 4 == 0 && (data - mapping->GetData()) % 4 == 0;
+#endif
+}
+
+char* DB2FileLoader::AutoProduceIndex(const char* format, uint32& records, char**& indexTable)
+{
+    typedef char * ptr;
+    if (!CanUseRecordsInPlace(format))
+        return NULL;
+
+    int32 i;
+    GetFormatRecordSize(format, &i);
+
+    if (i >= 0)
+    {
+        uint32 maxi = 0;
+        for (uint32 y = 0; y < recordCount; y++)
+        {
+            uint32 ind = getRecord(y).getUInt(i);
+            if (ind > maxi)
+                maxi = ind;
+        }
+
+        ++maxi;
+        records = maxi;
+        indexTable = new ptr[maxi];
+        memset(indexTable, 0, maxi * sizeof(ptr));
+    }
+    else
+    {
+        records = recordCount;
+        indexTable = new ptr[recordCount];
+    }
+
+    for (uint32 y = 0; y < recordCount; y++)
+    {
+        char* record = reinterpret_cast<char*>(data + y * recordSize);
+        if (i >= 0)
+            indexTable[getRecord(y).getUInt(i)] = record;
+        else
+            indexTable[y] = record;
+    }
+
+    return reinterpret_cast<char*>(data);
+}
+
 uint32 DB2FileLoader::GetFormatRecordSize(const char * format, int32* index_pos)
 {
     uint32 recordsize = 0;
@@ -365,14 +375,12 @@ char* DB2FileLoader::AutoProduceStringsArrayHolders(const char* format, char* da
     return stringHoldersPool;
 }
 
-char* DB2FileLoader::AutoProduceStrings(const char* format, char* dataTable)
+bool DB2FileLoader::AutoProduceStrings(const char* format, char* dataTable)
 {
     if (strlen(format) != fieldCount)
-        return NULL;
-
-    char* stringPool= new char[stringSize];
-    memcpy(stringPool, stringTable, stringSize);
+        return false;
 
+    bool referenced = false;
     uint32 offset = 0;
 
     for (uint32 y =0; y < recordCount; y++)
@@ -394,8 +402,15 @@ char* DB2FileLoader::AutoProduceStrings(const char* format, char* dataTable)
                 char** slot = (char**)(&dataTable[offset]);
                 if (**((char***)slot) == nullStr)
                 {
-                    const char * st = getRecord(y).getString(x);
-                    *slot=stringPool + (st-(const char*)stringTable);
+                    // the string stays in the mapped string table, empty ones need no mapping
+                    char const* st = getRecord(y).getString(x);
+                    if (*st)
+                    {
+                        *slot = const_cast<char*>(st);
+                        referenced = true;
+                    }
+                    else
+                        *slot = const_cast<char*>(nullStr);
                 }
 
                 offset+=sizeof(char*);
@@ -404,5 +419,5 @@ char* DB2FileLoader::AutoProduceStrings(const char* format, char* dataTable)
         }
     }
 
-    return stringPool;
+    return referenced;
 }
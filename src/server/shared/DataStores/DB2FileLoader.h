@@ -19,6 +19,7 @@
 #define DB2_FILE_LOADER_H
 
 #include "Define.h"
+#include "DBCFileMapping.h"
 #include "Utilities/ByteConverter.h"
 #include <cassert>
 
@@ -77,9 +78,14 @@ class DB2FileLoader
     uint32 GetCols() const { return fieldCount; }
     uint32 GetOffset(size_t id) const { return (fieldsOffset != NULL && id < fieldCount) ? fieldsOffset[id] : 0; }
     bool IsLoaded() const { return (data != NULL); }
+    DBCFileMappingPtr const& GetMapping() const { return mapping; }
+    // true when the structure has the layout of the file record, the records are then used in place
+    bool CanUseRecordsInPlace(const char* fmt) const;
+    char* AutoProduceIndex(const char* fmt, uint32& count, char**& indexTable);
     char* AutoProduceData(const char* fmt, uint32& count, char**& indexTable);
     char* AutoProduceStringsArrayHolders(const char* fmt, char* dataTable);
-    char* AutoProduceStrings(const char* fmt, char* dataTable);
+    // returns true if a string field now points into the string table of this file
+    bool AutoProduceStrings(const char* fmt, char* dataTable);
     static uint32 GetFormatRecordSize(const char * format, int32 * index_pos = NULL);
     static uint32 GetFormatStringsFields(const char * format);
 private:
@@ -89,6 +95,7 @@ private:
     uint32 fieldCount;
     uint32 stringSize;
     uint32 *fieldsOffset;
+    DBCFileMappingPtr mapping;
     unsigned char *data;
     unsigned char *stringTable;
 
@@ -32,15 +32,17 @@ template<class T>
 class DB2Storage
 {
     typedef std::list<char*> StringPoolList;
+    typedef std::list<DBCFileMappingPtr> MappingList;
     typedef std::vector<T*> DataTableEx;
 public:
-    explicit DB2Storage(const char *f) : nCount(0), fieldCount(0), fmt(f), indexTable(NULL), m_dataTable(NULL) { }
+    explicit DB2Storage(const char *f) : nCount(0), fieldCount(0), fmt(f), indexTable(NULL), m_dataTable(NULL), m_dataInPlace(false) { }
     ~DB2Storage() { Clear(); }
 
     T const* LookupEntry(uint32 id) const { return (id>=nCount)?NULL:indexTable[id]; }
     uint32  GetNumRows() const { return nCount; }
     char const* GetFormat() const { return fmt; }
     uint32 GetFieldCount() const { return fieldCount; }
+    bool IsDataInPlace() const { return m_dataInPlace; }
 
         /// Copies the provided entry and stores it.
         void AddEntry(uint32 id, const T* entry)
@@ -74,6 +76,15 @@ public:
 
         fieldCount = db2.GetCols();
 
+        // a store with the record layout of the file only needs an index
+        if (db2.CanUseRecordsInPlace(fmt))
+        {
+            m_dataTable = (T*)db2.AutoProduceIndex(fmt, nCount, (char**&)indexTable);
+            m_dataInPlace = true;
+            m_mappings.push_back(db2.GetMapping());
+            return indexTable != NULL;
+        }
+
         // load raw non-string data
         m_dataTable = (T*)db2.AutoProduceData(fmt, nCount, (char**&)indexTable);
 
@@ -81,7 +92,8 @@ public:
         m_stringPoolList.push_back(db2.AutoProduceStringsArrayHolders(fmt, (char*)m_dataTable));
 
         // load strings from dbc data
-        m_stringPoolList.push_back(db2.AutoProduceStrings(fmt, (char*)m_dataTable));
+        if (db2.AutoProduceStrings(fmt, (char*)m_dataTable))
+            m_mappings.push_back(db2.GetMapping());
 
         // error in dbc file at loading if NULL
         return indexTable!=NULL;
@@ -98,8 +110,9 @@ public:
         if (!db2.Load(fn, fmt))
             return false;
 
-        // load strings from another locale dbc data
-        m_stringPoolList.push_back(db2.AutoProduceStrings(fmt, (char*)m_dataTable));
+        // load strings from another locale dbc data, the file stays mapped only if some of its strings are used
+        if (db2.AutoProduceStrings(fmt, (char*)m_dataTable))
+            m_mappings.push_back(db2.GetMapping());
 
         return true;
     }
@@ -111,8 +124,10 @@ public:
 
         delete[] ((char*)indexTable);
         indexTable = NULL;
-        delete[] ((char*)m_dataTable);
+        if (!m_dataInPlace)
+            delete[] ((char*)m_dataTable);
         m_dataTable = NULL;
+        m_dataInPlace = false;
             for (typename DataTableEx::const_iterator itr = m_dataTableEx.begin(); itr != m_dataTableEx.end(); ++itr)
                 delete *itr;
             m_dataTableEx.clear();
@@ -122,6 +137,7 @@ public:
             delete[] m_stringPoolList.front();
             m_stringPoolList.pop_front();
         }
+        m_mappings.clear();
         nCount = 0;
     }
 
@@ -134,8 +150,10 @@ private:
     char const* fmt;
     T** indexTable;
     T* m_dataTable;
+    bool m_dataInPlace;                                     // m_dataTable points into the mapped file
     DataTableEx m_dataTableEx;
     StringPoolList m_stringPoolList;
+    MappingList m_mappings;                                 // files the records or strings point into
 };
 
 #endif
\ No newline at end of file
@@ -23,67 +23,40 @@
 #include "DBCFileLoader.h"
 #include "Errors.h"
 
+static char emptyString[] = "";
+
 DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), stringSize(0), fieldsOffset(NULL), data(NULL), stringTable(NULL) { }
 
 bool DBCFileLoader::Load(const char* filename, const char* fmt)
 {
-    uint32 header;
-    if (data)
-    {
-        delete [] data;
-        data = NULL;
-    }
+    mapping.reset();
+    data = NULL;
+    delete [] fieldsOffset;
+    fieldsOffset = NULL;
 
-    FILE* f = fopen(filename, "rb");
-    if (!f)
+    DBCFileMappingPtr file(new DBCFileMapping());
+    if (!file->Map(filename))
         return false;
 
-    if (fread(&header, 4, 1, f) != 1)                        // Number of records
-    {
-        fclose(f);
+    // header: signature, number of records, number of fields, size of a record, string size
+    uint32 header[5];
+    if (file->GetSize() < sizeof(header))
         return false;
-    }
-
 
-    EndianConvert(header);
+    memcpy(header, file->GetData(), sizeof(header));
+    for (uint8 i = 0; i < 5; ++i)
+        EndianConvert(header[i]);
 
-    if (header != 0x43424457)                                //'WDBC'
-    {
-        fclose(f);
-        return false;
-    }
-
-    if (fread(&recordCount, 4, 1, f) != 1)                   // Number of records
-    {
-        fclose(f);
+    if (header[0] != 0x43424457)                             //'WDBC'
         return false;
-    }
 
-    EndianConvert(recordCount);
+    recordCount = header[1];
+    fieldCount = header[2];
+    recordSize = header[3];
+    stringSize = header[4];
 
-    if (fread(&fieldCount, 4, 1, f) != 1)                    // Number of fields
-    {
-        fclose(f);
+    if (file->GetSize() < sizeof(header) + uint64(recordSize) * recordCount + stringSize)
         return false;
-    }
-
-    EndianConvert(fieldCount);
-
-    if (fread(&recordSize, 4, 1, f) != 1)                    // Size of a record
-    {
-        fclose(f);
-        return false;
-    }
-
-    EndianConvert(recordSize);
-
-    if (fread(&stringSize, 4, 1, f) != 1)                    // String size
-    {
-        fclose(f);
-        return false;
-    }
-
-    EndianConvert(stringSize);
 
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
@@ -96,25 +69,16 @@ bool DBCFileLoader::Load(const char* filename, const char* fmt)
             fieldsOffset[i] += sizeof(uint32);
     }
 
-    data = new unsigned char[recordSize * recordCount + stringSize];
-    stringTable = data + recordSize*recordCount;
-
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
-    {
-        fclose(f);
-        return false;
-    }
-
-    fclose(f);
+    // nothing is copied, records and strings are read in place from the mapping
+    mapping = file;
+    data = mapping->GetData() + sizeof(header);
+    stringTable = data + recordSize * recordCount;
 
     return true;
 }
 
 DBCFileLoader::~DBCFileLoader()
 {
-    if (data)
-        delete [] data;
-
     if (fieldsOffset)
         delete [] fieldsOffset;
 }
@@ -125,6 +89,80 @@ DBCFileLoader::Record DBCFileLoader::getRecord(size_t id)
     return Record(*this, data + id * recordSize);
 }
 
+char* DBCFileLoader::GetEmptyString()
+{
+    return emptyString;
+}
+
+bool DBCFileLoader::CanUseRecordsInPlace(const char* format) const
+{
+#if TRINITY_ENDIAN == TRINITY_BIGENDIAN
+    return false;
+#else
+    if (strlen(format) != fieldCount)
+        return false;
+
+    // every field of the file must be a field of the structure, with the same size
+    for (uint32 x = 0; format[x]; ++x)
+    {
+        switch (format[x])
+        {
+            case FT_FLOAT:
+            case FT_INT:
+            case FT_IND:
+            case FT_BYTE:
+                break;
+            default:
+                return false;
+        }
+    }
+
+    return GetFormatRecordSize(format) == recordSize && recordSize % sizeof(uint32) == 0;
+#endif
+}
+
+char* DBCFileLoader::AutoProduceIndex(const char* format, uint32& records, char**& indexTable)
+{
+    typedef char* ptr;
+    if (!CanUseRecordsInPlace(format))
+        return NULL;
+
+    int32 i;
+    GetFormatRecordSize(format, &i);
+
+    if (i >= 0)
+    {
+        uint32 maxi = 0;
+        for (uint32 y = 0; y < recordCount; ++y)
+        {
+            uint32 ind = getRecord(y).getUInt(i);
+            if (ind > maxi)
+                maxi = ind;
+        }
+
+        ++maxi;
+        records = maxi;
+        indexTable = new ptr[maxi];
+        memset(indexTable, 0, maxi * sizeof(ptr));
+    }
+    else
+    {
+        records = recordCount;
+        indexTable = new ptr[recordCount];
+    }
+
+    for (uint32 y = 0; y < recordCount; ++y)
+    {
+        char* record = reinterpret_cast<char*>(data + y * recordSize);
+        if (i >= 0)
+            indexTable[getRecord(y).getUInt(i)] = record;
+        else
+            indexTable[y] = record;
+    }
+
+    return reinterpret_cast<char*>(data);
+}
+
 uint32 DBCFileLoader::GetFormatRecordSize(const char* format, int32* index_pos)
 {
     uint32 recordsize = 0;
@@ -268,14 +306,12 @@ char* DBCFileLoader::AutoProduceData(const char* format, uint32& records, char**
     return dataTable;
 }
 
-char* DBCFileLoader::AutoProduceStrings(const char* format, char* dataTable)
+bool DBCFileLoader::AutoProduceStrings(const char* format, char* dataTable)
 {
     if (strlen(format) != fieldCount)
-        return NULL;
-
-    char* stringPool = new char[stringSize];
-    memcpy(stringPool, stringTable, stringSize);
+        return false;
 
+    bool referenced = false;
     uint32 offset = 0;
 
     for (uint32 y = 0; y < recordCount; ++y)
@@ -300,8 +336,15 @@ char* DBCFileLoader::AutoProduceStrings(const char* format, char* dataTable)
                     char** slot = (char**)(&dataTable[offset]);
                     if (!*slot || !**slot)
                     {
-                        const char * st = getRecord(y).getString(x);
-                        *slot=stringPool+(st-(const char*)stringTable);
+                        // empty strings of every file share one, the others stay in the mapped string table
+                        char* st = const_cast<char*>(getRecord(y).getString(x));
+                        if (*st)
+                        {
+                            *slot = st;
+                            referenced = true;
+                        }
+                        else
+                            *slot = emptyString;
                     }
                     offset += sizeof(char*);
                     break;
@@ -320,5 +363,5 @@ char* DBCFileLoader::AutoProduceStrings(const char* format, char* dataTable)
         }
     }
 
-    return stringPool;
+    return referenced;
 }
@@ -19,6 +19,7 @@
 #ifndef DBC_FILE_LOADER_H
 #define DBC_FILE_LOADER_H
 #include "Define.h"
+#include "DBCFileMapping.h"
 #include "Utilities/ByteConverter.h"
 #include <cassert>
 
@@ -79,9 +80,15 @@ class DBCFileLoader
         uint32 GetCols() const { return fieldCount; }
         uint32 GetOffset(size_t id) const { return (fieldsOffset != NULL && id < fieldCount) ? fieldsOffset[id] : 0; }
         bool IsLoaded() const { return data != NULL; }
+        DBCFileMappingPtr const& GetMapping() const { return mapping; }
+        // true when the structure has the layout of the file record, the records are then used in place
+        bool CanUseRecordsInPlace(const char* fmt) const;
+        char* AutoProduceIndex(const char* fmt, uint32& count, char**& indexTable);
         char* AutoProduceData(const char* fmt, uint32& count, char**& indexTable, uint32 sqlRecordCount, uint32 sqlHighestIndex, char *& sqlDataTable);
-        char* AutoProduceStrings(const char* fmt, char* dataTable);
+        // returns true if a string field now points into the string table of this file
+        bool AutoProduceStrings(const char* fmt, char* dataTable);
         static uint32 GetFormatRecordSize(const char * format, int32 * index_pos = NULL);
+        static char* GetEmptyString();
     private:
 
         uint32 recordSize;
@@ -89,6 +96,7 @@ class DBCFileLoader
         uint32 fieldCount;
         uint32 stringSize;
         uint32 *fieldsOffset;
+        DBCFileMappingPtr mapping;
         unsigned char *data;
         unsigned char *stringTable;
 };
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ * Copyright (C) 2005-2009 MaNGOS <http://getmangos.com/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DBCFileMapping.h"
+
+#include <ace/Mem_Map.h>
+
+DBCFileMapping::DBCFileMapping() : _mapping(NULL), _data(NULL), _size(0) { }
+
+DBCFileMapping::~DBCFileMapping()
+{
+    delete _mapping;
+}
+
+bool DBCFileMapping::Map(char const* filename)
+{
+    if (ACE_OS::access(filename, R_OK) == -1)
+        return false;
+
+    // private and writable: the file is never modified, written pages are copied on write
+    _mapping = new ACE_Mem_Map();
+    if (_mapping->map(filename, static_cast<size_t>(-1), O_RDONLY, ACE_DEFAULT_FILE_PERMS, PROT_RDWR, ACE_MAP_PRIVATE) == -1)
+    {
+        delete _mapping;
+        _mapping = NULL;
+        return false;
+    }
+
+    // the mapping stays valid without the descriptor, do not hold one open per loaded store
+    _mapping->close_handle();
+
+    _data = static_cast<unsigned char*>(_mapping->addr());
+    _size = _mapping->size();
+    return true;
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ * Copyright (C) 2005-2009 MaNGOS <http://getmangos.com/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DBC_FILE_MAPPING_H
+#define DBC_FILE_MAPPING_H
+
+#include "Define.h"
+
+#include <memory>
+
+class ACE_Mem_Map;
+
+// A DBC or DB2 file mapped copy on write. Records are read straight from the page cache and
+// only the pages the core patches after loading (the const_cast fixups) get a private copy.
+// The mapping is shared by the stores whose records or strings point into it.
+class DBCFileMapping
+{
+    public:
+        DBCFileMapping();
+        ~DBCFileMapping();
+
+        bool Map(char const* filename);
+
+        unsigned char* GetData() const { return _data; }
+        size_t GetSize() const { return _size; }
+
+    private:
+        DBCFileMapping(DBCFileMapping const&);
+        DBCFileMapping& operator=(DBCFileMapping const&);
+
+        ACE_Mem_Map* _mapping;
+        unsigned char* _data;
+        size_t _size;
+};
+
+typedef std::shared_ptr<DBCFileMapping> DBCFileMappingPtr;
+
+#endif
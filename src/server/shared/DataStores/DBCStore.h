@@ -68,10 +68,10 @@ struct SqlDbc
 template<class T>
 class DBCStorage
 {
-    typedef std::list<char*> StringPoolList;
+    typedef std::list<DBCFileMappingPtr> MappingList;
     public:
         explicit DBCStorage(const char *f) :
-            fmt(f), nCount(0), fieldCount(0), dataTable(NULL)
+            fmt(f), nCount(0), fieldCount(0), dataTable(NULL), dataInPlace(false)
         {
             indexTable.asT = NULL;
         }
@@ -84,6 +84,7 @@ class DBCStorage
         uint32  GetNumRows() const { return nCount; }
         char const* GetFormat() const { return fmt; }
         uint32 GetFieldCount() const { return fieldCount; }
+        bool IsDataInPlace() const { return dataInPlace; }
 
         bool Load(char const* fn, SqlDbc * sql)
         {
@@ -126,10 +127,19 @@ class DBCStorage
             char * sqlDataTable;
             fieldCount = dbc.GetCols();
 
-            dataTable = (T*)dbc.AutoProduceData(fmt, nCount, indexTable.asChar,
-                sqlRecordCount, sqlHighestIndex, sqlDataTable);
+            // without sql rows to append, a store with the record layout of the file only needs an index
+            if (!result && dbc.CanUseRecordsInPlace(fmt))
+            {
+                dataTable = (T*)dbc.AutoProduceIndex(fmt, nCount, indexTable.asChar);
+                dataInPlace = true;
+                mappings.push_back(dbc.GetMapping());
+            }
+            else
+                dataTable = (T*)dbc.AutoProduceData(fmt, nCount, indexTable.asChar,
+                    sqlRecordCount, sqlHighestIndex, sqlDataTable);
 
-            stringPoolList.push_back(dbc.AutoProduceStrings(fmt, (char*)dataTable));
+            if (dbc.AutoProduceStrings(fmt, (char*)dataTable) && !dataInPlace)
+                mappings.push_back(dbc.GetMapping());
 
             // Insert sql data into arrays
             if (result)
@@ -178,8 +188,7 @@ class DBCStorage
                                         offset+=1;
                                         break;
                                     case FT_STRING:
-                                        // Beginning of the pool - empty string
-                                        *((char**)(&sqlDataTable[offset]))=stringPoolList.back();
+                                        *((char**)(&sqlDataTable[offset]))=DBCFileLoader::GetEmptyString();
                                         offset+=sizeof(char*);
                                         break;
                                 }
@@ -247,7 +256,9 @@ class DBCStorage
             if (!dbc.Load(fn, fmt))
                 return false;
 
-            stringPoolList.push_back(dbc.AutoProduceStrings(fmt, (char*)dataTable));
+            // the localized file stays mapped only if some of its strings are used
+            if (dbc.AutoProduceStrings(fmt, (char*)dataTable))
+                mappings.push_back(dbc.GetMapping());
 
             return true;
         }
@@ -259,14 +270,12 @@ class DBCStorage
 
             delete[] ((char*)indexTable.asT);
             indexTable.asT = NULL;
-            delete[] ((char*)dataTable);
+            if (!dataInPlace)
+                delete[] ((char*)dataTable);
             dataTable = NULL;
+            dataInPlace = false;
 
-            while (!stringPoolList.empty())
-            {
-                delete[] stringPoolList.front();
-                stringPoolList.pop_front();
-            }
+            mappings.clear();
             nCount = 0;
         }
 
@@ -283,7 +292,8 @@ class DBCStorage
         indexTable;
 
         T* dataTable;
-        StringPoolList stringPoolList;
+        bool dataInPlace;                                   // dataTable points into the mapped file
+        MappingList mappings;                               // files the records or strings point into
 };
 
 #endif
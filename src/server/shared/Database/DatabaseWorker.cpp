@@ -18,10 +18,11 @@
 #include "DatabaseEnv.h"
 #include "DatabaseWorker.h"
 #include "SQLOperation.h"
+#include "SQLOperationQueue.h"
 #include "MySQLConnection.h"
 #include "MySQLThreading.h"
 
-DatabaseWorker::DatabaseWorker(ACE_Activation_Queue* new_queue, MySQLConnection* con) :
+DatabaseWorker::DatabaseWorker(SQLOperationQueue* new_queue, MySQLConnection* con) :
 m_queue(new_queue),
 m_conn(con)
 {
@@ -37,13 +38,14 @@ int DatabaseWorker::svc()
     SQLOperation *request = NULL;
     while (1)
     {
-        request = (SQLOperation*)(m_queue->dequeue());
+        request = m_queue->Dequeue();
         if (!request)
             break;
 
         request->SetConnection(m_conn);
         request->call();
 
+        m_queue->Finish(request);
         delete request;
     }
 
@@ -19,12 +19,14 @@
 #define _DATABASEWORKERPOOL_H
 
 #include <ace/Thread_Mutex.h>
+#include <ace/Atomic_Op.h>
 
 #include "Common.h"
 #include "Callback.h"
 #include "MySQLConnection.h"
 #include "Transaction.h"
 #include "DatabaseWorker.h"
+#include "SQLOperationQueue.h"
 #include "PreparedStatement.h"
 #include "Log.h"
 #include "QueryResult.h"
@@ -47,7 +49,7 @@ class DatabaseWorkerPool
     public:
         /* Activity state */
         DatabaseWorkerPool() :
-        _queue(new ACE_Activation_Queue())
+        _queue(NULL), _synchQueries(0)
         {
             memset(_connectionCount, 0, sizeof(_connectionCount));
 
@@ -64,7 +66,8 @@ class DatabaseWorkerPool
             sLog->outInfo(LOG_FILTER_SQL_DRIVER, "Opening DatabasePool '%s'. Asynchronous connections: %u, synchronous connections: %u.",
                 GetDatabaseName(), async_threads, synch_threads);
 
-            //! Open asynchronous connections (delayed operations)
+            //! Open asynchronous connections (delayed operations), they share one queue
+            _queue = new SQLOperationQueue();
             _connections[IDX_ASYNC].resize(async_threads);
             for (uint8 i = 0; i < async_threads; ++i)
             {
@@ -97,10 +100,9 @@ class DatabaseWorkerPool
         {
             sLog->outInfo(LOG_FILTER_SQL_DRIVER, "Closing down DatabasePool '%s'.", GetDatabaseName());
 
-            //! Shuts down delaythreads for this connection pool by underlying deactivate().
-            //! The next dequeue attempt in the worker thread tasks will result in an error,
-            //! ultimately ending the worker thread task.
-            _queue->queue()->close();
+            //! Shuts down delaythreads for this connection pool. They execute what is still queued,
+            //! then the next dequeue attempt returns NULL, ultimately ending the worker thread task.
+            _queue->Close();
 
             for (uint8 i = 0; i < _connectionCount[IDX_ASYNC]; ++i)
             {
@@ -121,8 +123,9 @@ class DatabaseWorkerPool
             for (uint8 i = 0; i < _connectionCount[IDX_SYNCH]; ++i)
                 _connections[IDX_SYNCH][i]->Close();
 
-            //! Deletes the ACE_Activation_Queue object and its underlying ACE_Message_Queue
+            //! Deletes the SQLOperationQueue
             delete _queue;
+            _queue = NULL;
 
             sLog->outInfo(LOG_FILTER_SQL_DRIVER, "All connections on DatabasePool '%s' closed.", GetDatabaseName());
         }
@@ -139,7 +142,7 @@ class DatabaseWorkerPool
                 return;
 
             BasicStatementTask* task = new BasicStatementTask(sql);
-            Enqueue(task);
+            _queue->Enqueue(task, SQL_QUEUE_INTERACTIVE, 0, true);
         }
 
         //! Enqueues a one-way SQL operation in string format -with variable args- that will be executed asynchronously.
@@ -160,10 +163,12 @@ class DatabaseWorkerPool
 
         //! Enqueues a one-way SQL operation in prepared statement format that will be executed asynchronously.
         //! Statement must be prepared with CONNECTION_ASYNC flag.
-        void Execute(PreparedStatement* stmt)
+        //! Writes with the same non zero orderKey are executed in the order they were enqueued, a write without key
+        //! after every write enqueued before it, see SQLOperationQueue.
+        void Execute(PreparedStatement* stmt, SQLQueueClass queueClass = SQL_QUEUE_INTERACTIVE, uint64 orderKey = 0)
         {
             PreparedStatementTask* task = new PreparedStatementTask(stmt);
-            Enqueue(task);
+            _queue->Enqueue(task, queueClass, orderKey, true);
         }
 
         /**
@@ -221,6 +226,7 @@ class DatabaseWorkerPool
             if (!conn)
                 conn = GetFreeConnection();
 
+            ++_synchQueries;
             ResultSet* result = conn->Query(sql);
             conn->Unlock();
             if (!result || !result->GetRowCount())
@@ -270,6 +276,7 @@ class DatabaseWorkerPool
         PreparedQueryResult Query(PreparedStatement* stmt)
         {
             T* t = GetFreeConnection();
+            ++_synchQueries;
             PreparedResultSet* ret = t->Query(stmt);
             t->Unlock();
 
@@ -295,7 +302,7 @@ class DatabaseWorkerPool
         {
             QueryResultFuture res;
             BasicStatementTask* task = new BasicStatementTask(sql, res);
-            Enqueue(task);
+            _queue->Enqueue(task, SQL_QUEUE_INTERACTIVE, 0, false);
             return res;         //! Actual return value has no use yet
         }
 
@@ -315,11 +322,13 @@ class DatabaseWorkerPool
         //! Enqueues a query in prepared format that will set the value of the PreparedQueryResultFuture return object as soon as the query is executed.
         //! The return value is then processed in ProcessQueryCallback methods.
         //! Statement must be prepared with CONNECTION_ASYNC flag.
-        PreparedQueryResultFuture AsyncQuery(PreparedStatement* stmt)
+        //! The query waits for the writes enqueued before it with the same orderKey and those without key, without key for
+        //! every write enqueued before it.
+        PreparedQueryResultFuture AsyncQuery(PreparedStatement* stmt, SQLQueueClass queueClass = SQL_QUEUE_INTERACTIVE, uint64 orderKey = 0)
         {
             PreparedQueryResultFuture res;
             PreparedStatementTask* task = new PreparedStatementTask(stmt, res);
-            Enqueue(task);
+            _queue->Enqueue(task, queueClass, orderKey, false);
             return res;
         }
 
@@ -327,11 +336,11 @@ class DatabaseWorkerPool
         //! return object as soon as the query is executed.
         //! The return value is then processed in ProcessQueryCallback methods.
         //! Any prepared statements added to this holder need to be prepared with the CONNECTION_ASYNC flag.
-        QueryResultHolderFuture DelayQueryHolder(SQLQueryHolder* holder)
+        QueryResultHolderFuture DelayQueryHolder(SQLQueryHolder* holder, SQLQueueClass queueClass = SQL_QUEUE_INTERACTIVE, uint64 orderKey = 0)
         {
             QueryResultHolderFuture res;
             SQLQueryHolderTask* task = new SQLQueryHolderTask(holder, res);
-            Enqueue(task);
+            _queue->Enqueue(task, queueClass, orderKey, false);
             return res;     //! Fool compiler, has no use yet
         }
 
@@ -346,8 +355,8 @@ class DatabaseWorkerPool
         }
 
         //! Enqueues a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
-        //! were appended to the transaction will be respected during execution.
-        void CommitTransaction(SQLTransaction transaction)
+        //! were appended to the transaction will be respected during execution. Ordered against other writes like Execute.
+        void CommitTransaction(SQLTransaction transaction, SQLQueueClass queueClass = SQL_QUEUE_INTERACTIVE, uint64 orderKey = 0)
         {
             #ifdef TRINITY_DEBUG
             //! Only analyze transaction weaknesses in Debug mode.
@@ -356,17 +365,17 @@ class DatabaseWorkerPool
             switch (transaction->GetSize())
             {
                 case 0:
-                    sLog->outDebug(LOG_FILTER_SQL_DRIVER, "Transaction contains 0 queries. Not executing.");
+                    TC_LOG_DEBUG(LOG_FILTER_SQL_DRIVER, "Transaction contains 0 queries. Not executing.");
                     return;
                 case 1:
-                    sLog->outDebug(LOG_FILTER_SQL_DRIVER, "Warning: Transaction only holds 1 query, consider removing Transaction context in code.");
+                    TC_LOG_DEBUG(LOG_FILTER_SQL_DRIVER, "Warning: Transaction only holds 1 query, consider removing Transaction context in code.");
                     break;
                 default:
                     break;
             }
             #endif // TRINITY_DEBUG
 
-            Enqueue(new TransactionTask(transaction));
+            _queue->Enqueue(new TransactionTask(transaction), queueClass, orderKey, true);
         }
 
         //! Directly executes a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
@@ -376,22 +385,23 @@ class DatabaseWorkerPool
             MySQLConnection* con = GetFreeConnection();
             if (con->ExecuteTransaction(transaction))
             {
+                transaction->SetCommitted(true);
                 con->Unlock();      // OK, operation succesful
                 return;
             }
 
             //! Handle MySQL Errno 1213 without extending deadlock to the core itself
             //! TODO: More elegant way
+            bool committed = false;
             if (con->GetLastError() == 1213)
             {
                 uint8 loopBreaker = 5;
-                for (uint8 i = 0; i < loopBreaker; ++i)
-                {
-                    if (con->ExecuteTransaction(transaction))
-                        break;
-                }
+                for (uint8 i = 0; i < loopBreaker && !committed; ++i)
+                    committed = con->ExecuteTransaction(transaction);
             }
 
+            transaction->SetCommitted(committed);
+
             //! Clean up now.
             transaction->Cleanup();
 
@@ -430,6 +440,21 @@ class DatabaseWorkerPool
             return new PreparedStatement(index);
         }
 
+        //! Collects rows of an INSERT or REPLACE prepared statement that are sent as multi-row statements.
+        //! Pointer is owned by the transaction it is appended to.
+        BatchedStatement* GetBatchedStatement(uint32 index)
+        {
+            return new BatchedStatement(index);
+        }
+
+        //! Disabled, the rows of a BatchedStatement are sent one statement per row. Call before the pool is used.
+        void SetBatchedStatements(bool enable)
+        {
+            for (uint8 i = 0; i < IDX_SIZE; ++i)
+                for (size_t j = 0; j < _connections[i].size(); ++j)
+                    _connections[i][j]->SetBatchedStatements(enable);
+        }
+
         //! Apply escape string'ing for current collation. (utf8)
         void EscapeString(std::string& str)
         {
@@ -456,11 +481,23 @@ class DatabaseWorkerPool
                 }
             }
 
-            //! Assuming all worker threads are free, every worker thread will receive 1 ping operation request
-            //! If one or more worker threads are busy, the ping operations will not be split evenly, but this doesn't matter
-            //! as the sole purpose is to prevent connections from idling.
-            for (size_t i = 0; i < _connections[IDX_ASYNC].size(); ++i)
-                Enqueue(new PingOperation);
+            //! As many pings as there are async connections, in the bulk class they run once nothing else waits
+            for (uint8 i = 0; i < _connectionCount[IDX_ASYNC]; ++i)
+                _queue->Enqueue(new PingOperation, SQL_QUEUE_BULK, 0, false);
+        }
+
+        //! Queries that blocked their calling thread since startup, see World::UpdateSynchQueryCount.
+        uint64 GetSynchQueryCount() const { return _synchQueries.value(); }
+
+        //! Depth and latency counters of the async queue.
+        void GetQueueCounters(SQLQueueCounters (&counters)[MAX_SQL_QUEUE_CLASS])
+        {
+            _queue->GetCounters(counters);
+        }
+
+        char const* GetDatabaseName() const
+        {
+            return _connectionInfo.database.c_str();
         }
 
     private:
@@ -472,11 +509,6 @@ class DatabaseWorkerPool
             return mysql_real_escape_string(_connections[IDX_SYNCH][0]->GetHandle(), to, from, length);
         }
 
-        void Enqueue(SQLOperation* op)
-        {
-            _queue->enqueue(op);
-        }
-
         //! Gets a free connection in the synchronous connection pool.
         //! Caller MUST call t->Unlock() after touching the MySQL context to prevent deadlocks.
         T* GetFreeConnection()
@@ -496,11 +528,6 @@ class DatabaseWorkerPool
             return NULL;
         }
 
-        char const* GetDatabaseName() const
-        {
-            return _connectionInfo.database.c_str();
-        }
-
     private:
         enum _internalIndex
         {
@@ -509,7 +536,8 @@ class DatabaseWorkerPool
             IDX_SIZE,
         };
 
-        ACE_Activation_Queue*           _queue;             //! Queue shared by async worker threads.
+        SQLOperationQueue*              _queue;             //! Queue shared by the async connections.
+        ACE_Atomic_Op<ACE_Thread_Mutex, uint64> _synchQueries; //! Synchronous Query() calls.
         std::vector<T*>                 _connections[IDX_SIZE];
         uint32                          _connectionCount[IDX_SIZE];       //! Counter of MySQL connections;
         MySQLConnectionInfo             _connectionInfo;
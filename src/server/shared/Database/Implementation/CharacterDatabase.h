@@ -26,7 +26,7 @@ class CharacterDatabaseConnection : public MySQLConnection
     public:
         //- Constructors for sync and async connections
         CharacterDatabaseConnection(MySQLConnectionInfo& connInfo) : MySQLConnection(connInfo) {}
-        CharacterDatabaseConnection(ACE_Activation_Queue* q, MySQLConnectionInfo& connInfo) : MySQLConnection(q, connInfo) {}
+        CharacterDatabaseConnection(SQLOperationQueue* q, MySQLConnectionInfo& connInfo) : MySQLConnection(q, connInfo) {}
 
         //- Loads database type specific prepared statements
         void DoPrepareStatements();
@@ -139,6 +139,7 @@ enum CharacterDatabaseStatements
     CHAR_SEL_CHARACTER_QUESTSTATUSREW,
     CHAR_SEL_ACCOUNT_INSTANCELOCKTIMES,
     CHAR_SEL_MAILITEMS,
+    CHAR_SEL_MAILITEMS_BY_RECEIVER,
     CHAR_SEL_AUCTION_ITEMS,
     CHAR_INS_AUCTION,
     CHAR_DEL_AUCTION,
@@ -277,8 +278,10 @@ enum CharacterDatabaseStatements
     CHAR_INS_EQUIP_SET,
     CHAR_DEL_EQUIP_SET,
 
-    CHAR_INS_AURA,
-    CHAR_INS_AURA_EFFECT,
+    CHAR_REP_AURA,
+    CHAR_REP_AURA_EFFECT,
+    CHAR_DEL_AURA_BY_KEY,
+    CHAR_DEL_AURA_EFFECT_BY_SLOT,
 
     CHAR_SEL_PLAYER_CURRENCY,
     CHAR_UPD_PLAYER_CURRENCY,
@@ -507,6 +510,8 @@ enum CharacterDatabaseStatements
     CHAR_UPD_CHAR_TITLES_FACTION_CHANGE,
     CHAR_RES_CHAR_TITLES_FACTION_CHANGE,
     CHAR_DEL_CHAR_SPELL_COOLDOWN,
+    CHAR_REP_CHAR_SPELL_COOLDOWN,
+    CHAR_DEL_CHAR_SPELL_COOLDOWN_BY_SPELL,
     CHAR_DEL_CHARACTER,
     CHAR_DEL_CHAR_ACTION,
     CHAR_DEL_CHAR_AURA,
@@ -545,12 +550,13 @@ enum CharacterDatabaseStatements
     CHAR_UDP_CHAR_SKILLS,
     CHAR_INS_CHAR_SPELL,
     CHAR_DEL_CHAR_STATS,
-    CHAR_INS_CHAR_STATS,
+    CHAR_REP_CHAR_STATS,
     CHAR_DEL_PETITION_BY_OWNER,
     CHAR_DEL_PETITION_SIGNATURE_BY_OWNER,
     CHAR_DEL_PETITION_BY_OWNER_AND_TYPE,
     CHAR_DEL_PETITION_SIGNATURE_BY_OWNER_AND_TYPE,
-    CHAR_INS_CHAR_GLYPHS,
+    CHAR_REP_CHAR_GLYPHS,
+    CHAR_DEL_CHAR_GLYPHS_BY_SPEC,
     CHAR_DEL_CHAR_TALENT_BY_SPELL_SPEC,
     CHAR_INS_CHAR_TALENT,
     CHAR_DEL_CHAR_ACTION_EXCEPT_SPEC,
@@ -586,6 +592,7 @@ enum CharacterDatabaseStatements
     
     CHAR_DEL_CUF_PROFILE,
     CHAR_REP_CUF_PROFILE,
+    CHAR_DEL_CUF_PROFILE_BY_NAME,
     CHAR_SEL_CUF_PROFILE,
 
     CHAR_UPD_PET_DATA_OWNER,
@@ -601,14 +608,12 @@ enum CharacterDatabaseStatements
     CHAR_INS_WEEKLY_BOSS_KILL,
     CHAR_UPD_WEEKLY_BOSS_KILL,
     CHAR_DEL_WEEKLY_BOSS_KILLS,
-    CHAR_SEL_WEEKLY_BOSS_KILL,
-    CHAR_SEL_WEEKLY_BOSS_KILLS,
-    CHAR_SEL_WEEKLY_BOSS_MAPS,
+    CHAR_SEL_CHARACTER_WEEKLY_BOSS_KILLS,
 
     // Dynamic Difficulty raid map system.
     CHAR_INS_DYN_DIFFICULTY_MAP,
     CHAR_DEL_DYN_DIFFICULTY_MAP,
-    CHAR_SEL_DYN_DIFFICULTY_MAP,
+    CHAR_SEL_CHARACTER_DYN_DIFFICULTY_MAPS,
 
     MAX_CHARACTERDATABASE_STATEMENTS
 };
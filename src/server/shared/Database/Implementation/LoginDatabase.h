@@ -26,7 +26,7 @@ class LoginDatabaseConnection : public MySQLConnection
     public:
         //- Constructors for sync and async connections
         LoginDatabaseConnection(MySQLConnectionInfo& connInfo) : MySQLConnection(connInfo) {}
-        LoginDatabaseConnection(ACE_Activation_Queue* q, MySQLConnectionInfo& connInfo) : MySQLConnection(q, connInfo) {}
+        LoginDatabaseConnection(SQLOperationQueue* q, MySQLConnectionInfo& connInfo) : MySQLConnection(q, connInfo) {}
 
         //- Loads database type specific prepared statements
         void DoPrepareStatements();
@@ -34,6 +34,8 @@
 #include "Timer.h"
 #include "Log.h"
 
+#include <algorithm>
+
 MySQLConnection::MySQLConnection(MySQLConnectionInfo& connInfo) :
 m_reconnecting(false),
 m_prepareError(false),
@@ -41,17 +43,21 @@ m_queue(NULL),
 m_worker(NULL),
 m_Mysql(NULL),
 m_connectionInfo(connInfo),
-m_connectionFlags(CONNECTION_SYNCH)
+m_connectionFlags(CONNECTION_SYNCH),
+m_statementCount(0),
+m_batchedStatements(true)
 {
 }
 
-MySQLConnection::MySQLConnection(ACE_Activation_Queue* queue, MySQLConnectionInfo& connInfo) :
+MySQLConnection::MySQLConnection(SQLOperationQueue* queue, MySQLConnectionInfo& connInfo) :
 m_reconnecting(false),
 m_prepareError(false),
 m_queue(queue),
 m_Mysql(NULL),
 m_connectionInfo(connInfo),
-m_connectionFlags(CONNECTION_ASYNC)
+m_connectionFlags(CONNECTION_ASYNC),
+m_statementCount(0),
+m_batchedStatements(true)
 {
     m_worker = new DatabaseWorker(m_queue, this);
 }
@@ -63,6 +69,8 @@ MySQLConnection::~MySQLConnection()
     for (size_t i = 0; i < m_stmts.size(); ++i)
         delete m_stmts[i];
 
+    ClearBatchedQueries();
+
     for (PreparedStatementMap::const_iterator itr = m_queries.begin(); itr != m_queries.end(); ++itr)
         free((void *)m_queries[itr->first].first);
 
@@ -151,6 +159,9 @@ bool MySQLConnection::Open()
 
 bool MySQLConnection::PrepareStatements()
 {
+    // the multi-row statements of the old connection are prepared again on first use
+    ClearBatchedQueries();
+
     DoPrepareStatements();
     for (PreparedStatementMap::const_iterator itr = m_queries.begin(); itr != m_queries.end(); ++itr)
         PrepareStatement(itr->first, itr->second.first, itr->second.second);
@@ -178,9 +189,10 @@ bool MySQLConnection::Execute(const char* sql)
             return false;
         }
         else
-            sLog->outDebug(LOG_FILTER_SQL, "[%u ms] SQL: %s", getMSTimeDiff(_s, getMSTime()), sql);
+            TC_LOG_DEBUG(LOG_FILTER_SQL, "[%u ms] SQL: %s", getMSTimeDiff(_s, getMSTime()), sql);
     }
 
+    ++m_statementCount;
     return true;
 }
 
@@ -227,13 +239,168 @@ bool MySQLConnection::Execute(PreparedStatement* stmt)
             return false;
         }
 
-        sLog->outDebug(LOG_FILTER_SQL, "[%u ms] SQL(p): %s", getMSTimeDiff(_s, getMSTime()), m_mStmt->getQueryString(m_queries[index].first).c_str());
+        TC_LOG_DEBUG(LOG_FILTER_SQL, "[%u ms] SQL(p): %s", getMSTimeDiff(_s, getMSTime()), m_mStmt->getQueryString(m_queries[index].first).c_str());
 
         m_mStmt->ClearParameters();
+        ++m_statementCount;
         return true;
     }
 }
 
+bool MySQLConnection::Execute(BatchedStatement* batch)
+{
+    if (!m_Mysql)
+        return false;
+
+    uint32 index = batch->m_index;
+    std::vector<PreparedStatement*> const& rows = batch->m_rows;
+
+    BatchedQuery const* query = m_batchedStatements ? GetBatchedQuery(index) : NULL;
+    for (size_t i = 0; query && i < rows.size(); ++i)
+        if (rows[i]->statement_data.size() != query->columns)
+            query = NULL;
+
+    // not an INSERT or REPLACE with a single values row, fall back to one statement per row
+    if (!query)
+    {
+        for (size_t i = 0; i < rows.size(); ++i)
+            if (!Execute(rows[i]))
+                return false;
+
+        return true;
+    }
+
+    size_t done = 0;
+    while (done < rows.size())
+    {
+        // largest chunk that is not bigger than the remaining rows
+        uint32 shift = 0;
+        while (shift < MAX_BATCH_SHIFT && (size_t(2) << shift) <= rows.size() - done)
+            ++shift;
+
+        uint32 count = 1 << shift;
+        MySQLPreparedStatement* m_mStmt = GetBatchedChunk(index, shift);
+        if (!m_mStmt)
+        {
+            for (uint32 i = 0; i < count; ++i)
+                if (!Execute(rows[done + i]))
+                    return false;
+
+            done += count;
+            continue;
+        }
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            PreparedStatement* stmt = rows[done + i];
+            m_mStmt->m_stmt = stmt;     // Cross reference them for debug output
+            stmt->m_stmt = m_mStmt;
+            stmt->BindRow(m_mStmt, i * query->columns);
+        }
+
+        // the error output shows the first row only
+        m_mStmt->m_stmt = rows[done];
+
+        MYSQL_STMT* msql_STMT = m_mStmt->GetSTMT();
+        uint32 _s = getMSTime();
+
+        if (mysql_stmt_bind_param(msql_STMT, m_mStmt->GetBind()) || mysql_stmt_execute(msql_STMT))
+        {
+            uint32 lErrno = mysql_errno(m_Mysql);
+            sLog->outError(LOG_FILTER_SQL, "SQL(p): %s (first of %u rows)\n [ERROR]: [%u] %s", m_mStmt->getQueryString(m_queries[index].first).c_str(), count, lErrno, mysql_stmt_error(msql_STMT));
+
+            // a reconnection prepares the statements again and deletes m_mStmt, so it is done with first
+            m_mStmt->ClearParameters();
+
+            // the rows can't be bound again and a reconnection loses the transaction, so no retry here
+            _HandleMySQLErrno(lErrno);
+            return false;
+        }
+
+        TC_LOG_DEBUG(LOG_FILTER_SQL, "[%u ms] SQL(p): %u rows of %s", getMSTimeDiff(_s, getMSTime()), count, m_queries[index].first);
+
+        m_mStmt->ClearParameters();
+        ++m_statementCount;
+        done += count;
+    }
+
+    return true;
+}
+
+MySQLConnection::BatchedQuery const* MySQLConnection::GetBatchedQuery(uint32 index)
+{
+    BatchedQueryMap::iterator itr = m_batchedQueries.find(index);
+    if (itr != m_batchedQueries.end())
+        return itr->second.columns ? &itr->second : NULL;
+
+    BatchedQuery& query = m_batchedQueries[index];
+
+    PreparedStatementMap::const_iterator sql = m_queries.find(index);
+    if (sql == m_queries.end())
+        return NULL;
+
+    std::string text = sql->second.first;
+    std::string upper = text;
+    std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+
+    size_t start = upper.find_first_not_of(" \t\r\n");
+    if (start == std::string::npos || (upper.compare(start, 6, "INSERT") != 0 && upper.compare(start, 7, "REPLACE") != 0))
+        return NULL;
+
+    size_t values = upper.find("VALUES");
+    size_t open = values == std::string::npos ? std::string::npos : upper.find('(', values);
+    size_t close = open == std::string::npos ? std::string::npos : upper.find(')', open);
+    if (close == std::string::npos || upper.find_first_not_of(" \t\r\n", values + 6) != open)
+        return NULL;
+
+    query.tail = text.substr(close + 1);
+    if (query.tail.find('?') != std::string::npos)
+        return NULL;
+
+    query.head = text.substr(0, open);
+    query.row = text.substr(open, close + 1 - open);
+    query.columns = uint32(std::count(query.row.begin(), query.row.end(), '?'));
+    return query.columns ? &query : NULL;
+}
+
+MySQLPreparedStatement* MySQLConnection::GetBatchedChunk(uint32 index, uint32 shift)
+{
+    BatchedQuery& query = m_batchedQueries[index];
+    if (query.chunks[shift])
+        return query.chunks[shift];
+
+    std::string sql = query.head + query.row;
+    for (uint32 i = 1; i < (1u << shift); ++i)
+        sql += ", " + query.row;
+    sql += query.tail;
+
+    MYSQL_STMT* stmt = mysql_stmt_init(m_Mysql);
+    if (!stmt)
+    {
+        sLog->outError(LOG_FILTER_SQL, "In mysql_stmt_init() id: %u, batch of %u rows", index, 1u << shift);
+        return NULL;
+    }
+
+    if (mysql_stmt_prepare(stmt, sql.c_str(), static_cast<unsigned long>(sql.size())))
+    {
+        sLog->outError(LOG_FILTER_SQL, "In mysql_stmt_prepare() id: %u, batch of %u rows: %s", index, 1u << shift, mysql_stmt_error(stmt));
+        mysql_stmt_close(stmt);
+        return NULL;
+    }
+
+    query.chunks[shift] = new MySQLPreparedStatement(stmt);
+    return query.chunks[shift];
+}
+
+void MySQLConnection::ClearBatchedQueries()
+{
+    for (BatchedQueryMap::iterator itr = m_batchedQueries.begin(); itr != m_batchedQueries.end(); ++itr)
+        for (uint32 i = 0; i <= MAX_BATCH_SHIFT; ++i)
+            delete itr->second.chunks[i];
+
+    m_batchedQueries.clear();
+}
+
 bool MySQLConnection::_Query(PreparedStatement* stmt, MYSQL_RES **pResult, uint64* pRowCount, uint32* pFieldCount)
 {
     if (!m_Mysql)
@@ -278,7 +445,7 @@ bool MySQLConnection::_Query(PreparedStatement* stmt, MYSQL_RES **pResult, uint6
             return false;
         }
 
-        sLog->outDebug(LOG_FILTER_SQL, "[%u ms] SQL(p): %s", getMSTimeDiff(_s, getMSTime()), m_mStmt->getQueryString(m_queries[index].first).c_str());
+        TC_LOG_DEBUG(LOG_FILTER_SQL, "[%u ms] SQL(p): %s", getMSTimeDiff(_s, getMSTime()), m_mStmt->getQueryString(m_queries[index].first).c_str());
 
         m_mStmt->ClearParameters();
 
@@ -330,7 +497,7 @@ bool MySQLConnection::_Query(const char *sql, MYSQL_RES **pResult, MYSQL_FIELD *
             return false;
         }
         else
-            sLog->outDebug(LOG_FILTER_SQL, "[%u ms] SQL: %s", getMSTimeDiff(_s, getMSTime()), sql);
+            TC_LOG_DEBUG(LOG_FILTER_SQL, "[%u ms] SQL: %s", getMSTimeDiff(_s, getMSTime()), sql);
 
         *pResult = mysql_store_result(m_Mysql);
         *pRowCount = mysql_affected_rows(m_Mysql);
@@ -392,6 +559,18 @@ bool MySQLConnection::ExecuteTransaction(SQLTransaction& transaction)
                 }
             }
             break;
+            case SQL_ELEMENT_BATCH:
+            {
+                BatchedStatement* batch = data.element.batch;
+                ASSERT(batch);
+                if (!Execute(batch))
+                {
+                    sLog->outWarn(LOG_FILTER_SQL, "Transaction aborted. %u queries not executed.", (uint32)queries.size());
+                    RollbackTransaction();
+                    return false;
+                }
+            }
+            break;
             case SQL_ELEMENT_RAW:
             {
                 const char* sql = data.element.query;
@@ -27,7 +27,9 @@
 class DatabaseWorker;
 class PreparedStatement;
 class MySQLPreparedStatement;
+class BatchedStatement;
 class PingOperation;
+class SQLOperationQueue;
 
 enum ConnectionFlags
 {
@@ -66,6 +68,9 @@ typedef std::map<uint32 /*index*/, std::pair<const char* /*query*/, ConnectionFl
 
 #define PREPARE_STATEMENT(a, b, c) m_queries[a] = std::make_pair(strdup(b), c);
 
+//! Largest multi-row statement a batch is split into is 1 << MAX_BATCH_SHIFT rows
+#define MAX_BATCH_SHIFT 6
+
 class MySQLConnection
 {
     template <class T> friend class DatabaseWorkerPool;
@@ -73,7 +78,7 @@ class MySQLConnection
 
     public:
         MySQLConnection(MySQLConnectionInfo& connInfo);                               //! Constructor for synchronous connections.
-        MySQLConnection(ACE_Activation_Queue* queue, MySQLConnectionInfo& connInfo);  //! Constructor for asynchronous connections.
+        MySQLConnection(SQLOperationQueue* queue, MySQLConnectionInfo& connInfo);     //! Constructor for asynchronous connections.
         virtual ~MySQLConnection();
 
         virtual bool Open();
@@ -82,6 +87,7 @@ class MySQLConnection
     public:
         bool Execute(const char* sql);
         bool Execute(PreparedStatement* stmt);
+        bool Execute(BatchedStatement* batch);
         ResultSet* Query(const char* sql);
         PreparedResultSet* Query(PreparedStatement* stmt);
         bool _Query(const char *sql, MYSQL_RES **pResult, MYSQL_FIELD **pFields, uint64* pRowCount, uint32* pFieldCount);
@@ -97,6 +103,11 @@ class MySQLConnection
 
         uint32 GetLastError() { return mysql_errno(m_Mysql); }
 
+        //! Statements sent to the server by Execute, a multi-row statement counts once
+        uint64 GetStatementCount() const { return m_statementCount; }
+        //! When disabled the rows of a BatchedStatement are executed one by one
+        void SetBatchedStatements(bool enable) { m_batchedStatements = enable; }
+
     protected:
         bool LockIfReady()
         {
@@ -125,15 +136,35 @@ class MySQLConnection
         bool                                 m_prepareError;  //! Was there any error while preparing statements?
 
     private:
+        //! Multi-row forms of one INSERT or REPLACE prepared statement
+        struct BatchedQuery
+        {
+            BatchedQuery() : columns(0) { memset(chunks, 0, sizeof(chunks)); }
+
+            std::string head;                               //! everything before the values row
+            std::string row;                                //! "(?, ?, ...)"
+            std::string tail;                               //! e.g. ON DUPLICATE KEY UPDATE, must not have parameters
+            uint32 columns;                                 //! 0 if the statement can't be batched
+            MySQLPreparedStatement* chunks[MAX_BATCH_SHIFT + 1];   //! prepared on first use, chunks[i] has 1 << i rows
+        };
+
+        typedef std::map<uint32 /*index*/, BatchedQuery> BatchedQueryMap;
+
         bool _HandleMySQLErrno(uint32 errNo);
+        BatchedQuery const* GetBatchedQuery(uint32 index);
+        MySQLPreparedStatement* GetBatchedChunk(uint32 index, uint32 shift);
+        void ClearBatchedQueries();
 
     private:
-        ACE_Activation_Queue* m_queue;                      //! Queue shared with other asynchronous connections.
+        SQLOperationQueue*    m_queue;                      //! Queue shared with other asynchronous connections.
         DatabaseWorker*       m_worker;                     //! Core worker task.
         MYSQL *               m_Mysql;                      //! MySQL Handle.
         MySQLConnectionInfo&  m_connectionInfo;             //! Connection info (used for logging)
         ConnectionFlags       m_connectionFlags;            //! Connection flags (for preparing relevant statements)
         ACE_Thread_Mutex      m_Mutex;
+        BatchedQueryMap       m_batchedQueries;
+        uint64                m_statementCount;             //! Statements sent by Execute
+        bool                  m_batchedStatements;          //! Execute BatchedStatement as multi-row statements
 };
 
 #endif
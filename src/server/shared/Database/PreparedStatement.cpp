@@ -41,59 +41,65 @@ void PreparedStatement::BindParameters()
 {
     ASSERT (m_stmt);
 
-    uint32 i = 0;
-    for (; i < statement_data.size(); i++)
+    BindRow(m_stmt, 0);
+
+    #ifdef _DEBUG
+    if (statement_data.size() < m_stmt->m_paramCount)
+        sLog->outWarn(LOG_FILTER_SQL, "[WARNING]: BindParameters() for statement %u did not bind all allocated parameters", m_index);
+    #endif
+}
+
+void PreparedStatement::BindRow(MySQLPreparedStatement* target, uint32 offset)
+{
+    for (uint32 i = 0; i < statement_data.size(); i++)
     {
+        uint32 param = offset + i;
         switch (statement_data[i].type)
         {
             case TYPE_BOOL:
-                m_stmt->setBool(i, statement_data[i].data.boolean);
+                target->setBool(param, statement_data[i].data.boolean);
                 break;
             case TYPE_UI8:
-                m_stmt->setUInt8(i, statement_data[i].data.ui8);
+                target->setUInt8(param, statement_data[i].data.ui8);
                 break;
             case TYPE_UI16:
-                m_stmt->setUInt16(i, statement_data[i].data.ui16);
+                target->setUInt16(param, statement_data[i].data.ui16);
                 break;
             case TYPE_UI32:
-                m_stmt->setUInt32(i, statement_data[i].data.ui32);
+                target->setUInt32(param, statement_data[i].data.ui32);
                 break;
             case TYPE_I8:
-                m_stmt->setInt8(i, statement_data[i].data.i8);
+                target->setInt8(param, statement_data[i].data.i8);
                 break;
             case TYPE_I16:
-                m_stmt->setInt16(i, statement_data[i].data.i16);
+                target->setInt16(param, statement_data[i].data.i16);
                 break;
             case TYPE_I32:
-                m_stmt->setInt32(i, statement_data[i].data.i32);
+                target->setInt32(param, statement_data[i].data.i32);
                 break;
             case TYPE_UI64:
-                m_stmt->setUInt64(i, statement_data[i].data.ui64);
+                target->setUInt64(param, statement_data[i].data.ui64);
                 break;
             case TYPE_I64:
-                m_stmt->setInt64(i, statement_data[i].data.i64);
+                target->setInt64(param, statement_data[i].data.i64);
                 break;
             case TYPE_FLOAT:
-                m_stmt->setFloat(i, statement_data[i].data.f);
+                target->setFloat(param, statement_data[i].data.f);
                 break;
             case TYPE_DOUBLE:
-                m_stmt->setDouble(i, statement_data[i].data.d);
+                target->setDouble(param, statement_data[i].data.d);
                 break;
             case TYPE_STRING:
                 if (!statement_data[i].data.str.ptr)
                     ASSERT(statement_data[i].data.str.ptr != NULL);
-                m_stmt->setString(i, statement_data[i].data.str.ptr, statement_data[i].data.str.len);
+                target->setString(param, statement_data[i].data.str.ptr, statement_data[i].data.str.len);
                 statement_data[i].data.str.ptr = NULL;
                 break;
             case TYPE_NULL:
-                m_stmt->setNull(i);
+                target->setNull(param);
                 break;
         }
     }
-    #ifdef _DEBUG
-    if (i < m_stmt->m_paramCount)
-        sLog->outWarn(LOG_FILTER_SQL, "[WARNING]: BindParameters() for statement %u did not bind all allocated parameters", m_index);
-    #endif
 }
 
 //- Bind to buffer
@@ -302,7 +308,7 @@ static bool ParementerIndexAssertFail(uint32 stmtIndex, uint8 index, uint32 para
 }
 
 //- Bind on mysql level
-bool MySQLPreparedStatement::CheckValidIndex(uint8 index)
+bool MySQLPreparedStatement::CheckValidIndex(uint32 index)
 {
     if (index >= m_paramCount)
     {
@@ -318,12 +324,12 @@ bool MySQLPreparedStatement::CheckValidIndex(uint8 index)
     return true;
 }
 
-void MySQLPreparedStatement::setBool(const uint8 index, const bool value)
+void MySQLPreparedStatement::setBool(const uint32 index, const bool value)
 {
     setUInt8(index, value ? 1 : 0);
 }
 
-void MySQLPreparedStatement::setUInt8(const uint8 index, const uint8 value)
+void MySQLPreparedStatement::setUInt8(const uint32 index, const uint8 value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -331,7 +337,7 @@ void MySQLPreparedStatement::setUInt8(const uint8 index, const uint8 value)
     setValue(param, MYSQL_TYPE_TINY, &value, sizeof(uint8), true);
 }
 
-void MySQLPreparedStatement::setUInt16(const uint8 index, const uint16 value)
+void MySQLPreparedStatement::setUInt16(const uint32 index, const uint16 value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -339,7 +345,7 @@ void MySQLPreparedStatement::setUInt16(const uint8 index, const uint16 value)
     setValue(param, MYSQL_TYPE_SHORT, &value, sizeof(uint16), true);
 }
 
-void MySQLPreparedStatement::setUInt32(const uint8 index, const uint32 value)
+void MySQLPreparedStatement::setUInt32(const uint32 index, const uint32 value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -347,7 +353,7 @@ void MySQLPreparedStatement::setUInt32(const uint8 index, const uint32 value)
     setValue(param, MYSQL_TYPE_LONG, &value, sizeof(uint32), true);
 }
 
-void MySQLPreparedStatement::setUInt64(const uint8 index, const uint64 value)
+void MySQLPreparedStatement::setUInt64(const uint32 index, const uint64 value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -355,7 +361,7 @@ void MySQLPreparedStatement::setUInt64(const uint8 index, const uint64 value)
     setValue(param, MYSQL_TYPE_LONGLONG, &value, sizeof(uint64), true);
 }
 
-void MySQLPreparedStatement::setInt8(const uint8 index, const int8 value)
+void MySQLPreparedStatement::setInt8(const uint32 index, const int8 value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -363,7 +369,7 @@ void MySQLPreparedStatement::setInt8(const uint8 index, const int8 value)
     setValue(param, MYSQL_TYPE_TINY, &value, sizeof(int8), false);
 }
 
-void MySQLPreparedStatement::setInt16(const uint8 index, const int16 value)
+void MySQLPreparedStatement::setInt16(const uint32 index, const int16 value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -371,7 +377,7 @@ void MySQLPreparedStatement::setInt16(const uint8 index, const int16 value)
     setValue(param, MYSQL_TYPE_SHORT, &value, sizeof(int16), false);
 }
 
-void MySQLPreparedStatement::setInt32(const uint8 index, const int32 value)
+void MySQLPreparedStatement::setInt32(const uint32 index, const int32 value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -379,7 +385,7 @@ void MySQLPreparedStatement::setInt32(const uint8 index, const int32 value)
     setValue(param, MYSQL_TYPE_LONG, &value, sizeof(int32), false);
 }
 
-void MySQLPreparedStatement::setInt64(const uint8 index, const int64 value)
+void MySQLPreparedStatement::setInt64(const uint32 index, const int64 value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -387,7 +393,7 @@ void MySQLPreparedStatement::setInt64(const uint8 index, const int64 value)
     setValue(param, MYSQL_TYPE_LONGLONG, &value, sizeof(int64), false);
 }
 
-void MySQLPreparedStatement::setFloat(const uint8 index, const float value)
+void MySQLPreparedStatement::setFloat(const uint32 index, const float value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -395,7 +401,7 @@ void MySQLPreparedStatement::setFloat(const uint8 index, const float value)
     setValue(param, MYSQL_TYPE_FLOAT, &value, sizeof(float), (value > 0.0f));
 }
 
-void MySQLPreparedStatement::setDouble(const uint8 index, const double value)
+void MySQLPreparedStatement::setDouble(const uint32 index, const double value)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -403,14 +409,14 @@ void MySQLPreparedStatement::setDouble(const uint8 index, const double value)
     setValue(param, MYSQL_TYPE_DOUBLE, &value, sizeof(double), (value > 0.0f));
 }
 
-void MySQLPreparedStatement::setString(const uint8 index, char* value)
+void MySQLPreparedStatement::setString(const uint32 index, char* value)
 {
     ASSERT(value != NULL);
 
     return setString(index, value, strlen(value));
 }
 
-void MySQLPreparedStatement::setString(const uint8 index, char* value, uint32 len)
+void MySQLPreparedStatement::setString(const uint32 index, char* value, uint32 len)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -426,7 +432,7 @@ void MySQLPreparedStatement::setString(const uint8 index, char* value, uint32 le
     param->length_value = len;
 }
 
-void MySQLPreparedStatement::setNull(const uint8 index)
+void MySQLPreparedStatement::setNull(const uint32 index)
 {
     CheckValidIndex(index);
     m_paramsSet[index] = true;
@@ -533,6 +539,18 @@ std::string MySQLPreparedStatement::getQueryString(const char *query)
     return ss.str();
 }
 
+BatchedStatement::~BatchedStatement()
+{
+    for (size_t i = 0; i < m_rows.size(); ++i)
+        delete m_rows[i];
+}
+
+void BatchedStatement::AddRow(PreparedStatement* stmt)
+{
+    ASSERT(stmt->m_index == m_index);
+    m_rows.push_back(stmt);
+}
+
 //- Execution
 PreparedStatementTask::PreparedStatementTask(PreparedStatement* stmt) :
 m_stmt(stmt),
@@ -77,6 +77,7 @@ class PreparedStatement
     friend class PreparedStatementTask;
     friend class MySQLPreparedStatement;
     friend class MySQLConnection;
+    friend class BatchedStatement;
 
     public:
         explicit PreparedStatement(uint32 index);
@@ -100,6 +101,8 @@ class PreparedStatement
 
     protected:
         void BindParameters();
+        //- Binds the values as one row of a multi-row statement, starting at parameter `offset`
+        void BindRow(MySQLPreparedStatement* target, uint32 offset);
 
     protected:
         MySQLPreparedStatement* m_stmt;
@@ -119,27 +122,27 @@ class MySQLPreparedStatement
         MySQLPreparedStatement(MYSQL_STMT* stmt);
         ~MySQLPreparedStatement();
 
-        void setBool(const uint8 index, const bool value);
-        void setUInt8(const uint8 index, const uint8 value);
-        void setUInt16(const uint8 index, const uint16 value);
-        void setUInt32(const uint8 index, const uint32 value);
-        void setUInt64(const uint8 index, const uint64 value);
-        void setInt8(const uint8 index, const int8 value);
-        void setInt16(const uint8 index, const int16 value);
-        void setInt32(const uint8 index, const int32 value);
-        void setInt64(const uint8 index, const int64 value);
-        void setFloat(const uint8 index, const float value);
-        void setDouble(const uint8 index, const double value);
-        void setString(const uint8 index, char* value);
-        void setString(const uint8 index, char* value, uint32 len);
-        void setNull(const uint8 index);
+        void setBool(const uint32 index, const bool value);
+        void setUInt8(const uint32 index, const uint8 value);
+        void setUInt16(const uint32 index, const uint16 value);
+        void setUInt32(const uint32 index, const uint32 value);
+        void setUInt64(const uint32 index, const uint64 value);
+        void setInt8(const uint32 index, const int8 value);
+        void setInt16(const uint32 index, const int16 value);
+        void setInt32(const uint32 index, const int32 value);
+        void setInt64(const uint32 index, const int64 value);
+        void setFloat(const uint32 index, const float value);
+        void setDouble(const uint32 index, const double value);
+        void setString(const uint32 index, char* value);
+        void setString(const uint32 index, char* value, uint32 len);
+        void setNull(const uint32 index);
 
     protected:
         MYSQL_STMT* GetSTMT() { return m_Mstmt; }
         MYSQL_BIND* GetBind() { return m_bind; }
         PreparedStatement* m_stmt;
         void ClearParameters();
-        bool CheckValidIndex(uint8 index);
+        bool CheckValidIndex(uint32 index);
         std::string getQueryString(const char *query);
 
     private:
@@ -152,6 +155,27 @@ class MySQLPreparedStatement
         MYSQL_BIND* m_bind;
 };
 
+//- Rows of one INSERT or REPLACE prepared statement that are sent to the server as multi-row statements.
+//- Owned by the transaction it is appended to, the rows are deleted with it.
+class BatchedStatement
+{
+    friend class MySQLConnection;
+
+    public:
+        explicit BatchedStatement(uint32 index) : m_index(index) { }
+        ~BatchedStatement();
+
+        //- Takes over the statement, it has to be created with the index of the batch
+        void AddRow(PreparedStatement* stmt);
+
+        uint32 GetIndex() const { return m_index; }
+        size_t GetRowCount() const { return m_rows.size(); }
+
+    protected:
+        uint32 m_index;
+        std::vector<PreparedStatement*> m_rows;
+};
+
 typedef ACE_Future<PreparedQueryResult> PreparedQueryResultFuture;
 
 //- Lower-level class, enqueuable operation
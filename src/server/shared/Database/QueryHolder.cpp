@@ -154,6 +154,8 @@ SQLQueryHolder::~SQLQueryHolder()
                 case SQL_ELEMENT_PREPARED:
                     delete data->element.stmt;
                     break;
+                default:                        // batches have no results, they are never added to a holder
+                    break;
             }
         }
     }
@@ -201,6 +203,8 @@ bool SQLQueryHolderTask::Execute()
                         m_holder->SetPreparedResult(i, m_conn->Query(stmt));
                     break;
                 }
+                default:
+                    break;
             }
         }
     }
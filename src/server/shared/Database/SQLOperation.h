@@ -20,17 +20,22 @@
 
 #include <ace/Method_Request.h>
 #include <ace/Activation_Queue.h>
+#include <ace/Guard_T.h>
+#include <ace/Thread_Mutex.h>
 
 #include "QueryResult.h"
+#include "Timer.h"
 
 //- Forward declare (don't include header to prevent circular includes)
 class PreparedStatement;
+class BatchedStatement;
 
 //- Union that holds element data
 union SQLElementUnion
 {
     PreparedStatement* stmt;
     const char* query;
+    BatchedStatement* batch;
 };
 
 //- Type specifier of our element data
@@ -38,6 +43,7 @@ enum SQLElementDataType
 {
     SQL_ELEMENT_RAW,
     SQL_ELEMENT_PREPARED,
+    SQL_ELEMENT_BATCH,
 };
 
 //- The element
@@ -54,21 +60,128 @@ union SQLResultSetUnion
     ResultSet* qresult;
 };
 
+//- Classes of the async operations. Of the operations that may start, the highest class is dequeued
+//- first, see SQLOperationQueue
+enum SQLQueueClass
+{
+    SQL_QUEUE_BULK          = 0,                        //- background work, runs when nothing else waits
+    SQL_QUEUE_SAVE          = 1,                        //- periodic character saves
+    SQL_QUEUE_INTERACTIVE   = 2,                        //- everything a player may be waiting for
+    MAX_SQL_QUEUE_CLASS
+};
+
+//- Counters of one priority class of an async queue
+struct SQLQueueCounters
+{
+    SQLQueueCounters() : depth(0), executed(0), totalWait(0), maxWait(0), transactions(0), transactionRows(0),
+        transactionStatements(0), transactionTime(0) { }
+
+    uint32 depth;                                       //- operations waiting
+    uint64 executed;
+    uint64 totalWait;                                   //- ms between enqueue and execution
+    uint32 maxWait;
+    uint64 transactions;                                //- committed transactions
+    uint64 transactionRows;                             //- statements appended to them, batches count every row
+    uint64 transactionStatements;                       //- statements actually sent to the server for them
+    uint64 transactionTime;                             //- ms spent executing them
+};
+
+//- Depth and latency of the async queue of one pool
+class SQLQueueStats
+{
+    public:
+        SQLQueueStats() { }
+
+        void OnEnqueue(SQLQueueClass queueClass)
+        {
+            ACE_Guard<ACE_Thread_Mutex> guard(_lock);
+            ++_counters[queueClass].depth;
+        }
+
+        void OnExecute(SQLQueueClass queueClass, uint32 wait)
+        {
+            ACE_Guard<ACE_Thread_Mutex> guard(_lock);
+            SQLQueueCounters& counters = _counters[queueClass];
+            --counters.depth;
+            ++counters.executed;
+            counters.totalWait += wait;
+            if (wait > counters.maxWait)
+                counters.maxWait = wait;
+        }
+
+        void OnTransaction(SQLQueueClass queueClass, uint32 rows, uint32 statements, uint32 time)
+        {
+            ACE_Guard<ACE_Thread_Mutex> guard(_lock);
+            SQLQueueCounters& counters = _counters[queueClass];
+            ++counters.transactions;
+            counters.transactionRows += rows;
+            counters.transactionStatements += statements;
+            counters.transactionTime += time;
+        }
+
+        void GetCounters(SQLQueueCounters (&counters)[MAX_SQL_QUEUE_CLASS])
+        {
+            ACE_Guard<ACE_Thread_Mutex> guard(_lock);
+            for (uint8 i = 0; i < MAX_SQL_QUEUE_CLASS; ++i)
+                counters[i] = _counters[i];
+        }
+
+    private:
+        ACE_Thread_Mutex _lock;
+        SQLQueueCounters _counters[MAX_SQL_QUEUE_CLASS];
+};
+
 class MySQLConnection;
 
 class SQLOperation : public ACE_Method_Request
 {
     public:
-        SQLOperation(): m_conn(NULL) {};
+        SQLOperation(): m_conn(NULL), m_queueStats(NULL), m_queueClass(SQL_QUEUE_INTERACTIVE), m_queueTime(0), m_orderKey(0),
+            m_write(false), m_sequence(0) {};
         virtual int call()
         {
+            if (m_queueStats)
+                m_queueStats->OnExecute(m_queueClass, GetMSTimeDiffToNow(m_queueTime));
+
             Execute();
             return 0;
         }
         virtual bool Execute() = 0;
         virtual void SetConnection(MySQLConnection* con) { m_conn = con; }
 
+        //- Called by SQLOperationQueue right before the operation is queued
+        void SetQueued(SQLQueueStats* stats, SQLQueueClass queueClass, uint64 orderKey, bool write, uint64 sequence)
+        {
+            m_queueStats = stats;
+            m_queueClass = queueClass;
+            m_queueTime = getMSTime();
+            m_orderKey = orderKey;
+            m_write = write;
+            m_sequence = sequence;
+            stats->OnEnqueue(queueClass);
+        }
+
+        SQLQueueClass GetQueueClass() const { return m_queueClass; }
+        uint64 GetOrderKey() const { return m_orderKey; }
+        bool IsWrite() const { return m_write; }
+        uint64 GetSequence() const { return m_sequence; }
+
         MySQLConnection* m_conn;
+
+    protected:
+        void RecordTransaction(uint32 rows, uint32 statements, uint32 time)
+        {
+            if (m_queueStats)
+                m_queueStats->OnTransaction(m_queueClass, rows, statements, time);
+        }
+
+    private:
+        SQLQueueStats* m_queueStats;
+        SQLQueueClass m_queueClass;
+        uint32 m_queueTime;
+        uint64 m_orderKey;                              //- 0 orders the operation against every write
+        bool m_write;
+        uint64 m_sequence;                              //- enqueue order within the pool
 };
 
 #endif
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SQLOperationQueue.h"
+
+#include <set>
+
+SQLOperationQueue::SQLOperationQueue() : _changed(_lock), _nextSequence(0), _closed(false)
+{
+}
+
+SQLOperationQueue::~SQLOperationQueue()
+{
+    //! only left over when the workers never ran
+    for (OperationList::iterator itr = _pending.begin(); itr != _pending.end(); ++itr)
+        delete *itr;
+}
+
+void SQLOperationQueue::Enqueue(SQLOperation* op, SQLQueueClass queueClass, uint64 orderKey, bool write)
+{
+    ACE_Guard<ACE_Thread_Mutex> guard(_lock);
+    op->SetQueued(&_stats, queueClass, orderKey, write, ++_nextSequence);
+    _pending.push_back(op);
+    _changed.signal();
+}
+
+SQLOperation* SQLOperationQueue::Dequeue()
+{
+    ACE_Guard<ACE_Thread_Mutex> guard(_lock);
+    for (;;)
+    {
+        if (SQLOperation* op = TakeNext())
+            return op;
+
+        if (_closed && _pending.empty())
+            return NULL;
+
+        _changed.wait();
+    }
+}
+
+void SQLOperationQueue::Finish(SQLOperation* op)
+{
+    //! nothing waits for reads
+    if (!op->IsWrite())
+        return;
+
+    ACE_Guard<ACE_Thread_Mutex> guard(_lock);
+    _running.remove(op);
+    _changed.broadcast();
+}
+
+void SQLOperationQueue::Close()
+{
+    ACE_Guard<ACE_Thread_Mutex> guard(_lock);
+    _closed = true;
+    _changed.broadcast();
+}
+
+bool SQLOperationQueue::WaitsForRunningWrite(SQLOperation const* op) const
+{
+    for (OperationList::const_iterator itr = _running.begin(); itr != _running.end(); ++itr)
+    {
+        SQLOperation const* running = *itr;
+        //! a read may have been passed by a later write, it doesn't wait for that one
+        if (running->GetSequence() > op->GetSequence())
+            continue;
+
+        if (!op->GetOrderKey() || !running->GetOrderKey() || running->GetOrderKey() == op->GetOrderKey())
+            return true;
+    }
+
+    return false;
+}
+
+SQLOperation* SQLOperationQueue::TakeNext()
+{
+    //! keys of the writes queued before the operation looked at
+    std::set<uint64> writeKeys;
+    bool queuedWrite = false;
+
+    OperationList::iterator best = _pending.end();
+    for (OperationList::iterator itr = _pending.begin(); itr != _pending.end(); ++itr)
+    {
+        SQLOperation* op = *itr;
+        uint64 key = op->GetOrderKey();
+
+        bool ready = key ? !writeKeys.count(key) : !queuedWrite;
+        if (ready && !WaitsForRunningWrite(op) && (best == _pending.end() || op->GetQueueClass() > (*best)->GetQueueClass()))
+        {
+            best = itr;
+            if (op->GetQueueClass() == SQL_QUEUE_INTERACTIVE)
+                break;
+        }
+
+        if (op->IsWrite())
+        {
+            //! nothing queued after a write without key can start before it
+            if (!key)
+                break;
+
+            queuedWrite = true;
+            writeKeys.insert(key);
+        }
+    }
+
+    if (best == _pending.end())
+        return NULL;
+
+    SQLOperation* op = *best;
+    _pending.erase(best);
+    if (op->IsWrite())
+        _running.push_back(op);
+
+    return op;
+}
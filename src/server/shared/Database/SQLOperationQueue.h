@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SQLOPERATIONQUEUE_H
+#define _SQLOPERATIONQUEUE_H
+
+#include <ace/Condition_Thread_Mutex.h>
+#include <ace/Thread_Mutex.h>
+
+#include "SQLOperation.h"
+
+#include <list>
+
+/*! Async operations of one pool, shared by all of its async connections.
+    Every operation gets an order key, 0 for none. An operation may only start once no write enqueued
+    before it and ordered against it is queued or running:
+    - writes and reads with the same key are ordered, so are a write without key and anything else,
+      a read without key waits for every write enqueued before it
+    - nothing waits for reads, a write enqueued after a read may run before it
+    Among the operations that may start, workers take the highest class first, then the oldest. Writes
+    of different keys run in parallel on different connections, and a keyed read does not wait for the
+    writes of other keys. */
+class SQLOperationQueue
+{
+    public:
+        SQLOperationQueue();
+        ~SQLOperationQueue();
+
+        void Enqueue(SQLOperation* op, SQLQueueClass queueClass, uint64 orderKey, bool write);
+
+        //- Blocks until an operation may start, returns NULL once the queue was closed and everything in it ran
+        SQLOperation* Dequeue();
+        //- Called by the worker once the operation returned by Dequeue was executed, before it is deleted
+        void Finish(SQLOperation* op);
+        //- Wakes the workers, they run what is left and stop
+        void Close();
+
+        void GetCounters(SQLQueueCounters (&counters)[MAX_SQL_QUEUE_CLASS]) { _stats.GetCounters(counters); }
+
+    private:
+        typedef std::list<SQLOperation*> OperationList;
+
+        bool WaitsForRunningWrite(SQLOperation const* op) const;
+        SQLOperation* TakeNext();
+
+        ACE_Thread_Mutex _lock;
+        ACE_Condition_Thread_Mutex _changed;
+        OperationList _pending;                             //- in the order they were enqueued
+        OperationList _running;                             //- writes being executed
+        uint64 _nextSequence;
+        bool _closed;
+        SQLQueueStats _stats;
+};
+
+#endif
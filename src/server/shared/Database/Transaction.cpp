@@ -47,6 +47,53 @@ void Transaction::Append(PreparedStatement* stmt)
     m_queries.push_back(data);
 }
 
+//- Append the rows of a batched statement to the transaction, they are executed at this position
+void Transaction::Append(BatchedStatement* batch)
+{
+    if (!batch->GetRowCount())
+    {
+        delete batch;
+        return;
+    }
+
+    SQLElementData data;
+    data.type = SQL_ELEMENT_BATCH;
+    data.element.batch = batch;
+    m_queries.push_back(data);
+}
+
+size_t Transaction::GetRowCount() const
+{
+    size_t rows = 0;
+    for (std::list<SQLElementData>::const_iterator itr = m_queries.begin(); itr != m_queries.end(); ++itr)
+        rows += itr->type == SQL_ELEMENT_BATCH ? itr->element.batch->GetRowCount() : 1;
+
+    return rows;
+}
+
+Transaction::~Transaction()
+{
+    Cleanup();
+
+    // dropped without being executed
+    if (_result.get() && _result->GetState() == TransactionResult::TRANSACTION_PENDING)
+        _result->SetState(TransactionResult::TRANSACTION_FAILED);
+}
+
+SQLTransactionResult Transaction::GetResult()
+{
+    if (!_result.get())
+        _result = SQLTransactionResult(new TransactionResult());
+
+    return _result;
+}
+
+void Transaction::SetCommitted(bool committed)
+{
+    if (_result.get())
+        _result->SetState(committed ? TransactionResult::TRANSACTION_COMMITTED : TransactionResult::TRANSACTION_FAILED);
+}
+
 void Transaction::Cleanup()
 {
     // This might be called by explicit calls to Cleanup or by the auto-destructor
@@ -64,6 +111,9 @@ void Transaction::Cleanup()
             case SQL_ELEMENT_RAW:
                 free((void*)(data.element.query));
             break;
+            case SQL_ELEMENT_BATCH:
+                delete data.element.batch;
+            break;
         }
 
         m_queries.pop_front();
@@ -74,18 +124,31 @@ void Transaction::Cleanup()
 
 bool TransactionTask::Execute()
 {
+    uint32 rows = uint32(m_trans->GetRowCount());
+    uint64 statements = m_conn->GetStatementCount();
+    uint32 startTime = getMSTime();
+
     if (m_conn->ExecuteTransaction(m_trans))
+    {
+        RecordTransaction(rows, uint32(m_conn->GetStatementCount() - statements), GetMSTimeDiffToNow(startTime));
+        m_trans->SetCommitted(true);
         return true;
+    }
 
     if (m_conn->GetLastError() == 1213)
     {
         uint8 loopBreaker = 5;  // Handle MySQL Errno 1213 without extending deadlock to the core itself
         for (uint8 i = 0; i < loopBreaker; ++i)
             if (m_conn->ExecuteTransaction(m_trans))
+            {
+                RecordTransaction(rows, uint32(m_conn->GetStatementCount() - statements), GetMSTimeDiffToNow(startTime));
+                m_trans->SetCommitted(true);
                 return true;
+            }
     }
 
     // Clean up now.
+    m_trans->SetCommitted(false);
     m_trans->Cleanup();
 
     return false;
@@ -19,33 +19,64 @@
 #define _TRANSACTION_H
 
 #include "SQLOperation.h"
+#include <ace/Atomic_Op.h>
 
 //- Forward declare (don't include header to prevent circular includes)
 class PreparedStatement;
+class BatchedStatement;
+
+/*! Outcome of a transaction, kept by the code that built it to learn later whether it was committed. */
+class TransactionResult
+{
+    public:
+        enum State
+        {
+            TRANSACTION_PENDING,
+            TRANSACTION_COMMITTED,
+            TRANSACTION_FAILED                      // failed, or released without being committed
+        };
+
+        TransactionResult() : _state(uint32(TRANSACTION_PENDING)) {}
+
+        State GetState() const { return State(_state.value()); }
+        void SetState(State state) { _state = uint32(state); }
+
+    private:
+        ACE_Atomic_Op<ACE_Thread_Mutex, uint32> _state;
+};
+typedef MoPCore::AutoPtr<TransactionResult, ACE_Thread_Mutex> SQLTransactionResult;
 
 /*! Transactions, high level class. */
 class Transaction
 {
     friend class TransactionTask;
     friend class MySQLConnection;
-    friend class DatabaseWokerPool;
+    template <class T> friend class DatabaseWorkerPool;
 
     public:
         Transaction() : _cleanedUp(false) {}
-        ~Transaction() { Cleanup(); }
+        ~Transaction();
 
         void Append(PreparedStatement* statement);
+        void Append(BatchedStatement* batch);
         void Append(const char* sql);
         void PAppend(const char* sql, ...);
 
         size_t GetSize() const { return m_queries.size(); }
+        //- Like GetSize, but every row of a batch counts
+        size_t GetRowCount() const;
+
+        //- Set by the database worker once the transaction was executed, only created on the first call
+        SQLTransactionResult GetResult();
 
     protected:
         void Cleanup();
+        void SetCommitted(bool committed);
         std::list<SQLElementData> m_queries;
 
     private:
         bool _cleanedUp;
+        SQLTransactionResult _result;
 
 };
 typedef MoPCore::AutoPtr<Transaction, ACE_Thread_Mutex> SQLTransaction;
@@ -20,10 +20,13 @@
 #include "Common.h"
 #include "Config.h"
 #include "Util.h"
+#include "Timer.h"
 #include "AppenderConsole.h"
 #include "AppenderFile.h"
 #include "AppenderDB.h"
-#include "LogOperation.h"
+#include "LogFormat.h"
+
+#include <ace/Thread_Manager.h>
 
 #include <cstdarg>
 #include <cstdio>
@@ -31,6 +34,7 @@
 
 Log::Log() : worker(NULL)
 {
+	memset(filterLoggers, 0, sizeof(filterLoggers));
 	SetRealmID(0);
 	m_logsTimestamp = "_" + GetTimestampStr();
 	LoadFromConfig();
@@ -65,11 +69,10 @@ std::string GetConfigStringDefault(std::string base, const char* name, const cha
 // Returns default logger if the requested logger is not found
 Logger* Log::GetLoggerByType(LogFilterType filter)
 {
-    LoggerMap::iterator it = loggers.begin();
-    while (it != loggers.end() && it->second.getType() != filter)
-        ++it;
+    if (filter < MaxLogFilter && filterLoggers[filter])
+        return filterLoggers[filter];
 
-    return it == loggers.end() ? &(loggers[0]) : &(it->second);
+    return &(loggers[0]);
 }
 
 Appender* Log::GetAppenderByName(std::string const& name)
@@ -272,6 +275,15 @@ void Log::ReadLoggersFromConfig()
     // root logger must exist. Marking as disabled as its not configured
     if (it == loggers.end())
         loggers[0].Create("root", LOG_FILTER_GENERAL, LOG_LEVEL_DISABLED);
+
+    // ShouldLog runs before every message, resolve the filters once instead of searching the loggers each time
+    memset(filterLoggers, 0, sizeof(filterLoggers));
+    for (LoggerMap::iterator itr = loggers.begin(); itr != loggers.end(); ++itr)
+    {
+        uint8 type = uint8(itr->second.getType());
+        if (type < MaxLogFilter && !filterLoggers[type])
+            filterLoggers[type] = &itr->second;
+    }
 }
 
 void Log::EnableDBAppenders()
@@ -283,9 +295,28 @@ void Log::EnableDBAppenders()
 
 void Log::vlog(LogFilterType filter, LogLevel level, char const* str, va_list argptr)
 {
+    if (!worker)
+        return;
+
+    // only the format and the argument values are copied here, the worker does the formatting
+    char packed[MAX_QUERY_LEN];
+    va_list args;
+    va_copy(args, argptr);
+    int32 size = LogFormat::Pack(str, args, packed, sizeof(packed));
+    va_end(args);
+
+    if (size >= 0)
+    {
+        worker->enqueue(GetLoggerByType(filter), level, filter, packed, uint32(size), true);
+        return;
+    }
+
     char text[MAX_QUERY_LEN];
-    vsnprintf(text, MAX_QUERY_LEN, str, argptr);
-    write(new LogMessage(level, filter, text));
+    int length = vsnprintf(text, MAX_QUERY_LEN, str, argptr);
+    if (length < 0)
+        return;
+
+    worker->enqueue(GetLoggerByType(filter), level, filter, text, uint32(std::min(length, MAX_QUERY_LEN - 1)));
 }
 
 void Log::write(LogMessage* msg)
@@ -293,13 +324,51 @@ void Log::write(LogMessage* msg)
     if (worker)
     {
         msg->text.append("\n");
-        Logger* logger = GetLoggerByType(msg->type);
-        worker->enqueue(new LogOperation(logger, msg));
+        worker->enqueue(GetLoggerByType(msg->type), msg);
     }
     else
         delete msg;
 }
 
+namespace
+{
+    struct LogBenchmarkArgs
+    {
+        LogWorker* worker;
+        uint32 count;
+    };
+
+    ACE_THR_FUNC_RETURN LogBenchmarkThread(void* arg)
+    {
+        LogBenchmarkArgs const* args = static_cast<LogBenchmarkArgs const*>(arg);
+
+        char text[MAX_QUERY_LEN];
+        for (uint32 i = 0; i < args->count; ++i)
+        {
+            int length = snprintf(text, MAX_QUERY_LEN, "Log benchmark message %u of %u", i, args->count);
+            args->worker->enqueue(NULL, LOG_LEVEL_DEBUG, LOG_FILTER_GENERAL, text, uint32(length));
+        }
+
+        return 0;
+    }
+}
+
+uint32 Log::BenchmarkWorker(uint32 threads, uint32 count)
+{
+    if (!worker)
+        return 0;
+
+    LogBenchmarkArgs args = { worker, count };
+
+    uint32 startTime = getMSTime();
+    int group = ACE_Thread_Manager::instance()->spawn_n(threads, &LogBenchmarkThread, &args, THR_NEW_LWP | THR_JOINABLE);
+    if (group == -1)
+        return 0;
+
+    ACE_Thread_Manager::instance()->wait_grp(group);
+    return GetMSTimeDiffToNow(startTime);
+}
+
 std::string Log::GetTimestampStr()
 {
     time_t t = time(NULL);
@@ -346,20 +415,15 @@ bool Log::SetLogLevel(std::string const& name, const char* newLevelc, bool isLog
 
 bool Log::ShouldLog(LogFilterType type, LogLevel level) const
 {
-    LoggerMap::const_iterator it = loggers.begin();
-    while (it != loggers.end() && it->second.getType() != type)
-        ++it;
+    Logger const* logger = type < MaxLogFilter ? filterLoggers[type] : NULL;
+    if (!logger)
+        logger = filterLoggers[LOG_FILTER_GENERAL];
 
-    if (it != loggers.end())
-    {
-        LogLevel loggerLevel = it->second.getLogLevel();
-        return loggerLevel && loggerLevel <= level;
-    }
-
-    if (type != LOG_FILTER_GENERAL)
-        return ShouldLog(LOG_FILTER_GENERAL, level);
+    if (!logger)
+        return false;
 
-    return false;
+    LogLevel loggerLevel = logger->getLogLevel();
+    return loggerLevel && loggerLevel <= level;
 }
 
 void Log::outTrace(LogFilterType filter, const char * str, ...)
@@ -494,6 +558,7 @@ void Log::Close()
 {
     delete worker;
     worker = NULL;
+    memset(filterLoggers, 0, sizeof(filterLoggers));
     loggers.clear();
     for (AppenderMap::iterator it = appenders.begin(); it != appenders.end(); ++it)
     {
@@ -68,6 +68,9 @@ class Log
         void OutSpecialLog(const char* str, ...);
 
         void EnableDBAppenders();
+
+        // Times count log calls from each of threads threads through the worker, the messages have no logger so nothing is written
+        uint32 BenchmarkWorker(uint32 threads, uint32 count);
         static std::string GetTimestampStr();
         
         void SetRealmID(uint32 id);
@@ -95,9 +98,22 @@ class Log
         uint32 realm;
         LogWorker* worker;
 
+        Logger* filterLoggers[MaxLogFilter];                // logger configured for exactly that filter or NULL, rebuilt with the loggers
+
         FILE* specialLog;
 };
 
 #define sLog ACE_Singleton<Log, ACE_Thread_Mutex>::instance()
 
+// Check the level before any argument of the message is evaluated, use them where building the arguments costs something
+#define TC_LOG_MESSAGE(filterType__, level__, method__, ...) \
+    do { if (sLog->ShouldLog(filterType__, level__)) sLog->method__(filterType__, __VA_ARGS__); } while (0)
+
+#define TC_LOG_TRACE(filterType__, ...) TC_LOG_MESSAGE(filterType__, LOG_LEVEL_TRACE, outTrace, __VA_ARGS__)
+#define TC_LOG_DEBUG(filterType__, ...) TC_LOG_MESSAGE(filterType__, LOG_LEVEL_DEBUG, outDebug, __VA_ARGS__)
+#define TC_LOG_INFO(filterType__, ...)  TC_LOG_MESSAGE(filterType__, LOG_LEVEL_INFO, outInfo, __VA_ARGS__)
+#define TC_LOG_WARN(filterType__, ...)  TC_LOG_MESSAGE(filterType__, LOG_LEVEL_WARN, outWarn, __VA_ARGS__)
+#define TC_LOG_ERROR(filterType__, ...) TC_LOG_MESSAGE(filterType__, LOG_LEVEL_ERROR, outError, __VA_ARGS__)
+#define TC_LOG_FATAL(filterType__, ...) TC_LOG_MESSAGE(filterType__, LOG_LEVEL_FATAL, outFatal, __VA_ARGS__)
+
 #endif
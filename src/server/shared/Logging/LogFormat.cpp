@@ -0,0 +1,398 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LogFormat.h"
+#include "Common.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    enum LogArgType
+    {
+        LOG_ARG_NONE,                                       // %%
+        LOG_ARG_INT,
+        LOG_ARG_LONG,
+        LOG_ARG_LONG_LONG,
+        LOG_ARG_SIZE,
+        LOG_ARG_INTMAX,
+        LOG_ARG_PTRDIFF,
+        LOG_ARG_DOUBLE,
+        LOG_ARG_LONG_DOUBLE,
+        LOG_ARG_STRING,
+        LOG_ARG_POINTER,
+        LOG_ARG_UNSUPPORTED
+    };
+
+    struct LogConversion
+    {
+        char const* begin;                                  // the '%'
+        char const* end;                                    // behind the conversion character
+        bool starWidth;
+        bool starPrecision;
+        int32 precision;                                    // written in the format, -1 if none or '*'
+        LogArgType type;
+    };
+
+    // Finds the first conversion of str, false if there is none left
+    bool NextConversion(char const* str, LogConversion& conv)
+    {
+        char const* p = strchr(str, '%');
+        if (!p)
+            return false;
+
+        conv.begin = p++;
+        conv.starWidth = false;
+        conv.starPrecision = false;
+        conv.precision = -1;
+        conv.type = LOG_ARG_UNSUPPORTED;
+
+        while (*p && strchr("-+ #0'", *p))
+            ++p;
+
+        if (*p == '*')
+        {
+            conv.starWidth = true;
+            ++p;
+        }
+        else
+            while (*p >= '0' && *p <= '9')
+                ++p;
+
+        if (*p == '.')
+        {
+            ++p;
+            if (*p == '*')
+            {
+                conv.starPrecision = true;
+                ++p;
+            }
+            else
+            {
+                conv.precision = 0;
+                while (*p >= '0' && *p <= '9')
+                    conv.precision = conv.precision * 10 + (*p++ - '0');
+            }
+        }
+
+        // length modifiers, I, I32 and I64 are those of the Windows runtime (UI64FMTD)
+        LogArgType intType = LOG_ARG_INT;
+        bool longDouble = false;
+        bool wide = false;
+        switch (*p)
+        {
+            case 'h':
+                p += p[1] == 'h' ? 2 : 1;
+                break;
+            case 'l':
+                if (p[1] == 'l')
+                {
+                    intType = LOG_ARG_LONG_LONG;
+                    p += 2;
+                }
+                else
+                {
+                    intType = LOG_ARG_LONG;
+                    wide = true;
+                    ++p;
+                }
+                break;
+            case 'q':
+                intType = LOG_ARG_LONG_LONG;
+                ++p;
+                break;
+            case 'L':
+                longDouble = true;
+                ++p;
+                break;
+            case 'j':
+                intType = LOG_ARG_INTMAX;
+                ++p;
+                break;
+            case 'z':
+                intType = LOG_ARG_SIZE;
+                ++p;
+                break;
+            case 't':
+                intType = LOG_ARG_PTRDIFF;
+                ++p;
+                break;
+            case 'I':
+                if (p[1] == '6' && p[2] == '4')
+                {
+                    intType = LOG_ARG_LONG_LONG;
+                    p += 3;
+                }
+                else if (p[1] == '3' && p[2] == '2')
+                    p += 3;
+                else
+                {
+                    intType = LOG_ARG_SIZE;
+                    ++p;
+                }
+                break;
+            default:
+                break;
+        }
+
+        conv.end = *p ? p + 1 : p;
+        switch (*p)
+        {
+            case 'd': case 'i': case 'o': case 'u': case 'x': case 'X':
+                conv.type = intType;
+                break;
+            case 'c':
+                conv.type = wide ? LOG_ARG_UNSUPPORTED : LOG_ARG_INT;
+                break;
+            case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+                conv.type = longDouble ? LOG_ARG_LONG_DOUBLE : LOG_ARG_DOUBLE;
+                break;
+            case 's':
+                conv.type = wide ? LOG_ARG_UNSUPPORTED : LOG_ARG_STRING;
+                break;
+            case 'p':
+                conv.type = LOG_ARG_POINTER;
+                break;
+            case '%':
+                conv.type = LOG_ARG_NONE;
+                break;
+            default:                                        // %n, unknown ones and a '%' ending the format
+                break;
+        }
+
+        return true;
+    }
+
+    class PackWriter
+    {
+        public:
+            PackWriter(char* buffer, uint32 size) : _buffer(buffer), _size(size), _pos(0) { }
+
+            bool Append(void const* data, uint32 length)
+            {
+                if (_size - _pos < length)
+                    return false;
+
+                memcpy(_buffer + _pos, data, length);
+                _pos += length;
+                return true;
+            }
+
+            template<class T>
+            bool AppendValue(T value) { return Append(&value, sizeof(T)); }
+
+            uint32 GetSize() const { return _pos; }
+
+        private:
+            char* _buffer;
+            uint32 _size;
+            uint32 _pos;
+    };
+
+    class PackReader
+    {
+        public:
+            PackReader(char const* begin, char const* end) : _pos(begin), _end(end) { }
+
+            char const* Read(uint32 length)
+            {
+                char const* data = _pos;
+                _pos += std::min<size_t>(length, _end - _pos);
+                return data;
+            }
+
+            // Pack and Format walk the same format, a short buffer would be a bug, it reads as zero then
+            template<class T>
+            T ReadValue()
+            {
+                T value = T();
+                if (size_t(_end - _pos) >= sizeof(T))
+                    memcpy(&value, Read(sizeof(T)), sizeof(T));
+                return value;
+            }
+
+        private:
+            char const* _pos;
+            char const* _end;
+    };
+
+    template<class T>
+    int FormatValue(char* buffer, size_t size, std::string const& spec, LogConversion const& conv, int width, int precision, T value)
+    {
+        if (conv.starWidth && conv.starPrecision)
+            return snprintf(buffer, size, spec.c_str(), width, precision, value);
+        if (conv.starWidth)
+            return snprintf(buffer, size, spec.c_str(), width, value);
+        if (conv.starPrecision)
+            return snprintf(buffer, size, spec.c_str(), precision, value);
+        return snprintf(buffer, size, spec.c_str(), value);
+    }
+}
+
+int32 LogFormat::Pack(char const* format, va_list args, char* buffer, uint32 size)
+{
+    PackWriter writer(buffer, size);
+    if (!writer.Append(format, uint32(strlen(format)) + 1))
+        return -1;
+
+    LogConversion conv;
+    for (char const* str = format; NextConversion(str, conv); str = conv.end)
+    {
+        int32 precision = conv.precision;
+        if (conv.starWidth && !writer.AppendValue(va_arg(args, int)))
+            return -1;
+
+        if (conv.starPrecision)
+        {
+            int value = va_arg(args, int);
+            precision = value < 0 ? -1 : value;
+            if (!writer.AppendValue(value))
+                return -1;
+        }
+
+        bool packed = true;
+        switch (conv.type)
+        {
+            case LOG_ARG_NONE:
+                break;
+            case LOG_ARG_INT:
+                packed = writer.AppendValue(va_arg(args, int));
+                break;
+            case LOG_ARG_LONG:
+                packed = writer.AppendValue(va_arg(args, long));
+                break;
+            case LOG_ARG_LONG_LONG:
+                packed = writer.AppendValue(va_arg(args, long long));
+                break;
+            case LOG_ARG_SIZE:
+                packed = writer.AppendValue(va_arg(args, size_t));
+                break;
+            case LOG_ARG_INTMAX:
+                packed = writer.AppendValue(va_arg(args, intmax_t));
+                break;
+            case LOG_ARG_PTRDIFF:
+                packed = writer.AppendValue(va_arg(args, ptrdiff_t));
+                break;
+            case LOG_ARG_DOUBLE:
+                packed = writer.AppendValue(va_arg(args, double));
+                break;
+            case LOG_ARG_LONG_DOUBLE:
+                packed = writer.AppendValue(va_arg(args, long double));
+                break;
+            case LOG_ARG_POINTER:
+                packed = writer.AppendValue(va_arg(args, void*));
+                break;
+            case LOG_ARG_STRING:
+            {
+                // the text is copied, the caller may free it as soon as the log call returns;
+                // NULL is kept apart from an empty string, the runtime prints it as (null)
+                char const* value = va_arg(args, char const*);
+                uint32 length = value ? uint32(precision >= 0 ? strnlen(value, precision) : strlen(value)) : uint32(-1);
+                packed = writer.AppendValue(length) && (!value || writer.Append(value, length));
+                break;
+            }
+            default:
+                return -1;
+        }
+
+        if (!packed)
+            return -1;
+    }
+
+    return int32(writer.GetSize());
+}
+
+std::string LogFormat::Format(char const* packed, uint32 size)
+{
+    char const* format = packed;
+    PackReader reader(packed + strlen(format) + 1, packed + size);
+
+    std::string text;
+    char buffer[MAX_QUERY_LEN];
+
+    LogConversion conv;
+    char const* str = format;
+    for (; NextConversion(str, conv); str = conv.end)
+    {
+        text.append(str, conv.begin);
+
+        std::string spec(conv.begin, conv.end);
+        int width = conv.starWidth ? reader.ReadValue<int>() : 0;
+        int precision = conv.starPrecision ? reader.ReadValue<int>() : 0;
+
+        int length = 0;
+        switch (conv.type)
+        {
+            case LOG_ARG_NONE:
+                text += '%';
+                break;
+            case LOG_ARG_INT:
+                length = FormatValue(buffer, sizeof(buffer), spec, conv, width, precision, reader.ReadValue<int>());
+                break;
+            case LOG_ARG_LONG:
+                length = FormatValue(buffer, sizeof(buffer), spec, conv, width, precision, reader.ReadValue<long>());
+                break;
+            case LOG_ARG_LONG_LONG:
+                length = FormatValue(buffer, sizeof(buffer), spec, conv, width, precision, reader.ReadValue<long long>());
+                break;
+            case LOG_ARG_SIZE:
+                length = FormatValue(buffer, sizeof(buffer), spec, conv, width, precision, reader.ReadValue<size_t>());
+                break;
+            case LOG_ARG_INTMAX:
+                length = FormatValue(buffer, sizeof(buffer), spec, conv, width, precision, reader.ReadValue<intmax_t>());
+                break;
+            case LOG_ARG_PTRDIFF:
+                length = FormatValue(buffer, sizeof(buffer), spec, conv, width, precision, reader.ReadValue<ptrdiff_t>());
+                break;
+            case LOG_ARG_DOUBLE:
+                length = FormatValue(buffer, sizeof(buffer), spec, conv, width, precision, reader.ReadValue<double>());
+                break;
+            case LOG_ARG_LONG_DOUBLE:
+                length = FormatValue(buffer, sizeof(buffer), spec, conv, width, precision, reader.ReadValue<long double>());
+                break;
+            case LOG_ARG_POINTER:
+                length = FormatValue(buffer, sizeof(buffer), spec, conv, width, precision, reader.ReadValue<void*>());
+                break;
+            case LOG_ARG_STRING:
+            {
+                uint32 stringLength = reader.ReadValue<uint32>();
+                if (stringLength == uint32(-1))
+                    length = FormatValue(buffer, sizeof(buffer), spec, conv, width, precision, (char const*)NULL);
+                else
+                {
+                    std::string value(reader.Read(stringLength), stringLength);
+                    length = FormatValue(buffer, sizeof(buffer), spec, conv, width, precision, value.c_str());
+                }
+                break;
+            }
+            default:                                        // Pack refused these
+                break;
+        }
+
+        if (length > 0)
+            text.append(buffer, std::min<size_t>(length, sizeof(buffer) - 1));
+    }
+
+    text.append(str);
+    if (text.size() > MAX_QUERY_LEN - 1)
+        text.resize(MAX_QUERY_LEN - 1);
+
+    return text;
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOGFORMAT_H
+#define LOGFORMAT_H
+
+#include "Define.h"
+
+#include <cstdarg>
+#include <string>
+
+/*
+ * Lets the log worker do the printf formatting of a log call. The calling thread only walks the format string
+ * and copies it together with the raw argument values (and the text of %s arguments) into a buffer, which goes
+ * through the log ring as it is. The worker walks the same format string again and formats every conversion
+ * with the value read back in its original type.
+ */
+class LogFormat
+{
+    public:
+        // Copies format and the arguments it consumes into buffer and returns the bytes used, or -1 if they do not
+        // fit or the format holds a conversion that can not be deferred (%n, wide strings, unknown ones)
+        static int32 Pack(char const* format, va_list args, char* buffer, uint32 size);
+
+        // Formats what Pack wrote, cut at MAX_QUERY_LEN - 1 characters like a direct vsnprintf into the log buffer
+        static std::string Format(char const* packed, uint32 size);
+};
+
+#endif
@@ -16,35 +16,322 @@
  */
 
 #include "LogWorker.h"
+#include "LogFormat.h"
+#include "Logger.h"
 
-LogWorker::LogWorker()
-    : m_queue(HIGH_WATERMARK, LOW_WATERMARK)
+#include <ace/OS_NS_unistd.h>
+#include <ace/TSS_T.h>
+
+#include <algorithm>
+#include <cstring>
+
+bool LogRing::Push(Record const& record, char const* text)
+{
+    uint32 const size = RecordSize(record.length);
+    uint64 write = _writePos.load(std::memory_order_relaxed);
+    uint64 const read = _readPos.load(std::memory_order_acquire);
+
+    // a record never wraps around, the rest of the buffer is skipped instead
+    size_t offset = size_t(write % Capacity);
+    size_t const skip = Capacity - offset < size ? Capacity - offset : 0;
+    if (write + skip + size - read > Capacity)
+        return false;
+
+    if (skip)
+    {
+        if (skip >= sizeof(Record))
+            reinterpret_cast<Record*>(_buffer + offset)->wrap = true;
+        write += skip;
+        offset = 0;
+    }
+
+    Record* target = reinterpret_cast<Record*>(_buffer + offset);
+    *target = record;
+    target->size = size;
+    target->wrap = false;
+    memcpy(target + 1, text, record.length);
+
+    _writePos.store(write + size, std::memory_order_release);
+    return true;
+}
+
+LogRing::Record const* LogRing::Peek()
+{
+    uint64 const current = _readPos.load(std::memory_order_relaxed);
+    uint64 const write = _writePos.load(std::memory_order_acquire);
+    uint64 read = current;
+    Record const* record = NULL;
+
+    while (read != write)
+    {
+        size_t const offset = size_t(read % Capacity);
+        if (Capacity - offset < sizeof(Record) || reinterpret_cast<Record const*>(_buffer + offset)->wrap)
+        {
+            read += Capacity - offset;
+            continue;
+        }
+
+        record = reinterpret_cast<Record const*>(_buffer + offset);
+        break;
+    }
+
+    if (read != current)
+        _readPos.store(read, std::memory_order_release);
+
+    return record;
+}
+
+void LogRing::Pop()
+{
+    uint64 const read = _readPos.load(std::memory_order_relaxed);
+    Record const* record = reinterpret_cast<Record const*>(_buffer + read % Capacity);
+    _readPos.store(read + record->size, std::memory_order_release);
+}
+
+namespace
+{
+    ACE_Thread_Mutex WorkerLock;                            // guards the generations against a thread exiting while the worker is replaced
+    uint32 LastGeneration = 0;
+    uint32 CurrentGeneration = 0;
+
+    struct ThreadRing
+    {
+        ThreadRing() : generation(0), ring(NULL) { }
+
+        ~ThreadRing()
+        {
+            if (ring)
+                LogWorker::ReleaseRing(generation, ring);
+        }
+
+        uint32 generation;
+        LogRing* ring;
+    };
+
+    ACE_TSS<ThreadRing> ThreadRings;
+}
+
+LogWorker::LogWorker() : m_sequence(0), m_stop(false), m_producers(0), m_sleeping(false), m_wakeup(m_wakeLock)
 {
+    {
+        ACE_GUARD(ACE_Thread_Mutex, guard, WorkerLock);
+        m_generation = ++LastGeneration;
+        CurrentGeneration = m_generation;
+    }
+
     ACE_Task_Base::activate(THR_NEW_LWP | THR_JOINABLE | THR_INHERIT_SCHED, 1);
 }
 
 LogWorker::~LogWorker()
 {
-    m_queue.deactivate();
+    m_stop.store(true);
+    {
+        ACE_GUARD(ACE_Thread_Mutex, guard, m_wakeLock);
+        m_wakeup.signal();
+    }
     wait();
+
+    // a thread that passed the stop check just before it was set may still be copying into its ring,
+    // what it wrote after the worker exited is written here, the worker thread is gone so this is the only consumer
+    while (m_producers.load())
+        ACE_OS::thr_yield();
+    while (Drain());
+
+    ACE_GUARD(ACE_Thread_Mutex, guard, WorkerLock);
+    if (CurrentGeneration == m_generation)
+        CurrentGeneration = 0;
+
+    for (std::vector<LogRing*>::const_iterator itr = m_rings.begin(); itr != m_rings.end(); ++itr)
+        delete *itr;
+    m_rings.clear();
 }
 
-int LogWorker::enqueue(LogOperation* op)
+void LogWorker::ReleaseRing(uint32 generation, LogRing* ring)
 {
-    return m_queue.enqueue(op);
+    ACE_GUARD(ACE_Thread_Mutex, guard, WorkerLock);
+    if (generation == CurrentGeneration)
+        ring->SetOrphaned();
 }
 
-int LogWorker::svc()
+LogRing* LogWorker::GetThreadRing()
+{
+    ThreadRing* threadRing = ThreadRings.ts_object();
+    if (threadRing->generation == m_generation)
+        return threadRing->ring;
+
+    LogRing* ring = new LogRing();
+    {
+        ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, m_ringLock, NULL);
+        m_rings.push_back(ring);
+    }
+
+    threadRing->generation = m_generation;
+    threadRing->ring = ring;
+    return ring;
+}
+
+void LogWorker::Push(LogRing::Record& record, char const* text)
+{
+    m_producers.fetch_add(1);
+
+    bool pushed = false;
+    if (!m_stop.load())
+    {
+        if (LogRing* ring = GetThreadRing())
+        {
+            record.sequence = m_sequence.fetch_add(1, std::memory_order_relaxed);
+            record.time = time(NULL);
+
+            // a full ring only waits while the worker is still there to empty it
+            while (!(pushed = ring->Push(record, text)) && !m_stop.load())
+                ACE_OS::thr_yield();
+        }
+    }
+
+    m_producers.fetch_sub(1);
+
+    if (!pushed)
+    {
+        delete record.message;
+        return;
+    }
+
+    // pairs with the fence in WaitForMessages, either the worker sees the record or this sees it sleeping
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_sleeping.load(std::memory_order_relaxed))
+    {
+        ACE_GUARD(ACE_Thread_Mutex, guard, m_wakeLock);
+        m_wakeup.signal();
+    }
+}
+
+void LogWorker::enqueue(Logger* logger, LogLevel level, LogFilterType type, char const* text, uint32 length, bool packed)
 {
-    while (1)
+    if (LogRing::RecordSize(length) > LogRing::Capacity / 4)
     {
-        LogOperation* request;
-        if (m_queue.dequeue(request) == -1)
+        std::string message = packed ? LogFormat::Format(text, length) : std::string(text, length);
+        enqueue(logger, new LogMessage(level, type, message.append("\n")));
+        return;
+    }
+
+    LogRing::Record record;
+    record.logger = logger;
+    record.message = NULL;
+    record.length = length;
+    record.level = uint8(level);
+    record.type = uint8(type);
+    record.packed = packed;
+    Push(record, text);
+}
+
+void LogWorker::enqueue(Logger* logger, LogMessage* msg)
+{
+    LogRing::Record record;
+    record.logger = logger;
+    record.message = msg;
+    record.length = 0;
+    record.level = uint8(msg->level);
+    record.type = uint8(msg->type);
+    record.packed = false;
+    Push(record, NULL);
+}
+
+bool LogWorker::Drain()
+{
+    std::vector<LogRing*> rings;
+    {
+        ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, m_ringLock, false);
+        rings = m_rings;
+    }
+
+    bool wrote = false;
+    while (true)
+    {
+        LogRing* next = NULL;
+        LogRing::Record const* nextRecord = NULL;
+        for (std::vector<LogRing*>::const_iterator itr = rings.begin(); itr != rings.end(); ++itr)
+        {
+            LogRing::Record const* record = (*itr)->Peek();
+            if (record && (!nextRecord || record->sequence < nextRecord->sequence))
+            {
+                next = *itr;
+                nextRecord = record;
+            }
+        }
+
+        if (!next)
             break;
 
-        request->call();
-        delete request;
+        Write(*nextRecord);
+        next->Pop();
+        wrote = true;
+    }
+
+    // a ring whose thread exited can not get new messages, free it once it is empty
+    for (std::vector<LogRing*>::const_iterator itr = rings.begin(); itr != rings.end(); ++itr)
+    {
+        LogRing* ring = *itr;
+        if (!ring->IsOrphaned() || ring->Peek())
+            continue;
+
+        ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, m_ringLock, wrote);
+        m_rings.erase(std::find(m_rings.begin(), m_rings.end(), ring));
+        delete ring;
     }
 
+    return wrote;
+}
+
+bool LogWorker::HasPending()
+{
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, m_ringLock, true);
+    for (std::vector<LogRing*>::const_iterator itr = m_rings.begin(); itr != m_rings.end(); ++itr)
+        if ((*itr)->Peek())
+            return true;
+
+    return false;
+}
+
+void LogWorker::WaitForMessages()
+{
+    ACE_GUARD(ACE_Thread_Mutex, guard, m_wakeLock);
+    m_sleeping.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (!m_stop.load() && !HasPending())
+        m_wakeup.wait();
+
+    m_sleeping.store(false, std::memory_order_relaxed);
+}
+
+void LogWorker::Write(LogRing::Record const& record)
+{
+    if (LogMessage* msg = record.message)
+    {
+        if (record.logger)
+            record.logger->write(*msg);
+        delete msg;
+        return;
+    }
+
+    if (!record.logger)
+        return;
+
+    char const* payload = reinterpret_cast<char const*>(&record + 1);
+    std::string text = record.packed ? LogFormat::Format(payload, record.length) : std::string(payload, record.length);
+    LogMessage msg(LogLevel(record.level), LogFilterType(record.type), text.append("\n"));
+    msg.mtime = record.time;
+    record.logger->write(msg);
+}
+
+int LogWorker::svc()
+{
+    while (!m_stop.load())
+        if (!Drain())
+            WaitForMessages();
+
+    // everything logged before the worker was told to stop still gets written
+    while (Drain());
+
     return 0;
 }
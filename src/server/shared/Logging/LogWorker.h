@@ -18,10 +18,70 @@
 #ifndef LOGWORKER_H
 #define LOGWORKER_H
 
-#include "LogOperation.h"
+#include "Appender.h"
 
+#include <ace/Condition_Thread_Mutex.h>
 #include <ace/Task.h>
-#include <ace/Activation_Queue.h>
+#include <ace/Thread_Mutex.h>
+
+#include <atomic>
+#include <vector>
+
+class Logger;
+
+/*
+ * Every thread that logs gets its own single producer / single consumer ring of LogRing::Capacity bytes,
+ * so a log call copies its format string and arguments (see LogFormat) into memory no other producer touches
+ * and never waits for a lock or allocates. The worker thread drains the rings, formats the text, builds the
+ * LogMessage and runs the appenders, so the printf work, timestamps, prefixes and the file or console writes
+ * all happen off the calling thread.
+ * Messages of one thread are written in the order they were logged. Messages of different threads are merged
+ * by the sequence number each call took, but a call takes it before its record is visible, so messages logged
+ * by two threads at nearly the same time can still be written in either order.
+ */
+class LogRing
+{
+    public:
+        enum
+        {
+            Capacity = 256 * 1024
+        };
+
+        struct Record
+        {
+            uint64 sequence;                                // order the log calls started in, the worker merges the rings by it
+            time_t time;
+            Logger* logger;
+            LogMessage* message;                            // messages too long for the ring, the text follows the record otherwise
+            uint32 size;                                    // bytes of the record including the text and the padding
+            uint32 length;                                  // text bytes following the record
+            uint8 level;
+            uint8 type;
+            bool wrap;                                      // nothing but padding up to the end of the buffer
+            bool packed;                                    // the text is a LogFormat::Pack buffer the worker still has to format
+        };
+
+        LogRing() : _writePos(0), _readPos(0), _orphaned(false) { }
+
+        // producer side, false if the ring has not enough free space right now
+        bool Push(Record const& record, char const* text);
+
+        // consumer side, NULL if the ring is empty
+        Record const* Peek();
+        void Pop();
+
+        // set once the thread owning the ring exited, the worker frees it after draining it
+        void SetOrphaned() { _orphaned.store(true, std::memory_order_release); }
+        bool IsOrphaned() const { return _orphaned.load(std::memory_order_acquire); }
+
+        static uint32 RecordSize(uint32 length) { return uint32((sizeof(Record) + length + 7) & ~size_t(7)); }
+
+    private:
+        char _buffer[Capacity];
+        std::atomic<uint64> _writePos;                      // total bytes ever written, only the producer stores it
+        std::atomic<uint64> _readPos;                       // total bytes ever consumed, only the worker stores it
+        std::atomic<bool> _orphaned;
+};
 
 class LogWorker: protected ACE_Task_Base
 {
@@ -29,19 +89,36 @@ class LogWorker: protected ACE_Task_Base
         LogWorker();
         ~LogWorker();
 
-        typedef ACE_Message_Queue_Ex<LogOperation, ACE_MT_SYNCH> LogMessageQueueType;
-
-        enum
-        {
-            HIGH_WATERMARK = 8 * 1024 * 1024,
-            LOW_WATERMARK  = 8 * 1024 * 1024
-        };
+        // copies text into the ring of the calling thread, waits for the worker only if that ring is full,
+        // the message is dropped once the worker is being destroyed; packed text is formatted by the worker
+        void enqueue(Logger* logger, LogLevel level, LogFilterType type, char const* text, uint32 length, bool packed = false);
+        // for messages with extra parameters or longer than a ring can hold, the worker takes ownership of msg
+        void enqueue(Logger* logger, LogMessage* msg);
 
-        int enqueue(LogOperation *op);
+        // called by the ring handle of a thread when the thread exits
+        static void ReleaseRing(uint32 generation, LogRing* ring);
 
     private:
         virtual int svc();
-        LogMessageQueueType m_queue;
+
+        LogRing* GetThreadRing();
+        void Push(LogRing::Record& record, char const* text);
+        bool Drain();                                       // writes everything pending, false if nothing was pending
+        bool HasPending();
+        void WaitForMessages();
+        void Write(LogRing::Record const& record);
+
+        uint32 m_generation;                                // tells the ring handles of an older worker (before a config reload) apart
+        std::atomic<uint64> m_sequence;
+        std::atomic<bool> m_stop;
+        std::atomic<uint32> m_producers;                    // threads inside Push, the rings are not freed before they left
+        std::atomic<bool> m_sleeping;                       // the worker found all rings empty and waits for m_wakeup
+
+        ACE_Thread_Mutex m_wakeLock;
+        ACE_Condition_Thread_Mutex m_wakeup;
+
+        ACE_Thread_Mutex m_ringLock;                        // only taken when a thread logs the first time or exits
+        std::vector<LogRing*> m_rings;
 };
 
 #endif
@@ -698,7 +698,7 @@ class ByteBuffer
                 o << read<uint8>(i) << " - ";
             o << " ";
 
-            sLog->outTrace(LOG_FILTER_NETWORKIO, "%s", o.str().c_str());
+            TC_LOG_TRACE(LOG_FILTER_NETWORKIO, "%s", o.str().c_str());
         }
 
         void textlike() const
@@ -715,7 +715,7 @@ class ByteBuffer
                 o << buf;
             }
             o << " ";
-            sLog->outTrace(LOG_FILTER_NETWORKIO, "%s", o.str().c_str());
+            TC_LOG_TRACE(LOG_FILTER_NETWORKIO, "%s", o.str().c_str());
         }
 
         void hexlike() const
@@ -747,7 +747,7 @@ class ByteBuffer
                 o << buf;
             }
             o << " ";
-            sLog->outTrace(LOG_FILTER_NETWORKIO, "%s", o.str().c_str());
+            TC_LOG_TRACE(LOG_FILTER_NETWORKIO, "%s", o.str().c_str());
         }
 
         size_t GetBitPos() const
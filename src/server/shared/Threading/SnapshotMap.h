@@ -0,0 +1,256 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/* read-mostly replacement for LockedMap: lock-free lookups, copy-on-write updates */
+
+#ifndef SNAPSHOTMAP_H
+#define SNAPSHOTMAP_H
+
+#include "Common.h"
+#include <algorithm>
+#include <atomic>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ACE_Based
+{
+    /*
+     * Owns one heap allocated T per key.
+     *
+     * Until Freeze() the map is a plain hash map for the single threaded startup loaders. Freeze() turns it into
+     * Shards immutable arrays sorted by key, which readers search without taking any lock. A writer copies the
+     * one shard it changes and publishes the copy, so a reader keeps a consistent view of whatever shard it loaded.
+     * Replaced arrays and records stay allocated until Reclaim(), which must only be called while no other thread
+     * can read the map (the world thread between two map updates).
+     */
+    template <class Key, class T, uint32 Shards = 256>
+    class SnapshotMap
+    {
+        public:
+            typedef std::pair<Key, T*> Entry;
+            typedef std::vector<Entry> Snapshot;
+
+            SnapshotMap() : m_frozen(false)
+            {
+                for (uint32 i = 0; i < Shards; ++i)
+                    m_shards[i].store(NULL, std::memory_order_relaxed);
+            }
+
+            ~SnapshotMap()
+            {
+                Reclaim();
+
+                for (typename std::unordered_map<Key, T*>::const_iterator itr = m_staging.begin(); itr != m_staging.end(); ++itr)
+                    delete itr->second;
+
+                for (uint32 i = 0; i < Shards; ++i)
+                {
+                    Snapshot const* snapshot = m_shards[i].load(std::memory_order_relaxed);
+                    if (!snapshot)
+                        continue;
+
+                    for (typename Snapshot::const_iterator itr = snapshot->begin(); itr != snapshot->end(); ++itr)
+                        delete itr->second;
+                    delete snapshot;
+                }
+            }
+
+            bool IsFrozen() const { return m_frozen; }
+
+            T const* Find(Key const& key) const { return FindRecord(key); }
+
+            // returns the record for key, creating a default one; the record itself is shared with readers
+            T& Insert(Key const& key)
+            {
+                if (!m_frozen)
+                {
+                    T*& record = m_staging[key];
+                    if (!record)
+                        record = new T();
+                    return *record;
+                }
+
+                WriteGuard guard(m_writeLock);
+                if (T* record = FindRecord(key))
+                    return *record;
+
+                T* record = new T();
+                Publish(key, record);
+                return *record;
+            }
+
+            // applies modifier to a private copy of the record for key (a default one if it is missing) and publishes the copy
+            template <class Modifier>
+            void Modify(Key const& key, Modifier modifier)
+            {
+                if (!m_frozen)
+                {
+                    modifier(Insert(key));
+                    return;
+                }
+
+                WriteGuard guard(m_writeLock);
+                T const* current = FindRecord(key);
+                T* record = current ? new T(*current) : new T();
+                modifier(*record);
+                Publish(key, record);
+            }
+
+            void Erase(Key const& key)
+            {
+                if (!m_frozen)
+                {
+                    typename std::unordered_map<Key, T*>::iterator itr = m_staging.find(key);
+                    if (itr != m_staging.end())
+                    {
+                        delete itr->second;
+                        m_staging.erase(itr);
+                    }
+                    return;
+                }
+
+                WriteGuard guard(m_writeLock);
+                if (FindRecord(key))
+                    Publish(key, NULL);
+            }
+
+            // moves the staged records into the shards, every later change is copy-on-write
+            void Freeze()
+            {
+                if (m_frozen)
+                    return;
+
+                std::vector<Snapshot*> shards(Shards);
+                for (uint32 i = 0; i < Shards; ++i)
+                    shards[i] = new Snapshot();
+
+                for (typename std::unordered_map<Key, T*>::const_iterator itr = m_staging.begin(); itr != m_staging.end(); ++itr)
+                    shards[ShardOf(itr->first)]->push_back(*itr);
+
+                for (uint32 i = 0; i < Shards; ++i)
+                {
+                    std::sort(shards[i]->begin(), shards[i]->end(), CompareEntry());
+                    m_shards[i].store(shards[i], std::memory_order_release);
+                }
+
+                std::unordered_map<Key, T*>().swap(m_staging);
+                m_frozen = true;
+            }
+
+            // frees what the writers replaced since the last call
+            void Reclaim()
+            {
+                WriteGuard guard(m_writeLock);
+
+                for (typename std::vector<Snapshot const*>::const_iterator itr = m_retiredSnapshots.begin(); itr != m_retiredSnapshots.end(); ++itr)
+                    delete *itr;
+                m_retiredSnapshots.clear();
+
+                for (typename std::vector<T const*>::const_iterator itr = m_retiredRecords.begin(); itr != m_retiredRecords.end(); ++itr)
+                    delete *itr;
+                m_retiredRecords.clear();
+            }
+
+            size_t size() const
+            {
+                if (!m_frozen)
+                    return m_staging.size();
+
+                size_t count = 0;
+                for (uint32 i = 0; i < Shards; ++i)
+                    count += m_shards[i].load(std::memory_order_acquire)->size();
+                return count;
+            }
+
+            // calls visitor(key, record) for every record, shard by shard
+            template <class Visitor>
+            void Visit(Visitor visitor) const
+            {
+                if (!m_frozen)
+                {
+                    for (typename std::unordered_map<Key, T*>::const_iterator itr = m_staging.begin(); itr != m_staging.end(); ++itr)
+                        visitor(itr->first, *itr->second);
+                    return;
+                }
+
+                for (uint32 i = 0; i < Shards; ++i)
+                {
+                    Snapshot const* snapshot = m_shards[i].load(std::memory_order_acquire);
+                    for (typename Snapshot::const_iterator itr = snapshot->begin(); itr != snapshot->end(); ++itr)
+                        visitor(itr->first, *itr->second);
+                }
+            }
+
+        private:
+            typedef ACE_Thread_Mutex LockType;
+            typedef ACE_Guard<LockType> WriteGuard;
+
+            struct CompareEntry
+            {
+                bool operator()(Entry const& left, Entry const& right) const { return left.first < right.first; }
+                bool operator()(Entry const& left, Key const& right) const { return left.first < right; }
+            };
+
+            static uint32 ShardOf(Key const& key) { return uint32(std::hash<Key>()(key) % Shards); }
+
+            T* FindRecord(Key const& key) const
+            {
+                if (!m_frozen)
+                {
+                    typename std::unordered_map<Key, T*>::const_iterator itr = m_staging.find(key);
+                    return itr != m_staging.end() ? itr->second : NULL;
+                }
+
+                Snapshot const* snapshot = m_shards[ShardOf(key)].load(std::memory_order_acquire);
+                typename Snapshot::const_iterator itr = std::lower_bound(snapshot->begin(), snapshot->end(), key, CompareEntry());
+                return itr != snapshot->end() && itr->first == key ? itr->second : NULL;
+            }
+
+            // replaces the record of key by record (erases it for NULL) in a copy of its shard, m_writeLock must be held
+            void Publish(Key const& key, T* record)
+            {
+                std::atomic<Snapshot const*>& shard = m_shards[ShardOf(key)];
+                Snapshot const* current = shard.load(std::memory_order_relaxed);
+                Snapshot* copy = new Snapshot();
+                copy->reserve(current->size() + 1);
+
+                typename Snapshot::const_iterator itr = std::lower_bound(current->begin(), current->end(), key, CompareEntry());
+                copy->insert(copy->end(), current->begin(), itr);
+                if (record)
+                    copy->push_back(Entry(key, record));
+                if (itr != current->end() && itr->first == key)
+                {
+                    m_retiredRecords.push_back(itr->second);
+                    ++itr;
+                }
+                copy->insert(copy->end(), itr, current->end());
+
+                shard.store(copy, std::memory_order_release);
+                m_retiredSnapshots.push_back(current);
+            }
+
+            std::unordered_map<Key, T*> m_staging;
+            std::atomic<Snapshot const*> m_shards[Shards];
+            bool m_frozen;                                  // only flipped by the world thread before the first map update
+
+            LockType m_writeLock;
+            std::vector<Snapshot const*> m_retiredSnapshots;
+            std::vector<T const*> m_retiredRecords;
+    };
+}
+
+#endif
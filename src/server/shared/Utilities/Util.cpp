@@ -242,6 +242,27 @@ uint32 CreatePIDFile(const std::string& filename)
     return (uint32)pid;
 }
 
+uint64 GetResidentMemorySize()
+{
+#if PLATFORM == PLATFORM_UNIX
+    FILE* statm = fopen("/proc/self/statm", "r");
+    if (statm == NULL)
+        return 0;
+
+    unsigned long size = 0;
+    unsigned long resident = 0;
+    int fields = fscanf(statm, "%lu %lu", &size, &resident);
+    fclose(statm);
+
+    if (fields != 2)
+        return 0;
+
+    return uint64(resident) * uint64(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+}
+
 size_t utf8length(std::string& utf8str)
 {
     try
@@ -367,6 +367,9 @@ void vutf8printf(FILE* out, const char *str, va_list* ap);
 bool IsIPAddress(char const* ipaddress);
 uint32 CreatePIDFile(const std::string& filename);
 
+// Resident set size of the process in bytes, 0 where the platform does not expose it
+uint64 GetResidentMemorySize();
+
 std::string ByteArrayToHexStr(uint8 const* bytes, uint32 length, bool reverse = false);
 #endif
 
@@ -417,6 +417,12 @@ bool Master::_StartDB()
         return false;
     }
 
+    ///- Batched statements are sent as multi-row statements unless disabled
+    bool batchedStatements = ConfigMgr::GetBoolDefault("Database.BatchedStatements", true);
+    WorldDatabase.SetBatchedStatements(batchedStatements);
+    CharacterDatabase.SetBatchedStatements(batchedStatements);
+    LoginDatabase.SetBatchedStatements(batchedStatements);
+
     ///- Get the realm Id from the configuration file
     realmID = ConfigMgr::GetIntDefault("RealmID", 0);
     if (!realmID)
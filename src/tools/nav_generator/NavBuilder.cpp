@@ -0,0 +1,412 @@
+/*
+ * Copyright (C) 2008-2013 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NavBuilder.h"
+#include "VMapManager2.h"
+
+#include <ace/Dirent.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// .map file layout as written by the map extractor, see Map.h
+static char const* MAP_MAGIC         = "MAPS";
+static char const* MAP_VERSION_MAGIC = "v1.3";
+static char const* MAP_HEIGHT_MAGIC  = "MHGT";
+
+struct map_fileheader
+{
+    uint32 mapMagic;
+    uint32 versionMagic;
+    uint32 buildMagic;
+    uint32 areaMapOffset;
+    uint32 areaMapSize;
+    uint32 heightMapOffset;
+    uint32 heightMapSize;
+    uint32 liquidMapOffset;
+    uint32 liquidMapSize;
+};
+
+#define MAP_HEIGHT_NO_HEIGHT  0x0001
+#define MAP_HEIGHT_AS_INT16   0x0002
+#define MAP_HEIGHT_AS_INT8    0x0004
+
+struct map_heightHeader
+{
+    uint32 fourcc;
+    uint32 flags;
+    float  gridHeight;
+    float  gridMaxHeight;
+};
+
+namespace NAV
+{
+    NavBuilder::NavBuilder(std::string const& mapsPath, std::string const& vmapsPath, std::string const& outputPath) :
+        _mapsPath(mapsPath), _vmapsPath(vmapsPath), _outputPath(outputPath), _vmapManager(new VMAP::VMapManager2())
+    {
+    }
+
+    NavBuilder::~NavBuilder()
+    {
+        UnloadTerrain();
+        delete _vmapManager;
+    }
+
+    void NavBuilder::DiscoverTiles(std::map<uint32, std::set<uint32> >& tiles) const
+    {
+        ACE_Dirent dir(_mapsPath.c_str());
+        while (ACE_DIRENT* entry = dir.read())
+        {
+            // mmmxxyy.map
+            std::string name = entry->d_name;
+            if (name.length() != 11 || name.compare(7, 4, ".map") != 0)
+                continue;
+
+            uint32 mapId = uint32(atoi(name.substr(0, 3).c_str()));
+            uint32 tileX = uint32(atoi(name.substr(3, 2).c_str()));
+            uint32 tileY = uint32(atoi(name.substr(5, 2).c_str()));
+            tiles[mapId].insert((tileX << 8) | tileY);
+        }
+    }
+
+    bool NavBuilder::BuildMap(uint32 mapId, std::set<uint32> const& tiles)
+    {
+        uint32 built = 0;
+        for (std::set<uint32>::const_iterator itr = tiles.begin(); itr != tiles.end(); ++itr)
+        {
+            uint32 tileX = *itr >> 8;
+            uint32 tileY = *itr & 0xFF;
+
+            printf("[Map %03u] Building tile [%02u, %02u] (%u/%u)\n", mapId, tileX, tileY, ++built, uint32(tiles.size()));
+            if (!BuildTile(mapId, tileX, tileY))
+                printf("[Map %03u] Failed to build tile [%02u, %02u]\n", mapId, tileX, tileY);
+        }
+
+        _vmapManager->unloadMap(mapId);
+        UnloadTerrain();
+        return true;
+    }
+
+    bool NavBuilder::BuildTile(uint32 mapId, uint32 tileX, uint32 tileY)
+    {
+        // the border cells link into the neighbour tiles, their terrain and models are needed too
+        std::vector<std::pair<uint32, uint32> > vmapTiles;
+        for (int32 x = int32(tileX) - 1; x <= int32(tileX) + 1; ++x)
+        {
+            for (int32 y = int32(tileY) - 1; y <= int32(tileY) + 1; ++y)
+            {
+                if (x < 0 || y < 0 || x >= int32(NAV_TILES_PER_MAP) || y >= int32(NAV_TILES_PER_MAP))
+                    continue;
+
+                LoadTerrain(mapId, uint32(x), uint32(y));
+                if (_vmapManager->loadMap(_vmapsPath.c_str(), mapId, x, y) == VMAP::VMAP_LOAD_RESULT_OK)
+                    vmapTiles.push_back(std::make_pair(uint32(x), uint32(y)));
+            }
+        }
+
+        // surfaces of the tile cells and of one ring of cells around them
+        int32 const side = int32(NAV_TILE_CELLS) + 2;
+        int32 const firstX = int32(tileX * NAV_TILE_CELLS) - 1;
+        int32 const firstY = int32(tileY * NAV_TILE_CELLS) - 1;
+
+        std::vector<CellSurfaces> surfaces(side * side);
+        for (int32 x = 0; x < side; ++x)
+            for (int32 y = 0; y < side; ++y)
+                GetSurfaces(mapId, firstX + x, firstY + y, surfaces[x * side + y]);
+
+        NavTileHeader header;
+        header.magic = NAV_TILE_MAGIC;
+        header.version = NAV_TILE_VERSION;
+        header.mapId = mapId;
+        header.tileX = tileX;
+        header.tileY = tileY;
+        header.cellsPerSide = NAV_TILE_CELLS;
+        header.layerCount = 0;
+
+        std::vector<uint32> cellIndex;
+        std::vector<NavLayer> layers;
+        cellIndex.reserve(NAV_TILE_CELLS * NAV_TILE_CELLS + 1);
+
+        for (int32 x = 1; x <= int32(NAV_TILE_CELLS); ++x)
+        {
+            for (int32 y = 1; y <= int32(NAV_TILE_CELLS); ++y)
+            {
+                cellIndex.push_back(uint32(layers.size()));
+
+                float worldX = CellToWorld(firstX + x);
+                float worldY = CellToWorld(firstY + y);
+
+                CellSurfaces const& cell = surfaces[x * side + y];
+                for (size_t i = 0; i < cell.size(); ++i)
+                {
+                    NavLayer layer;
+                    layer.z = cell[i];
+                    layer.links = 0;
+
+                    for (uint32 dir = 0; dir < 8; ++dir)
+                    {
+                        int32 nearX = x + NAV_DIR_X[dir];
+                        int32 nearY = y + NAV_DIR_Y[dir];
+                        CellSurfaces const& nearCell = surfaces[nearX * side + nearY];
+
+                        float maxStep = (dir & 1) ? NAV_MAX_STEP * float(M_SQRT2) : NAV_MAX_STEP;
+
+                        // link the closest surface in reach that is not behind a wall
+                        int32 best = -1;
+                        float bestStep = maxStep;
+                        for (size_t j = 0; j < nearCell.size(); ++j)
+                        {
+                            float step = std::fabs(nearCell[j] - cell[i]);
+                            if (step > bestStep)
+                                continue;
+
+                            if (!_vmapManager->isInLineOfSight(mapId, worldX, worldY, cell[i] + NAV_AGENT_CLIMB,
+                                CellToWorld(firstX + nearX), CellToWorld(firstY + nearY), nearCell[j] + NAV_AGENT_CLIMB))
+                                continue;
+
+                            best = int32(j);
+                            bestStep = step;
+                        }
+
+                        if (best >= 0)
+                            layer.SetLink(dir, uint32(best));
+                    }
+
+                    layers.push_back(layer);
+                }
+            }
+        }
+
+        cellIndex.push_back(uint32(layers.size()));
+        header.layerCount = uint32(layers.size());
+
+        for (size_t i = 0; i < vmapTiles.size(); ++i)
+            _vmapManager->unloadMap(mapId, vmapTiles[i].first, vmapTiles[i].second);
+
+        char fileName[32];
+        snprintf(fileName, sizeof(fileName), "%03u%02u%02u.nav", mapId, tileX, tileY);
+        return WriteNavTile(_outputPath + fileName, header, cellIndex, layers);
+    }
+
+    NavBuilder::TerrainTile* NavBuilder::LoadTerrain(uint32 mapId, uint32 tileX, uint32 tileY)
+    {
+        uint32 key = (tileX << 8) | tileY;
+        TerrainMap::const_iterator itr = _terrain.find(key);
+        if (itr != _terrain.end())
+            return itr->second;
+
+        // remember missing tiles too
+        TerrainTile*& tile = _terrain[key];
+        tile = NULL;
+
+        char fileName[32];
+        snprintf(fileName, sizeof(fileName), "%03u%02u%02u.map", mapId, tileX, tileY);
+
+        FILE* file = fopen((_mapsPath + fileName).c_str(), "rb");
+        if (!file)
+            return NULL;
+
+        map_fileheader fileHeader;
+        map_heightHeader heightHeader;
+        if (fread(&fileHeader, sizeof(fileHeader), 1, file) != 1 ||
+            fileHeader.mapMagic != *(uint32 const*)MAP_MAGIC || fileHeader.versionMagic != *(uint32 const*)MAP_VERSION_MAGIC ||
+            !fileHeader.heightMapOffset || fseek(file, fileHeader.heightMapOffset, SEEK_SET) != 0 ||
+            fread(&heightHeader, sizeof(heightHeader), 1, file) != 1 || heightHeader.fourcc != *(uint32 const*)MAP_HEIGHT_MAGIC)
+        {
+            printf("Map file '%s' is missing or has an incompatible version, terrain skipped\n", fileName);
+            fclose(file);
+            return NULL;
+        }
+
+        TerrainTile* terrain = new TerrainTile();
+        terrain->gridHeight = heightHeader.gridHeight;
+
+        if (!(heightHeader.flags & MAP_HEIGHT_NO_HEIGHT))
+        {
+            terrain->v9.resize(129 * 129);
+            terrain->v8.resize(128 * 128);
+
+            bool loaded;
+            if (heightHeader.flags & (MAP_HEIGHT_AS_INT16 | MAP_HEIGHT_AS_INT8))
+            {
+                // stored relative to the lowest point of the grid, scaled to the integer range
+                bool asInt16 = (heightHeader.flags & MAP_HEIGHT_AS_INT16) != 0;
+                float multiplier = (heightHeader.gridMaxHeight - heightHeader.gridHeight) / (asInt16 ? 65535 : 255);
+
+                std::vector<uint16> v9(129 * 129);
+                std::vector<uint16> v8(128 * 128);
+                if (asInt16)
+                    loaded = fread(&v9[0], sizeof(uint16), v9.size(), file) == v9.size() &&
+                        fread(&v8[0], sizeof(uint16), v8.size(), file) == v8.size();
+                else
+                {
+                    std::vector<uint8> v9Int8(129 * 129);
+                    std::vector<uint8> v8Int8(128 * 128);
+                    loaded = fread(&v9Int8[0], sizeof(uint8), v9Int8.size(), file) == v9Int8.size() &&
+                        fread(&v8Int8[0], sizeof(uint8), v8Int8.size(), file) == v8Int8.size();
+                    std::copy(v9Int8.begin(), v9Int8.end(), v9.begin());
+                    std::copy(v8Int8.begin(), v8Int8.end(), v8.begin());
+                }
+
+                for (size_t i = 0; i < v9.size(); ++i)
+                    terrain->v9[i] = v9[i] * multiplier + heightHeader.gridHeight;
+                for (size_t i = 0; i < v8.size(); ++i)
+                    terrain->v8[i] = v8[i] * multiplier + heightHeader.gridHeight;
+            }
+            else
+                loaded = fread(&terrain->v9[0], sizeof(float), terrain->v9.size(), file) == terrain->v9.size() &&
+                    fread(&terrain->v8[0], sizeof(float), terrain->v8.size(), file) == terrain->v8.size();
+
+            if (!loaded)
+            {
+                printf("Map file '%s' is truncated, terrain skipped\n", fileName);
+                delete terrain;
+                fclose(file);
+                return NULL;
+            }
+        }
+
+        fclose(file);
+        tile = terrain;
+        return terrain;
+    }
+
+    void NavBuilder::UnloadTerrain()
+    {
+        for (TerrainMap::iterator itr = _terrain.begin(); itr != _terrain.end(); ++itr)
+            delete itr->second;
+
+        _terrain.clear();
+    }
+
+    bool NavBuilder::GetTerrainHeight(uint32 mapId, float x, float y, float& height)
+    {
+        // same interpolation as GridMap::getHeightFromFloat
+        float fx = 128.0f * (NAV_TILES_PER_MAP / 2 - x / NAV_TILE_SIZE);
+        float fy = 128.0f * (NAV_TILES_PER_MAP / 2 - y / NAV_TILE_SIZE);
+        if (fx < 0.0f || fy < 0.0f || fx >= 128.0f * NAV_TILES_PER_MAP || fy >= 128.0f * NAV_TILES_PER_MAP)
+            return false;
+
+        TerrainTile const* terrain = LoadTerrain(mapId, uint32(fx) / 128, uint32(fy) / 128);
+        if (!terrain)
+            return false;
+
+        if (terrain->v9.empty())
+        {
+            height = terrain->gridHeight;
+            return true;
+        }
+
+        int x_int = int(fx);
+        int y_int = int(fy);
+        fx -= x_int;
+        fy -= y_int;
+        x_int &= 127;
+        y_int &= 127;
+
+        float h5 = 2 * terrain->v8[x_int * 128 + y_int];
+        float a, b, c;
+        if (fx + fy < 1)
+        {
+            if (fx > fy)
+            {
+                float h1 = terrain->v9[x_int * 129 + y_int];
+                float h2 = terrain->v9[(x_int + 1) * 129 + y_int];
+                a = h2 - h1;
+                b = h5 - h1 - h2;
+                c = h1;
+            }
+            else
+            {
+                float h1 = terrain->v9[x_int * 129 + y_int];
+                float h3 = terrain->v9[x_int * 129 + y_int + 1];
+                a = h5 - h1 - h3;
+                b = h3 - h1;
+                c = h1;
+            }
+        }
+        else
+        {
+            if (fx > fy)
+            {
+                float h2 = terrain->v9[(x_int + 1) * 129 + y_int];
+                float h4 = terrain->v9[(x_int + 1) * 129 + y_int + 1];
+                a = h2 + h4 - h5;
+                b = h4 - h2;
+                c = h5 - h4;
+            }
+            else
+            {
+                float h3 = terrain->v9[x_int * 129 + y_int + 1];
+                float h4 = terrain->v9[(x_int + 1) * 129 + y_int + 1];
+                a = h4 - h3;
+                b = h3 + h4 - h5;
+                c = h5 - h4;
+            }
+        }
+
+        height = a * fx + b * fy + c;
+        return true;
+    }
+
+    void NavBuilder::GetSurfaces(uint32 mapId, int32 cellX, int32 cellY, CellSurfaces& surfaces)
+    {
+        surfaces.clear();
+        if (cellX < 0 || cellY < 0 || cellX >= int32(NAV_MAP_CELLS) || cellY >= int32(NAV_MAP_CELLS))
+            return;
+
+        float x = CellToWorld(cellX);
+        float y = CellToWorld(cellY);
+
+        float terrainHeight = 0.0f;
+        bool hasTerrain = GetTerrainHeight(mapId, x, y, terrainHeight);
+
+        // every model surface below the search start: floors, roofs, bridges, ceilings
+        std::vector<float> hits;
+        float z = terrainHeight + NAV_SEARCH_HEIGHT;
+        float searchDist = hasTerrain ? NAV_SEARCH_HEIGHT + NAV_AGENT_HEIGHT : 2.0f * NAV_SEARCH_HEIGHT;
+        for (uint32 i = 0; i < 32; ++i)
+        {
+            float height = _vmapManager->getHeight(mapId, x, y, z, searchDist);
+            if (height <= VMAP_INVALID_HEIGHT)
+                break;
+
+            hits.push_back(height);
+            searchDist -= z - height + 0.1f;
+            z = height - 0.1f;
+            if (searchDist <= 0.0f)
+                break;
+        }
+
+        if (hasTerrain)
+            hits.push_back(terrainHeight);
+
+        std::sort(hits.begin(), hits.end());
+
+        // a surface is walkable if there is room to stand on it
+        for (size_t i = 0; i < hits.size() && surfaces.size() < NAV_MAX_LAYERS; ++i)
+        {
+            if (i + 1 < hits.size() && hits[i + 1] - hits[i] < NAV_AGENT_HEIGHT)
+                continue;
+
+            surfaces.push_back(hits[i]);
+        }
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2008-2013 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _NAVBUILDER_H
+#define _NAVBUILDER_H
+
+#include "Define.h"
+#include "NavTile.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace VMAP
+{
+    class VMapManager2;
+}
+
+namespace NAV
+{
+    // walkable surfaces need this much free space above them
+    const float NAV_AGENT_HEIGHT    = 2.0f;
+    // height of the line of sight checks between neighbour cells, lower obstacles are stepped over
+    const float NAV_AGENT_CLIMB     = 1.0f;
+    // highest height difference between two neighbour cells, about a 50 degree slope
+    const float NAV_MAX_STEP        = NAV_CELL_SIZE * 1.19f;
+    // the world models are searched from this far above the terrain
+    const float NAV_SEARCH_HEIGHT   = 200.0f;
+
+    class NavBuilder
+    {
+        public:
+            NavBuilder(std::string const& mapsPath, std::string const& vmapsPath, std::string const& outputPath);
+            ~NavBuilder();
+
+            // collects every tile that has a .map file
+            void DiscoverTiles(std::map<uint32, std::set<uint32> >& tiles) const;
+
+            bool BuildMap(uint32 mapId, std::set<uint32> const& tiles);
+            bool BuildTile(uint32 mapId, uint32 tileX, uint32 tileY);
+
+        private:
+            struct TerrainTile
+            {
+                float gridHeight;
+                std::vector<float> v9;              // 129 * 129 heights, empty for flat tiles
+                std::vector<float> v8;              // 128 * 128 heights
+            };
+
+            typedef std::map<uint32, TerrainTile*> TerrainMap;
+            typedef std::vector<float> CellSurfaces;
+
+            TerrainTile* LoadTerrain(uint32 mapId, uint32 tileX, uint32 tileY);
+            void UnloadTerrain();
+            bool GetTerrainHeight(uint32 mapId, float x, float y, float& height);
+            void GetSurfaces(uint32 mapId, int32 cellX, int32 cellY, CellSurfaces& surfaces);
+
+            std::string _mapsPath;
+            std::string _vmapsPath;
+            std::string _outputPath;
+
+            VMAP::VMapManager2* _vmapManager;
+            TerrainMap _terrain;                    // tiles of the map being built, NULL if the tile has no terrain
+    };
+}
+
+#endif
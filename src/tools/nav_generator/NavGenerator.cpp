@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2008-2013 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NavBuilder.h"
+
+#include <ace/OS_NS_sys_stat.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+
+// Builds the nav/ tiles from the extracted maps/ and vmaps/ directories of the working directory
+int main(int argc, char* argv[])
+{
+    if (argc != 1 && argc != 2 && argc != 4)
+    {
+        printf("usage: %s [mapId [tileX tileY]]\n", argv[0]);
+        return 1;
+    }
+
+    if (ACE_OS::mkdir("nav") != 0 && errno != EEXIST)
+    {
+        printf("Can not create the output directory 'nav'\n");
+        return 1;
+    }
+
+    NAV::NavBuilder builder("maps/", "vmaps/", "nav/");
+    if (argc == 4)
+    {
+        uint32 mapId = uint32(atoi(argv[1]));
+        uint32 tileX = uint32(atoi(argv[2]));
+        uint32 tileY = uint32(atoi(argv[3]));
+        if (!builder.BuildTile(mapId, tileX, tileY))
+        {
+            printf("Failed to build tile [%02u, %02u] of map %03u\n", tileX, tileY, mapId);
+            return 1;
+        }
+
+        printf("Done\n");
+        return 0;
+    }
+
+    std::map<uint32, std::set<uint32> > tiles;
+    builder.DiscoverTiles(tiles);
+    if (tiles.empty())
+    {
+        printf("No map files found in 'maps', run the map extractor first\n");
+        return 1;
+    }
+
+    for (std::map<uint32, std::set<uint32> >::const_iterator itr = tiles.begin(); itr != tiles.end(); ++itr)
+    {
+        if (argc == 2 && itr->first != uint32(atoi(argv[1])))
+            continue;
+
+        builder.BuildMap(itr->first, itr->second);
+    }
+
+    printf("Done\n");
+    return 0;
+}